@@ -15,6 +15,8 @@
 #include <limits>
 #include <fstream>
 #include <filesystem>
+#include <sstream>
+#include <vector>
 
 void pause()
 {
@@ -295,36 +297,19 @@ void output_type_functions(std::ostream &out_stream, const TypeInfo &t_info)
     }
 }
 
-void generic_container_generate_menu(const std::string &full_cont_name, 
-    const std::string &abrev_cont_name, const std::string &header_guard_name)
-{
-    // const char * msg = "C type the Array contains (ie. MyStruct*)?\n\n >> ";
-
-    std::string msg = "C type the " + abrev_cont_name + " contains "
-        "(ie. MyStruct*)?\n\n >> ";
-
-    std::string type_lit = prompt_type<std::string>(msg);
-
-    msg = "Header-guard friendly name for this type "
-        "(ie. MyStruct_ptr)?\n\n >> ";
-
-    std::string type_name = prompt_type<std::string>(msg);
-
-    TypeInfo t_info = prompt_type_info();
+// File writers shared by the interactive menus and batch mode ----------------
 
-    std::string new_file_name = full_cont_name + type_name + ".h";
-
-    std::cerr << "New file name: " << new_file_name << '\n';
-
-    std::string out_directory = prompt_directory(new_file_name);
-
-    std::ofstream out_file(out_directory);
+bool write_generic_file(const std::string &path, const std::string &full_cont_name,
+    const std::string &header_guard_name, const std::string &type_lit,
+    const std::string &type_name, const TypeInfo &t_info, bool reduce = false,
+    bool byte_views = false)
+{
+    std::ofstream out_file(path);
 
     if(!out_file)
     {
-        std::cerr << "Failed to open output directory: " << out_directory << 
-            '\n';
-        exit(1);
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
     }
 
     out_file << "\n#ifndef " << header_guard_name << type_name << "_H\n"
@@ -385,96 +370,117 @@ void generic_container_generate_menu(const std::string &full_cont_name,
     out_file << 
     "\n// -----------------------------------------------------------------------------\n\n"
     "// Create specialization for the given type\n"
-    "#include \"tundra/internal/container_templates/" << 
+    "#include \"tundra/internal/container_templates/" <<
         full_cont_name << ".h\"\n\n";
-  
+
+    if(reduce)
+    {
+        out_file <<
+        "// Also emit the task-pool parallel reduction over the container.\n"
+        "#include \"tundra/internal/container_templates/ParallelReduce.h\"\n\n";
+    }
+
+    if(byte_views)
+    {
+        out_file <<
+        "// Also emit the checked typed views over the container's bytes.\n"
+        "#include \"tundra/internal/container_templates/ByteViews.h\"\n\n";
+    }
+
     output_type_cleanup(out_file, t_info);
 
     out_file << 
     "#endif // " << header_guard_name << type_name << "_H\n";
 
     out_file.close();
+
+    return true;
 }
 
-void arr_generate_menu()
+bool write_array_file(const std::string &path, const std::string &type_lit,
+    const std::string &type_name, size_t arr_cap)
 {
-    const char * msg = "C type the Array contains (ie. MyStruct*)?\n\n >> ";
-
-    clear_screen();
-    std::cout << msg;
-
-    // std::string type_lit = prompt_type<std::string>(msg);
-    std::string type_lit;
-    std::getline(std::cin, type_lit);
-
-    msg = "Header-guard friendly name for this type "
-        "(ie. MyStruct_ptr)?\n\n >> ";
-
-    std::string type_name = prompt_type<std::string>(msg);
-
-    msg = "Capacity of the Array (Must be non negative)?\n\n >> ";
-
-    size_t arr_cap = prompt_type<size_t>(msg);
-
-    std::string new_file_name = "Array" + std::to_string(arr_cap) +  
-        type_name + ".h";
-
-    std::string out_directory = prompt_directory(new_file_name);
-
-    std::ofstream out_file(out_directory);
+    std::ofstream out_file(path);
 
     if(!out_file)
     {
-        std::cerr << "Failed to open output directory: " << out_directory << 
-            '\n';
-        exit(1);
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
     }
 
-    out_file << "\n#ifndef TUNDRA_ARRAY" << type_name << arr_cap << "_H\n"
-        "#define TUNDRA_DYNAMICARRAY" << type_name << arr_cap << "_H\n\n"
+    out_file << "\n#ifndef TUNDRA_ARRAY" << arr_cap << type_name << "_H\n"
+        "#define TUNDRA_ARRAY" << arr_cap << type_name << "_H\n\n"
        "#include \"tundra/internal/MacroHelper.h\"\n\n";
 
     out_file << "#define TUNDRA_TYPE " << type_lit << "\n"
-    "#define TUNDRA_TYPENAME " << type_name << "\n" << 
+    "#define TUNDRA_TYPENAME " << type_name << "\n" <<
     "#define TUNDRA_CAPACITY " << arr_cap << '\n';
 
-    out_file << 
+    out_file <<
     "\n// Create specialization for the given type\n"
     "#include \"tundra/internal/container_templates/Array.h\"\n\n";
 
-    out_file << 
-    "#endif // TUNDRA_ARR" << type_name << arr_cap << "_H\n";
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_TYPE\n"
+    "#undef TUNDRA_TYPENAME\n"
+    "#undef TUNDRA_CAPACITY\n\n";
+
+    out_file <<
+    "#endif // TUNDRA_ARRAY" << arr_cap << type_name << "_H\n";
 
     out_file.close();
+
+    return true;
 }
 
-void dynstk_generate_menu()
+bool write_smallarr_file(const std::string &path,
+    const std::string &type_lit, const std::string &type_name, size_t arr_cap)
 {
-    std::string msg = "C type the Stack contains "
-        "(ie. MyStruct*)?\n\n >> ";
+    std::ofstream out_file(path);
 
-    std::string type_lit = prompt_type<std::string>(msg);
+    if(!out_file)
+    {
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
+    }
 
-    msg = "Header-guard friendly name for this type "
-        "(ie. MyStruct_ptr)?\n\n >> ";
+    out_file << "\n#ifndef TUNDRA_SMALLARRAY" << arr_cap << type_name <<
+        "_H\n"
+        "#define TUNDRA_SMALLARRAY" << arr_cap << type_name << "_H\n\n"
+        "#include \"tundra/internal/MacroHelper.h\"\n\n";
 
-    std::string type_name = prompt_type<std::string>(msg);
+    out_file << "#define TUNDRA_TYPE " << type_lit << "\n"
+    "#define TUNDRA_TYPENAME " << type_name << "\n"
+    "#define TUNDRA_CAPACITY " << arr_cap << '\n';
 
-    TypeInfo t_info = prompt_type_info();
+    out_file <<
+    "\n// Create specialization for the given type\n"
+    "#include \"tundra/internal/container_templates/SmallArray.h\"\n\n";
 
-    std::string new_file_name = "DynamicStack" + type_name + ".h";
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_TYPE\n"
+    "#undef TUNDRA_TYPENAME\n"
+    "#undef TUNDRA_CAPACITY\n\n";
 
-    std::cerr << "New file name: " << new_file_name << '\n';
+    out_file <<
+    "#endif // TUNDRA_SMALLARRAY" << arr_cap << type_name << "_H\n";
 
-    std::string out_directory = prompt_directory(new_file_name);
+    out_file.close();
+
+    return true;
+}
 
-    std::ofstream out_file(out_directory);
+bool write_dynstk_file(const std::string &path, const std::string &type_lit,
+    const std::string &type_name, const TypeInfo &t_info)
+{
+    std::ofstream out_file(path);
 
     if(!out_file)
     {
-        std::cerr << "Failed to open output directory: " << out_directory << 
-            '\n';
-        exit(1);
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
     }
 
     const char * HEADER_GUARD_NAME = "TUNDRA_DYNAMICSTACK";
@@ -548,69 +554,1584 @@ void dynstk_generate_menu()
     "#endif // " << HEADER_GUARD_NAME << type_name << "_H\n";
 
     out_file.close();
+
+    return true;
 }
 
-void container_selection_menu()
+bool write_pool_file(const std::string &path, const std::string &type_lit,
+    const std::string &type_name)
 {
-    enum SELECTION_TYPE
+    std::ofstream out_file(path);
+
+    if(!out_file)
     {
-        ARRAY = 1,
-        DYN_ARR,
-        STACK,
-        DYN_STK,
-        LNK_LST,
-        QUIT
-    };
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
+    }
 
-    while(true)
+    const char * HEADER_GUARD_NAME = "TUNDRA_POOL";
+
+    // The Pool hands out uninitialized slots and never copies or moves
+    // elements, so no type behavior flags are prompted for.
+    out_file << "\n#ifndef " << HEADER_GUARD_NAME << type_name << "_H\n"
+        "#define " << HEADER_GUARD_NAME << type_name << "_H\n\n"
+        "#include \"tundra/internal/MacroHelper.h\"\n\n";
+
+    out_file << "#define TUNDRA_TYPE " << type_lit << "\n"
+    "#define TUNDRA_TYPENAME " << type_name << "\n";
+
+    out_file <<
+    "\n// -----------------------------------------------------------------------------\n\n"
+    "// Create specialization for the given type\n"
+    "#include \"tundra/internal/container_templates/Pool.h\"\n\n";
+
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_TYPE\n"
+    "#undef TUNDRA_TYPENAME\n";
+
+    out_file <<
+    "#endif // " << HEADER_GUARD_NAME << type_name << "_H\n";
+
+    out_file.close();
+
+    return true;
+}
+
+bool write_ringbuf_file(const std::string &path,
+    const std::string &type_lit, const std::string &type_name)
+{
+    std::ofstream out_file(path);
+
+    if(!out_file)
     {
-        clear_screen();
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
+    }
 
-        int selected = prompt_type<int>("Generate which container?\n\n1: Array\n2: "
-            "DynamicArray\n3: Stack\n4: DynamicStack\n5: LinkedList\n"
-            "6: Quit\n\n   >> ");
+    out_file << "\n#ifndef TUNDRA_RINGBUFFER" << type_name << "_H\n"
+        "#define TUNDRA_RINGBUFFER" << type_name << "_H\n\n"
+        "#include \"tundra/internal/MacroHelper.h\"\n\n";
 
-        if(selected < 1 || selected > 6)
-        {
-            clear_input();
-            print_invalid_sel();
-            continue;
-        }
+    out_file << "#define TUNDRA_TYPE " << type_lit << "\n"
+    "#define TUNDRA_TYPENAME " << type_name << "\n";
 
-        switch(selected)
-        {
-            case ARRAY:
+    out_file <<
+    "\n// -----------------------------------------------------------------------------\n\n"
+    "// Create specialization for the given type\n"
+    "#include \"tundra/internal/container_templates/RingBuffer.h\"\n\n";
 
-                arr_generate_menu();
-                break;
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_TYPE\n"
+    "#undef TUNDRA_TYPENAME\n";
 
-            case DYN_ARR:
+    out_file <<
+    "#endif // TUNDRA_RINGBUFFER" << type_name << "_H\n";
 
-                // dyn_arr_generate_menu();
-                generic_container_generate_menu("DynamicArray", 
-                    "Array", "TUNDRA_DYNAMICARRAY");
-                break;
+    out_file.close();
 
-            case DYN_STK:
+    return true;
+}
 
-                dynstk_generate_menu();
-                break;
+bool write_mpscq_file(const std::string &path,
+    const std::string &type_lit, const std::string &type_name)
+{
+    std::ofstream out_file(path);
 
-            case LNK_LST:
+    if(!out_file)
+    {
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
+    }
 
-                generic_container_generate_menu("LinkedList",
-                    "List", "TUNDRA_LINKEDLIST");
-                break;
+    out_file << "\n#ifndef TUNDRA_MPSCQUEUE" << type_name << "_H\n"
+        "#define TUNDRA_MPSCQUEUE" << type_name << "_H\n\n"
+        "#include \"tundra/internal/MacroHelper.h\"\n\n";
 
-            case QUIT:
+    out_file << "#define TUNDRA_TYPE " << type_lit << "\n"
+    "#define TUNDRA_TYPENAME " << type_name << "\n";
 
-                exit(0);
-        }
+    out_file <<
+    "\n// -----------------------------------------------------------------------------\n\n"
+    "// Create specialization for the given type\n"
+    "#include \"tundra/internal/container_templates/MpscQueue.h\"\n\n";
+
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_TYPE\n"
+    "#undef TUNDRA_TYPENAME\n";
+
+    out_file <<
+    "#endif // TUNDRA_MPSCQUEUE" << type_name << "_H\n";
+
+    out_file.close();
+
+    return true;
+}
+
+bool write_chunkstk_file(const std::string &path,
+    const std::string &type_lit, const std::string &type_name)
+{
+    std::ofstream out_file(path);
+
+    if(!out_file)
+    {
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
+    }
+
+    out_file << "\n#ifndef TUNDRA_CHUNKEDSTACK" << type_name << "_H\n"
+        "#define TUNDRA_CHUNKEDSTACK" << type_name << "_H\n\n"
+        "#include \"tundra/internal/MacroHelper.h\"\n\n";
+
+    out_file << "#define TUNDRA_TYPE " << type_lit << "\n"
+    "#define TUNDRA_TYPENAME " << type_name << "\n";
+
+    out_file <<
+    "\n// -----------------------------------------------------------------------------\n\n"
+    "// Create specialization for the given type\n"
+    "#include \"tundra/internal/container_templates/ChunkedStack.h\"\n\n";
+
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_TYPE\n"
+    "#undef TUNDRA_TYPENAME\n";
+
+    out_file <<
+    "#endif // TUNDRA_CHUNKEDSTACK" << type_name << "_H\n";
+
+    out_file.close();
+
+    return true;
+}
+
+bool write_slotmap_file(const std::string &path,
+    const std::string &type_lit, const std::string &type_name)
+{
+    std::ofstream out_file(path);
+
+    if(!out_file)
+    {
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
+    }
+
+    out_file << "\n#ifndef TUNDRA_SLOTMAP" << type_name << "_H\n"
+        "#define TUNDRA_SLOTMAP" << type_name << "_H\n\n"
+        "#include \"tundra/internal/MacroHelper.h\"\n\n";
+
+    out_file << "#define TUNDRA_TYPE " << type_lit << "\n"
+    "#define TUNDRA_TYPENAME " << type_name << "\n";
+
+    out_file <<
+    "\n// -----------------------------------------------------------------------------\n\n"
+    "// Create specialization for the given type\n"
+    "#include \"tundra/internal/container_templates/SlotMap.h\"\n\n";
+
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_TYPE\n"
+    "#undef TUNDRA_TYPENAME\n";
+
+    out_file <<
+    "#endif // TUNDRA_SLOTMAP" << type_name << "_H\n";
+
+    out_file.close();
+
+    return true;
+}
+
+bool write_heap_file(const std::string &path,
+    const std::string &type_lit, const std::string &type_name,
+    bool custom_before)
+{
+    std::ofstream out_file(path);
+
+    if(!out_file)
+    {
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
+    }
+
+    out_file << "\n#ifndef TUNDRA_HEAP" << type_name << "_H\n"
+        "#define TUNDRA_HEAP" << type_name << "_H\n\n"
+        "#include \"tundra/internal/MacroHelper.h\"\n\n";
+
+    out_file << "// Create dependant container"
+    "\n// -----------------------------------------------------------------------------\n"
+    "#ifndef TUNDRA_DYNAMICARRAY" << type_name << "_H\n"
+    "#define TUNDRA_DYNAMICARRAY" << type_name << "_H\n#define TUNDRA_TYPE " <<
+    type_lit << "\n#define TUNDRA_TYPENAME " << type_name <<
+    "\n#include \"tundra/internal/container_templates/DynamicArray.h\"\n"
+    "#undef TUNDRA_TYPE\n#undef TUNDRA_TYPENAME\n#endif\n\n";
+
+    out_file << "#define TUNDRA_TYPE " << type_lit << "\n"
+    "#define TUNDRA_TYPENAME " << type_name << "\n";
+
+    if(custom_before)
+    {
+        out_file <<
+        "\n// Ordering predicate; true if the first element should sit "
+        "closer to the\n"
+        "// top of the Heap. Change the expression as needed, but macro name "
+        "must\n"
+        "// remain the same.\n"
+        "#define TUNDRA_HEAP_BEFORE(first, second) // User defines "
+        "predicate.\n";
     }
+
+    out_file <<
+    "\n// -----------------------------------------------------------------------------\n\n"
+    "// Create specialization for the given type\n"
+    "#include \"tundra/internal/container_templates/Heap.h\"\n\n";
+
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_TYPE\n"
+    "#undef TUNDRA_TYPENAME\n";
+
+    out_file <<
+    "#endif // TUNDRA_HEAP" << type_name << "_H\n";
+
+    out_file.close();
+
+    return true;
 }
 
-int main()
+bool write_sort_file(const std::string &path,
+    const std::string &type_lit, const std::string &type_name,
+    bool custom_before, bool radix)
 {
+    std::ofstream out_file(path);
+
+    if(!out_file)
+    {
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
+    }
+
+    out_file << "\n#ifndef TUNDRA_SORT" << type_name << "_H\n"
+        "#define TUNDRA_SORT" << type_name << "_H\n\n"
+        "#include \"tundra/internal/MacroHelper.h\"\n\n";
+
+    out_file << "// Create dependant container"
+    "\n// -----------------------------------------------------------------------------\n"
+    "#ifndef TUNDRA_DYNAMICARRAY" << type_name << "_H\n"
+    "#define TUNDRA_DYNAMICARRAY" << type_name << "_H\n#define TUNDRA_TYPE " <<
+    type_lit << "\n#define TUNDRA_TYPENAME " << type_name <<
+    "\n#include \"tundra/internal/container_templates/DynamicArray.h\"\n"
+    "#undef TUNDRA_TYPE\n#undef TUNDRA_TYPENAME\n#endif\n\n";
+
+    out_file << "#define TUNDRA_TYPE " << type_lit << "\n"
+    "#define TUNDRA_TYPENAME " << type_name << "\n";
+
+    if(custom_before)
+    {
+        out_file <<
+        "\n// Ordering predicate; true if the first element should come "
+        "before the\n"
+        "// second in the sorted output. Change the expression as needed, "
+        "but macro\n"
+        "// name must remain the same.\n"
+        "#define TUNDRA_SORT_BEFORE(first, second) // User defines "
+        "predicate.\n";
+    }
+
+    if(radix)
+    {
+        out_file <<
+        "\n// Also emit the comparison-free radix sort. The key mapping "
+        "must be\n"
+        "// order preserving; the default (u64) cast is only correct for "
+        "unsigned\n"
+        "// integer types.\n"
+        "#define TUNDRA_SORT_RADIX 1\n";
+    }
+
+    out_file <<
+    "\n// -----------------------------------------------------------------------------\n\n"
+    "// Create specialization for the given type\n"
+    "#include \"tundra/internal/container_templates/Sort.h\"\n\n";
+
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_TYPE\n"
+    "#undef TUNDRA_TYPENAME\n";
+
+    if(radix)
+    {
+        out_file << "#undef TUNDRA_SORT_RADIX\n";
+    }
+
+    out_file <<
+    "#endif // TUNDRA_SORT" << type_name << "_H\n";
+
+    out_file.close();
+
+    return true;
+}
+
+bool write_hshtbl_file(const std::string &path, const std::string &key_lit,
+    const std::string &key_name, const std::string &val_lit,
+    const std::string &val_name, const std::string &hash_func,
+    bool custom_key_eq, bool cache_hash, bool hot_cache)
+{
+    std::ofstream out_file(path);
+
+    if(!out_file)
+    {
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
+    }
+
+    const char * HEADER_GUARD_NAME = "TUNDRA_HASHTABLE";
+
+    out_file << "\n#ifndef " << HEADER_GUARD_NAME << key_name << val_name <<
+        "_H\n"
+        "#define " << HEADER_GUARD_NAME << key_name << val_name << "_H\n\n"
+        "#include \"tundra/internal/MacroHelper.h\"\n\n"
+        "// Declares the hash function bound to TUNDRA_HASH_FUNC below, so "
+        "the\n"
+        "// wrapper stands alone no matter the include order.\n"
+        "#include \"tundra/common/Hash.h\"\n\n";
+
+    out_file << "#define TUNDRA_KEY " << key_lit << "\n"
+    "#define TUNDRA_KEYNAME " << key_name << "\n"
+    "#define TUNDRA_VAL " << val_lit << "\n"
+    "#define TUNDRA_VALNAME " << val_name << "\n"
+    "#define TUNDRA_HASH_FUNC " << hash_func << "\n";
+
+    if(custom_key_eq)
+    {
+        out_file <<
+        "\n// Equality compare for keys. Change the expression as needed, "
+        "but macro \n"
+        "// name must remain the same.\n"
+        "#define TUNDRA_KEY_EQ(first, second) // User defines compare.\n";
+    }
+
+    if(cache_hash)
+    {
+        out_file <<
+        "\n// Store each entry's full hash so expansion never re-hashes and "
+        "lookups\n"
+        "// filter on the hash before comparing keys.\n"
+        "#define TUNDRA_HSHTBL_CACHE_HASH 1\n";
+    }
+
+    if(hot_cache)
+    {
+        out_file <<
+        "\n// Keep a one-entry inline cache of the last-hit entry so "
+        "repeated-key\n"
+        "// lookups skip the hash and probe, for read-mostly tables.\n"
+        "#define TUNDRA_HSHTBL_HOT_CACHE 1\n";
+    }
+
+    out_file <<
+    "\n// -----------------------------------------------------------------------------\n\n"
+    "// Create specialization for the given types\n"
+    "#include \"tundra/internal/container_templates/HashTable.h\"\n\n";
+
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_KEY\n"
+    "#undef TUNDRA_KEYNAME\n"
+    "#undef TUNDRA_VAL\n"
+    "#undef TUNDRA_VALNAME\n"
+    "#undef TUNDRA_HASH_FUNC\n";
+
+    out_file <<
+    "#endif // " << HEADER_GUARD_NAME << key_name << val_name << "_H\n";
+
+    out_file.close();
+
+    return true;
+}
+
+bool write_flattbl_file(const std::string &path, const std::string &key_lit,
+    const std::string &key_name, const std::string &val_lit,
+    const std::string &val_name, const std::string &hash_func,
+    bool custom_key_eq)
+{
+    std::ofstream out_file(path);
+
+    if(!out_file)
+    {
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
+    }
+
+    const char * HEADER_GUARD_NAME = "TUNDRA_FLATHASHTABLE";
+
+    out_file << "\n#ifndef " << HEADER_GUARD_NAME << key_name << val_name <<
+        "_H\n"
+        "#define " << HEADER_GUARD_NAME << key_name << val_name << "_H\n\n"
+        "#include \"tundra/internal/MacroHelper.h\"\n\n"
+        "// Declares the hash function bound to TUNDRA_HASH_FUNC below, so "
+        "the\n"
+        "// wrapper stands alone no matter the include order.\n"
+        "#include \"tundra/common/Hash.h\"\n\n";
+
+    out_file << "#define TUNDRA_KEY " << key_lit << "\n"
+    "#define TUNDRA_KEYNAME " << key_name << "\n"
+    "#define TUNDRA_VAL " << val_lit << "\n"
+    "#define TUNDRA_VALNAME " << val_name << "\n"
+    "#define TUNDRA_HASH_FUNC " << hash_func << "\n";
+
+    if(custom_key_eq)
+    {
+        out_file <<
+        "\n// Equality compare for keys. Change the expression as needed, "
+        "but macro \n"
+        "// name must remain the same.\n"
+        "#define TUNDRA_KEY_EQ(first, second) // User defines compare.\n";
+    }
+
+    out_file <<
+    "\n// -----------------------------------------------------------------------------\n\n"
+    "// Create specialization for the given types\n"
+    "#include \"tundra/internal/container_templates/FlatHashTable.h\"\n\n";
+
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_KEY\n"
+    "#undef TUNDRA_KEYNAME\n"
+    "#undef TUNDRA_VAL\n"
+    "#undef TUNDRA_VALNAME\n"
+    "#undef TUNDRA_HASH_FUNC\n";
+
+    out_file <<
+    "#endif // " << HEADER_GUARD_NAME << key_name << val_name << "_H\n";
+
+    out_file.close();
+
+    return true;
+}
+
+bool write_hshset_file(const std::string &path, const std::string &key_lit,
+    const std::string &key_name, const std::string &hash_func,
+    bool custom_key_eq)
+{
+    std::ofstream out_file(path);
+
+    if(!out_file)
+    {
+        std::cerr << "Failed to open output file: " << path << '\n';
+        return false;
+    }
+
+    const char * HEADER_GUARD_NAME = "TUNDRA_HASHSET";
+
+    out_file << "\n#ifndef " << HEADER_GUARD_NAME << key_name << "_H\n"
+        "#define " << HEADER_GUARD_NAME << key_name << "_H\n\n"
+        "#include \"tundra/internal/MacroHelper.h\"\n\n"
+        "// Declares the hash function bound to TUNDRA_HASH_FUNC below, so "
+        "the\n"
+        "// wrapper stands alone no matter the include order.\n"
+        "#include \"tundra/common/Hash.h\"\n\n";
+
+    out_file << "#define TUNDRA_KEY " << key_lit << "\n"
+    "#define TUNDRA_KEYNAME " << key_name << "\n"
+    "#define TUNDRA_HASH_FUNC " << hash_func << "\n";
+
+    if(custom_key_eq)
+    {
+        out_file <<
+        "\n// Equality compare for keys. Change the expression as needed, "
+        "but macro \n"
+        "// name must remain the same.\n"
+        "#define TUNDRA_KEY_EQ(first, second) // User defines compare.\n";
+    }
+
+    out_file <<
+    "\n// -----------------------------------------------------------------------------\n\n"
+    "// Create specialization for the given type\n"
+    "#include \"tundra/internal/container_templates/HashSet.h\"\n\n";
+
+    out_file <<
+    "// Clean up\n"
+    "#undef TUNDRA_KEY\n"
+    "#undef TUNDRA_KEYNAME\n"
+    "#undef TUNDRA_HASH_FUNC\n";
+
+    out_file <<
+    "#endif // " << HEADER_GUARD_NAME << key_name << "_H\n";
+
+    out_file.close();
+
+    return true;
+}
+
+void generic_container_generate_menu(const std::string &full_cont_name, 
+    const std::string &abrev_cont_name, const std::string &header_guard_name)
+{
+    // const char * msg = "C type the Array contains (ie. MyStruct*)?\n\n >> ";
+
+    std::string msg = "C type the " + abrev_cont_name + " contains "
+        "(ie. MyStruct*)?\n\n >> ";
+
+    std::string type_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for this type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string type_name = prompt_type<std::string>(msg);
+
+    TypeInfo t_info = prompt_type_info();
+
+    std::string new_file_name = full_cont_name + type_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_generic_file(out_directory, full_cont_name,
+        header_guard_name, type_lit, type_name, t_info))
+    {
+        exit(1);
+    }
+}
+
+void arr_generate_menu()
+{
+    const char * msg = "C type the Array contains (ie. MyStruct*)?\n\n >> ";
+
+    clear_screen();
+    std::cout << msg;
+
+    // std::string type_lit = prompt_type<std::string>(msg);
+    std::string type_lit;
+    std::getline(std::cin, type_lit);
+
+    msg = "Header-guard friendly name for this type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string type_name = prompt_type<std::string>(msg);
+
+    msg = "Capacity of the Array (Must be non negative)?\n\n >> ";
+
+    size_t arr_cap = prompt_type<size_t>(msg);
+
+    std::string new_file_name = "Array" + std::to_string(arr_cap) +  
+        type_name + ".h";
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_array_file(out_directory, type_lit, type_name, arr_cap))
+    {
+        exit(1);
+    }
+}
+
+void smallarr_generate_menu()
+{
+    std::string msg = "C type the SmallArray contains (ie. MyStruct*)?"
+        "\n\n >> ";
+
+    std::string type_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for this type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string type_name = prompt_type<std::string>(msg);
+
+    msg = "Inline capacity of the SmallArray (Must be non negative)?\n\n >> ";
+
+    size_t arr_cap = prompt_type<size_t>(msg);
+
+    std::string new_file_name = "SmallArray" + std::to_string(arr_cap) +
+        type_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_smallarr_file(out_directory, type_lit, type_name, arr_cap))
+    {
+        exit(1);
+    }
+}
+
+void dynstk_generate_menu()
+{
+    std::string msg = "C type the Stack contains "
+        "(ie. MyStruct*)?\n\n >> ";
+
+    std::string type_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for this type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string type_name = prompt_type<std::string>(msg);
+
+    TypeInfo t_info = prompt_type_info();
+
+    std::string new_file_name = "DynamicStack" + type_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_dynstk_file(out_directory, type_lit, type_name, t_info))
+    {
+        exit(1);
+    }
+}
+
+void pool_generate_menu()
+{
+    std::string msg = "C type the Pool contains (ie. MyStruct*)?\n\n >> ";
+
+    std::string type_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for this type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string type_name = prompt_type<std::string>(msg);
+
+    std::string new_file_name = "Pool" + type_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_pool_file(out_directory, type_lit, type_name))
+    {
+        exit(1);
+    }
+}
+
+void ringbuf_generate_menu()
+{
+    std::string msg = "C type the RingBuffer contains (ie. MyStruct*)?"
+        "\n\n >> ";
+
+    std::string type_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for this type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string type_name = prompt_type<std::string>(msg);
+
+    std::string new_file_name = "RingBuffer" + type_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_ringbuf_file(out_directory, type_lit, type_name))
+    {
+        exit(1);
+    }
+}
+
+void mpscq_generate_menu()
+{
+    std::string msg = "C type the MpscQueue contains (ie. MyStruct*)?"
+        "\n\n >> ";
+
+    std::string type_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for this type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string type_name = prompt_type<std::string>(msg);
+
+    std::string new_file_name = "MpscQueue" + type_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_mpscq_file(out_directory, type_lit, type_name))
+    {
+        exit(1);
+    }
+}
+
+void chunkstk_generate_menu()
+{
+    std::string msg = "C type the ChunkedStack contains (ie. MyStruct*)?"
+        "\n\n >> ";
+
+    std::string type_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for this type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string type_name = prompt_type<std::string>(msg);
+
+    std::string new_file_name = "ChunkedStack" + type_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_chunkstk_file(out_directory, type_lit, type_name))
+    {
+        exit(1);
+    }
+}
+
+void slotmap_generate_menu()
+{
+    std::string msg = "C type the SlotMap contains (ie. MyStruct*)?"
+        "\n\n >> ";
+
+    std::string type_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for this type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string type_name = prompt_type<std::string>(msg);
+
+    std::string new_file_name = "SlotMap" + type_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_slotmap_file(out_directory, type_lit, type_name))
+    {
+        exit(1);
+    }
+}
+
+void heap_generate_menu()
+{
+    std::string msg = "C type the Heap contains (ie. MyStruct*)?\n\n >> ";
+
+    std::string type_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for this type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string type_name = prompt_type<std::string>(msg);
+
+    bool custom_before = false;
+
+    while(true)
+    {
+        char selected = prompt_type<char>("Does the type need a custom "
+            "ordering predicate instead of < (y/n)?\n\n >> ");
+
+        if(selected != 'y' && selected != 'n')
+        {
+            clear_input();
+            print_invalid_sel();
+            continue;
+        }
+
+        custom_before = selected == 'y';
+        break;
+    }
+
+    std::string new_file_name = "Heap" + type_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_heap_file(out_directory, type_lit, type_name, custom_before))
+    {
+        exit(1);
+    }
+}
+
+void sort_generate_menu()
+{
+    std::string msg = "C type the Sort orders (ie. u64)?\n\n >> ";
+
+    std::string type_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for this type (ie. U64)?\n\n >> ";
+
+    std::string type_name = prompt_type<std::string>(msg);
+
+    bool custom_before = false;
+
+    while(true)
+    {
+        char selected = prompt_type<char>("Does the type need a custom "
+            "ordering predicate instead of < (y/n)?\n\n >> ");
+
+        if(selected != 'y' && selected != 'n')
+        {
+            clear_input();
+            print_invalid_sel();
+            continue;
+        }
+
+        custom_before = selected == 'y';
+        break;
+    }
+
+    bool radix = false;
+
+    while(true)
+    {
+        char selected = prompt_type<char>("Also emit the comparison-free "
+            "radix sort (unsigned integer keys) (y/n)?\n\n >> ");
+
+        if(selected != 'y' && selected != 'n')
+        {
+            clear_input();
+            print_invalid_sel();
+            continue;
+        }
+
+        radix = selected == 'y';
+        break;
+    }
+
+    std::string new_file_name = "Sort" + type_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_sort_file(out_directory, type_lit, type_name, custom_before,
+        radix))
+    {
+        exit(1);
+    }
+}
+
+void hshtbl_generate_menu()
+{
+    std::string msg = "C type of the HashTable's keys (ie. u64)?\n\n >> ";
+
+    std::string key_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for the key type (ie. U64)?\n\n >> ";
+
+    std::string key_name = prompt_type<std::string>(msg);
+
+    msg = "C type of the HashTable's values (ie. MyStruct*)?\n\n >> ";
+
+    std::string val_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for the value type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string val_name = prompt_type<std::string>(msg);
+
+    msg = "Hash function for the key type (ie. Tundra_hash_u64)?\n\n >> ";
+
+    std::string hash_func = prompt_type<std::string>(msg);
+
+    bool custom_key_eq = false;
+
+    while(true)
+    {
+        char selected = prompt_type<char>("Does the key type need a custom "
+            "equality compare instead of == (y/n)?\n\n >> ");
+
+        if(selected != 'y' && selected != 'n')
+        {
+            clear_input();
+            print_invalid_sel();
+            continue;
+        }
+
+        custom_key_eq = selected == 'y';
+        break;
+    }
+
+    bool cache_hash = false;
+
+    while(true)
+    {
+        char selected = prompt_type<char>("Cache each entry's full 64 bit "
+            "hash? Expansion then re-places entries without re-hashing and "
+            "lookups filter on the hash before comparing keys, for 8 extra "
+            "bytes per entry. Recommended for string or wide keys (y/n)?"
+            "\n\n >> ");
+
+        if(selected != 'y' && selected != 'n')
+        {
+            clear_input();
+            print_invalid_sel();
+            continue;
+        }
+
+        cache_hash = selected == 'y';
+        break;
+    }
+
+    bool hot_cache = false;
+
+    while(true)
+    {
+        char selected = prompt_type<char>("Keep a one-entry inline cache of "
+            "the last-hit entry? Repeated-key lookups then skip the hash and "
+            "probe, for 24 extra bytes per table. Recommended for read-mostly "
+            "tables whose lookups repeat keys (y/n)?\n\n >> ");
+
+        if(selected != 'y' && selected != 'n')
+        {
+            clear_input();
+            print_invalid_sel();
+            continue;
+        }
+
+        hot_cache = selected == 'y';
+        break;
+    }
+
+    std::string new_file_name = "HashTable" + key_name + val_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_hshtbl_file(out_directory, key_lit, key_name, val_lit,
+        val_name, hash_func, custom_key_eq, cache_hash, hot_cache))
+    {
+        exit(1);
+    }
+}
+
+void flattbl_generate_menu()
+{
+    std::string msg = "C type of the FlatHashTable's keys (ie. u64)?\n\n >> ";
+
+    std::string key_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for the key type (ie. U64)?\n\n >> ";
+
+    std::string key_name = prompt_type<std::string>(msg);
+
+    msg = "C type of the FlatHashTable's values (ie. MyStruct*)?\n\n >> ";
+
+    std::string val_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for the value type "
+        "(ie. MyStruct_ptr)?\n\n >> ";
+
+    std::string val_name = prompt_type<std::string>(msg);
+
+    msg = "Hash function for the key type (ie. Tundra_hash_u64)?\n\n >> ";
+
+    std::string hash_func = prompt_type<std::string>(msg);
+
+    bool custom_key_eq = false;
+
+    while(true)
+    {
+        char selected = prompt_type<char>("Does the key type need a custom "
+            "equality compare instead of == (y/n)?\n\n >> ");
+
+        if(selected != 'y' && selected != 'n')
+        {
+            clear_input();
+            print_invalid_sel();
+            continue;
+        }
+
+        custom_key_eq = selected == 'y';
+        break;
+    }
+
+    std::string new_file_name = "FlatHashTable" + key_name + val_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_flattbl_file(out_directory, key_lit, key_name, val_lit,
+        val_name, hash_func, custom_key_eq))
+    {
+        exit(1);
+    }
+}
+
+void hshset_generate_menu()
+{
+    std::string msg = "C type of the HashSet's keys (ie. u64)?\n\n >> ";
+
+    std::string key_lit = prompt_type<std::string>(msg);
+
+    msg = "Header-guard friendly name for the key type (ie. U64)?\n\n >> ";
+
+    std::string key_name = prompt_type<std::string>(msg);
+
+    msg = "Hash function for the key type (ie. Tundra_hash_u64)?\n\n >> ";
+
+    std::string hash_func = prompt_type<std::string>(msg);
+
+    bool custom_key_eq = false;
+
+    while(true)
+    {
+        char selected = prompt_type<char>("Does the key type need a custom "
+            "equality compare instead of == (y/n)?\n\n >> ");
+
+        if(selected != 'y' && selected != 'n')
+        {
+            clear_input();
+            print_invalid_sel();
+            continue;
+        }
+
+        custom_key_eq = selected == 'y';
+        break;
+    }
+
+    std::string new_file_name = "HashSet" + key_name + ".h";
+
+    std::cerr << "New file name: " << new_file_name << '\n';
+
+    std::string out_directory = prompt_directory(new_file_name);
+
+    if(!write_hshset_file(out_directory, key_lit, key_name, hash_func, custom_key_eq))
+    {
+        exit(1);
+    }
+}
+
+
+// Batch mode ------------------------------------------------------------------
+
+/**
+ * Splits a manifest line into whitespace separated fields. Double quotes group
+ * a field containing spaces (ie. "const char*").
+ */
+std::vector<std::string> split_manifest_fields(const std::string &line)
+{
+    std::vector<std::string> fields;
+
+    std::string field;
+    bool in_quotes = false;
+
+    for(char c : line)
+    {
+        if(c == '"')
+        {
+            in_quotes = !in_quotes;
+            continue;
+        }
+
+        if(!in_quotes && (c == ' ' || c == '\t'))
+        {
+            if(!field.empty())
+            {
+                fields.push_back(field);
+                field.clear();
+            }
+
+            continue;
+        }
+
+        field += c;
+    }
+
+    if(!field.empty()) fields.push_back(field);
+
+    return fields;
+}
+
+/**
+ * Parses the optional trailing flag fields of a manifest line. Unknown flags
+ * are reported and fail the line. `out_path` is filled from an `out=` flag if
+ * present.
+ */
+bool parse_manifest_flags(const std::vector<std::string> &fields,
+    size_t first_flag, TypeInfo &t_info, bool &key_eq, bool &cache_hash,
+    bool &hot_cache, bool &custom_before, bool &radix, bool &reduce,
+    bool &byte_views, std::string &out_path)
+{
+    for(size_t idx = first_flag; idx < fields.size(); ++idx)
+    {
+        const std::string &flag = fields[idx];
+
+        if(flag == "custom_copy") { t_info.custom_copy = true; }
+        else if(flag == "custom_move") { t_info.custom_move = true; }
+        else if(flag == "custom_free") { t_info.custom_free = true; }
+        else if(flag == "custom_init") { t_info.custom_init = true; }
+        else if(flag == "key_eq") { key_eq = true; }
+        else if(flag == "cache_hash") { cache_hash = true; }
+        else if(flag == "hot_cache") { hot_cache = true; }
+        else if(flag == "custom_before") { custom_before = true; }
+        else if(flag == "radix") { radix = true; }
+        else if(flag == "reduce") { reduce = true; }
+        else if(flag == "byte_views") { byte_views = true; }
+        else if(flag.rfind("out=", 0) == 0) { out_path = flag.substr(4); }
+        else
+        {
+            std::cerr << "Unknown manifest flag: " << flag << '\n';
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Generates one container from a parsed manifest line. Returns false and
+ * reports on malformed lines or write failures.
+ */
+bool run_manifest_line(const std::vector<std::string> &fields,
+    const std::string &out_dir)
+{
+    const std::string &kind = fields[0];
+
+    TypeInfo t_info;
+    bool key_eq = false;
+    bool cache_hash = false;
+    bool hot_cache = false;
+    bool custom_before = false;
+    bool radix = false;
+    bool reduce = false;
+    bool byte_views = false;
+    std::string out_path;
+
+    if(kind == "Array")
+    {
+        if(fields.size() < 4)
+        {
+            std::cerr << "Array needs: Array <type> <name> <capacity>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 4, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        size_t arr_cap = std::stoul(fields[3]);
+
+        if(out_path.empty())
+        {
+            out_path = out_dir + "/Array" + fields[3] + fields[2] + ".h";
+        }
+
+        return write_array_file(out_path, fields[1], fields[2], arr_cap);
+    }
+
+    if(kind == "SmallArray")
+    {
+        if(fields.size() < 4)
+        {
+            std::cerr << "SmallArray needs: SmallArray <type> <name> "
+                "<capacity>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 4, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        size_t arr_cap = std::stoul(fields[3]);
+
+        if(out_path.empty())
+        {
+            out_path = out_dir + "/SmallArray" + fields[3] + fields[2] + ".h";
+        }
+
+        return write_smallarr_file(out_path, fields[1], fields[2], arr_cap);
+    }
+
+    if(kind == "DynamicArray" || kind == "LinkedList")
+    {
+        if(fields.size() < 3)
+        {
+            std::cerr << kind << " needs: " << kind << " <type> <name>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 3, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        if(out_path.empty()) { out_path = out_dir + '/' + kind + fields[2] +
+            ".h"; }
+
+        return write_generic_file(out_path, kind,
+            kind == "DynamicArray" ? "TUNDRA_DYNAMICARRAY" :
+            "TUNDRA_LINKEDLIST", fields[1], fields[2], t_info,
+            kind == "DynamicArray" && reduce,
+            kind == "DynamicArray" && byte_views);
+    }
+
+    if(kind == "DynamicStack")
+    {
+        if(fields.size() < 3)
+        {
+            std::cerr << "DynamicStack needs: DynamicStack <type> <name>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 3, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        if(out_path.empty()) { out_path = out_dir + "/DynamicStack" +
+            fields[2] + ".h"; }
+
+        return write_dynstk_file(out_path, fields[1], fields[2], t_info);
+    }
+
+    if(kind == "Sort")
+    {
+        if(fields.size() < 3)
+        {
+            std::cerr << "Sort needs: Sort <type> <name>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 3, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        if(out_path.empty()) { out_path = out_dir + "/Sort" + fields[2] +
+            ".h"; }
+
+        return write_sort_file(out_path, fields[1], fields[2], custom_before,
+            radix);
+    }
+
+    if(kind == "Heap")
+    {
+        if(fields.size() < 3)
+        {
+            std::cerr << "Heap needs: Heap <type> <name>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 3, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        if(out_path.empty()) { out_path = out_dir + "/Heap" + fields[2] +
+            ".h"; }
+
+        return write_heap_file(out_path, fields[1], fields[2], custom_before);
+    }
+
+    if(kind == "RingBuffer")
+    {
+        if(fields.size() < 3)
+        {
+            std::cerr << "RingBuffer needs: RingBuffer <type> <name>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 3, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        if(out_path.empty()) { out_path = out_dir + "/RingBuffer" +
+            fields[2] + ".h"; }
+
+        return write_ringbuf_file(out_path, fields[1], fields[2]);
+    }
+
+    if(kind == "MpscQueue")
+    {
+        if(fields.size() < 3)
+        {
+            std::cerr << "MpscQueue needs: MpscQueue <type> <name>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 3, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        if(out_path.empty()) { out_path = out_dir + "/MpscQueue" +
+            fields[2] + ".h"; }
+
+        return write_mpscq_file(out_path, fields[1], fields[2]);
+    }
+
+    if(kind == "ChunkedStack")
+    {
+        if(fields.size() < 3)
+        {
+            std::cerr << "ChunkedStack needs: ChunkedStack <type> <name>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 3, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        if(out_path.empty()) { out_path = out_dir + "/ChunkedStack" +
+            fields[2] + ".h"; }
+
+        return write_chunkstk_file(out_path, fields[1], fields[2]);
+    }
+
+    if(kind == "SlotMap")
+    {
+        if(fields.size() < 3)
+        {
+            std::cerr << "SlotMap needs: SlotMap <type> <name>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 3, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        if(out_path.empty()) { out_path = out_dir + "/SlotMap" +
+            fields[2] + ".h"; }
+
+        return write_slotmap_file(out_path, fields[1], fields[2]);
+    }
+
+    if(kind == "Pool")
+    {
+        if(fields.size() < 3)
+        {
+            std::cerr << "Pool needs: Pool <type> <name>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 3, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        if(out_path.empty()) { out_path = out_dir + "/Pool" + fields[2] +
+            ".h"; }
+
+        return write_pool_file(out_path, fields[1], fields[2]);
+    }
+
+    if(kind == "HashTable" || kind == "FlatHashTable")
+    {
+        if(fields.size() < 6)
+        {
+            std::cerr << kind << " needs: " << kind << " <key> <key_name> "
+                "<val> <val_name> <hash_func>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 6, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path))
+        { return false; }
+
+        if(out_path.empty()) { out_path = out_dir + '/' + kind + fields[2] +
+            fields[4] + ".h"; }
+
+        if(kind == "HashTable")
+        {
+            return write_hshtbl_file(out_path, fields[1], fields[2],
+                fields[3], fields[4], fields[5], key_eq, cache_hash,
+                hot_cache);
+        }
+
+        return write_flattbl_file(out_path, fields[1], fields[2], fields[3],
+            fields[4], fields[5], key_eq);
+    }
+
+    if(kind == "HashSet")
+    {
+        if(fields.size() < 4)
+        {
+            std::cerr << "HashSet needs: HashSet <key> <key_name> "
+                "<hash_func>\n";
+            return false;
+        }
+
+        if(!parse_manifest_flags(fields, 4, t_info, key_eq, cache_hash,
+            hot_cache, custom_before, radix, reduce, byte_views, out_path)) { return false; }
+
+        if(out_path.empty()) { out_path = out_dir + "/HashSet" + fields[2] +
+            ".h"; }
+
+        return write_hshset_file(out_path, fields[1], fields[2], fields[3],
+            key_eq);
+    }
+
+    std::cerr << "Unknown container kind: " << kind << '\n';
+    return false;
+}
+
+/**
+ * Generates every container listed in the manifest at `manifest_path` into
+ * `out_dir`, overwriting existing files. Returns 0 if every line succeeded.
+ */
+int run_batch(const std::string &manifest_path, const std::string &out_dir)
+{
+    std::ifstream manifest(manifest_path);
+
+    if(!manifest)
+    {
+        std::cerr << "Failed to open manifest: " << manifest_path << '\n';
+        return 1;
+    }
+
+    int line_num = 0;
+    int num_failed = 0;
+
+    std::string line;
+
+    while(std::getline(manifest, line))
+    {
+        ++line_num;
+
+        std::vector<std::string> fields = split_manifest_fields(line);
+
+        if(fields.empty() || fields[0][0] == '#') continue;
+
+        if(!run_manifest_line(fields, out_dir))
+        {
+            std::cerr << manifest_path << ':' << line_num <<
+                ": generation failed\n";
+            ++num_failed;
+        }
+    }
+
+    return num_failed == 0 ? 0 : 1;
+}
+
+void container_selection_menu()
+{
+    enum SELECTION_TYPE
+    {
+        ARRAY = 1,
+        DYN_ARR,
+        STACK,
+        DYN_STK,
+        LNK_LST,
+        POOL,
+        HSH_TBL,
+        FLAT_TBL,
+        HSH_SET,
+        SM_ARR,
+        RING_BUF,
+        HEAP,
+        SORT,
+        SLOT_MAP,
+        CHNK_STK,
+        MPSC_QUEUE,
+        QUIT
+    };
+
+    while(true)
+    {
+        clear_screen();
+
+        int selected = prompt_type<int>("Generate which container?\n\n1: Array\n2: "
+            "DynamicArray\n3: Stack\n4: DynamicStack\n5: LinkedList\n"
+            "6: Pool\n7: HashTable\n8: FlatHashTable\n9: HashSet\n"
+            "10: SmallArray\n11: RingBuffer\n12: Heap\n13: Sort\n"
+            "14: SlotMap\n15: ChunkedStack\n16: MpscQueue\n17: Quit\n\n"
+            "   >> ");
+
+        if(selected < 1 || selected > 17)
+        {
+            clear_input();
+            print_invalid_sel();
+            continue;
+        }
+
+        switch(selected)
+        {
+            case ARRAY:
+
+                arr_generate_menu();
+                break;
+
+            case DYN_ARR:
+
+                // dyn_arr_generate_menu();
+                generic_container_generate_menu("DynamicArray", 
+                    "Array", "TUNDRA_DYNAMICARRAY");
+                break;
+
+            case DYN_STK:
+
+                dynstk_generate_menu();
+                break;
+
+            case LNK_LST:
+
+                generic_container_generate_menu("LinkedList",
+                    "List", "TUNDRA_LINKEDLIST");
+                break;
+
+            case POOL:
+
+                pool_generate_menu();
+                break;
+
+            case HSH_TBL:
+
+                hshtbl_generate_menu();
+                break;
+
+            case FLAT_TBL:
+
+                flattbl_generate_menu();
+                break;
+
+            case HSH_SET:
+
+                hshset_generate_menu();
+                break;
+
+            case SM_ARR:
+
+                smallarr_generate_menu();
+                break;
+
+            case RING_BUF:
+
+                ringbuf_generate_menu();
+                break;
+
+            case HEAP:
+
+                heap_generate_menu();
+                break;
+
+            case SORT:
+
+                sort_generate_menu();
+                break;
+
+            case SLOT_MAP:
+
+                slotmap_generate_menu();
+                break;
+
+            case CHNK_STK:
+
+                chunkstk_generate_menu();
+                break;
+
+            case MPSC_QUEUE:
+
+                mpscq_generate_menu();
+                break;
+
+            case QUIT:
+
+                exit(0);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string manifest_path;
+    std::string out_dir = "../include/tundra/containers";
+
+    for(int idx = 1; idx < argc; ++idx)
+    {
+        std::string arg = argv[idx];
+
+        if(arg == "--batch" && idx + 1 < argc)
+        {
+            manifest_path = argv[++idx];
+        }
+        else if(arg == "--out-dir" && idx + 1 < argc)
+        {
+            out_dir = argv[++idx];
+        }
+        else
+        {
+            std::cerr << "Usage: generate [--batch <manifest> "
+                "[--out-dir <dir>]]\n";
+            return 1;
+        }
+    }
+
+    if(!manifest_path.empty()) return run_batch(manifest_path, out_dir);
+
     container_selection_menu();
     return 0;
 }
\ No newline at end of file
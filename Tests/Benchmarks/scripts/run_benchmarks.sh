@@ -0,0 +1,5 @@
+#!/bin/bash
+
+for file in bin/*; do
+    "$file"
+done
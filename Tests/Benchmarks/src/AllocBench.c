@@ -0,0 +1,251 @@
+/**
+ * @file AllocBench.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Allocator benchmarks: small/large allocators and dispatch against
+ * glibc malloc, with RSS and fragmentation reporting.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <stdlib.h>
+
+#include "tundra/Tundra.h"
+#include "tundra/utils/Benchmark.h"
+#include "tundra/utils/ConsoleIO.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/Rng.h"
+#include "tundra/utils/StringConversion.h"
+#include "tundra/internal/SmallMemAlloc.h"
+#include "tundra/internal/LargeMemAlloc.h"
+
+// Slots in the live working set for the churn scenarios; old allocations age
+// in place while the benchmark replaces random ones, modelling mixed
+// size-class churn rather than a pure alloc/free ping-pong.
+#define CHURN_SLOTS 4096
+
+// Sizes drawn for the small/mixed scenarios, spanning the small allocator's
+// bins.
+#define MIXED_SIZE_BOUND 500
+
+#define LARGE_BLOCK_BYTES (256 * 1024)
+
+static Tundra_Rng rng;
+
+// Fixed-size alloc/free pairs: the allocators' fastest path.
+
+TUNDRA_BENCHMARK(bench_sml_alloc_free_64)
+{
+    (void)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        void *mem = InTundra_SmlMemAlc_malloc(64);
+        TUNDRA_BENCH_KEEP(mem);
+        InTundra_SmlMemAlc_free(mem);
+    }
+}
+
+TUNDRA_BENCHMARK(bench_glibc_alloc_free_64)
+{
+    (void)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        void *mem = malloc(64);
+        TUNDRA_BENCH_KEEP(mem);
+        free(mem);
+    }
+}
+
+// Mixed size-class churn over an aging working set.
+
+TUNDRA_BENCHMARK(bench_sml_mixed_churn)
+{
+    (void)user_data;
+
+    static void *slots[CHURN_SLOTS];
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        const u64 SLOT = Tundra_Rng_range_u64(&rng, CHURN_SLOTS);
+
+        if(slots[SLOT] != NULL) { InTundra_SmlMemAlc_free(slots[SLOT]); }
+
+        slots[SLOT] = InTundra_SmlMemAlc_malloc(
+            1 + Tundra_Rng_range_u64(&rng, MIXED_SIZE_BOUND));
+        TUNDRA_BENCH_KEEP(slots[SLOT]);
+    }
+}
+
+TUNDRA_BENCHMARK(bench_glibc_mixed_churn)
+{
+    (void)user_data;
+
+    static void *slots[CHURN_SLOTS];
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        const u64 SLOT = Tundra_Rng_range_u64(&rng, CHURN_SLOTS);
+
+        if(slots[SLOT] != NULL) { free(slots[SLOT]); }
+
+        slots[SLOT] = malloc(
+            1 + Tundra_Rng_range_u64(&rng, MIXED_SIZE_BOUND));
+        TUNDRA_BENCH_KEEP(slots[SLOT]);
+    }
+}
+
+// Large-block alloc/free: exercises the large allocator's block cache.
+
+TUNDRA_BENCHMARK(bench_lg_alloc_free)
+{
+    (void)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        void *mem = InTundra_LgMemAlc_malloc(LARGE_BLOCK_BYTES);
+        TUNDRA_BENCH_KEEP(mem);
+        InTundra_LgMemAlc_free(mem);
+    }
+}
+
+TUNDRA_BENCHMARK(bench_glibc_large_alloc_free)
+{
+    (void)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        void *mem = malloc(LARGE_BLOCK_BYTES);
+        TUNDRA_BENCH_KEEP(mem);
+        free(mem);
+    }
+}
+
+// Full Tundra_alloc_mem dispatch across the small/large boundary.
+
+TUNDRA_BENCHMARK(bench_dispatch_mixed_churn)
+{
+    (void)user_data;
+
+    static void *slots[CHURN_SLOTS];
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        const u64 SLOT = Tundra_Rng_range_u64(&rng, CHURN_SLOTS);
+
+        if(slots[SLOT] != NULL) { Tundra_free_mem(slots[SLOT]); }
+
+        // 1 in 64 allocations is large, the rest small.
+        const u64 NUM_BYTES = (Tundra_Rng_range_u64(&rng, 64) == 0) ?
+            LARGE_BLOCK_BYTES :
+            1 + Tundra_Rng_range_u64(&rng, MIXED_SIZE_BOUND);
+
+        slots[SLOT] = Tundra_alloc_mem(NUM_BYTES);
+        TUNDRA_BENCH_KEEP(slots[SLOT]);
+    }
+}
+
+// Resident set size in bytes from /proc/self/statm.
+static u64 read_rss_bytes(void)
+{
+    Tundra_File statm;
+
+    if(Tundra_File_open(&statm, "/proc/self/statm",
+        TUNDRA_FILE_OPEN_MODE_READONLY, TUNDRA_FILE_WRITE_BEHAVIOR_NONE,
+        false, false) < 0)
+    {
+        return 0;
+    }
+
+    char buffer[128] = {0};
+    i64 read_result;
+
+    Tundra_File_readin_bytes(&statm, buffer, sizeof(buffer) - 1,
+        &read_result);
+    Tundra_File_close(&statm);
+
+    // Second field is resident pages; terminate it for conversion.
+    u64 pos = 0;
+
+    while(buffer[pos] != ' ' && buffer[pos] != '\0') { ++pos; }
+
+    const u64 FIELD_START = pos + 1;
+
+    while(buffer[pos + 1] != ' ' && buffer[pos + 1] != '\0') { ++pos; }
+
+    buffer[pos + 1] = '\0';
+
+    return Tundra_str_to_u64(buffer + FIELD_START) * 4096;
+}
+
+// Ages the allocator: builds a large mixed working set, frees every other
+// block to shatter it, then reports how much of the freed memory the
+// allocator gave back against the bytes still live.
+static void report_fragmentation_aging(void)
+{
+    enum { NUM_BLOCK = 200000 };
+
+    static void *blocks[NUM_BLOCK];
+    static u64 sizes[NUM_BLOCK];
+
+    const u64 RSS_BASE = read_rss_bytes();
+
+    u64 live_bytes = 0;
+
+    for(u64 i = 0; i < NUM_BLOCK; ++i)
+    {
+        sizes[i] = 1 + Tundra_Rng_range_u64(&rng, MIXED_SIZE_BOUND);
+        blocks[i] = Tundra_alloc_mem(sizes[i]);
+        live_bytes += sizes[i];
+    }
+
+    const u64 RSS_FULL = read_rss_bytes();
+
+    // Free every other block: worst-case interleaved fragmentation, no run
+    // of free neighbors to coalesce.
+    for(u64 i = 0; i < NUM_BLOCK; i += 2)
+    {
+        Tundra_free_mem(blocks[i]);
+        live_bytes -= sizes[i];
+    }
+
+    const u64 RSS_AGED = read_rss_bytes();
+
+    Tundra_printf("\nfragmentation aging (%d mixed blocks):\n", NUM_BLOCK);
+    Tundra_printf("  rss baseline:     %lu KiB\n", RSS_BASE / 1024);
+    Tundra_printf("  rss fully live:   %lu KiB\n", RSS_FULL / 1024);
+    Tundra_printf("  rss half freed:   %lu KiB\n", RSS_AGED / 1024);
+    Tundra_printf("  live bytes:       %lu KiB\n", live_bytes / 1024);
+
+    Tundra_flush_stdout();
+
+    for(u64 i = 1; i < NUM_BLOCK; i += 2) { Tundra_free_mem(blocks[i]); }
+}
+
+int main(void)
+{
+    Tundra_init();
+    Tundra_Rng_init(&rng, 77);
+
+    Tundra_File human;
+    Tundra_File csv;
+
+    Tundra_File_check_openerr(Tundra_File_open(&human, "alloc_bench.txt",
+        TUNDRA_FILE_OPEN_MODE_WRITEONLY, TUNDRA_FILE_WRITE_BEHAVIOR_AT_CURSOR,
+        true, true));
+    Tundra_File_check_openerr(Tundra_File_open(&csv, "alloc_bench.csv",
+        TUNDRA_FILE_OPEN_MODE_WRITEONLY, TUNDRA_FILE_WRITE_BEHAVIOR_AT_CURSOR,
+        true, true));
+
+    Tundra_Bench_run_all(&human, &csv);
+
+    Tundra_File_close(&human);
+    Tundra_File_close(&csv);
+
+    report_fragmentation_aging();
+
+    Tundra_shutdown();
+
+    return 0;
+}
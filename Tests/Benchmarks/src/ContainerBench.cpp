@@ -0,0 +1,445 @@
+/**
+ * @file ContainerBench.cpp
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Benchmarks generated containers side by side with their STL
+ * counterparts, with a bytes-per-element footprint report.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <stack>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tundra/Tundra.h"
+#include "tundra/containers/DynamicArrayU8.h"
+#include "tundra/containers/DynamicStackU8.h"
+#include "tundra/containers/HashTableU64U64.h"
+#include "tundra/containers/String.h"
+#include "tundra/utils/Benchmark.h"
+#include "tundra/utils/ConsoleIO.h"
+
+// Working-set sizes each scenario is registered at. The original plan went to
+// 100M elements, but the largest STL baselines run into multiple gigabytes
+// there; 1M keeps the full matrix runnable on a dev box while still spilling
+// every container out of L2.
+static const u64 SIZES[] = { 1024, 32 * 1024, 1024 * 1024 };
+
+#define NUM_SIZES (sizeof(SIZES) / sizeof(SIZES[0]))
+
+// Registered benchmark names live here; the harness stores the pointers.
+static char name_storage[128][64];
+static u64 num_names = 0;
+
+// Per-scenario state passed through user_data: the containers under test and
+// the working-set size for this registration.
+struct BenchState
+{
+    u64 size;
+
+    Tundra_DynamicArrayU8 tundra_arr;
+
+    // Separate prefilled array for the insert/erase scenario, so the push
+    // scenario's resets never leave it short of the middle index.
+    Tundra_DynamicArrayU8 tundra_ins_arr;
+    Tundra_DynamicStackU8 tundra_stk;
+    Tundra_HashTableU64U64 tundra_tbl;
+
+    // Separate prefilled tables for the find scenarios, so the insert
+    // scenarios' resets never disturb them.
+    Tundra_HashTableU64U64 tundra_find_tbl;
+    Tundra_String tundra_str;
+
+    // Separate prefilled haystack for the search scenario, so the append
+    // scenario's clears never shorten it.
+    Tundra_String tundra_search_str;
+
+    std::vector<u8> std_vec;
+    std::vector<u8> std_ins_vec;
+    std::stack<u8> std_stk;
+    std::unordered_map<u64, u64> std_map;
+    std::unordered_map<u64, u64> std_find_map;
+    std::string std_str;
+    std::string std_search_str;
+};
+
+static BenchState states[NUM_SIZES];
+
+// Cheap key sequence for hash scenarios, deliberately not Tundra_Rng so both
+// sides pay identical per-iteration overhead.
+static inline u64 next_key(u64 &lcg_state)
+{
+    lcg_state = lcg_state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return lcg_state >> 33;
+}
+
+// DynamicArray push: grow to the working-set size, clear (capacity is kept),
+// repeat, so the steady state is the pure append path.
+
+static void bench_tundra_arr_push(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        if(Tundra_DynArrU8_size(&st->tundra_arr) == st->size)
+        { Tundra_DynArrU8_clear(&st->tundra_arr); }
+
+        Tundra_DynArrU8_add_val(&st->tundra_arr, (u8)i);
+    }
+}
+
+static void bench_std_vec_push(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        if(st->std_vec.size() == st->size) { st->std_vec.clear(); }
+
+        st->std_vec.push_back((u8)i);
+    }
+}
+
+// DynamicArray insert/erase: one middle insert and one middle erase per
+// iteration on a container held at the working-set size, so each iteration
+// shifts half the elements twice.
+
+static void bench_tundra_arr_insert_erase(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    const u64 MID = st->size / 2;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        Tundra_DynArrU8_insert_val(&st->tundra_ins_arr, MID, (u8)i);
+        Tundra_DynArrU8_erase(&st->tundra_ins_arr, MID);
+    }
+}
+
+static void bench_std_vec_insert_erase(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    const u64 MID = st->size / 2;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        st->std_ins_vec.insert(st->std_ins_vec.begin() + MID, (u8)i);
+        st->std_ins_vec.erase(st->std_ins_vec.begin() + MID);
+    }
+}
+
+// DynamicStack push/pop pair per iteration at a steady half-full depth.
+
+static void bench_tundra_stk_push_pop(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        Tundra_DynStkU8_push_val(&st->tundra_stk, (u8)i);
+        Tundra_DynStkU8_pop(&st->tundra_stk);
+    }
+}
+
+static void bench_std_stk_push_pop(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        st->std_stk.push((u8)i);
+        st->std_stk.pop();
+    }
+}
+
+// HashTable insert: fill to the working-set size, reset, repeat. The Tundra
+// table has no clear, so the reset is a free/init_cap pair; both resets
+// amortize to nothing against the fill.
+
+static void bench_tundra_tbl_insert(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    u64 lcg = st->size;
+    u64 num_added = 0;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        if(num_added == st->size)
+        {
+            Tundra_HshTblU64U64_free(&st->tundra_tbl);
+            Tundra_HshTblU64U64_init(&st->tundra_tbl);
+            num_added = 0;
+        }
+
+        Tundra_HshTblU64U64_add(&st->tundra_tbl, next_key(lcg), i);
+        ++num_added;
+    }
+}
+
+static void bench_std_map_insert(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    u64 lcg = st->size;
+    u64 num_added = 0;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        if(num_added == st->size)
+        {
+            st->std_map = std::unordered_map<u64, u64>();
+            num_added = 0;
+        }
+
+        st->std_map[next_key(lcg)] = i;
+        ++num_added;
+    }
+}
+
+// HashTable find: random lookups against a prebuilt table of the working-set
+// size, the same key sequence the insert scenarios used.
+
+static void bench_tundra_tbl_find(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    u64 lcg = st->size;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        TUNDRA_BENCH_KEEP(
+            Tundra_HshTblU64U64_get(&st->tundra_find_tbl, next_key(lcg)));
+    }
+}
+
+static void bench_std_map_find(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    u64 lcg = st->size;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        TUNDRA_BENCH_KEEP(st->std_find_map.count(next_key(lcg)));
+    }
+}
+
+// String append: grow to the working-set size, clear, repeat.
+
+static void bench_tundra_str_append(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        if(Tundra_Str_size(&st->tundra_str) == st->size)
+        { Tundra_Str_clear(&st->tundra_str); }
+
+        Tundra_Str_add(&st->tundra_str, (char)('a' + (i & 15)));
+    }
+}
+
+static void bench_std_str_append(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        if(st->std_str.size() == st->size) { st->std_str.clear(); }
+
+        st->std_str.push_back((char)('a' + (i & 15)));
+    }
+}
+
+// String search: scan a prebuilt working-set-size haystack for a needle
+// placed at the very end, one full scan per iteration.
+
+static void bench_tundra_str_search(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        TUNDRA_BENCH_KEEP(
+            Tundra_Str_find_cstr(&st->tundra_search_str, "needle"));
+    }
+}
+
+static void bench_std_str_search(u64 num_iter, void *user_data)
+{
+    BenchState *st = (BenchState*)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        TUNDRA_BENCH_KEEP(st->std_search_str.find("needle"));
+    }
+}
+
+/**
+ * @brief Registers one scenario at one size under a composed stable name.
+ */
+static void register_at_size(const char *base, Tundra_BenchFn fn,
+    BenchState *st)
+{
+    char *name = name_storage[num_names++];
+    u64 pos = 0;
+
+    while(base[pos] != '\0') { name[pos] = base[pos]; ++pos; }
+
+    name[pos++] = '_';
+
+    if(st->size >= 1024 * 1024)
+    {
+        name[pos++] = (char)('0' + st->size / (1024 * 1024));
+        name[pos++] = 'm';
+    }
+
+    else
+    {
+        const u64 KIB = st->size / 1024;
+
+        if(KIB >= 10) { name[pos++] = (char)('0' + KIB / 10); }
+
+        name[pos++] = (char)('0' + KIB % 10);
+        name[pos++] = 'k';
+    }
+
+    name[pos] = '\0';
+
+    Tundra_Bench_register(name, fn, st);
+}
+
+/**
+ * @brief Prints resident and exact footprints per element at the largest
+ * size.
+ *
+ * Exact capacities are reported where the container exposes them; the
+ * std::unordered_map entry is approximate (buckets plus a typical libstdc++
+ * node), since node overhead is not observable portably.
+ */
+static void report_bytes_per_element(void)
+{
+    BenchState *st = &states[NUM_SIZES - 1];
+
+    const u64 SIZE = st->size;
+
+    Tundra_printf("\nbytes per element at %lu elements:\n", SIZE);
+
+    Tundra_printf("  Tundra_DynamicArrayU8: %lu.%lu\n",
+        Tundra_DynArrU8_capacity(&st->tundra_arr) / SIZE,
+        Tundra_DynArrU8_capacity(&st->tundra_arr) * 10 / SIZE % 10);
+    Tundra_printf("  std::vector<u8>:       %lu.%lu\n",
+        (u64)st->std_vec.capacity() / SIZE,
+        (u64)st->std_vec.capacity() * 10 / SIZE % 10);
+
+    const u64 TBL_BYTES = (st->tundra_find_tbl.top_capacity +
+        st->tundra_find_tbl.cellar_capacity) *
+        sizeof(Tundra_HshTblEntryU64U64);
+    const u64 MAP_BYTES =
+        (u64)st->std_find_map.bucket_count() * sizeof(void*) +
+        (u64)st->std_find_map.size() * (sizeof(void*) + 2 * sizeof(u64) + 8);
+
+    Tundra_printf("  Tundra_HashTableU64U64:   %lu.%lu\n",
+        TBL_BYTES / SIZE, TBL_BYTES * 10 / SIZE % 10);
+    Tundra_printf("  std::unordered_map (est): %lu.%lu\n",
+        MAP_BYTES / SIZE, MAP_BYTES * 10 / SIZE % 10);
+
+    Tundra_printf("  Tundra_String: %lu.%lu\n",
+        Tundra_Str_capacity(&st->tundra_str) / SIZE,
+        Tundra_Str_capacity(&st->tundra_str) * 10 / SIZE % 10);
+    Tundra_printf("  std::string:   %lu.%lu\n",
+        (u64)st->std_str.capacity() / SIZE,
+        (u64)st->std_str.capacity() * 10 / SIZE % 10);
+
+    Tundra_flush_stdout();
+}
+
+int main()
+{
+    Tundra_init();
+
+    for(u64 i = 0; i < NUM_SIZES; ++i)
+    {
+        BenchState *st = &states[i];
+
+        st->size = SIZES[i];
+
+        Tundra_DynArrU8_init(&st->tundra_arr);
+        Tundra_DynArrU8_init(&st->tundra_ins_arr);
+        Tundra_DynStkU8_init(&st->tundra_stk);
+        Tundra_HshTblU64U64_init(&st->tundra_tbl);
+        Tundra_HshTblU64U64_init(&st->tundra_find_tbl);
+        Tundra_Str_init(&st->tundra_str);
+        Tundra_Str_init(&st->tundra_search_str);
+
+        // The insert/erase and search scenarios need prefilled containers;
+        // the fill scenarios reset them on their own.
+        Tundra_DynArrU8_resize(&st->tundra_ins_arr, st->size);
+        st->std_ins_vec.resize(st->size);
+
+        for(u64 c = 0; c + 7 < st->size; ++c)
+        { Tundra_Str_add(&st->tundra_search_str, 'a'); }
+
+        Tundra_Str_add_multiple(&st->tundra_search_str, "needle", 6);
+        st->std_search_str.assign(st->size - 7, 'a');
+        st->std_search_str.append("needle");
+
+        register_at_size("tundra_arr_push", bench_tundra_arr_push, st);
+        register_at_size("std_vec_push", bench_std_vec_push, st);
+        register_at_size("tundra_arr_insert_erase",
+            bench_tundra_arr_insert_erase, st);
+        register_at_size("std_vec_insert_erase",
+            bench_std_vec_insert_erase, st);
+        register_at_size("tundra_stk_push_pop",
+            bench_tundra_stk_push_pop, st);
+        register_at_size("std_stk_push_pop", bench_std_stk_push_pop, st);
+        register_at_size("tundra_tbl_insert", bench_tundra_tbl_insert, st);
+        register_at_size("std_map_insert", bench_std_map_insert, st);
+        register_at_size("tundra_tbl_find", bench_tundra_tbl_find, st);
+        register_at_size("std_map_find", bench_std_map_find, st);
+        register_at_size("tundra_str_append", bench_tundra_str_append, st);
+        register_at_size("std_str_append", bench_std_str_append, st);
+        register_at_size("tundra_str_search", bench_tundra_str_search, st);
+        register_at_size("std_str_search", bench_std_str_search, st);
+    }
+
+    // Populate the find-scenario tables with the same key sequence the find
+    // loops draw their lookups from.
+    for(u64 i = 0; i < NUM_SIZES; ++i)
+    {
+        u64 lcg = states[i].size;
+
+        for(u64 k = 0; k < states[i].size; ++k)
+        {
+            const u64 KEY = next_key(lcg);
+
+            Tundra_HshTblU64U64_add(&states[i].tundra_find_tbl, KEY, k);
+            states[i].std_find_map[KEY] = k;
+        }
+    }
+
+    Tundra_File human;
+    Tundra_File csv;
+
+    Tundra_File_check_openerr(Tundra_File_open(&human,
+        "container_bench.txt", TUNDRA_FILE_OPEN_MODE_WRITEONLY,
+        TUNDRA_FILE_WRITE_BEHAVIOR_AT_CURSOR, true, true));
+    Tundra_File_check_openerr(Tundra_File_open(&csv, "container_bench.csv",
+        TUNDRA_FILE_OPEN_MODE_WRITEONLY,
+        TUNDRA_FILE_WRITE_BEHAVIOR_AT_CURSOR, true, true));
+
+    Tundra_Bench_run_all(&human, &csv);
+
+    Tundra_File_close(&human);
+    Tundra_File_close(&csv);
+
+    report_bytes_per_element();
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file MathBench.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Benchmarks for the Math reduction and clamp kernels.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/Benchmark.h"
+#include "tundra/utils/Math.h"
+#include "tundra/utils/Rng.h"
+
+#define NUM_ELEM 65536
+
+static u64 values[NUM_ELEM];
+
+TUNDRA_BENCHMARK(bench_sum_u64_arr)
+{
+    (void)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        TUNDRA_BENCH_KEEP(Tundra_sum_u64_arr(values, NUM_ELEM));
+    }
+}
+
+TUNDRA_BENCHMARK(bench_min_u64_arr)
+{
+    (void)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        TUNDRA_BENCH_KEEP(Tundra_min_u64_arr(values, NUM_ELEM));
+    }
+}
+
+TUNDRA_BENCHMARK(bench_clamp_arr_u64)
+{
+    (void)user_data;
+
+    for(u64 i = 0; i < num_iter; ++i)
+    {
+        Tundra_clamp_arr_u64(values, NUM_ELEM, 1ULL << 16, 1ULL << 48);
+        TUNDRA_BENCH_CLOBBER();
+    }
+}
+
+int main(void)
+{
+    Tundra_Rng rng;
+    Tundra_Rng_init(&rng, 76);
+    Tundra_Rng_fill(&rng, values, sizeof(values));
+
+    Tundra_File human;
+    Tundra_File csv;
+
+    Tundra_File_check_openerr(Tundra_File_open(&human, "math_bench.txt",
+        TUNDRA_FILE_OPEN_MODE_WRITEONLY, TUNDRA_FILE_WRITE_BEHAVIOR_AT_CURSOR,
+        true, true));
+    Tundra_File_check_openerr(Tundra_File_open(&csv, "math_bench.csv",
+        TUNDRA_FILE_OPEN_MODE_WRITEONLY, TUNDRA_FILE_WRITE_BEHAVIOR_AT_CURSOR,
+        true, true));
+
+    Tundra_Bench_run_all(&human, &csv);
+
+    Tundra_File_close(&human);
+    Tundra_File_close(&csv);
+
+    return 0;
+}
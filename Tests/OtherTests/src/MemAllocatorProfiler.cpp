@@ -88,62 +88,37 @@ void realloc_some_mem(std::vector<AllocData> &dealloced_mem)
 }
 
 std::string get_mem_alloc_status()
-{        
-    const MemArena * arena = get_mem_arena_instance();
-    
-    float ratio = float(arena->used_bytes) / arena->total_size_bytes;
-    int ratio_as_percent = ratio * 100; 
-
-    std::stringstream main_buf;
+{
+    Tundra_MemStats stats;
+    Tundra_get_mem_stats(&stats);
 
-    main_buf << " -- ARENA --\n\n";
-    main_buf << "Bytes used: " << arena->used_bytes << " / " << 
-        arena->total_size_bytes << " (" << ratio_as_percent << "%)\n\n"; 
+    float ratio = float(stats.small_used_bytes) / stats.small_arena_bytes;
+    int ratio_as_percent = ratio * 100;
 
-    u64 inspected_byte = 0;
+    std::stringstream main_buf;
 
-    std::string display_buf = "[";
+    main_buf << " -- SMALL ALLOCATOR --\n\n";
+    main_buf << "Arenas: " << stats.small_num_arenas << '\n';
+    main_buf << "Bytes used: " << stats.small_used_bytes << " / " <<
+        stats.small_arena_bytes << " (" << ratio_as_percent << "%)\n";
+    main_buf << "Peak arena bytes: " << stats.small_peak_arena_bytes << "\n\n";
 
-    int id = 0;
+    main_buf << "Freed bins:\n";
 
-    while(inspected_byte < arena->used_bytes)
+    for(int i = 0; i < TUNDRA_MEM_STATS_NUM_SIZE_CLASSES; ++i)
     {
-        display_buf += '|' + std::to_string(id) + '|';
-
-        // Get the BlockHeader of the inspected byte.
-        const BlockHeader * header = 
-            (const BlockHeader*)(arena->base_ptr + inspected_byte);
-
-        main_buf << "Alloc id: " << id++ << '\n';
-        main_buf << "Block size: " << header->block_byte_size << "\n\n";
-
-        const u64 total_used_size = BLOCK_HEADER_SIZE + header->block_byte_size;
-    
-        char display = '.';
-
-        if(header->in_use)
-        {
-            display = '*';
-        }
-
-        for(int i = 0; i < total_used_size / TUNDRA_MIN_SIZE_CLASS_BYTE_SIZE; 
-            ++i)
-        {
-            display_buf += display;
-        }
-
-        inspected_byte += total_used_size;
+        main_buf << "  " << (TUNDRA_MIN_SIZE_CLASS_BYTE_SIZE << i) <<
+            " B: " << stats.small_freed_bin_counts[i] << '\n';
     }
 
-    display_buf += "| -> ...]\n"; 
-
-    // for(int i = 0; i < (arena->total_size_bytes - arena->used_bytes) / 
-    //     TUNDRA_MIN_SIZE_CLASS_BYTE_SIZE; ++i)
-    // {
-    //     display_buf += '.';
-    // }
-
-    main_buf << "\n" << display_buf << '\n';
+    main_buf << "\n -- LARGE ALLOCATOR --\n\n";
+    main_buf << "Live blocks: " << stats.large_live_blocks << " (" <<
+        stats.large_live_bytes << " B, peak " <<
+        stats.large_peak_live_bytes << " B)\n";
+    main_buf << "Cache: " << stats.large_cache_hits << " hits / " <<
+        stats.large_cache_misses << " misses, " <<
+        stats.large_cached_blocks << " blocks cached (" <<
+        stats.large_cached_bytes << " B)\n\n";
 
     return main_buf.str();
 }
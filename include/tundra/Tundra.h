@@ -20,9 +20,14 @@ extern "C" {
 #endif
 
 /**
- * @brief Initializes any components in the library that need initializing. Must
- * be called before the library is used.
- * 
+ * @brief Pre-warms the library's lazily initialized components.
+ *
+ * Calling this is optional: every component initializes itself on first use
+ * (the allocator maps its arena on the first allocation, console buffers on
+ * the first print), after which each use costs one predicted branch. Call it
+ * to move that first-use work to a point of your choosing, ie. before a
+ * latency sensitive section.
+ *
  * @return int 0 if successful. Error code otherwise.
  */
 static inline int Tundra_init()
@@ -30,9 +35,6 @@ static inline int Tundra_init()
     InTundra_Mem_init();
     InTundra_ConIO_init();
 
-    InTundra_float_rounding_constant = ((float)1 / (float)Tundra_uint_pow(10,
-        TUNDRA_FLOAT_PRECISION + 1)) * 5;
-
     return 0;
 }
 
@@ -0,0 +1,169 @@
+/**
+ * @file Atomics.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Atomic operations on Tundra types for lock-free building blocks.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_ATOMICS_H
+#define TUNDRA_ATOMICS_H
+
+#include "tundra/common/TypeDef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Memory orders, passed to every operation below. Same numbering as the
+// GCC builtins they map onto.
+#define TUNDRA_ATM_RELAXED __ATOMIC_RELAXED
+#define TUNDRA_ATM_ACQUIRE __ATOMIC_ACQUIRE
+#define TUNDRA_ATM_RELEASE __ATOMIC_RELEASE
+#define TUNDRA_ATM_ACQ_REL __ATOMIC_ACQ_REL
+#define TUNDRA_ATM_SEQ_CST __ATOMIC_SEQ_CST
+
+// Size of one cache line; keep hot shared data on separate lines to avoid
+// false sharing.
+#define TUNDRA_CACHELINE_BYTES 64
+
+/**
+ * A u64 counter alone on its cache line, for counters bumped from several
+ * threads at once.
+ */
+typedef struct Tundra_AtmPaddedU64
+{
+    u64 value;
+    u8 padding[TUNDRA_CACHELINE_BYTES - sizeof(u64)];
+} __attribute__((aligned(TUNDRA_CACHELINE_BYTES))) Tundra_AtmPaddedU64;
+
+
+// -- u32 --
+
+static inline u32 Tundra_atm_load_u32(const u32 *target, int order)
+{
+    return __atomic_load_n(target, order);
+}
+
+static inline void Tundra_atm_store_u32(u32 *target, u32 value, int order)
+{
+    __atomic_store_n(target, value, order);
+}
+
+static inline u32 Tundra_atm_exchange_u32(u32 *target, u32 value, int order)
+{
+    return __atomic_exchange_n(target, value, order);
+}
+
+/**
+ * @brief Atomically replaces `*target` with `desired` if it equals
+ * `*expected`; on failure `*expected` receives the observed value.
+ *
+ * @return bool True if the swap happened.
+ */
+static inline bool Tundra_atm_cas_u32(u32 *target, u32 *expected,
+    u32 desired, int success_order, int failure_order)
+{
+    return __atomic_compare_exchange_n(target, expected, desired, false,
+        success_order, failure_order);
+}
+
+static inline u32 Tundra_atm_fetch_add_u32(u32 *target, u32 value,
+    int order)
+{
+    return __atomic_fetch_add(target, value, order);
+}
+
+static inline u32 Tundra_atm_fetch_sub_u32(u32 *target, u32 value,
+    int order)
+{
+    return __atomic_fetch_sub(target, value, order);
+}
+
+
+// -- u64 --
+
+static inline u64 Tundra_atm_load_u64(const u64 *target, int order)
+{
+    return __atomic_load_n(target, order);
+}
+
+static inline void Tundra_atm_store_u64(u64 *target, u64 value, int order)
+{
+    __atomic_store_n(target, value, order);
+}
+
+static inline u64 Tundra_atm_exchange_u64(u64 *target, u64 value, int order)
+{
+    return __atomic_exchange_n(target, value, order);
+}
+
+static inline bool Tundra_atm_cas_u64(u64 *target, u64 *expected,
+    u64 desired, int success_order, int failure_order)
+{
+    return __atomic_compare_exchange_n(target, expected, desired, false,
+        success_order, failure_order);
+}
+
+static inline u64 Tundra_atm_fetch_add_u64(u64 *target, u64 value,
+    int order)
+{
+    return __atomic_fetch_add(target, value, order);
+}
+
+static inline u64 Tundra_atm_fetch_sub_u64(u64 *target, u64 value,
+    int order)
+{
+    return __atomic_fetch_sub(target, value, order);
+}
+
+
+// -- Pointers --
+
+static inline void* Tundra_atm_load_ptr(void * const *target, int order)
+{
+    return __atomic_load_n(target, order);
+}
+
+static inline void Tundra_atm_store_ptr(void **target, void *value,
+    int order)
+{
+    __atomic_store_n(target, value, order);
+}
+
+static inline void* Tundra_atm_exchange_ptr(void **target, void *value,
+    int order)
+{
+    return __atomic_exchange_n(target, value, order);
+}
+
+static inline bool Tundra_atm_cas_ptr(void **target, void **expected,
+    void *desired, int success_order, int failure_order)
+{
+    return __atomic_compare_exchange_n(target, expected, desired, false,
+        success_order, failure_order);
+}
+
+
+/**
+ * @brief Full memory fence with the given order.
+ */
+static inline void Tundra_atm_fence(int order)
+{
+    __atomic_thread_fence(order);
+}
+
+/**
+ * @brief Politely yields the core for one iteration of a busy-wait loop.
+ */
+static inline void Tundra_atm_spin_pause(void)
+{
+    __builtin_ia32_pause();
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
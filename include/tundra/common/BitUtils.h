@@ -40,13 +40,18 @@ static inline u8 Tundra_get_lsb_pos(u64 bits)
     return Tundra_get_num_trail_zeros(bits);
 }
 
+static inline u8 Tundra_get_num_set_bits(u64 bits)
+{
+    return (u8)__builtin_popcountll(bits);
+}
+
 /**
  * @brief Returns whether `num` is a power of two.
- * 
+ *
  * If `num` is zero, false is returned.
- * 
+ *
  * @param num Number to check.
- * 
+ *
  * @return true if `num` is a power of two, false otherwise.
  */
 static inline bool Tundra_is_pow2(u64 num)
@@ -54,6 +59,70 @@ static inline bool Tundra_is_pow2(u64 num)
     return (num != 0) && (num & (num - 1)) == 0;
 }
 
+/**
+ * @brief Returns the largest power of two less than or equal to `num`.
+ *
+ * If `num` is zero, 0 is returned.
+ *
+ * @param num Number to floor to a power of two.
+ *
+ * @return Largest power of two less than or equal to `num`, 0 if `num` is 0.
+ */
+static inline u64 Tundra_bit_floor(u64 num)
+{
+    return (num == 0) ? 0 : 1ULL << Tundra_get_msb_pos(num);
+}
+
+/**
+ * @brief Returns the smallest power of two greater than or equal to `num`.
+ *
+ * If `num` is 0 or 1, 1 is returned. `num` must not exceed 2^63.
+ *
+ * @param num Number to ceil to a power of two.
+ *
+ * @return Smallest power of two greater than or equal to `num`.
+ */
+static inline u64 Tundra_bit_ceil(u64 num)
+{
+    return (num <= 1) ? 1 : 1ULL << (Tundra_get_msb_pos(num - 1) + 1);
+}
+
+/**
+ * @brief Returns the `num_bit` wide bit field of `bits` starting at bit
+ * position `pos`.
+ *
+ * `pos` plus `num_bit` must not exceed 64. If `num_bit` is 64, `pos` must be
+ * 0.
+ *
+ * @param bits Bits to extract from.
+ * @param pos Bit position of the field's lowest bit.
+ * @param num_bit Width of the field in bits.
+ *
+ * @return Extracted field, shifted down to bit 0.
+ */
+static inline u64 Tundra_extract_bits(u64 bits, u8 pos, u8 num_bit)
+{
+    return (bits >> pos) & ((num_bit == 64) ? ~0ULL : (1ULL << num_bit) - 1);
+}
+
+/**
+ * @brief Iterates `pos_var` over the position of every set bit of `bits`,
+ * lowest to highest.
+ *
+ * `pos_var` is declared by the macro as a u64 scoped to the loop. The
+ * iteration works from a copy of `bits`, clearing the lowest set bit each
+ * pass, so one trailing-zero count and one blsr-style and per set bit.
+ *
+ * Usage:
+ *
+ * TUNDRA_FOR_EACH_SET_BIT(mask, pos) { use(pos); }
+ */
+#define TUNDRA_FOR_EACH_SET_BIT(bits, pos_var) \
+    for(u64 InTundra_rem_bits = (bits), pos_var = 0; \
+        InTundra_rem_bits != 0 && \
+        ((pos_var = Tundra_get_num_trail_zeros(InTundra_rem_bits)), true); \
+        InTundra_rem_bits &= InTundra_rem_bits - 1)
+
 #ifdef __cplusplus
 }   
 #endif
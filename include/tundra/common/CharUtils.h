@@ -13,6 +13,8 @@
 #ifndef TUNDRA_CHARUTILS_H
 #define TUNDRA_CHARUTILS_H
 
+#include "tundra/common/TypeDef.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -24,7 +26,7 @@ extern "C" {
  * 
  * @return `bool` True if letter. 
  */
-static bool Tundra_is_letter(char c)
+static inline bool Tundra_is_letter(char c)
 {
     return (c >= 'a' && c <= 'z') ||
         (c >= 'A' && c <= 'Z');
@@ -37,7 +39,7 @@ static bool Tundra_is_letter(char c)
  * 
  * @return `bool` True if digit. 
  */
-static bool Tundra_is_digit(char c)
+static inline bool Tundra_is_digit(char c)
 {
     return c >= '0' && c <= '9';
 }
@@ -49,12 +51,82 @@ static bool Tundra_is_digit(char c)
  * 
  * @return `bool` True if alphanumerical. 
  */
-static bool Tundra_is_alphnum(char c)
+static inline bool Tundra_is_alphnum(char c)
 {
     return Tundra_is_letter(c) ||
         Tundra_is_digit(c);
 }
 
+/**
+ * @brief Returns true if every byte of `text` is 7 bit ASCII.
+ *
+ * Checks 16 bytes per iteration with a wide high-bit test, so the common
+ * all-ASCII case runs at memory speed.
+ *
+ * @param text Bytes to check.
+ * @param num_bytes Number of bytes to check.
+ *
+ * @return `bool` True if no byte has its high bit set.
+ */
+bool Tundra_is_ascii(const char *text, u64 num_bytes);
+
+/**
+ * @brief Returns true if `text` is well formed UTF-8.
+ *
+ * ASCII runs are skipped 8 bytes at a time with a wide high-bit test, which
+ * is the dominant case for untrusted inbound text; only the multibyte
+ * sequences fall through to per-byte checks. Overlong encodings, surrogate
+ * code points, values above U+10FFFF and truncated sequences all fail.
+ *
+ * @param text Bytes to validate.
+ * @param num_bytes Number of bytes to validate.
+ *
+ * @return `bool` True if the whole range is valid UTF-8.
+ */
+bool Tundra_utf8_validate(const char *text, u64 num_bytes);
+
+/**
+ * @brief Converts every ASCII uppercase letter in `mem` to lowercase, in
+ * place.
+ *
+ * Runs 8 bytes at a time with SWAR range arithmetic, setting the case bit
+ * only in bytes classified as 'A'..'Z'. Bytes outside that range, including
+ * UTF-8 multibyte units, pass through untouched.
+ *
+ * @param mem Memory block to convert.
+ * @param num_bytes Number of bytes to convert.
+ */
+void Tundra_to_lower_mem(void *mem, u64 num_bytes);
+
+/**
+ * @brief Converts every ASCII lowercase letter in `mem` to uppercase, in
+ * place.
+ *
+ * Same wide kernel as `Tundra_to_lower_mem`, clearing the case bit in bytes
+ * classified as 'a'..'z'.
+ *
+ * @param mem Memory block to convert.
+ * @param num_bytes Number of bytes to convert.
+ */
+void Tundra_to_upper_mem(void *mem, u64 num_bytes);
+
+/**
+ * @brief Counts the bytes of `mem` in the inclusive range [`min`, `max`].
+ *
+ * Generic classify-and-count kernel: digits are [`'0'`, `'9'`], spaces are
+ * [`' '`, `' '`], and so on. Classification runs 8 bytes at a time with a
+ * popcount over the match flags. Both bounds must be 7 bit ASCII; bytes with
+ * the high bit set never match.
+ *
+ * @param mem Memory block to scan.
+ * @param num_bytes Number of bytes to scan.
+ * @param min Lowest matching byte value, at most 0x7F.
+ * @param max Highest matching byte value, at most 0x7F.
+ *
+ * @return `u64` Number of bytes within the range.
+ */
+u64 Tundra_count_byte_range(const void *mem, u64 num_bytes, u8 min, u8 max);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,54 @@
+/**
+ * @file Checksum.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief CRC-32C (Castagnoli) checksums over byte ranges.
+ * @version 0.1
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef TUNDRA_CHECKSUM_H
+#define TUNDRA_CHECKSUM_H
+
+#include "tundra/common/TypeDef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Computes the CRC-32C checksum of a block of memory.
+ *
+ * Uses the x86-64 crc32 instruction with three interleaved streams when the
+ * executing cpu supports it, falling back to a table implementation
+ * otherwise. Both paths produce identical checksums.
+ *
+ * @param mem Memory to checksum.
+ * @param num_bytes Number of bytes to checksum.
+ *
+ * @return u32 CRC-32C of the bytes.
+ */
+u32 Tundra_crc32c(const void *mem, u64 num_bytes);
+
+/**
+ * @brief Extends a CRC-32C checksum with further bytes.
+ *
+ * Feeding a stream through this in pieces produces the same checksum as one
+ * `Tundra_crc32c` call over the concatenated bytes. Pass 0 as the starting
+ * crc for the first piece.
+ *
+ * @param crc Checksum of the bytes seen so far, 0 to start.
+ * @param mem Memory to checksum.
+ * @param num_bytes Number of bytes to checksum.
+ *
+ * @return u32 CRC-32C of all bytes seen so far.
+ */
+u32 Tundra_crc32c_extend(u32 crc, const void *mem, u64 num_bytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TUNDRA_CHECKSUM_H
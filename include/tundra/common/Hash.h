@@ -27,6 +27,57 @@ extern "C" {
  */
 u64 Tundra_hash_u64(u64 i);
 
+/**
+ * @brief Hashes an array of u64 keys.
+ * 
+ * Hashes four keys per iteration in independent streams, so large batches
+ * (table rehashes, bulk inserts) run at instruction-level parallelism instead
+ * of one dependent mix chain per call.
+ * 
+ * @param keys Keys to hash.
+ * @param hashes_out Output array receiving one hash per key.
+ * @param num_keys Number of keys.
+ */
+void Tundra_hash_u64_batch(const u64 *keys, u64 *hashes_out, u64 num_keys);
+
+/**
+ * @brief Hashes a variable-length block of bytes.
+ * 
+ * Wide-stripe wyhash-class mix; three independent 128-bit multiply lanes on
+ * long inputs, one compare-friendly tail path for short keys.
+ * 
+ * @param mem Memory to hash.
+ * @param num_bytes Number of bytes to hash.
+ * 
+ * @return u64 Hash result. 
+ */
+u64 Tundra_hash_bytes(const void *mem, u64 num_bytes);
+
+/**
+ * @brief Hashes a variable-length block of bytes with a seed.
+ * 
+ * Distinct seeds give independent hash functions over the same bytes.
+ * 
+ * @param mem Memory to hash.
+ * @param num_bytes Number of bytes to hash.
+ * @param seed Seed mixed into the hash.
+ * 
+ * @return u64 Hash result. 
+ */
+u64 Tundra_hash_bytes_seeded(const void *mem, u64 num_bytes, u64 seed);
+
+/**
+ * @brief Hashes a null terminated string.
+ * 
+ * Suitable as the TUNDRA_HASH_FUNC of a HashTable instantiation keyed on
+ * c-strings.
+ * 
+ * @param cstr Null terminated string to hash.
+ * 
+ * @return u64 Hash result. 
+ */
+u64 Tundra_hash_cstr(const char *cstr);
+
 /**
  * @brief Hashes an i64.
  * 
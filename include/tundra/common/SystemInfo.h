@@ -47,4 +47,66 @@
 #if !defined(__GNUC__) && !defined(__clang__)
 #error Unsupported Compiler
 #endif
+
+#include "tundra/common/TypeDef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Runtime cpu feature bits, returned by Tundra_get_cpu_features. The build
+// targets the baseline ISA, so kernels wanting wider instructions probe
+// these at runtime and dispatch, letting one binary run across a mixed
+// fleet instead of faulting on the oldest tier.
+#define TUNDRA_CPU_FEAT_SSE42 (1ULL << 0)
+#define TUNDRA_CPU_FEAT_AVX (1ULL << 1)
+#define TUNDRA_CPU_FEAT_AVX2 (1ULL << 2)
+#define TUNDRA_CPU_FEAT_AVX512F (1ULL << 3)
+#define TUNDRA_CPU_FEAT_NEON (1ULL << 32)
+
+/**
+ * @brief Returns the executing cpu's feature bitmask, probed once and cached.
+ *
+ * On x86_64 the avx bits are only reported when the os has also enabled the
+ * corresponding register state (xgetbv), so a set bit always means the
+ * instructions are safe to execute.
+ *
+ * @return u64 Bitmask of TUNDRA_CPU_FEAT_ bits.
+ */
+u64 Tundra_get_cpu_features(void);
+
+/**
+ * @brief Returns true if the executing cpu has every feature in `features`.
+ *
+ * @param features TUNDRA_CPU_FEAT_ bits to test.
+ *
+ * @return bool True if all requested features are present.
+ */
+bool Tundra_cpu_has_features(u64 features);
+
+/**
+ * @brief Returns the number of numa nodes the system can have, probed once
+ * and cached.
+ *
+ * Returns 1 whenever the topology cannot be read, so callers can treat
+ * every machine as having at least one node.
+ *
+ * @return u32 Number of possible numa nodes, at least 1.
+ */
+u32 Tundra_get_num_numa_nodes(void);
+
+/**
+ * @brief Returns the numa node the calling thread is currently executing on.
+ *
+ * The thread can migrate right after this returns unless it is pinned, so
+ * the answer is only stable for threads with an affinity set.
+ *
+ * @return u32 Node of the executing cpu, 0 if it cannot be queried.
+ */
+u32 Tundra_get_current_numa_node(void);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
 #endif
@@ -15,6 +15,7 @@
 typedef __builtin_va_list Tundra_VaList;
 
 #define Tundra_varg_start(args, last) __builtin_va_start(args, last)
+#define Tundra_varg_copy(dst, src) __builtin_va_copy(dst, src)
 #define Tundra_varg_arg(args, type) __builtin_va_arg(args, type)
 #define Tundra_varg_end(args) __builtin_va_end(args)
 
@@ -1,6 +1,6 @@
 
-#ifndef TUNDRA_ARRAYCCharPtr128_H
-#define TUNDRA_DYNAMICARRAYCCharPtr128_H
+#ifndef TUNDRA_ARRAY128CCharPtr_H
+#define TUNDRA_ARRAY128CCharPtr_H
 
 #include "tundra/internal/MacroHelper.h"
 
@@ -11,4 +11,9 @@
 // Create specialization for the given type
 #include "tundra/internal/container_templates/Array.h"
 
-#endif // TUNDRA_ARRCCharPtr128_H
+// Clean up
+#undef TUNDRA_TYPE
+#undef TUNDRA_TYPENAME
+#undef TUNDRA_CAPACITY
+
+#endif // TUNDRA_ARRAY128CCharPtr_H
@@ -0,0 +1,19 @@
+
+#ifndef TUNDRA_ARRAY64U64_H
+#define TUNDRA_ARRAY64U64_H
+
+#include "tundra/internal/MacroHelper.h"
+
+#define TUNDRA_TYPE u64
+#define TUNDRA_TYPENAME U64
+#define TUNDRA_CAPACITY 64
+
+// Create specialization for the given type
+#include "tundra/internal/container_templates/Array.h"
+
+// Clean up
+#undef TUNDRA_TYPE
+#undef TUNDRA_TYPENAME
+#undef TUNDRA_CAPACITY
+
+#endif // TUNDRA_ARRAY64U64_H
@@ -0,0 +1,228 @@
+/**
+ * @file Bitset.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Dynamic set of bits packed into u64 words with word-level scans.
+ * @version 0.1
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef TUNDRA_BITSET_H
+#define TUNDRA_BITSET_H
+
+#include "tundra/common/TypeDef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Dynamic set of bits packed into u64 words.
+ *
+ * One bit of storage per flag instead of the byte a DynamicArrayU8 burns, and
+ * scans (count, find_first_set) walk 64 flags per word.
+ *
+ * Must be initialized using any of the `init` methods before use. Must be
+ * freed using the `free` method when no longer needed.
+ *
+ * Bits past `num_bits` in the last word are kept zero; the scan and count
+ * methods rely on this.
+ *
+ * Internals are read-only.
+ */
+typedef struct Tundra_Bitset
+{
+    // Heap allocated words holding the bits.
+    u64 *words;
+
+    // Number of indexable bits.
+    u64 num_bits;
+
+    // Number of allocated words.
+    u64 num_words;
+} Tundra_Bitset;
+
+/**
+ * @brief Initializes a Bitset holding `num_bits` bits, all cleared. Allocates
+ * memory and sets internal components.
+ *
+ * Only initialize a Bitset once. If an already initialized Bitset is called
+ * with init, undefined behavior may occur.
+ *
+ * @param set Bitset to init.
+ * @param num_bits Number of bits to hold.
+ */
+void Tundra_Bitset_init(Tundra_Bitset *set, u64 num_bits);
+
+/**
+ * @brief Initializes a Bitset by deep copying another Bitset.
+ *
+ * `src` must be an initialized Bitset, and `dst` must be uninitialized.
+ *
+ * @param dst Bitset to deep copy to, must be uninitialized.
+ * @param src Bitset to source from, must be initialized.
+ */
+void Tundra_Bitset_init_copy(Tundra_Bitset *dst, const Tundra_Bitset *src);
+
+/**
+ * @brief Frees memory allocated for an initialized Bitset.
+ *
+ * After calling this method, the Bitset must not be used unless
+ * reinitialized.
+ *
+ * @param set Initialized Bitset to free.
+ */
+void Tundra_Bitset_free(Tundra_Bitset *set);
+
+/**
+ * @brief Resizes the Bitset to hold `num_bits` bits, reallocating if more
+ * words are required. New bits are cleared; surviving bits keep their values.
+ *
+ * @param set Bitset to resize.
+ * @param num_bits Number of bits to hold.
+ */
+void Tundra_Bitset_resize(Tundra_Bitset *set, u64 num_bits);
+
+/**
+ * @brief Sets every bit in the Bitset.
+ *
+ * @param set Bitset to fill.
+ */
+void Tundra_Bitset_set_all(Tundra_Bitset *set);
+
+/**
+ * @brief Clears every bit in the Bitset.
+ *
+ * @param set Bitset to clear.
+ */
+void Tundra_Bitset_clear_all(Tundra_Bitset *set);
+
+/**
+ * @brief Returns the number of set bits, popcounting a word at a time.
+ *
+ * @param set Bitset to count.
+ *
+ * @return u64 Number of set bits.
+ */
+u64 Tundra_Bitset_count(const Tundra_Bitset *set);
+
+/**
+ * @brief Returns the index of the first set bit, scanning a word at a time.
+ *
+ * @param set Bitset to scan.
+ *
+ * @return i64 Index of the first set bit, or -1 if no bit is set.
+ */
+i64 Tundra_Bitset_find_first_set(const Tundra_Bitset *set);
+
+/**
+ * @brief Returns the index of the first clear bit, scanning a word at a time.
+ *
+ * @param set Bitset to scan.
+ *
+ * @return i64 Index of the first clear bit, or -1 if every bit is set.
+ */
+i64 Tundra_Bitset_find_first_clear(const Tundra_Bitset *set);
+
+/**
+ * @brief Ands the bits of `first` and `second` into `dst`.
+ *
+ * All three Bitsets must be initialized and hold the same number of bits;
+ * `dst` may alias either source.
+ *
+ * @param dst Bitset to write the result to.
+ * @param first First source Bitset.
+ * @param second Second source Bitset.
+ */
+void Tundra_Bitset_and(Tundra_Bitset *dst, const Tundra_Bitset *first,
+    const Tundra_Bitset *second);
+
+/**
+ * @brief Ors the bits of `first` and `second` into `dst`.
+ *
+ * All three Bitsets must be initialized and hold the same number of bits;
+ * `dst` may alias either source.
+ *
+ * @param dst Bitset to write the result to.
+ * @param first First source Bitset.
+ * @param second Second source Bitset.
+ */
+void Tundra_Bitset_or(Tundra_Bitset *dst, const Tundra_Bitset *first,
+    const Tundra_Bitset *second);
+
+/**
+ * @brief Xors the bits of `first` and `second` into `dst`.
+ *
+ * All three Bitsets must be initialized and hold the same number of bits;
+ * `dst` may alias either source.
+ *
+ * @param dst Bitset to write the result to.
+ * @param first First source Bitset.
+ * @param second Second source Bitset.
+ */
+void Tundra_Bitset_xor(Tundra_Bitset *dst, const Tundra_Bitset *first,
+    const Tundra_Bitset *second);
+
+/**
+ * @brief Sets the bit at `index`.
+ *
+ * @attention For fast access, this method does not perform a bounds check on
+ * `index`. It is the user's responsibility to ensure the index is valid.
+ *
+ * @param set Bitset to modify.
+ * @param index Index of the bit to set.
+ */
+static inline void Tundra_Bitset_set(Tundra_Bitset *set, u64 index)
+{
+    set->words[index / 64] |= 1ULL << (index % 64);
+}
+
+/**
+ * @brief Clears the bit at `index`.
+ *
+ * @attention For fast access, this method does not perform a bounds check on
+ * `index`. It is the user's responsibility to ensure the index is valid.
+ *
+ * @param set Bitset to modify.
+ * @param index Index of the bit to clear.
+ */
+static inline void Tundra_Bitset_clear(Tundra_Bitset *set, u64 index)
+{
+    set->words[index / 64] &= ~(1ULL << (index % 64));
+}
+
+/**
+ * @brief Returns true if the bit at `index` is set.
+ *
+ * @attention For fast access, this method does not perform a bounds check on
+ * `index`. It is the user's responsibility to ensure the index is valid.
+ *
+ * @param set Bitset to query.
+ * @param index Index of the bit to test.
+ *
+ * @return bool True if the bit is set.
+ */
+static inline bool Tundra_Bitset_test(const Tundra_Bitset *set, u64 index)
+{
+    return (set->words[index / 64] >> (index % 64)) & 1;
+}
+
+/**
+ * @brief Returns the number of indexable bits in the Bitset.
+ *
+ * @param set Bitset to query.
+ *
+ * @return u64 Number of bits.
+ */
+static inline u64 Tundra_Bitset_size(const Tundra_Bitset *set)
+{
+    return set->num_bits;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TUNDRA_BITSET_H
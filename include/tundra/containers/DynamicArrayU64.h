@@ -0,0 +1,30 @@
+
+#ifndef TUNDRA_DYNAMICARRAYU64_H
+#define TUNDRA_DYNAMICARRAYU64_H
+
+#include "tundra/internal/MacroHelper.h"
+
+// Type flags for the template 
+#define TUNDRA_NEEDS_CUSTOM_COPY 0
+#define TUNDRA_NEEDS_CUSTOM_FREE 0
+#define TUNDRA_NEEDS_CUSTOM_MOVE 0
+#define TUNDRA_NEEDS_CUSTOM_INIT 0
+#define TUNDRA_TYPE u64
+#define TUNDRA_TYPENAME U64
+
+// -----------------------------------------------------------------------------
+
+// Create specialization for the given type
+#include "tundra/internal/container_templates/DynamicArray.h"
+
+// Also emit the task-pool parallel reduction over the container.
+#include "tundra/internal/container_templates/ParallelReduce.h"
+
+// Clean up
+#undef TUNDRA_TYPE
+#undef TUNDRA_TYPENAME
+#undef TUNDRA_NEEDS_CUSTOM_COPY
+#undef TUNDRA_NEEDS_CUSTOM_FREE
+#undef TUNDRA_NEEDS_CUSTOM_MOVE
+#undef TUNDRA_NEEDS_CUSTOM_INIT
+#endif // TUNDRA_DYNAMICARRAYU64_H
@@ -13,9 +13,13 @@
 #define TUNDRA_TYPENAME U8
 
 // -----------------------------------------------------------------------------
+
 // Create specialization for the given type
 #include "tundra/internal/container_templates/DynamicArray.h"
 
+// Also emit the checked typed views over the container's bytes.
+#include "tundra/internal/container_templates/ByteViews.h"
+
 // Clean up
 #undef TUNDRA_TYPE
 #undef TUNDRA_TYPENAME
@@ -24,4 +28,3 @@
 #undef TUNDRA_NEEDS_CUSTOM_MOVE
 #undef TUNDRA_NEEDS_CUSTOM_INIT
 #endif // TUNDRA_DYNAMICARRAYU8_H
-
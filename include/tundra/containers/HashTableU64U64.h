@@ -0,0 +1,28 @@
+
+#ifndef TUNDRA_HASHTABLEU64U64_H
+#define TUNDRA_HASHTABLEU64U64_H
+
+#include "tundra/internal/MacroHelper.h"
+
+// Declares the hash function bound to TUNDRA_HASH_FUNC below, so the
+// wrapper stands alone no matter the include order.
+#include "tundra/common/Hash.h"
+
+#define TUNDRA_KEY u64
+#define TUNDRA_KEYNAME U64
+#define TUNDRA_VAL u64
+#define TUNDRA_VALNAME U64
+#define TUNDRA_HASH_FUNC Tundra_hash_u64
+
+// -----------------------------------------------------------------------------
+
+// Create specialization for the given types
+#include "tundra/internal/container_templates/HashTable.h"
+
+// Clean up
+#undef TUNDRA_KEY
+#undef TUNDRA_KEYNAME
+#undef TUNDRA_VAL
+#undef TUNDRA_VALNAME
+#undef TUNDRA_HASH_FUNC
+#endif // TUNDRA_HASHTABLEU64U64_H
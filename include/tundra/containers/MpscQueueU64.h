@@ -0,0 +1,18 @@
+
+#ifndef TUNDRA_MPSCQUEUEU64_H
+#define TUNDRA_MPSCQUEUEU64_H
+
+#include "tundra/internal/MacroHelper.h"
+
+#define TUNDRA_TYPE u64
+#define TUNDRA_TYPENAME U64
+
+// -----------------------------------------------------------------------------
+
+// Create specialization for the given type
+#include "tundra/internal/container_templates/MpscQueue.h"
+
+// Clean up
+#undef TUNDRA_TYPE
+#undef TUNDRA_TYPENAME
+#endif // TUNDRA_MPSCQUEUEU64_H
@@ -15,6 +15,10 @@
 
 #define TUNDRA_STR_DEF_CAP 4
 
+// Number of characters, including the null terminator, a String stores inside
+// the struct itself before spilling to the heap.
+#define TUNDRA_STR_SMALL_CAP 24
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,13 +27,18 @@ extern "C" {
 // Containers ------------------------------------------------------------------
 
 /**
- * @brief Automatic resizing container for procedurally adding characters to a 
+ * @brief Automatic resizing container for procedurally adding characters to a
  * null terminated array.
- * 
+ *
+ * Strings of fewer than `TUNDRA_STR_SMALL_CAP` characters live entirely in
+ * the inline `small` buffer with no heap allocation; `chars` points at it, so
+ * access methods never branch on where the characters live. Longer Strings
+ * spill to the heap as before.
  */
 typedef struct
 {
-    // Heap allocated array of characters. 
+    // Array of characters; points at `small` while the String fits inline,
+    // otherwise at a heap allocation.
     char *chars;
 
     // Number of characters in the String, including the null terminator.
@@ -38,6 +47,9 @@ typedef struct
     // Current maximum number of characters that the String can store before it
     // needs to be resized.
     u64 cap;
+
+    // Inline storage for short Strings.
+    char small[TUNDRA_STR_SMALL_CAP];
 } Tundra_String;
 
 
@@ -59,6 +71,22 @@ typedef struct
 
 
 
+/**
+ * @brief Iterator state for splitting a StringView on a delimiter character.
+ *
+ * Initialize with `Tundra_StrView_split_init`, then pull tokens with
+ * `Tundra_StrView_split_next`. Holds no resources, nothing to free.
+ */
+typedef struct
+{
+    const char *view; // Characters being split, not owned.
+    u64 num_char; // Number of characters in `view`.
+    u64 pos; // Index the next token starts at.
+    char delim; // Delimiter character to split on.
+    bool done; // True once every token has been yielded.
+} Tundra_StrViewSplitter;
+
+
 // Internal Methods ------------------------------------------------------------
 
 /**
@@ -251,6 +279,20 @@ void Tundra_Str_add(Tundra_String *str, char ch);
 void Tundra_Str_add_multiple(Tundra_String *str, const char *chars, 
     u64 num_char);
 
+/**
+ * @brief Appends formatted output to the String in a single sized pass.
+ *
+ * Supports the same format specifiers as `Tundra_printf`: %%, %c, %s, %u, %d,
+ * %x, %lu, %ld, %lx and %f. An upper bound on the expanded length is computed
+ * first so the String grows at most once, and each argument is converted
+ * directly into the String's tail with no intermediate buffer.
+ *
+ * @param str String to append to.
+ * @param format Format string.
+ * @param ... Arguments matching the format specifiers.
+ */
+void Tundra_Str_appendf(Tundra_String *str, const char *format, ...);
+
 /**
  * @brief Inserts a character at a position, shifting all elements ahead of 
  * it forward by one.
@@ -483,9 +525,173 @@ u64 Tundra_Str_capacity(const Tundra_String *str);
  * 
  * @return `Tundra_StringView` Constructed view. 
  */
-Tundra_StringView Tundra_Str_make_view(const Tundra_String *str, u64 index, 
+Tundra_StringView Tundra_Str_make_view(const Tundra_String *str, u64 index,
     u64 num_char);
 
+/**
+ * @brief Converts every ASCII uppercase letter in the String to lowercase,
+ * in place.
+ *
+ * Runs through the wide `Tundra_to_lower_mem` kernel; multibyte UTF-8 units
+ * pass through untouched.
+ *
+ * @param str String to convert.
+ */
+void Tundra_Str_to_lower(Tundra_String *str);
+
+/**
+ * @brief Converts every ASCII lowercase letter in the String to uppercase,
+ * in place.
+ *
+ * @param str String to convert.
+ */
+void Tundra_Str_to_upper(Tundra_String *str);
+
+/**
+ * @brief Returns true if both Strings hold the same characters.
+ *
+ * Lengths are checked first, so unequal-length Strings return without
+ * touching the characters; equal lengths compare 16 bytes at a time.
+ *
+ * @param first First String.
+ * @param second Second String.
+ *
+ * @return `bool` True if the Strings are character-for-character equal.
+ */
+bool Tundra_Str_eq(const Tundra_String *first, const Tundra_String *second);
+
+/**
+ * @brief Compares two Strings lexicographically, byte by byte as unsigned
+ * values.
+ *
+ * The shared prefix is compared 16 bytes at a time; if one String is a
+ * prefix of the other, the shorter orders first.
+ *
+ * @param first First String.
+ * @param second Second String.
+ *
+ * @return `i32` Negative if `first` orders below `second`, 0 if equal,
+ * positive if `first` orders above `second`.
+ */
+i32 Tundra_Str_compare(const Tundra_String *first,
+    const Tundra_String *second);
+
+/**
+ * @brief Returns true if both views hold the same characters.
+ *
+ * Same length-first wide compare as `Tundra_Str_eq`.
+ *
+ * @param first First view.
+ * @param second Second view.
+ *
+ * @return `bool` True if the views are character-for-character equal.
+ */
+bool Tundra_StrView_eq(const Tundra_StringView *first,
+    const Tundra_StringView *second);
+
+/**
+ * @brief Returns the index of the first occurrence of `c` in the String, or
+ * -1 if the String does not contain it.
+ *
+ * The scan runs 16 bytes at a time through `Tundra_find_byte`.
+ *
+ * @param str String to search.
+ * @param c Character to search for.
+ *
+ * @return `i64` Index of the first occurrence, or -1 if there is none.
+ */
+i64 Tundra_Str_find_char(const Tundra_String *str, char c);
+
+/**
+ * @brief Returns the index of the last occurrence of `c` in the String, or
+ * -1 if the String does not contain it.
+ *
+ * @param str String to search.
+ * @param c Character to search for.
+ *
+ * @return `i64` Index of the last occurrence, or -1 if there is none.
+ */
+i64 Tundra_Str_rfind_char(const Tundra_String *str, char c);
+
+/**
+ * @brief Returns the index of the first occurrence of the null terminated
+ * `cstr` inside the String, or -1 if it does not occur.
+ *
+ * An empty `cstr` matches at index 0.
+ *
+ * @param str String to search.
+ * @param cstr Null terminated substring to search for.
+ *
+ * @return `i64` Index of the first occurrence, or -1 if there is none.
+ */
+i64 Tundra_Str_find_cstr(const Tundra_String *str, const char *cstr);
+
+/**
+ * @brief Returns the index of the first occurrence of `c` in the view, or -1
+ * if the view does not contain it.
+ *
+ * @param view View to search.
+ * @param c Character to search for.
+ *
+ * @return `i64` Index of the first occurrence, or -1 if there is none.
+ */
+i64 Tundra_StrView_find_char(const Tundra_StringView *view, char c);
+
+/**
+ * @brief Returns the index of the last occurrence of `c` in the view, or -1
+ * if the view does not contain it.
+ *
+ * @param view View to search.
+ * @param c Character to search for.
+ *
+ * @return `i64` Index of the last occurrence, or -1 if there is none.
+ */
+i64 Tundra_StrView_rfind_char(const Tundra_StringView *view, char c);
+
+/**
+ * @brief Returns the index of the first occurrence of the null terminated
+ * `cstr` inside the view, or -1 if it does not occur.
+ *
+ * An empty `cstr` matches at index 0.
+ *
+ * @param view View to search.
+ * @param cstr Null terminated substring to search for.
+ *
+ * @return `i64` Index of the first occurrence, or -1 if there is none.
+ */
+i64 Tundra_StrView_find_cstr(const Tundra_StringView *view, const char *cstr);
+
+/**
+ * @brief Initializes a splitter that yields the tokens of `view` separated
+ * by `delim`.
+ *
+ * Tokens are sub-views into `view`, nothing is copied or allocated, so the
+ * tokens share `view`'s lifetime. Splitting follows the usual field rules:
+ * adjacent delimiters yield an empty token between them, as do delimiters at
+ * either end of the view, so a view with n delimiters always yields n + 1
+ * tokens.
+ *
+ * @param splitter Splitter to initialize.
+ * @param view View to split. Only the pointer and length are captured.
+ * @param delim Delimiter character to split on.
+ */
+void Tundra_StrView_split_init(Tundra_StrViewSplitter *splitter,
+    const Tundra_StringView *view, char delim);
+
+/**
+ * @brief Yields the next token of the split, returning false once every
+ * token has been yielded.
+ *
+ * The delimiter scan runs 16 bytes at a time through `Tundra_find_byte`.
+ *
+ * @param splitter Splitter to advance.
+ * @param token_output Receives the token, excluding the delimiter.
+ *
+ * @return `bool` True if a token was yielded.
+ */
+bool Tundra_StrView_split_next(Tundra_StrViewSplitter *splitter,
+    Tundra_StringView *token_output);
+
 #ifdef __cplusplus
 } // extern "C" 
 #endif
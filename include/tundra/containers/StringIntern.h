@@ -0,0 +1,168 @@
+/**
+ * @file StringIntern.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief String interning table mapping distinct strings to stable u32 ids.
+ * @version 0.1
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef TUNDRA_STRINGINTERN_H
+#define TUNDRA_STRINGINTERN_H
+
+#include "tundra/common/TypeDef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TUNDRA_STRINTERN_DEF_SLOT_CAP 64
+#define TUNDRA_STRINTERN_DEF_ARENA_CAP 1024
+
+/**
+ * Open hash of string payloads stored back to back in one bump arena.
+ *
+ * Each distinct string is stored exactly once and receives a stable u32 id
+ * (its insertion order). Ids never move or change, so two interned strings
+ * are equal exactly when their ids are equal — an integer compare replaces
+ * a character compare everywhere ids are used.
+ */
+typedef struct
+{
+    // Open addressed hash slots. Each slot holds id + 1, 0 marks an empty
+    // slot. Slots never hold payloads, so rehashing moves only u32s.
+    u32 *slots;
+
+    // Capacity of `slots`, always a power of 2.
+    u64 slot_cap;
+
+    // Byte offset of each id's payload inside the arena, indexed by id.
+    u64 *offsets;
+
+    // Capacity in entries of `offsets`.
+    u64 offset_cap;
+
+    // Number of distinct interned strings; the next id handed out.
+    u32 num_strs;
+
+    // Bump arena holding every payload: u32 char count, chars, null
+    // terminator.
+    u8 *arena;
+
+    // Bytes of the arena in use.
+    u64 arena_size;
+
+    // Byte capacity of the arena.
+    u64 arena_cap;
+
+} Tundra_StrIntern;
+
+
+// Public ----------------------------------------------------------------------
+
+/**
+ * @brief Initializes an intern table with default capacities.
+ *
+ * @param tbl Table to initialize.
+ */
+void Tundra_StrIntern_init(Tundra_StrIntern *tbl);
+
+/**
+ * @brief Initializes an intern table sized for an expected number of distinct
+ * strings and total payload bytes.
+ *
+ * Sizing up front avoids rehashes and arena growth during the fill phase.
+ * Either parameter may be 0 to use the default for that component.
+ *
+ * @param tbl Table to initialize.
+ * @param expected_strs Expected number of distinct strings.
+ * @param expected_bytes Expected total bytes across all distinct strings.
+ */
+void Tundra_StrIntern_init_cap(Tundra_StrIntern *tbl, u64 expected_strs,
+    u64 expected_bytes);
+
+/**
+ * @brief Interns a string, returning its stable id.
+ *
+ * If the string has been interned before, the existing id is returned and
+ * nothing is stored; otherwise the string is copied into the arena and a new
+ * id is minted.
+ *
+ * @param tbl Table to intern into.
+ * @param chars Characters of the string, need not be null terminated.
+ * @param num_char Number of characters.
+ *
+ * @return u32 Stable id of the string.
+ */
+u32 Tundra_StrIntern_add(Tundra_StrIntern *tbl, const char *chars,
+    u64 num_char);
+
+/**
+ * @brief Interns a null terminated string, returning its stable id.
+ *
+ * @param tbl Table to intern into.
+ * @param cstr Null terminated string.
+ *
+ * @return u32 Stable id of the string.
+ */
+u32 Tundra_StrIntern_add_cstr(Tundra_StrIntern *tbl, const char *cstr);
+
+/**
+ * @brief Looks up the id of a string without interning it.
+ *
+ * @param tbl Table to search.
+ * @param chars Characters of the string, need not be null terminated.
+ * @param num_char Number of characters.
+ *
+ * @return i64 Id of the string if interned, -1 if not present.
+ */
+i64 Tundra_StrIntern_find(const Tundra_StrIntern *tbl, const char *chars,
+    u64 num_char);
+
+/**
+ * @brief Returns the null terminated characters of an interned id.
+ *
+ * The returned pointer is stable for the life of the table.
+ *
+ * @param tbl Table to read from.
+ * @param id Id to resolve.
+ *
+ * @return const char* Null terminated characters of the id.
+ */
+const char* Tundra_StrIntern_get(const Tundra_StrIntern *tbl, u32 id);
+
+/**
+ * @brief Returns the character count of an interned id, excluding the null
+ * terminator.
+ *
+ * @param tbl Table to read from.
+ * @param id Id to resolve.
+ *
+ * @return u64 Number of characters.
+ */
+u64 Tundra_StrIntern_get_len(const Tundra_StrIntern *tbl, u32 id);
+
+/**
+ * @brief Returns the number of distinct interned strings.
+ *
+ * @param tbl Table to query.
+ *
+ * @return u32 Number of distinct strings.
+ */
+u32 Tundra_StrIntern_num_strs(const Tundra_StrIntern *tbl);
+
+/**
+ * @brief Frees the table's memory. All ids and character pointers are
+ * invalidated.
+ *
+ * @param tbl Table to free.
+ */
+void Tundra_StrIntern_free(Tundra_StrIntern *tbl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TUNDRA_STRINGINTERN_H
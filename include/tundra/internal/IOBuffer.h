@@ -13,29 +13,167 @@
 #define TUNDRA_IOBUFFER_H
 
 #include "tundra/internal/IOInterface.h"
-#include "tundra/containers/DynamicStackU8.h"
 #include "tundra/containers/DynamicArrayU8.h"
+#include "tundra/containers/String.h"
+#include "tundra/utils/Thread.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Default byte capacity for io buffers on interactive handles like the
+// console, where latency matters more than throughput.
+#define TUNDRA_IOBUFF_DEF_CAPACITY 128U
+
+// Default byte capacity for io buffers on file handles, sized so bulk
+// writers accumulate a meaningful amount of data per write syscall.
+#define TUNDRA_IOBUFF_FILE_CAPACITY (64U * 1024U)
+
+// Alignment and granularity O_DIRECT requires of buffers, offsets and write
+// lengths. One page covers every common logical block size.
+#define TUNDRA_IOBUFF_DIRECT_BLOCK_BYTES 4096U
+
+// Default number of buffers a prefetching reader keeps filled ahead of the
+// consumer.
+#define TUNDRA_IOBUFF_PREFETCH_DEF_BUFFERS 4U
+
+/**
+ * Background read-ahead state for one input buffer. A fill thread keeps a
+ * ring of slots read ahead of the consumer with positional reads, so a
+ * sequential reader drains completed slots instead of stalling on a
+ * synchronous refill. Single producer, single consumer.
+ */
+typedef struct
+{
+    InTundra_IOHandle handle;
+
+    // Ring of fill slots, slot s occupying
+    // [s * slot_capacity, (s + 1) * slot_capacity).
+    u8 *slots;
+    u64 slot_capacity;
+    u64 num_slots;
+
+    // Result of the read that filled each slot: bytes read, 0 at end of
+    // input, negative error. An end or error slot is never retired, so the
+    // consumer keeps seeing it like a raw read at a file's end.
+    i64 *slot_results;
+
+    // Free-running slot counters; the fill thread owns tail, the consumer
+    // owns head, and a counter's slot is counter % num_slots.
+    u64 head;
+    u64 tail;
+
+    // Bytes already consumed out of the head slot.
+    u64 head_consumed;
+
+    // File offset of the fill thread's next positional read.
+    u64 fill_offset;
+
+    // File offset of the next byte the consumer will receive; the handle's
+    // cursor is restored here when prefetching stops.
+    u64 consume_offset;
+
+    // Futex words bumped when a slot is filled / retired; waits snapshot
+    // them before re-checking the counters.
+    u32 filled_seq;
+    u32 consumed_seq;
+
+    u32 stop; // Set to halt the fill thread.
+
+    Tundra_Thread thread;
+} InTundra_IBuffPrefetcher;
+
+/**
+ * Transform applied to each batch of buffered output right before its raw
+ * write, letting bytes pass through a filter stage (compression, checksums)
+ * without an external process. Appends the transformed bytes to `out` and
+ * returns 0, or a negative error code to fail the write.
+ */
+typedef i64 (*InTundra_OBuffFilterFn)(const u8 *bytes, u64 num_bytes,
+    Tundra_DynamicArrayU8 *out, void *user_data);
+
 typedef struct
 {
     InTundra_IOHandle handle;
-    Tundra_DynamicStackU8 data;
+
+    // Flat refill buffer. Bytes [read_pos, end_pos) are buffered input that
+    // has not been consumed yet; draining is a cursor bump and refilling is
+    // one raw read into the front, so no byte is ever handled individually.
+    u8 *data;
+    u64 capacity; // Byte capacity of `data`.
+    u64 read_pos; // Index of the next unread byte.
+    u64 end_pos; // One past the last buffered byte.
+
+    // Background read-ahead ring refills are served from while prefetching,
+    // NULL for synchronous refills.
+    InTundra_IBuffPrefetcher *prefetcher;
 } InTundra_InputBuffer;
 
 typedef struct
 {
     InTundra_IOHandle handle;
+    u64 capacity; // Byte capacity accumulated before a flush.
+
+    // When true, a filled `data` buffer is swapped into `pending` instead of
+    // being written on the append path; the write syscall happens later in
+    // InTundra_OBuff_drain_pending or a blocking flush.
+    bool async_mode;
+
     Tundra_DynamicArrayU8 data;
+
+    // Retired full buffer awaiting a drain. Only initialized in async mode,
+    // and always holds bytes older than `data`.
+    Tundra_DynamicArrayU8 pending;
+
+    // When true the buffer is the flat block-aligned `direct_data` and every
+    // flush writes whole blocks, as O_DIRECT requires. `data` and `pending`
+    // are not initialized in this mode.
+    bool direct_mode;
+
+    u8 *direct_data; // Block-aligned backing memory, direct mode only.
+    u64 direct_size; // Bytes currently buffered, direct mode only.
+
+    // Bytes at the front of `direct_data` re-buffered from the zero-padded
+    // final block of the previous partial flush; the next flush rewrites
+    // that block in place.
+    u64 direct_carry;
+
+    // Total payload bytes accepted, used to trim the zero pad off the file's
+    // tail when it is closed.
+    u64 direct_tot_bytes;
+
+    // Filter stage every flushed batch passes through before its raw write,
+    // NULL for plain writes.
+    InTundra_OBuffFilterFn filter;
+    void *filter_user_data;
+
+    // Scratch the filter transforms into. Only initialized while a filter is
+    // set.
+    Tundra_DynamicArrayU8 filter_out;
 } InTundra_OutputBuffer;
 
-void InTundra_IBuff_init(InTundra_InputBuffer *buff, InTundra_IOHandle handle);
+void InTundra_IBuff_init(InTundra_InputBuffer *buff, InTundra_IOHandle handle,
+    u64 capacity);
 
-void InTundra_OBuff_init(InTundra_OutputBuffer *buff, 
-    InTundra_IOHandle handle);
+void InTundra_OBuff_init(InTundra_OutputBuffer *buff,
+    InTundra_IOHandle handle, u64 capacity);
+
+/**
+ * @brief Initializes an output buffer for an O_DIRECT handle.
+ *
+ * The backing memory is block aligned and `capacity` is rounded up to a
+ * whole number of blocks, so flushes satisfy O_DIRECT's buffer, offset and
+ * length alignment rules. A flush with a partial final block zero-pads it,
+ * then seeks back and re-buffers the partial bytes so the next flush
+ * rewrites the block with real data; the file layer trims the pad off the
+ * file tail on close. Writes must be sequential from the start of the file.
+ *
+ * @param buff Buffer to initialize.
+ * @param handle Handle the buffer writes to.
+ * @param capacity Byte capacity, rounded up to a block multiple.
+ */
+void InTundra_OBuff_init_direct(InTundra_OutputBuffer *buff,
+    InTundra_IOHandle handle, u64 capacity);
 
 void InTundra_IBuff_free(InTundra_InputBuffer *buff);
 
@@ -64,8 +202,26 @@ i64 InTundra_OBuff_write_i8(InTundra_OutputBuffer *buff, i8 num);
 
 i64 InTundra_OBuff_write_float(InTundra_OutputBuffer *buff, float num);
 
-void InTundra_IBuff_readin_bytes(InTundra_InputBuffer *buff, u8 *bytes, 
-    u64 num_bytes, i64 *read_result_output); 
+void InTundra_IBuff_readin_bytes(InTundra_InputBuffer *buff, u8 *bytes,
+    u64 num_bytes, i64 *read_result_output);
+
+/**
+ * @brief Reads the next newline-terminated line, returning a zero-copy view
+ * into the input buffer.
+ *
+ * The newline is scanned 8 bytes at a time. The view excludes the newline and
+ * stays valid only until the next read on this buffer; a line that straddles
+ * a refill is compacted to the buffer front so the view remains contiguous.
+ * Lines longer than the buffer capacity fail with `-TUNDRA_ERR_NOMEM`.
+ *
+ * @param buff Buffer to read from.
+ * @param view_output Receives the view of the line, excluding the newline.
+ *
+ * @return `i64` Number of bytes consumed (line plus newline) if non negative,
+ * -1 at end of input, otherwise an error code.
+ */
+i64 InTundra_IBuff_readin_line(InTundra_InputBuffer *buff,
+    Tundra_StringView *view_output);
 
 char InTundra_IBuff_readin_char(InTundra_InputBuffer *buff, 
     i64 *read_result_output);
@@ -94,11 +250,108 @@ u8 InTundra_IBuff_readin_u8(InTundra_InputBuffer *buff,
 i8 InTundra_IBuff_readin_i8(InTundra_InputBuffer *buff, 
     i64 *read_result_output);
 
-float InTundra_IBuff_readin_float(InTundra_InputBuffer *buff, 
+float InTundra_IBuff_readin_float(InTundra_InputBuffer *buff,
     i64 *read_result_output);
 
+/**
+ * @brief Reads up to `max_elems` whitespace-separated u64s into `output`,
+ * accumulating digits straight out of the buffered spans. If the return is
+ * negative, it's an error code. Otherwise it is the number of elements
+ * parsed, which stops short at the end of input.
+ *
+ * @param buff Buffer to read from.
+ * @param output Receives the parsed values.
+ * @param max_elems Capacity of `output`.
+ * @param num_bytes_output Receives the number of bytes consumed. Pass as
+ * `NULL` to discard.
+ *
+ * @return `i64` Number of elements parsed if the return is non negative,
+ * otherwise it is an error code.
+ */
+i64 InTundra_IBuff_readin_u64_array(InTundra_InputBuffer *buff, u64 *output,
+    u64 max_elems, u64 *num_bytes_output);
+
 i64 InTundra_OBuff_flush(InTundra_OutputBuffer *buff);
 
+/**
+ * @brief Enables or disables double-buffered async mode on an output buffer.
+ *
+ * In async mode a filled buffer is retired to a pending slot and appending
+ * continues into a fresh buffer, keeping write syscalls off the append path.
+ * The caller drains retired buffers at a point of its choosing with
+ * `InTundra_OBuff_drain_pending`; a blocking flush still drains everything.
+ * Disabling drains any pending bytes first.
+ *
+ * @param buff Buffer to configure.
+ * @param enable True to enable async mode.
+ *
+ * @return `i64` 0 or bytes drained on success, otherwise an error code.
+ */
+i64 InTundra_OBuff_set_async(InTundra_OutputBuffer *buff, bool enable);
+
+/**
+ * @brief Installs or removes the buffer's filter stage, flushing buffered
+ * bytes through the previous configuration first so filter boundaries stay
+ * clean.
+ *
+ * While a filter is set every batch of buffered bytes is handed to it right
+ * before the raw write and the transformed bytes go to the handle instead.
+ * Write methods keep returning payload byte counts, not transformed counts.
+ * Direct mode rewrites partial blocks in place, which a transform cannot
+ * reproduce, so the two modes don't combine.
+ *
+ * @param buff Buffer to configure.
+ * @param filter Filter to install, NULL to remove the current one.
+ * @param user_data Opaque pointer handed to every filter call.
+ *
+ * @return `i64` 0 or bytes flushed on success, otherwise an error code.
+ */
+i64 InTundra_OBuff_set_filter(InTundra_OutputBuffer *buff,
+    InTundra_OBuffFilterFn filter, void *user_data);
+
+/**
+ * @brief Starts background read-ahead on an input buffer: a fill thread
+ * keeps `num_slots` buffers of the buffer's capacity read ahead with
+ * positional reads, and refills drain completed slots without blocking on
+ * the device.
+ *
+ * The handle's cursor is not moved while prefetching; stopping restores it
+ * to the consumer's position. Intended for sequential consumption of
+ * seekable handles. Bytes appended to the file after the fill thread
+ * observes the end of input are not seen until prefetching restarts.
+ *
+ * @param buff Buffer to prefetch for.
+ * @param num_slots Number of read-ahead slots, 0 for the default.
+ * @param fill_offset File offset the fill thread starts reading at.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 InTundra_IBuff_start_prefetch(InTundra_InputBuffer *buff, u64 num_slots,
+    u64 fill_offset);
+
+/**
+ * @brief Stops background read-ahead: joins the fill thread, discards
+ * unconsumed read-ahead and seeks the handle back to the consumer's
+ * position so synchronous refills continue seamlessly.
+ *
+ * No-op when the buffer is not prefetching.
+ *
+ * @param buff Buffer to stop prefetching for.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 InTundra_IBuff_stop_prefetch(InTundra_InputBuffer *buff);
+
+/**
+ * @brief Writes out the retired pending buffer, if any. Returns the number of
+ * bytes written, or an error code if negative.
+ *
+ * @param buff Buffer to drain.
+ *
+ * @return `i64` Bytes written if non negative, otherwise an error code.
+ */
+i64 InTundra_OBuff_drain_pending(InTundra_OutputBuffer *buff);
+
 i64 InTundra_IBuff_peek(InTundra_InputBuffer *buff);
 
 u64 InTundra_OBuff_size(InTundra_OutputBuffer *buff);
@@ -49,9 +49,17 @@ typedef i64 InTundra_IOHandle;
 #define TUNDRA_LINUX_FILEOPENFLAG_TRUNC 512 
 
 // Append to the file's contents if it exists.
-#define TUNDRA_LINUX_FILEOPENFLAG_APPEND 1024 
+#define TUNDRA_LINUX_FILEOPENFLAG_APPEND 1024
 
 
+// One segment of a vectored write. Field layout matches the kernel's iovec,
+// so an array of these is handed straight to the writev syscall.
+typedef struct
+{
+    const void *bytes;
+    u64 num_bytes;
+} Tundra_IOVec;
+
 /**
  * @brief Writes a set number of bytes to the specified handle.  
  * If the return is negative, it's an error code. Otherwise it is
@@ -64,9 +72,24 @@ typedef i64 InTundra_IOHandle;
  * @return `i64` Number of bytes written if the return is non negative, otherwise 
  * it is an error code. 
  */
-i64 InTundra_raw_write_bytes(InTundra_IOHandle handle, const void *bytes, 
+i64 InTundra_raw_write_bytes(InTundra_IOHandle handle, const void *bytes,
     i64 num_bytes);
 
+/**
+ * @brief Writes several memory segments to the specified handle in one
+ * syscall. If the return is negative, it's an error code. Otherwise it is the
+ * total number of bytes successfully written across all segments.
+ *
+ * @param handle Handle to write to.
+ * @param vecs Segments to write, in order.
+ * @param num_vecs Number of segments.
+ *
+ * @return `i64` Total bytes written if the return is non negative, otherwise
+ * it is an error code.
+ */
+i64 InTundra_raw_writev(InTundra_IOHandle handle, const Tundra_IOVec *vecs,
+    i64 num_vecs);
+
 /**
  * @brief Writes a u64 to the specified handle. If the return is negative, it's 
  * an error code. Otherwise it is the number of bytes successfully written.
@@ -119,9 +142,96 @@ i64 InTundra_vargs_raw_writef(InTundra_IOHandle handle, const char *format,
  * @return `i64` Number of bytes read if the return is non negative, otherwise it 
  * is an error code. 
  */
-i64 InTundra_raw_read_bytes(InTundra_IOHandle handle, void *output, 
+i64 InTundra_raw_read_bytes(InTundra_IOHandle handle, void *output,
     i64 num_bytes);
 
+/**
+ * @brief Reads a set number of bytes from the specified handle at an absolute
+ * byte offset, without moving the handle's cursor. If the return is negative,
+ * it's an error code. Otherwise it is the number of bytes successfully read.
+ *
+ * @param handle Handle to read from.
+ * @param output Pointer to the memory to read into.
+ * @param num_bytes Number of bytes to read.
+ * @param offset Absolute byte offset to read from.
+ *
+ * @return `i64` Number of bytes read if the return is non negative, otherwise
+ * it is an error code.
+ */
+i64 InTundra_raw_pread_bytes(InTundra_IOHandle handle, void *output,
+    i64 num_bytes, i64 offset);
+
+/**
+ * @brief Writes a set number of bytes to the specified handle at an absolute
+ * byte offset, without moving the handle's cursor. If the return is negative,
+ * it's an error code. Otherwise it is the number of bytes successfully
+ * written.
+ *
+ * @param handle Handle to write to.
+ * @param bytes Pointer to the bytes to write.
+ * @param num_bytes Number of bytes to write.
+ * @param offset Absolute byte offset to write at.
+ *
+ * @return `i64` Number of bytes written if the return is non negative,
+ * otherwise it is an error code.
+ */
+i64 InTundra_raw_pwrite_bytes(InTundra_IOHandle handle, const void *bytes,
+    i64 num_bytes, i64 offset);
+
+/**
+ * @brief Copies bytes between two handles without the data entering
+ * userspace. If the return is negative, it's an error code. Otherwise it is
+ * the number of bytes the kernel copied, which may be short.
+ *
+ * Both offsets are advanced by the number of bytes copied; neither handle's
+ * cursor moves. Fails with `-TUNDRA_LINUX_ERR_CROSSDEV` when the handles live
+ * on different filesystems.
+ *
+ * @param in_handle Handle to copy from.
+ * @param in_offset Absolute byte offset to copy from, advanced by the copy.
+ * @param out_handle Handle to copy to.
+ * @param out_offset Absolute byte offset to copy to, advanced by the copy.
+ * @param num_bytes Number of bytes to copy.
+ *
+ * @return `i64` Number of bytes copied if the return is non negative,
+ * otherwise it is an error code.
+ */
+i64 InTundra_raw_copy_file_range(InTundra_IOHandle in_handle, i64 *in_offset,
+    InTundra_IOHandle out_handle, i64 *out_offset, u64 num_bytes);
+
+/**
+ * @brief Copies bytes from `in_handle` to `out_handle`'s cursor position
+ * without the data entering userspace. If the return is negative, it's an
+ * error code. Otherwise it is the number of bytes copied, which may be short.
+ *
+ * Works across filesystems, unlike `InTundra_raw_copy_file_range`.
+ *
+ * @param out_handle Handle to write to, at its current cursor.
+ * @param in_handle Handle to copy from.
+ * @param in_offset Absolute byte offset to copy from, advanced by the copy.
+ * @param num_bytes Number of bytes to copy.
+ *
+ * @return `i64` Number of bytes copied if the return is non negative,
+ * otherwise it is an error code.
+ */
+i64 InTundra_raw_sendfile(InTundra_IOHandle out_handle,
+    InTundra_IOHandle in_handle, i64 *in_offset, u64 num_bytes);
+
+/**
+ * @brief Passes an access-pattern hint for a byte range of a handle to the
+ * kernel via fadvise. If the return is negative, it's an error code.
+ *
+ * @param handle Handle to advise on.
+ * @param offset Absolute byte offset the hint starts at.
+ * @param num_bytes Length of the hinted range, 0 for everything from
+ * `offset` on.
+ * @param advice Kernel advice value.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 InTundra_raw_fadvise(InTundra_IOHandle handle, i64 offset, i64 num_bytes,
+    i64 advice);
+
 #else // TUNDRA_SYS_x86_64
 #error Not Implemented
 #endif // TUNDRA_SYS_x86_64
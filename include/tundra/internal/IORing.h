@@ -0,0 +1,178 @@
+/**
+ * @file IORing.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief io_uring backed submission/completion queues for keeping many
+ * reads and writes in flight at once.
+ * @version 0.1
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef TUNDRA_IORING_H
+#define TUNDRA_IORING_H
+
+#include "tundra/common/SystemInfo.h"
+#include "tundra/common/TypeDef.h"
+#include "tundra/internal/IOInterface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef TUNDRA_PLATFORM_LINUX
+
+#ifdef TUNDRA_SYS_x86_64
+
+// One finished operation drained from the completion queue.
+typedef struct
+{
+    // Tag the operation was queued with.
+    u64 user_data;
+
+    // Bytes transferred if non negative, otherwise an error code.
+    i64 result;
+} InTundra_IORingCompletion;
+
+/**
+ * @brief One io_uring instance: the ring handle plus the kernel-shared
+ * submission and completion rings mapped into the process.
+ *
+ * Operations are staged with the queue methods, handed to the kernel in one
+ * syscall with `InTundra_IORing_submit`, and drained with
+ * `InTundra_IORing_drain`. Not thread safe; one ring per owner.
+ */
+typedef struct
+{
+    InTundra_IOHandle handle;
+
+    // Number of submission slots the ring was created with.
+    u32 sq_capacity;
+
+    // Operations staged since the last submit.
+    u32 num_staged;
+
+    // Mapped ring memory, retained for unmapping.
+    u8 *sq_ring;
+    u64 sq_ring_bytes;
+    u8 *cq_ring;
+    u64 cq_ring_bytes;
+    u8 *sqes;
+    u64 sqes_bytes;
+
+    // Pointers resolved into the shared rings.
+    u32 *sq_head;
+    u32 *sq_tail;
+    u32 *sq_mask;
+    u32 *sq_array;
+    u32 *cq_head;
+    u32 *cq_tail;
+    u32 *cq_mask;
+    u8 *cqes;
+} InTundra_IORing;
+
+/**
+ * @brief Creates an io_uring instance with at least `num_entries` submission
+ * slots and maps its rings. If the return is negative, it's an error code.
+ *
+ * @param ring Ring to initialize.
+ * @param num_entries Submission slots to request, rounded up to a power of
+ * two by the kernel.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 InTundra_IORing_init(InTundra_IORing *ring, u32 num_entries);
+
+/**
+ * @brief Unmaps a ring's shared memory and closes its handle. Any operations
+ * still in flight are abandoned.
+ *
+ * @param ring Ring to free.
+ */
+void InTundra_IORing_free(InTundra_IORing *ring);
+
+/**
+ * @brief Stages a read of `num_bytes` into `output` from an absolute byte
+ * offset of `handle`. Nothing reaches the kernel until
+ * `InTundra_IORing_submit`. If the return is negative, it's an error code;
+ * `-TUNDRA_ERR_AGAIN` means the submission queue is full and a submit is
+ * needed first.
+ *
+ * @param ring Ring to stage on.
+ * @param handle Handle to read from.
+ * @param output Memory to read into; must stay valid until completion.
+ * @param num_bytes Number of bytes to read.
+ * @param offset Absolute byte offset to read from, -1 for the handle's
+ * cursor.
+ * @param user_data Tag returned with this operation's completion.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 InTundra_IORing_queue_read(InTundra_IORing *ring, InTundra_IOHandle handle,
+    void *output, u64 num_bytes, i64 offset, u64 user_data);
+
+/**
+ * @brief Stages a write of `num_bytes` from `bytes` to an absolute byte
+ * offset of `handle`. Nothing reaches the kernel until
+ * `InTundra_IORing_submit`. If the return is negative, it's an error code;
+ * `-TUNDRA_ERR_AGAIN` means the submission queue is full and a submit is
+ * needed first.
+ *
+ * @param ring Ring to stage on.
+ * @param handle Handle to write to.
+ * @param bytes Bytes to write; must stay valid until completion.
+ * @param num_bytes Number of bytes to write.
+ * @param offset Absolute byte offset to write at, -1 for the handle's
+ * cursor.
+ * @param user_data Tag returned with this operation's completion.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 InTundra_IORing_queue_write(InTundra_IORing *ring,
+    InTundra_IOHandle handle, const void *bytes, u64 num_bytes, i64 offset,
+    u64 user_data);
+
+/**
+ * @brief Hands every staged operation to the kernel in one syscall. If the
+ * return is negative, it's an error code. Otherwise it is the number of
+ * operations submitted.
+ *
+ * @param ring Ring to submit.
+ *
+ * @return `i64` Number of operations submitted if the return is non
+ * negative, otherwise it is an error code.
+ */
+i64 InTundra_IORing_submit(InTundra_IORing *ring);
+
+/**
+ * @brief Drains finished operations from the completion queue into
+ * `completions_output`, blocking until at least `min_completions` are
+ * available. Pass 0 to poll without blocking. If the return is negative,
+ * it's an error code. Otherwise it is the number of completions drained.
+ *
+ * @param ring Ring to drain.
+ * @param completions_output Receives the drained completions.
+ * @param max_completions Capacity of `completions_output`.
+ * @param min_completions Completions to block for, 0 to poll.
+ *
+ * @return `i64` Number of completions drained if the return is non negative,
+ * otherwise it is an error code.
+ */
+i64 InTundra_IORing_drain(InTundra_IORing *ring,
+    InTundra_IORingCompletion *completions_output, u64 max_completions,
+    u64 min_completions);
+
+#else // TUNDRA_SYS_x86_64
+#error Not Implemented
+#endif // TUNDRA_SYS_x86_64
+
+#else // TUNDRA_PLATFORM_LINUX
+#error Not Implemented
+#endif // TUNDRA_PLATFORM_LINUX
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -16,6 +16,7 @@ extern "C" {
 #endif // __cplusplus
 
 #include "tundra/common/TypeDef.h"
+#include "tundra/utils/MemAlloc.h"
 
 /**
  * @brief The large memory allocator functions differently than the small one. 
@@ -62,6 +63,114 @@ void InTundra_LgMemAlc_free(void *ptr);
  */
 void* InTundra_LgMemAlc_malloc(u64 num_bytes);
 
+/**
+ * @brief Allocates zero-initialized memory, returning a pointer to the usable
+ * memory.
+ *
+ * Fresh blocks come from the os already zeroed and are returned without
+ * touching the payload; only blocks recycled from the freed-block cache are
+ * cleared.
+ *
+ * @param num_bytes Number of bytes to allocate.
+ *
+ * @return void* Pointer to the zeroed usable memory, with at least
+ * `num_bytes` addressable bytes.
+ */
+void* InTundra_LgMemAlc_malloc_zeroed(u64 num_bytes);
+
+/**
+ * @brief Returns the usable byte size of a block allocated by the large
+ * allocator.
+ *
+ * Since allocations are rounded up to increments of the os alloc alignment,
+ * this may be larger than the byte size originally requested.
+ *
+ * @param ptr Pointer to memory allocated by the large allocator.
+ *
+ * @return u64 Usable size in bytes.
+ */
+u64 InTundra_LgMemAlc_usable_size(void *ptr);
+
+/**
+ * @brief Sets the runtime limits of the freed-block cache.
+ *
+ * Blocks larger than `max_block_bytes` (clamped to the compile-time cache
+ * bound, currently 2 MiB) skip the cache, as do frees once a block size
+ * already holds `max_blocks_per_size` entries. Cached blocks the tightened
+ * limits no longer allow are released to the os immediately. Passing 0 for
+ * either limit disables caching.
+ *
+ * @param max_block_bytes Largest block byte size allowed into the cache.
+ * @param max_blocks_per_size Most cached entries allowed per block size.
+ */
+void InTundra_LgMemAlc_set_cache_limits(u64 max_block_bytes,
+    u8 max_blocks_per_size);
+
+/**
+ * @brief Sets the guarded allocation sampling rate: one in every `rate`
+ * large allocations is placed against a trailing PROT_NONE guard page, so
+ * an overrun of it traps at the faulting instruction instead of silently
+ * corrupting memory.
+ *
+ * Guarded blocks cost one extra page plus up to a page of payload rounding,
+ * skip the freed-block cache and forgo huge pages, so the aggregate
+ * overhead scales with 1/rate and is negligible at rates in the thousands.
+ * Passing 0 (the default) disables sampling.
+ *
+ * @param rate Sampling rate, every `rate`-th allocation is guarded.
+ */
+void InTundra_LgMemAlc_set_guard_rate(u64 rate);
+
+/**
+ * @brief Tells the os the payload pages of every cached block are unneeded,
+ * dropping them from resident memory while keeping the blocks reusable.
+ *
+ * Useful after a burst of large frees: reuse still skips the mmap syscall,
+ * but cold cached blocks stop holding physical memory.
+ */
+void InTundra_LgMemAlc_trim_cache(void);
+
+/**
+ * @brief Fills the large allocator fields of a stats snapshot.
+ *
+ * Counter reads are relaxed, so the snapshot is best effort while other
+ * threads allocate. Only the large_* fields are written.
+ *
+ * @param stats_out Stats struct whose large allocator fields are filled.
+ */
+void InTundra_LgMemAlc_gather_stats(Tundra_MemStats *stats_out);
+
+/**
+ * @brief Allocates memory whose payload address is aligned to `alignment`.
+ *
+ * The payload is pushed forward inside an over-allocated block to the first
+ * aligned address, with the header placed right before it so the returned
+ * pointer is freed like any other large allocation.
+ *
+ * @param num_bytes Number of bytes to allocate.
+ * @param alignment Required payload alignment, must be a power of two greater
+ * than TUNDRA_MEM_ALIGNMENT.
+ *
+ * @return void* Pointer to the aligned usable memory.
+ */
+void* InTundra_LgMemAlc_malloc_aligned(u64 num_bytes, u64 alignment);
+
+/**
+ * @brief Allocates memory whose pages are placed on a numa node, best
+ * effort.
+ *
+ * The block is always fresh from the os and bound before any byte of it is
+ * touched, so every page faults in on `node`. The payload is pushed to a
+ * page boundary, which keeps a freed node-bound block out of the shared
+ * block cache where another socket's thread could recycle it.
+ *
+ * @param num_bytes Number of bytes to allocate.
+ * @param node Numa node the block's pages should live on.
+ *
+ * @return void* Pointer to the usable memory, page aligned.
+ */
+void* InTundra_LgMemAlc_malloc_on_node(u64 num_bytes, u32 node);
+
 #ifdef __cplusplus
 }   
 #endif // __cplusplus
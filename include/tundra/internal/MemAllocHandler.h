@@ -19,10 +19,13 @@ extern "C" {
 // Alignment for memory alignment inside of fetched chunks from the os.
 #define TUNDRA_MEM_ALIGNMENT (short)16
 
-// Required alignment of byte sizes when allocing from the os. This value must 
+// Required alignment of byte sizes when allocing from the os. This value must
 // be a power of 2.
 #define TUNDRA_OS_ALLOC_ALIGNMENT (u32)4096
 
+// Byte size of one huge page (2 MiB).
+#define TUNDRA_HUGE_PAGE_BYTE_SIZE (1ULL << 21)
+
 // typedef struct __attribute__((aligned(TUNDRA_MEM_ALIGNMENT))) 
 //     InTundra_SystemMemData
 // {
@@ -39,10 +42,46 @@ void InTundra_Mem_free(void *ptr);
 
 void* InTundra_Mem_malloc(u64 num_bytes);
 
+void* InTundra_Mem_malloc_aligned(u64 num_bytes, u64 alignment);
+
+void* InTundra_Mem_malloc_on_node(u64 num_bytes, u32 node);
+
+void* InTundra_Mem_malloc_zeroed(u64 num_bytes);
+
+void* InTundra_Mem_realloc(void *ptr, u64 num_bytes);
+
 void InTundra_Mem_release_mem_to_os(void *ptr, u64 num_bytes);
 
 void *InTundra_Mem_get_mem_from_os(u64 num_bytes);
 
+void *InTundra_Mem_get_huge_mem_from_os(u64 num_bytes);
+
+void InTundra_Mem_advise_mem_unneeded(void *ptr, u64 num_bytes);
+
+void InTundra_Mem_bind_mem_to_node(void *ptr, u64 num_bytes, u32 node);
+
+/**
+ * @brief Revokes all access to a page range, so any touch of it traps.
+ *
+ * Best effort: a refused mprotect leaves the range accessible. The pages
+ * regain normal access only by being unmapped and remapped.
+ *
+ * @param ptr Page-aligned start of the range.
+ * @param num_bytes Length of the range, a page multiple.
+ */
+void InTundra_Mem_protect_mem_none(void *ptr, u64 num_bytes);
+
+/**
+ * @brief Writes a report of live allocations to an io handle.
+ *
+ * Tracking is compiled in with TUNDRA_TRACK_ALLOCS; without it this writes a
+ * notice that tracking is disabled. With TUNDRA_TRACK_ALLOC_SITES defined as
+ * well, sampled allocation call sites are appended to the report.
+ *
+ * @param handle Io handle the report is written to.
+ */
+void InTundra_Mem_dump_alloc_stats(i64 handle);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -20,12 +20,22 @@ extern "C" {
 #include "tundra/internal/MemAllocHandler.h"
 #include "tundra/internal/MacroHelper.h"
 #include "tundra/common/Core.h"
+#include "tundra/utils/MemAlloc.h"
 
 
 /**
- * The small memory allocator uses a single allocated memory arena, and carves 
- * out chunks of it in specified "buckets". These buckets are then reused when
- * no longer needed. We represent bucket sizes as "size class"s. We have a 
+ * The small memory allocator uses a chain of allocated memory arenas, and
+ * carves out chunks of them in specified "buckets". These buckets are then
+ * reused when no longer needed. When every arena in the chain is exhausted, a
+ * new OS-backed arena is linked onto the chain so allocation never hard fails
+ * at a fixed arena size.
+ *
+ * Each thread owns its own arena chain, created lazily on its first small
+ * allocation, so the malloc hot path never takes a lock. Every arena is also
+ * linked into a global registry; a free from a thread that does not own the
+ * block's arena pushes the block onto the owning arena's remote free list
+ * with an atomic exchange, and the owning thread drains that list back into
+ * its bins during later allocations. We represent bucket sizes as "size class"s. We have a 
  * minimum size class, which means a chunk of a smaller size than that min size
  * class cannot be carved from the arena. This is for memory alignment purposes.
  * If a user requests to allocate memory larger than the maximum size class, the 
@@ -71,14 +81,34 @@ typedef struct TUNDRA_CMPDIR_ALIGN(TUNDRA_MEM_ALIGNMENT)
 #define BLOCK_HEADER_SIZE sizeof(BlockHeader)
 
 
-typedef struct 
+typedef struct MemArena
 {
     u8 *base_ptr; // Pointer to the arena's allocated memory start.
     u64 used_bytes; // Number of bytes currently used of the arena.
     u64 total_size_bytes; // Total size in bytes the arena holds.
 
+    // Next arena in the chain, NULL if this is the last arena. Additional
+    // arenas are linked when the existing ones are exhausted.
+    struct MemArena *next_arena;
+
+    // Head arena of the chain this arena belongs to. Each thread owns one
+    // chain, so this doubles as the owning thread's identity.
+    struct MemArena *owner_head;
+
+    // Next arena in the global cross-thread registry, which exists so frees
+    // and ownership checks from foreign threads can find any arena.
+    struct MemArena *next_registered;
+
+    // Blocks freed by threads that do not own this arena. Pushed with atomic
+    // exchanges and drained into `freed_bins` by the owning thread.
+    FreedBlock *remote_freed;
+
     // Array of linked lists holding freed blocks of each size class.
     FreedBlock *freed_bins[TUNDRA_EXPAND(TUNDRA_NUM_SIZE_CLASSES)];
+
+    // Number of blocks sitting in each freed bin, maintained by the owning
+    // thread and read racily by stats gathering.
+    u32 freed_bin_counts[TUNDRA_EXPAND(TUNDRA_NUM_SIZE_CLASSES)];
 } MemArena;
 
 /**
@@ -96,8 +126,8 @@ void InTundra_SmlMemAlc_init(void);
 void InTundra_SmlMemAlc_shutdown(void);
 
 /**
- * @brief Returns true if the passed pointer is within the address range of 
- * the internal memory arena.
+ * @brief Returns true if the passed pointer is within the address range of
+ * any arena in the internal arena chain.
  * 
  * @param ptr Pointer address to check.
  * 
@@ -139,7 +169,45 @@ void InTundra_SmlMemAlc_free(void *ptr);
  */
 void* InTundra_SmlMemAlc_malloc(u64 num_bytes);
 
-const MemArena * get_mem_arena_instance(void);
+/**
+ * @brief Allocates memory whose payload address is aligned to `alignment`,
+ * carving it from the arena like a regular allocation.
+ *
+ * The block is over-allocated and re-carved so the aligned payload has its own
+ * header, meaning the returned pointer is freed like any other small
+ * allocation. The cut-off front pad is binned as a reusable freed block.
+ *
+ * @param num_bytes Number of bytes to allocate.
+ * @param alignment Required payload alignment, must be a power of two greater
+ * than TUNDRA_MEM_ALIGNMENT.
+ *
+ * @return void* Pointer to the aligned usable memory.
+ */
+void* InTundra_SmlMemAlc_malloc_aligned(u64 num_bytes, u64 alignment);
+
+/**
+ * @brief Returns the usable payload byte size of a block allocated by the
+ * small allocator.
+ *
+ * Because requests are rounded up to a size class (and coalescing can leave
+ * extra slack), this may be larger than the byte size originally requested.
+ *
+ * @param ptr Pointer to memory allocated by the small allocator.
+ *
+ * @return u64 Usable payload size in bytes.
+ */
+u64 InTundra_SmlMemAlc_usable_size(void *ptr);
+
+/**
+ * @brief Fills the small allocator fields of a stats snapshot by walking the
+ * global arena registry.
+ *
+ * Arenas owned by other threads are read without synchronization, so the
+ * snapshot is best effort. Only the small_* fields are written.
+ *
+ * @param stats_out Stats struct whose small allocator fields are filled.
+ */
+void InTundra_SmlMemAlc_gather_stats(Tundra_MemStats *stats_out);
 
 #ifdef __cplusplus
 }
@@ -26,9 +26,77 @@ extern "C" {
 #define TUNDRA_LINUX_SYSCALL_READ 0
 #define TUNDRA_LINUX_SYSCALL_WRITE 1
 #define TUNDRA_LINUX_SYSCALL_CLOSE 3
+#define TUNDRA_LINUX_SYSCALL_FSTAT 5
 #define TUNDRA_LINUX_SYSCALL_LSEEK 8
+#define TUNDRA_LINUX_SYSCALL_MMAP 9
+#define TUNDRA_LINUX_SYSCALL_MPROTECT 10
+#define TUNDRA_LINUX_SYSCALL_MUNMAP 11
+#define TUNDRA_LINUX_SYSCALL_PREAD64 17
+#define TUNDRA_LINUX_SYSCALL_PWRITE64 18
+#define TUNDRA_LINUX_SYSCALL_WRITEV 20
+#define TUNDRA_LINUX_SYSCALL_MADVISE 28
+#define TUNDRA_LINUX_SYSCALL_SENDFILE 40
 #define TUNDRA_LINUX_SYSCALL_EXIT 60
+#define TUNDRA_LINUX_SYSCALL_FDATASYNC 75
+#define TUNDRA_LINUX_SYSCALL_FTRUNCATE 77
+#define TUNDRA_LINUX_SYSCALL_GETTID 186
+#define TUNDRA_LINUX_SYSCALL_FUTEX 202
+#define TUNDRA_LINUX_SYSCALL_SCHED_SETAFFINITY 203
+#define TUNDRA_LINUX_SYSCALL_SCHED_GETAFFINITY 204
+#define TUNDRA_LINUX_SYSCALL_GETDENTS64 217
+#define TUNDRA_LINUX_SYSCALL_FADVISE64 221
+#define TUNDRA_LINUX_SYSCALL_CLOCK_GETTIME 228
+#define TUNDRA_LINUX_SYSCALL_MBIND 237
+#define TUNDRA_LINUX_SYSCALL_SET_MEMPOLICY 238
 #define TUNDRA_LINUX_SYSCALL_OPENAT 257
+#define TUNDRA_LINUX_SYSCALL_PERF_EVENT_OPEN 298
+#define TUNDRA_LINUX_SYSCALL_GETCPU 309
+#define TUNDRA_LINUX_SYSCALL_COPY_FILE_RANGE 326
+#define TUNDRA_LINUX_SYSCALL_IO_URING_SETUP 425
+#define TUNDRA_LINUX_SYSCALL_IO_URING_ENTER 426
+#define TUNDRA_LINUX_SYSCALL_CLONE3 435
+
+#elif defined(TUNDRA_SYS_ARM)
+
+// aarch64 uses the unified asm-generic syscall table, so most numbers
+// differ from x86_64. Note there is no plain open/stat/lseek-free legacy
+// set here; everything already routes through openat and friends.
+#define TUNDRA_LINUX_SYSCALL_READ 63
+#define TUNDRA_LINUX_SYSCALL_WRITE 64
+#define TUNDRA_LINUX_SYSCALL_CLOSE 57
+#define TUNDRA_LINUX_SYSCALL_FSTAT 80
+#define TUNDRA_LINUX_SYSCALL_LSEEK 62
+#define TUNDRA_LINUX_SYSCALL_MMAP 222
+#define TUNDRA_LINUX_SYSCALL_MPROTECT 226
+#define TUNDRA_LINUX_SYSCALL_MUNMAP 215
+#define TUNDRA_LINUX_SYSCALL_PREAD64 67
+#define TUNDRA_LINUX_SYSCALL_PWRITE64 68
+#define TUNDRA_LINUX_SYSCALL_WRITEV 66
+#define TUNDRA_LINUX_SYSCALL_MADVISE 233
+#define TUNDRA_LINUX_SYSCALL_SENDFILE 71
+#define TUNDRA_LINUX_SYSCALL_EXIT 93
+#define TUNDRA_LINUX_SYSCALL_FDATASYNC 83
+#define TUNDRA_LINUX_SYSCALL_FTRUNCATE 46
+#define TUNDRA_LINUX_SYSCALL_GETTID 178
+#define TUNDRA_LINUX_SYSCALL_FUTEX 98
+#define TUNDRA_LINUX_SYSCALL_SCHED_SETAFFINITY 122
+#define TUNDRA_LINUX_SYSCALL_SCHED_GETAFFINITY 123
+#define TUNDRA_LINUX_SYSCALL_GETDENTS64 61
+#define TUNDRA_LINUX_SYSCALL_FADVISE64 223
+#define TUNDRA_LINUX_SYSCALL_CLOCK_GETTIME 113
+#define TUNDRA_LINUX_SYSCALL_MBIND 235
+#define TUNDRA_LINUX_SYSCALL_SET_MEMPOLICY 237
+#define TUNDRA_LINUX_SYSCALL_OPENAT 56
+#define TUNDRA_LINUX_SYSCALL_PERF_EVENT_OPEN 241
+#define TUNDRA_LINUX_SYSCALL_GETCPU 168
+#define TUNDRA_LINUX_SYSCALL_COPY_FILE_RANGE 285
+#define TUNDRA_LINUX_SYSCALL_IO_URING_SETUP 425
+#define TUNDRA_LINUX_SYSCALL_IO_URING_ENTER 426
+#define TUNDRA_LINUX_SYSCALL_CLONE3 435
+
+#else // TUNDRA_SYS_x86_64
+#error Not Implemented
+#endif // TUNDRA_SYS_x86_64
 
 #define TUNDRA_LINUX_SEEKBEHAVIOR_SET 0 // from beginning
 #define TUNDRA_LINUX_SEEKBEHAVIOR_CUR 1 // from current position
@@ -44,15 +112,13 @@ extern "C" {
 #define TUNDRA_LINUX_ERR_NOMEM 12  // Out of memory
 #define TUNDRA_LINUX_ERR_PERMDENY 13  // Permission denied
 #define TUNDRA_LINUX_ERR_BADADDR 14  // Bad address
+#define TUNDRA_LINUX_ERR_CROSSDEV 18  // Cross-device link / operation
 #define TUNDRA_LINUX_ERR_INVARG 22  // Invalid argument
+#define TUNDRA_LINUX_ERR_NOSYS 38  // Syscall not implemented
 
 i64 InTundra_syscall(i64 number, i64 arg0, i64 arg1, i64 arg2, i64 arg3,
     i64 arg4, i64 arg5);
 
-#else // TUNDRA_SYS_x86_64
-#error Not Implemented
-#endif // TUNDRA_SYS_x86_64
-
 #else // TUNDRA_PLATFORM_LINUX
 #error Not Implemented
 #endif // TUNDRA_PLATFORM_LINUX
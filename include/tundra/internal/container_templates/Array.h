@@ -10,6 +10,7 @@
 #include "tundra/internal/MacroHelper.h"
 #include "tundra/common/TypeDef.h"
 #include "tundra/utils/FatalHandler.h"
+#include "tundra/utils/MemUtils.h"
 
 #ifndef TUNDRA_ARRAY_H
 #define TUNDRA_ARRAY_H
@@ -214,6 +215,56 @@ static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(data)(
     return arr->data;
 }
 
+/**
+ * @brief Bulk copies `num_elem` elements from `elems` into the front of the
+ * Array with bounds checking.
+ *
+ * A fatal is thrown if `num_elem` exceeds the Array's capacity with the Array
+ * unmodified.
+ *
+ * @param arr Array to copy into.
+ * @param elems Elements to copy in.
+ * @param num_elem Number of elements in `elems`.
+ */
+static inline void TUNDRA_FUNC_NAME(copy_in)(TUNDRA_NAME *arr,
+    const TUNDRA_TYPE *elems, u64 num_elem)
+{
+    if(num_elem > TUNDRA_CAPACITY)
+    {
+        TUNDRA_FATAL("Num elem is: \"%llu\" but Array cap is: \"%llu\".",
+            num_elem, TUNDRA_CAPACITY);
+        return;
+    }
+
+    Tundra_copy_mem_fwd((const void*)elems, (void*)arr->data,
+        num_elem * sizeof(TUNDRA_TYPE));
+}
+
+/**
+ * @brief Bulk copies `num_elem` elements from the front of the Array into
+ * `dst` with bounds checking.
+ *
+ * A fatal is thrown if `num_elem` exceeds the Array's capacity with `dst`
+ * unmodified.
+ *
+ * @param arr Array to copy out of.
+ * @param dst Buffer to copy into, must hold at least `num_elem` elements.
+ * @param num_elem Number of elements to copy out.
+ */
+static inline void TUNDRA_FUNC_NAME(copy_out)(const TUNDRA_NAME *arr,
+    TUNDRA_TYPE *dst, u64 num_elem)
+{
+    if(num_elem > TUNDRA_CAPACITY)
+    {
+        TUNDRA_FATAL("Num elem is: \"%llu\" but Array cap is: \"%llu\".",
+            num_elem, TUNDRA_CAPACITY);
+        return;
+    }
+
+    Tundra_copy_mem_fwd((const void*)arr->data, (void*)dst,
+        num_elem * sizeof(TUNDRA_TYPE));
+}
+
 /**
  * @brief Returns the fixed size of the Array type.
  *
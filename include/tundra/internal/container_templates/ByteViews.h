@@ -0,0 +1,79 @@
+/**
+ * @file ByteViews.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Checked typed views over the byte array container.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TYPE
+#error TUNDRA_TYPE not defined.
+#endif
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/common/Core.h"
+#include "tundra/internal/MacroHelper.h"
+
+
+// Type and Function Name Macros -----------------------------------------------
+#define TUNDRA_DYNARR_NAME TUNDRA_CONCAT(Tundra_DynamicArray, TUNDRA_TYPENAME)
+
+#define TUNDRA_BV_FUNC_NAME(name) TUNDRA_CONCAT3(Tundra_DynArr, \
+    TUNDRA_TYPENAME, _##name)
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Views reinterpret the raw bytes, they only make sense over a byte array.
+TUNDRA_CT_ASSERT(sizeof(TUNDRA_TYPE) == 1);
+
+/**
+ * Emits one checked reinterpret-view method. Every allocator path hands back
+ * memory aligned to TUNDRA_MEM_ALIGNMENT, which covers every scalar type, so
+ * an in-bounds offset that is an increment of the view type's size is enough
+ * to guarantee aligned element access.
+ *
+ * The view reads fixed-layout records in place of copying fields out:
+ *
+ *     const u64 *fields = Tundra_DynArrU8_view_as_u64(&frame, 16, 4);
+ *     if(fields == NULL) { // truncated or misaligned frame }
+ *
+ * Returns NULL if `offset_bytes` is not an increment of the view type's size
+ * or `num_elem` elements starting there would run past the array's bytes.
+ * The pointer is invalidated by any later add that expands the array.
+ */
+#define TUNDRA_INT_DEF_BYTE_VIEW(view_type) \
+static inline const view_type* TUNDRA_BV_FUNC_NAME(view_as_##view_type)( \
+    const TUNDRA_DYNARR_NAME *arr, u64 offset_bytes, u64 num_elem) \
+{ \
+    if(offset_bytes > arr->num_elem || \
+        offset_bytes % sizeof(view_type) != 0 || \
+        num_elem > (arr->num_elem - offset_bytes) / sizeof(view_type)) \
+    { \
+        return NULL; \
+    } \
+ \
+    return (const view_type*)(const void*)(arr->data + offset_bytes); \
+}
+
+TUNDRA_INT_DEF_BYTE_VIEW(u16)
+TUNDRA_INT_DEF_BYTE_VIEW(u32)
+TUNDRA_INT_DEF_BYTE_VIEW(u64)
+TUNDRA_INT_DEF_BYTE_VIEW(i16)
+TUNDRA_INT_DEF_BYTE_VIEW(i32)
+TUNDRA_INT_DEF_BYTE_VIEW(i64)
+TUNDRA_INT_DEF_BYTE_VIEW(float)
+TUNDRA_INT_DEF_BYTE_VIEW(double)
+
+#undef TUNDRA_INT_DEF_BYTE_VIEW
+
+#ifdef __cplusplus
+} // Extern "C"
+#endif // __cplusplus
+
+// Clean up
+#undef TUNDRA_DYNARR_NAME
+#undef TUNDRA_BV_FUNC_NAME
@@ -0,0 +1,393 @@
+/**
+ * @file ChunkedStack.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief LIFO stack growing by fixed-size chunks, never copying elements.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TYPE
+#error TUNDRA_TYPE not defined.
+#endif
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/common/NumLimits.h"
+#include "tundra/internal/MacroHelper.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/MemUtils.h"
+#include "tundra/utils/Math.h"
+#include "tundra/utils/FatalHandler.h"
+#include "tundra/utils/ScratchArena.h"
+
+#ifndef TUNDRA_CHNKSTK_H
+#define TUNDRA_CHNKSTK_H
+
+// Elements per chunk.
+#define TUNDRA_CHNKSTK_CHUNK_ELEMS 256
+
+// Initial capacity of the chunk pointer array.
+#define TUNDRA_CHNKSTK_DEF_CHUNK_CAP 4
+#endif
+
+
+// Type and Function Name Macros -----------------------------------------------
+#define TUNDRA_NAME TUNDRA_CONCAT(Tundra_ChunkedStack, TUNDRA_TYPENAME)
+
+#define TUNDRA_FUNC_NAME(name) TUNDRA_CONCAT3(Tundra_ChnkStk, \
+    TUNDRA_TYPENAME, _##name)
+#define TUNDRA_INT_FUNC_NAME(name) TUNDRA_CONCAT3(InTundra_ChnkStk, \
+    TUNDRA_TYPENAME, _##name)
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Containers ------------------------------------------------------------------
+
+/**
+ * @brief LIFO stack storing elements in fixed-size chunks instead of one
+ * flat buffer.
+ *
+ * Growth appends a new chunk; existing elements are never copied, so
+ * worst-case push latency is O(1) rather than the O(n) realloc copy of a
+ * flat stack, and element addresses are stable for the element's lifetime.
+ * Push and pop stay branch-cheap through a cached current-chunk pointer;
+ * the chunk-boundary branch is taken once per chunk of elements.
+ *
+ * Popped chunks are retained for reuse until `free`, so capacity only grows.
+ *
+ * Must be initialized using any of the `init` methods before use. Must be
+ * freed using the `free` method when no longer needed.
+ *
+ * Elements are byte copied; custom element handling (copy, free, move) is not
+ * supported and should be done by the user through external calls.
+ *
+ * Internals are read-only.
+ */
+typedef struct TUNDRA_NAME
+{
+    // Heap allocated array of chunk pointers.
+    TUNDRA_TYPE **chunks;
+
+    // Number of chunks allocated.
+    u64 num_chunk;
+
+    // Number of chunk pointers `chunks` can hold before resizing.
+    u64 chunk_cap;
+
+    // Cached pointer to the chunk holding the top of the stack, always
+    // `chunks[cur_chunk_idx]`.
+    TUNDRA_TYPE *cur_chunk;
+
+    // Index of the current chunk in `chunks`.
+    u64 cur_chunk_idx;
+
+    // Next free slot inside the current chunk. Only 0 when the stack is
+    // empty; a pop that empties a later chunk retreats to the previous one
+    // with this set to TUNDRA_CHNKSTK_CHUNK_ELEMS.
+    u64 cur_idx;
+} TUNDRA_NAME;
+
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Steps the current chunk forward for a push into a full chunk,
+ * allocating a fresh chunk when none has been retained.
+ *
+ * @param stk Stack to handle.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(advance_chunk)(TUNDRA_NAME *stk)
+{
+    const u64 NEXT_CHUNK_IDX = stk->cur_chunk_idx + 1;
+
+    if(NEXT_CHUNK_IDX == stk->num_chunk)
+    {
+        if(stk->num_chunk == stk->chunk_cap)
+        {
+            stk->chunk_cap *= 2;
+            stk->chunks = (TUNDRA_TYPE**)Tundra_realloc_mem(
+                (void*)stk->chunks, stk->chunk_cap * sizeof(TUNDRA_TYPE*));
+        }
+
+        stk->chunks[NEXT_CHUNK_IDX] = (TUNDRA_TYPE*)Tundra_alloc_mem(
+            TUNDRA_CHNKSTK_CHUNK_ELEMS * sizeof(TUNDRA_TYPE));
+        ++stk->num_chunk;
+    }
+
+    stk->cur_chunk_idx = NEXT_CHUNK_IDX;
+    stk->cur_chunk = stk->chunks[NEXT_CHUNK_IDX];
+    stk->cur_idx = 0;
+}
+
+
+// Public Methods --------------------------------------------------------------
+
+/**
+ * @brief Initializes a Stack with a single chunk. Allocates memory and sets
+ * internal components.
+ *
+ * Only initialize a Stack once. If an already initialized Stack is called
+ * with init, undefined behavior may occur.
+ *
+ * @param stk Stack to init.
+ */
+static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_NAME *stk)
+{
+    stk->chunks = (TUNDRA_TYPE**)Tundra_alloc_mem(
+        TUNDRA_CHNKSTK_DEF_CHUNK_CAP * sizeof(TUNDRA_TYPE*));
+    stk->chunks[0] = (TUNDRA_TYPE*)Tundra_alloc_mem(
+        TUNDRA_CHNKSTK_CHUNK_ELEMS * sizeof(TUNDRA_TYPE));
+
+    stk->num_chunk = 1;
+    stk->chunk_cap = TUNDRA_CHNKSTK_DEF_CHUNK_CAP;
+    stk->cur_chunk = stk->chunks[0];
+    stk->cur_chunk_idx = 0;
+    stk->cur_idx = 0;
+}
+
+/**
+ * @brief Initializes a Stack with a single chunk inside `arena`, bump
+ * allocating its storage so the arena's reset reclaims it in O(1).
+ *
+ * Chunks appended by later growth are fresh allocations, so they come from
+ * the arena only while one of its scopes is active; `free` stays safe to
+ * call either way, frees of arena owned memory are absorbed as no-ops.
+ *
+ * Only initialize a Stack once. If an already initialized Stack is called
+ * with init, undefined behavior may occur.
+ *
+ * @param stk Stack to init.
+ * @param arena Scratch arena to allocate from.
+ */
+static inline void TUNDRA_FUNC_NAME(init_in)(TUNDRA_NAME *stk,
+    Tundra_ScratchArena *arena)
+{
+    Tundra_ScrArena_push_scope(arena);
+    TUNDRA_FUNC_NAME(init)(stk);
+    Tundra_ScrArena_pop_scope();
+}
+
+/**
+ * @brief Initializes a Stack by deep copying another Stack.
+ *
+ * `src` must be an initialized Stack, and `dst` must be uninitialized.
+ *
+ * @param src Stack to source from, must be initialized.
+ * @param dst Stack to deep copy to, must be uninitialized.
+ */
+static inline void TUNDRA_FUNC_NAME(init_copy)(const TUNDRA_NAME *src,
+    TUNDRA_NAME *dst)
+{
+    *dst = *src;
+
+    dst->chunks = (TUNDRA_TYPE**)Tundra_alloc_mem(
+        src->chunk_cap * sizeof(TUNDRA_TYPE*));
+
+    for(u64 i = 0; i < src->num_chunk; ++i)
+    {
+        dst->chunks[i] = (TUNDRA_TYPE*)Tundra_alloc_copy_mem(
+            (const void*)src->chunks[i],
+            TUNDRA_CHNKSTK_CHUNK_ELEMS * sizeof(TUNDRA_TYPE),
+            TUNDRA_CHNKSTK_CHUNK_ELEMS * sizeof(TUNDRA_TYPE));
+    }
+
+    dst->cur_chunk = dst->chunks[src->cur_chunk_idx];
+}
+
+/**
+ * @brief Frees memory allocated for an initialized Stack.
+ *
+ * After calling this method, the Stack must not be used unless reinitialized.
+ *
+ * @param stk Initialized Stack to free.
+ */
+static inline void TUNDRA_FUNC_NAME(free)(TUNDRA_NAME *stk)
+{
+    for(u64 i = 0; i < stk->num_chunk; ++i)
+    {
+        Tundra_free_mem((void*)stk->chunks[i]);
+    }
+
+    Tundra_free_mem((void*)stk->chunks);
+
+    stk->chunks = NULL;
+    stk->num_chunk = 0;
+    stk->chunk_cap = 0;
+    stk->cur_chunk = NULL;
+    stk->cur_chunk_idx = 0;
+    stk->cur_idx = 0;
+}
+
+/**
+ * @brief Clears the Stack of all elements. Retained chunks are kept, so the
+ * capacity remains unchanged.
+ *
+ * @param stk Stack to clear.
+ */
+static inline void TUNDRA_FUNC_NAME(clear)(TUNDRA_NAME *stk)
+{
+    stk->cur_chunk = stk->chunks[0];
+    stk->cur_chunk_idx = 0;
+    stk->cur_idx = 0;
+}
+
+/**
+ * @brief Pushes an element onto the Stack by copying it in.
+ *
+ * @param stk Stack to push to.
+ * @param elem Pointer to the element to copy in.
+ */
+static inline void TUNDRA_FUNC_NAME(push_copy)(TUNDRA_NAME *stk,
+    const TUNDRA_TYPE *elem)
+{
+    if(stk->cur_idx == TUNDRA_CHNKSTK_CHUNK_ELEMS)
+    {
+        TUNDRA_INT_FUNC_NAME(advance_chunk)(stk);
+    }
+
+    stk->cur_chunk[stk->cur_idx++] = *elem;
+}
+
+/**
+ * @brief Pushes an element onto the Stack by value.
+ *
+ * @param stk Stack to push to.
+ * @param elem Element to push.
+ */
+static inline void TUNDRA_FUNC_NAME(push_val)(TUNDRA_NAME *stk,
+    TUNDRA_TYPE elem)
+{
+    if(stk->cur_idx == TUNDRA_CHNKSTK_CHUNK_ELEMS)
+    {
+        TUNDRA_INT_FUNC_NAME(advance_chunk)(stk);
+    }
+
+    stk->cur_chunk[stk->cur_idx++] = elem;
+}
+
+/**
+ * @brief Pushes an uninitialized element slot onto the Stack and returns a
+ * pointer to it for the user to construct in place.
+ *
+ * The pointer is stable until the element is popped.
+ *
+ * @param stk Stack to push to.
+ *
+ * @return TUNDRA_TYPE* Pointer to the pushed slot.
+ */
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(push_uninit)(TUNDRA_NAME *stk)
+{
+    if(stk->cur_idx == TUNDRA_CHNKSTK_CHUNK_ELEMS)
+    {
+        TUNDRA_INT_FUNC_NAME(advance_chunk)(stk);
+    }
+
+    return &stk->cur_chunk[stk->cur_idx++];
+}
+
+/**
+ * @brief Pops the top element off the Stack.
+ *
+ * The element's chunk is retained for reuse, not freed.
+ *
+ * @attention For fast access, this method does not check that the Stack has
+ * an element to pop. It is the user's responsibility to ensure the Stack is
+ * not empty.
+ *
+ * @param stk Stack to pop from.
+ */
+static inline void TUNDRA_FUNC_NAME(pop)(TUNDRA_NAME *stk)
+{
+    --stk->cur_idx;
+
+    // Retreat to the previous chunk once this one empties, keeping the
+    // "only 0 when empty" invariant on `cur_idx`.
+    if(stk->cur_idx == 0 && stk->cur_chunk_idx > 0)
+    {
+        --stk->cur_chunk_idx;
+        stk->cur_chunk = stk->chunks[stk->cur_chunk_idx];
+        stk->cur_idx = TUNDRA_CHNKSTK_CHUNK_ELEMS;
+    }
+}
+
+/**
+ * @brief Returns a pointer to the top element of the Stack.
+ *
+ * @attention For fast access, this method does not check that the Stack has
+ * an element. It is the user's responsibility to ensure the Stack is not
+ * empty.
+ *
+ * @param stk Stack to view the top of.
+ *
+ * @return TUNDRA_TYPE* Pointer to the top element.
+ */
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(top_mut)(TUNDRA_NAME *stk)
+{
+    return &stk->cur_chunk[stk->cur_idx - 1];
+}
+
+/**
+ * @brief Returns a const-pointer to the top element of the Stack.
+ *
+ * @attention For fast access, this method does not check that the Stack has
+ * an element. It is the user's responsibility to ensure the Stack is not
+ * empty.
+ *
+ * @param stk Stack to view the top of.
+ *
+ * @return const TUNDRA_TYPE* Pointer to the top element.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(top)(
+    const TUNDRA_NAME *stk)
+{
+    return &stk->cur_chunk[stk->cur_idx - 1];
+}
+
+/**
+ * @brief Returns true if the Stack is empty.
+ *
+ * @param stk Stack to check.
+ *
+ * @return bool True if the Stack is empty.
+ */
+static inline bool TUNDRA_FUNC_NAME(is_empty)(const TUNDRA_NAME *stk)
+{
+    return stk->cur_idx == 0;
+}
+
+/**
+ * @brief Returns the number of elements in the Stack.
+ *
+ * @param stk Stack to query.
+ *
+ * @return u64 Number of elements.
+ */
+static inline u64 TUNDRA_FUNC_NAME(size)(const TUNDRA_NAME *stk)
+{
+    return stk->cur_chunk_idx * TUNDRA_CHNKSTK_CHUNK_ELEMS + stk->cur_idx;
+}
+
+/**
+ * @brief Returns the number of elements the Stack's allocated chunks can
+ * hold.
+ *
+ * @param stk Stack to query.
+ *
+ * @return u64 Current capacity.
+ */
+static inline u64 TUNDRA_FUNC_NAME(capacity)(const TUNDRA_NAME *stk)
+{
+    return stk->num_chunk * TUNDRA_CHNKSTK_CHUNK_ELEMS;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+
+#undef TUNDRA_NAME
+#undef TUNDRA_FUNC_NAME
+#undef TUNDRA_INT_FUNC_NAME
@@ -18,6 +18,7 @@
 #include "tundra/utils/MemUtils.h"
 #include "tundra/utils/Math.h"
 #include "tundra/utils/FatalHandler.h"
+#include "tundra/utils/ScratchArena.h"
 #include "tundra/common/Core.h"
 
 #ifndef TUNDRA_DYNARR_H
@@ -108,36 +109,36 @@ static inline void TUNDRA_INT_FUNC_NAME(init)(TUNDRA_NAME *arr, u64 init_cap)
  * @param arr Array to reallocate.
  * @param new_cap_bytes New capacity in bytes, power of 2.
  */
-static inline void TUNDRA_INT_FUNC_NAME(alloc_move_mem)(TUNDRA_NAME *arr, 
+static inline void TUNDRA_INT_FUNC_NAME(alloc_move_mem)(TUNDRA_NAME *arr,
     u64 new_cap_bytes)
 {
-    TUNDRA_TYPE *new_mem = (TUNDRA_TYPE*)Tundra_alloc_mem(new_cap_bytes);
-
 // Elements need custom move handling, cannot be simply byte copied.
     #if TUNDRA_NEEDS_CUSTOM_MOVE
 
+    TUNDRA_TYPE *new_mem = (TUNDRA_TYPE*)Tundra_alloc_mem(new_cap_bytes);
+
     // Call the custom move function on each element.
     for(u64 i = 0; i < arr->num_elem; ++i)
     {
         TUNDRA_MOVE_INIT_CALL_SIG(new_mem + i, arr->data + i);
     }
 
-// No custom move handling needed, can do a byte copy.
+    // Since we have covered any custom move handling, we don't need to worry
+    // about freeing the old memory in a special way, since the move behavior
+    // has left the old memory in an uninitialized state.
+    Tundra_free_mem((void*)arr->data);
+    arr->data = new_mem;
+
+// No custom move handling needed, elems can be byte copied so the block can
+// go through realloc, which grows in place (skipping the copy entirely) when
+// the block's allocation slack allows.
     #else
 
-    Tundra_copy_mem_fwd(
-        (const void*)arr->data,
-        (void*)new_mem,
-        arr->num_elem * sizeof(TUNDRA_TYPE)
-    );
+    arr->data =
+        (TUNDRA_TYPE*)Tundra_realloc_mem((void*)arr->data, new_cap_bytes);
 
     #endif
 
-    // Since we have covered any custom move handling, we don't need to worry 
-    // about freeing the old memory in a special way, since the move behavior 
-    // has left the old memory in an uninitialized state.
-    Tundra_free_mem((void*)arr->data);
-    arr->data = new_mem;
     arr->cap = new_cap_bytes / sizeof(TUNDRA_TYPE);
     arr->cap_bytes = new_cap_bytes;
 }
@@ -360,7 +361,29 @@ static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_NAME *arr)
 }
 
 /**
- * @brief Initialize an Array with set capacity. Allocates memory and sets 
+ * @brief Initializes an Array with default capacity inside `arena`, bump
+ * allocating its storage so it is reclaimed in O(1) when the arena is reset.
+ *
+ * Growth reallocates within the arena while it has room, falling back to the
+ * regular allocator once it runs out. `free` stays safe to call either way,
+ * frees of arena owned memory are absorbed as no-ops.
+ *
+ * Only initialize an Array once. If an already initialized Array is called with
+ * init, undefined behavior may occur.
+ *
+ * @param arr Array to init.
+ * @param arena Scratch arena to allocate from.
+ */
+static inline void TUNDRA_FUNC_NAME(init_in)(TUNDRA_NAME *arr,
+    Tundra_ScratchArena *arena)
+{
+    Tundra_ScrArena_push_scope(arena);
+    TUNDRA_FUNC_NAME(init)(arr);
+    Tundra_ScrArena_pop_scope();
+}
+
+/**
+ * @brief Initialize an Array with set capacity. Allocates memory and sets
  * internal components.
  *
  * If `init_cap` is 0, the Array is initialized with default capacity.
@@ -698,6 +721,18 @@ static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(add_uninit)(TUNDRA_NAME *arr)
     return arr->data + arr->num_elem++;
 }
 
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(add_mult_uninit)(TUNDRA_NAME *arr,
+    u64 num_elem)
+{
+    TUNDRA_INT_FUNC_NAME(reserve_for)(arr, num_elem);
+
+    TUNDRA_TYPE *mem = arr->data + arr->num_elem;
+
+    arr->num_elem += num_elem;
+
+    return mem;
+}
+
 static inline void TUNDRA_FUNC_NAME(add_mult_copy)(TUNDRA_NAME *arr,
     const TUNDRA_TYPE *elems, u64 num_elem)
 {
@@ -1126,18 +1161,73 @@ static inline void TUNDRA_FUNC_NAME(swap_pop)(TUNDRA_NAME *arr,
     --arr->num_elem;
 }
 
+/**
+ * @brief Removes every element the predicate returns true for, compacting the
+ * survivors in a single pass.
+ *
+ * Erasing k elements this way is O(n) total instead of the O(nk) that k
+ * ordered `erase` calls cost. The relative order of surviving elements is
+ * preserved. Removed elements are freed with the custom free function if one
+ * is defined.
+ *
+ * @param arr Array to remove from.
+ * @param pred Predicate returning true for elements to remove.
+ * @param user_data Opaque pointer passed through to the predicate.
+ *
+ * @return `u64` Number of elements removed.
+ */
+static inline u64 TUNDRA_FUNC_NAME(remove_if)(TUNDRA_NAME *arr,
+    bool (*pred)(const TUNDRA_TYPE *elem, void *user_data), void *user_data)
+{
+    u64 dst = 0;
+
+    for(u64 i = 0; i < arr->num_elem; ++i)
+    {
+        if(pred(arr->data + i, user_data))
+        {
+            #if TUNDRA_NEEDS_CUSTOM_FREE
+
+            TUNDRA_FREE_CALL_SIG(arr->data + i);
+
+            #endif
+
+            continue;
+        }
+
+        // Survivor; slide it down into the first open slot.
+        if(dst != i)
+        {
+            #if TUNDRA_NEEDS_CUSTOM_MOVE
+
+            TUNDRA_MOVE_ASSIGN_CALL_SIG(arr->data + dst, arr->data + i);
+            #else
+
+            arr->data[dst] = arr->data[i];
+            #endif
+        }
+
+        ++dst;
+    }
+
+    const u64 NUM_REMOVED = arr->num_elem - dst;
+
+    arr->num_elem = dst;
+
+    return NUM_REMOVED;
+}
+
 /**
  * @brief Returns a pointer to the element at `index`.
  *
- * @attention For fast access, this method does not perform a bounds check on 
- * `index`. It is the user's responsibility to ensure the index is valid. 
- * 
+ * @attention For fast access, this method does not perform a bounds check on
+ * `index`. It is the user's responsibility to ensure the index is valid.
+ *
  * @param arr Array to index into.
  * @param index Index to get element.
  *
  * @return TUNDRA_TYPE* Pointer to the element at `index`.
  */
-static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(at_mut_nochk)(TUNDRA_NAME *arr, 
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(at_mut_nochk)(TUNDRA_NAME *arr,
     u64 index)
 {
     return &(arr->data[index]);
@@ -14,6 +14,7 @@
 #include "tundra/utils/MemUtils.h"
 #include "tundra/utils/Math.h"
 #include "tundra/utils/FatalHandler.h"
+#include "tundra/utils/ScratchArena.h"
 
 #ifndef TUNDRA_DYNSTK_H
 #define TUNDRA_DYNSTK_H
@@ -73,10 +74,32 @@ typedef struct TUNDRA_NAME
 */
 static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_NAME *stk)
 {
-    TUNDRA_DYNARR_FUNC_NAME(init_cap)(&stk->dyn_arr, 
+    TUNDRA_DYNARR_FUNC_NAME(init_cap)(&stk->dyn_arr,
         TUNDRA_DYNSTK_DEF_CAP);
 }
 
+/**
+ * @brief Initializes a Stack with default capacity inside `arena`, so its
+ * storage is bump allocated and dies in O(1) when the arena is reset.
+ *
+ * While the arena has room, growth reallocates within it; past that the
+ * storage migrates to the regular allocator. Calling `free` stays safe in
+ * both cases, frees of arena owned memory are absorbed as no-ops.
+ *
+ * Only initialize a Stack once. If an already initialized Stack is called with
+ * init, undefined behavior may occur.
+ *
+ * @param stk Stack to init.
+ * @param arena Scratch arena to allocate from.
+ */
+static inline void TUNDRA_FUNC_NAME(init_in)(TUNDRA_NAME *stk,
+    Tundra_ScratchArena *arena)
+{
+    Tundra_ScrArena_push_scope(arena);
+    TUNDRA_FUNC_NAME(init)(stk);
+    Tundra_ScrArena_pop_scope();
+}
+
 /**
  * @brief Initialize a Stack with set capacity. Allocates memory and sets 
  * internal components.
@@ -0,0 +1,521 @@
+/**
+ * @file FlatHashTable.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Open-addressing key-value container with group-probed control bytes.
+ * @version 0.1
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef TUNDRA_FLATHASHTABLE_H
+#define TUNDRA_FLATHASHTABLE_H
+#define TUNDRA_FLATTBL_DEF_CAP 16
+
+// Control bytes probed per group; one u64 lane.
+#define TUNDRA_FLATTBL_GROUP_WIDTH 8
+
+// Ratio (out of 8) of occupied/capacity slots, where if exceeded the table is
+// expanded and rebuilt.
+#define TUNDRA_FLATTBL_LOAD_LIMIT 7
+
+// Control byte values for slots not holding an entry. Occupied slots hold the
+// low 7 bits of their key's hash, so the high bit distinguishes the two
+// classes with one mask.
+#define TUNDRA_FLATTBL_CTRL_EMPTY 0x80
+#define TUNDRA_FLATTBL_CTRL_DELETED 0xFE
+#endif
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/common/BitUtils.h"
+#include "tundra/internal/MacroHelper.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/MemUtils.h"
+#include "tundra/utils/Math.h"
+#include "tundra/utils/ScratchArena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef TUNDRA_KEY
+#error TUNDRA_KEY not defined.
+#endif
+
+#ifndef TUNDRA_KEYNAME
+#error TUNDRA_KEYNAME not defined.
+#endif
+
+#ifndef TUNDRA_VAL
+#error TUNDRA_VAL not defined.
+#endif
+
+#ifndef TUNDRA_VALNAME
+#error TUNDRA_VALNAME not defined.
+#endif
+
+#ifndef TUNDRA_HASH_FUNC
+#error TUNDRA_HASH_FUNC not defined.
+#endif
+
+// Key equality; defaults to the == operator for integral keys. Instantiations
+// with struct or pointer-to-content keys define their own.
+#ifndef TUNDRA_KEY_EQ
+#define TUNDRA_KEY_EQ(first, second) ((first) == (second))
+#endif
+
+// Type and Function Name Macros -----------------------------------------------
+#define TUNDRA_TBL_NAME TUNDRA_CONCAT3(Tundra_FlatHashTable, TUNDRA_KEYNAME, \
+    TUNDRA_VALNAME)
+#define TUNDRA_ENTRY_NAME TUNDRA_CONCAT3(Tundra_FlatTblEntry, \
+    TUNDRA_KEYNAME, TUNDRA_VALNAME)
+
+#define TUNDRA_FUNC_NAME(name) TUNDRA_CONCAT4(Tundra_FlatTbl, \
+    TUNDRA_KEYNAME, TUNDRA_VALNAME, _##name)
+#define TUNDRA_INT_FUNC_NAME(name) TUNDRA_CONCAT4(InTundra_FlatTbl, \
+    TUNDRA_KEYNAME, TUNDRA_VALNAME, _##name)
+
+// Containers ------------------------------------------------------------------
+
+typedef struct
+{
+    TUNDRA_KEY key;
+    TUNDRA_VAL val;
+} TUNDRA_ENTRY_NAME;
+
+typedef struct
+{
+    // One control byte per slot: the low 7 hash bits of an occupied slot's
+    // key, TUNDRA_FLATTBL_CTRL_EMPTY, or TUNDRA_FLATTBL_CTRL_DELETED. Kept
+    // separate from the entries so probing touches 1 byte per slot.
+    u8 *ctrl;
+
+    // Entry storage, parallel to `ctrl`.
+    TUNDRA_ENTRY_NAME *entries;
+
+    // Capacity in slots, always a power of 2 and a multiple of the group
+    // width.
+    u64 capacity;
+
+    // Number of slots holding a valid entry.
+    u64 num_entries;
+
+    // Number of slots holding an entry or a tombstone; drives expansion since
+    // tombstones lengthen probes like entries do.
+    u64 num_occupied;
+
+    // Ratio (out of 8) of occupied/capacity slots that triggers expansion.
+    // Defaults to TUNDRA_FLATTBL_LOAD_LIMIT.
+    u64 load_limit;
+
+} TUNDRA_TBL_NAME;
+
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Returns a mask with 0x80 set in every byte of `lane` equal to
+ * `byte`.
+ *
+ * Exact match flags (no false positives), so every candidate in a group can
+ * be visited by iterating set bits.
+ *
+ * @param lane 8 control bytes.
+ * @param byte Byte to match, broadcast across the lane.
+ *
+ * @return u64 Match flags, 0x80 per matching byte.
+ */
+static inline u64 TUNDRA_INT_FUNC_NAME(match_byte)(u64 lane, u8 byte)
+{
+    const u64 DIFF = lane ^ ((u64)byte * 0x0101010101010101ULL);
+
+    return ~(((DIFF & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL) |
+        DIFF) & 0x8080808080808080ULL;
+}
+
+/**
+ * @brief Internal init method called by public init methods. Allocates the
+ * control and entry arrays and marks every slot empty.
+ *
+ * Assumes `init_cap` is a power of 2 at least one group wide.
+ *
+ * @param tbl Table to initialize.
+ * @param init_cap Initial capacity in slots.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(init)(TUNDRA_TBL_NAME *tbl,
+    u64 init_cap)
+{
+    tbl->capacity = init_cap;
+    tbl->num_entries = 0;
+    tbl->num_occupied = 0;
+    tbl->load_limit = TUNDRA_FLATTBL_LOAD_LIMIT;
+
+    tbl->ctrl = (u8*)Tundra_alloc_mem(init_cap);
+    tbl->entries = (TUNDRA_ENTRY_NAME*)Tundra_alloc_mem(
+        init_cap * sizeof(TUNDRA_ENTRY_NAME));
+
+    Tundra_fill_mem(tbl->ctrl, TUNDRA_FLATTBL_CTRL_EMPTY, init_cap);
+}
+
+/**
+ * @brief Places a key/value pair whose hash is already known, updating the
+ * value in place if the key is present.
+ *
+ * Declared ahead so the expand path below can re-place entries through it.
+ *
+ * @param tbl Table to add to.
+ * @param key Key to add.
+ * @param val Value to add.
+ * @param hash Full hash of `key`.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(add_hashed)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_KEY key, TUNDRA_VAL val, u64 hash);
+
+/**
+ * @brief Rebuilds the table at a new capacity, re-placing every entry and
+ * dropping accumulated tombstones.
+ *
+ * Assumes `new_cap` is a power of 2 large enough for the current entries.
+ *
+ * @param tbl Table to rebuild.
+ * @param new_cap New capacity in slots.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(rebuild)(TUNDRA_TBL_NAME *tbl,
+    u64 new_cap)
+{
+    u8 *old_ctrl = tbl->ctrl;
+    TUNDRA_ENTRY_NAME *old_entries = tbl->entries;
+
+    const u64 OLD_CAP = tbl->capacity;
+    const u64 LOAD_LIMIT = tbl->load_limit;
+
+    TUNDRA_INT_FUNC_NAME(init)(tbl, new_cap);
+
+    tbl->load_limit = LOAD_LIMIT;
+
+    for(u64 i = 0; i < OLD_CAP; ++i)
+    {
+        // Occupied control bytes have a clear high bit.
+        if((old_ctrl[i] & 0x80) != 0) { continue; }
+
+        TUNDRA_INT_FUNC_NAME(add_hashed)(tbl, old_entries[i].key,
+            old_entries[i].val, TUNDRA_HASH_FUNC(old_entries[i].key));
+    }
+
+    Tundra_free_mem(old_ctrl);
+    Tundra_free_mem(old_entries);
+}
+
+static inline void TUNDRA_INT_FUNC_NAME(add_hashed)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_KEY key, TUNDRA_VAL val, u64 hash)
+{
+    const u8 CTRL_BYTE = (u8)(hash & 0x7F);
+    const u64 NUM_GROUPS = tbl->capacity / TUNDRA_FLATTBL_GROUP_WIDTH;
+
+    u64 group = (hash >> 7) & (NUM_GROUPS - 1);
+
+    // First tombstone seen along the probe, reused as the insert slot so
+    // chains do not grow while erased slots sit unused.
+    i64 first_deleted = -1;
+
+    while(true)
+    {
+        const u64 LANE = *(const u64*)(tbl->ctrl +
+            group * TUNDRA_FLATTBL_GROUP_WIDTH);
+
+        // Visit every slot in the group whose control byte matches the
+        // hash's low 7 bits.
+        u64 candidates = TUNDRA_INT_FUNC_NAME(match_byte)(LANE, CTRL_BYTE);
+
+        while(candidates != 0)
+        {
+            const u64 SLOT = group * TUNDRA_FLATTBL_GROUP_WIDTH +
+                ((u64)Tundra_get_num_trail_zeros(candidates) >> 3);
+
+            if(TUNDRA_KEY_EQ(tbl->entries[SLOT].key, key))
+            {
+                tbl->entries[SLOT].val = val;
+                return;
+            }
+
+            candidates &= candidates - 1;
+        }
+
+        if(first_deleted < 0)
+        {
+            const u64 DELETED = TUNDRA_INT_FUNC_NAME(match_byte)(LANE,
+                TUNDRA_FLATTBL_CTRL_DELETED);
+
+            if(DELETED != 0)
+            {
+                first_deleted = (i64)(group * TUNDRA_FLATTBL_GROUP_WIDTH +
+                    ((u64)Tundra_get_num_trail_zeros(DELETED) >> 3));
+            }
+        }
+
+        const u64 EMPTY = TUNDRA_INT_FUNC_NAME(match_byte)(LANE,
+            TUNDRA_FLATTBL_CTRL_EMPTY);
+
+        if(EMPTY != 0)
+        {
+            // Key is absent. Fill the earliest tombstone on the probe if one
+            // was passed, otherwise the first empty slot here.
+            u64 slot;
+
+            if(first_deleted >= 0) { slot = (u64)first_deleted; }
+
+            else
+            {
+                slot = group * TUNDRA_FLATTBL_GROUP_WIDTH +
+                    ((u64)Tundra_get_num_trail_zeros(EMPTY) >> 3);
+                ++tbl->num_occupied;
+            }
+
+            tbl->ctrl[slot] = CTRL_BYTE;
+            tbl->entries[slot].key = key;
+            tbl->entries[slot].val = val;
+            ++tbl->num_entries;
+            return;
+        }
+
+        group = (group + 1) & (NUM_GROUPS - 1);
+    }
+}
+
+
+// Public ----------------------------------------------------------------------
+
+static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_TBL_NAME *tbl)
+{
+    TUNDRA_INT_FUNC_NAME(init)(tbl, TUNDRA_FLATTBL_DEF_CAP);
+}
+
+// Initializes inside `arena` so the table's storage is bump allocated and
+// dies in O(1) with the arena's reset. Growth rebuilds come from the arena
+// only while a scope on it is active; frees of arena owned memory are no-ops.
+static inline void TUNDRA_FUNC_NAME(init_in)(TUNDRA_TBL_NAME *tbl,
+    Tundra_ScratchArena *arena)
+{
+    Tundra_ScrArena_push_scope(arena);
+    TUNDRA_FUNC_NAME(init)(tbl);
+    Tundra_ScrArena_pop_scope();
+}
+
+static inline void TUNDRA_FUNC_NAME(init_cap)(TUNDRA_TBL_NAME *tbl,
+    u64 init_cap)
+{
+    if(init_cap == 0)
+    {
+        TUNDRA_FATAL("init_cap cannot be 0.\n");
+        return;
+    }
+
+    init_cap = Tundra_ceil_pow2(init_cap);
+
+    if(init_cap < TUNDRA_FLATTBL_DEF_CAP)
+    {
+        init_cap = TUNDRA_FLATTBL_DEF_CAP;
+    }
+
+    TUNDRA_INT_FUNC_NAME(init)(tbl, init_cap);
+}
+
+/**
+ * @brief Adds a key/value pair, updating the value in place if the key is
+ * already present.
+ *
+ * @param tbl Table to add to.
+ * @param key Key to add.
+ * @param val Value to add.
+ */
+static inline void TUNDRA_FUNC_NAME(add)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_KEY key, TUNDRA_VAL val)
+{
+    if((tbl->num_occupied + 1) * 8 > tbl->capacity * tbl->load_limit)
+    {
+        TUNDRA_INT_FUNC_NAME(rebuild)(tbl, tbl->capacity * 2);
+    }
+
+    TUNDRA_INT_FUNC_NAME(add_hashed)(tbl, key, val, TUNDRA_HASH_FUNC(key));
+}
+
+/**
+ * @brief Sizes the table for an expected number of entries in one rebuild.
+ *
+ * After reserving, adding up to `expected_count` distinct keys performs no
+ * further expansion. No-op if the table is already large enough.
+ *
+ * @param tbl Table to reserve in.
+ * @param expected_count Expected number of entries.
+ */
+static inline void TUNDRA_FUNC_NAME(reserve)(TUNDRA_TBL_NAME *tbl,
+    u64 expected_count)
+{
+    const u64 REQ_CAP = Tundra_ceil_pow2(
+        expected_count * 8 / tbl->load_limit + 1);
+
+    if(REQ_CAP <= tbl->capacity) { return; }
+
+    TUNDRA_INT_FUNC_NAME(rebuild)(tbl, REQ_CAP);
+}
+
+/**
+ * @brief Sets the load-factor limit (out of 8) of the table.
+ *
+ * Lower limits trade memory for shorter probes; higher limits pack the table
+ * denser. Takes effect on the next add.
+ *
+ * @param tbl Table to tune.
+ * @param load_limit New limit, in (0, 8).
+ */
+static inline void TUNDRA_FUNC_NAME(set_load_limit)(TUNDRA_TBL_NAME *tbl,
+    u64 load_limit)
+{
+    TUNDRA_RT_ASSERT(load_limit > 0 && load_limit < 8,
+        "\"load_limit\" must be in (0, 8).\n");
+
+    tbl->load_limit = load_limit;
+}
+
+/**
+ * @brief Returns a pointer to the value stored under a key, NULL if the key
+ * is not present.
+ *
+ * The pointer is invalidated by any later add that expands the table.
+ *
+ * @param tbl Table to search.
+ * @param key Key to search for.
+ *
+ * @return Pointer to the value, NULL if absent.
+ */
+static inline TUNDRA_VAL* TUNDRA_FUNC_NAME(get)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_KEY key)
+{
+    const u64 HASH = TUNDRA_HASH_FUNC(key);
+
+    const u8 CTRL_BYTE = (u8)(HASH & 0x7F);
+    const u64 NUM_GROUPS = tbl->capacity / TUNDRA_FLATTBL_GROUP_WIDTH;
+
+    u64 group = (HASH >> 7) & (NUM_GROUPS - 1);
+
+    while(true)
+    {
+        const u64 LANE = *(const u64*)(tbl->ctrl +
+            group * TUNDRA_FLATTBL_GROUP_WIDTH);
+
+        u64 candidates = TUNDRA_INT_FUNC_NAME(match_byte)(LANE, CTRL_BYTE);
+
+        while(candidates != 0)
+        {
+            const u64 SLOT = group * TUNDRA_FLATTBL_GROUP_WIDTH +
+                ((u64)Tundra_get_num_trail_zeros(candidates) >> 3);
+
+            if(TUNDRA_KEY_EQ(tbl->entries[SLOT].key, key))
+            {
+                return &tbl->entries[SLOT].val;
+            }
+
+            candidates &= candidates - 1;
+        }
+
+        // An empty slot anywhere in the group ends the probe; the key would
+        // have been placed no later than here.
+        if(TUNDRA_INT_FUNC_NAME(match_byte)(LANE,
+            TUNDRA_FLATTBL_CTRL_EMPTY) != 0)
+        {
+            return NULL;
+        }
+
+        group = (group + 1) & (NUM_GROUPS - 1);
+    }
+}
+
+/**
+ * @brief Returns true if a key is present in the table.
+ *
+ * @param tbl Table to search.
+ * @param key Key to search for.
+ *
+ * @return bool True if the key is present.
+ */
+static inline bool TUNDRA_FUNC_NAME(contains)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_KEY key)
+{
+    return TUNDRA_FUNC_NAME(get)(tbl, key) != NULL;
+}
+
+/**
+ * @brief Removes a key's entry from the table.
+ *
+ * The slot is tombstoned; its space is reclaimed on the next expansion.
+ *
+ * @param tbl Table to remove from.
+ * @param key Key to remove.
+ *
+ * @return bool True if the key was present and removed.
+ */
+static inline bool TUNDRA_FUNC_NAME(erase)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_KEY key)
+{
+    TUNDRA_VAL *val = TUNDRA_FUNC_NAME(get)(tbl, key);
+
+    if(val == NULL) { return false; }
+
+    const u64 SLOT = (u64)((TUNDRA_ENTRY_NAME*)((u8*)val -
+        __builtin_offsetof(TUNDRA_ENTRY_NAME, val)) - tbl->entries);
+
+    tbl->ctrl[SLOT] = TUNDRA_FLATTBL_CTRL_DELETED;
+    --tbl->num_entries;
+
+    return true;
+}
+
+/**
+ * @brief Returns the number of entries in the table.
+ *
+ * @param tbl Table to query.
+ *
+ * @return u64 Number of entries.
+ */
+static inline u64 TUNDRA_FUNC_NAME(size)(const TUNDRA_TBL_NAME *tbl)
+{
+    return tbl->num_entries;
+}
+
+static inline void TUNDRA_FUNC_NAME(init_copy)(TUNDRA_TBL_NAME *dst,
+    const TUNDRA_TBL_NAME *src)
+{
+    *dst = *src;
+
+    dst->ctrl = (u8*)Tundra_alloc_copy_mem((const void*)src->ctrl,
+        src->capacity, src->capacity);
+
+    dst->entries = (TUNDRA_ENTRY_NAME*)Tundra_alloc_copy_mem(
+        (const void*)src->entries,
+        src->capacity * sizeof(TUNDRA_ENTRY_NAME),
+        src->capacity * sizeof(TUNDRA_ENTRY_NAME));
+}
+
+static inline void TUNDRA_FUNC_NAME(free)(TUNDRA_TBL_NAME *tbl)
+{
+    Tundra_free_mem(tbl->ctrl);
+    Tundra_free_mem(tbl->entries);
+
+    tbl->ctrl = NULL;
+    tbl->entries = NULL;
+    tbl->capacity = 0;
+    tbl->num_entries = 0;
+    tbl->num_occupied = 0;
+}
+
+
+#ifdef __cplusplus
+} // Extern "C"
+#endif
+
+#undef TUNDRA_TBL_NAME
+#undef TUNDRA_ENTRY_NAME
+#undef TUNDRA_FUNC_NAME
+#undef TUNDRA_INT_FUNC_NAME
+#undef TUNDRA_KEY_EQ
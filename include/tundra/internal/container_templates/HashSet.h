@@ -0,0 +1,508 @@
+/**
+ * @file HashSet.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Open-addressing key-only set with group-probed control bytes.
+ * @version 0.1
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef TUNDRA_HASHSET_H
+#define TUNDRA_HASHSET_H
+#define TUNDRA_HSHSET_DEF_CAP 16
+
+// Control bytes probed per group; one u64 lane.
+#define TUNDRA_HSHSET_GROUP_WIDTH 8
+
+// Ratio (out of 8) of occupied/capacity slots, where if exceeded the set is
+// expanded and rebuilt.
+#define TUNDRA_HSHSET_LOAD_LIMIT 7
+
+// Control byte values for slots not holding a key. Occupied slots hold the
+// low 7 bits of their key's hash, so the high bit distinguishes the two
+// classes with one mask.
+#define TUNDRA_HSHSET_CTRL_EMPTY 0x80
+#define TUNDRA_HSHSET_CTRL_DELETED 0xFE
+#endif
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/common/BitUtils.h"
+#include "tundra/internal/MacroHelper.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/MemUtils.h"
+#include "tundra/utils/Math.h"
+#include "tundra/utils/ScratchArena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef TUNDRA_KEY
+#error TUNDRA_KEY not defined.
+#endif
+
+#ifndef TUNDRA_KEYNAME
+#error TUNDRA_KEYNAME not defined.
+#endif
+
+#ifndef TUNDRA_HASH_FUNC
+#error TUNDRA_HASH_FUNC not defined.
+#endif
+
+// Key equality; defaults to the == operator for integral keys. Instantiations
+// with struct or pointer-to-content keys define their own.
+#ifndef TUNDRA_KEY_EQ
+#define TUNDRA_KEY_EQ(first, second) ((first) == (second))
+#endif
+
+// Type and Function Name Macros -----------------------------------------------
+#define TUNDRA_SET_NAME TUNDRA_CONCAT(Tundra_HashSet, TUNDRA_KEYNAME)
+
+#define TUNDRA_FUNC_NAME(name) TUNDRA_CONCAT3(Tundra_HshSet, \
+    TUNDRA_KEYNAME, _##name)
+#define TUNDRA_INT_FUNC_NAME(name) TUNDRA_CONCAT3(InTundra_HshSet, \
+    TUNDRA_KEYNAME, _##name)
+
+// Containers ------------------------------------------------------------------
+
+typedef struct
+{
+    // One control byte per slot: the low 7 hash bits of an occupied slot's
+    // key, TUNDRA_HSHSET_CTRL_EMPTY, or TUNDRA_HSHSET_CTRL_DELETED. Kept
+    // separate from the keys so probing touches 1 byte per slot.
+    u8 *ctrl;
+
+    // Key storage, parallel to `ctrl`; no value payload, so a cache line of
+    // key data is all live keys.
+    TUNDRA_KEY *keys;
+
+    // Capacity in slots, always a power of 2 and a multiple of the group
+    // width.
+    u64 capacity;
+
+    // Number of slots holding a valid key.
+    u64 num_keys;
+
+    // Number of slots holding a key or a tombstone; drives expansion since
+    // tombstones lengthen probes like keys do.
+    u64 num_occupied;
+
+    // Ratio (out of 8) of occupied/capacity slots that triggers expansion.
+    // Defaults to TUNDRA_HSHSET_LOAD_LIMIT.
+    u64 load_limit;
+
+} TUNDRA_SET_NAME;
+
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Returns a mask with 0x80 set in every byte of `lane` equal to
+ * `byte`.
+ *
+ * Exact match flags (no false positives), so every candidate in a group can
+ * be visited by iterating set bits.
+ *
+ * @param lane 8 control bytes.
+ * @param byte Byte to match, broadcast across the lane.
+ *
+ * @return u64 Match flags, 0x80 per matching byte.
+ */
+static inline u64 TUNDRA_INT_FUNC_NAME(match_byte)(u64 lane, u8 byte)
+{
+    const u64 DIFF = lane ^ ((u64)byte * 0x0101010101010101ULL);
+
+    return ~(((DIFF & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL) |
+        DIFF) & 0x8080808080808080ULL;
+}
+
+/**
+ * @brief Internal init method called by public init methods. Allocates the
+ * control and key arrays and marks every slot empty.
+ *
+ * Assumes `init_cap` is a power of 2 at least one group wide.
+ *
+ * @param set Set to initialize.
+ * @param init_cap Initial capacity in slots.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(init)(TUNDRA_SET_NAME *set,
+    u64 init_cap)
+{
+    set->capacity = init_cap;
+    set->num_keys = 0;
+    set->num_occupied = 0;
+    set->load_limit = TUNDRA_HSHSET_LOAD_LIMIT;
+
+    set->ctrl = (u8*)Tundra_alloc_mem(init_cap);
+    set->keys = (TUNDRA_KEY*)Tundra_alloc_mem(
+        init_cap * sizeof(TUNDRA_KEY));
+
+    Tundra_fill_mem(set->ctrl, TUNDRA_HSHSET_CTRL_EMPTY, init_cap);
+}
+
+/**
+ * @brief Places a key whose hash is already known, no-op if the key is
+ * already present.
+ *
+ * Declared ahead so the expand path below can re-place keys through it.
+ *
+ * @param set Set to add to.
+ * @param key Key to add.
+ * @param hash Full hash of `key`.
+ *
+ * @return bool True if the key was newly added.
+ */
+static inline bool TUNDRA_INT_FUNC_NAME(add_hashed)(TUNDRA_SET_NAME *set,
+    TUNDRA_KEY key, u64 hash);
+
+/**
+ * @brief Rebuilds the set at a new capacity, re-placing every key and
+ * dropping accumulated tombstones.
+ *
+ * Assumes `new_cap` is a power of 2 large enough for the current keys.
+ *
+ * @param set Set to rebuild.
+ * @param new_cap New capacity in slots.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(rebuild)(TUNDRA_SET_NAME *set,
+    u64 new_cap)
+{
+    u8 *old_ctrl = set->ctrl;
+    TUNDRA_KEY *old_keys = set->keys;
+
+    const u64 OLD_CAP = set->capacity;
+    const u64 LOAD_LIMIT = set->load_limit;
+
+    TUNDRA_INT_FUNC_NAME(init)(set, new_cap);
+
+    set->load_limit = LOAD_LIMIT;
+
+    for(u64 i = 0; i < OLD_CAP; ++i)
+    {
+        // Occupied control bytes have a clear high bit.
+        if((old_ctrl[i] & 0x80) != 0) { continue; }
+
+        TUNDRA_INT_FUNC_NAME(add_hashed)(set, old_keys[i],
+            TUNDRA_HASH_FUNC(old_keys[i]));
+    }
+
+    Tundra_free_mem(old_ctrl);
+    Tundra_free_mem(old_keys);
+}
+
+static inline bool TUNDRA_INT_FUNC_NAME(add_hashed)(TUNDRA_SET_NAME *set,
+    TUNDRA_KEY key, u64 hash)
+{
+    const u8 CTRL_BYTE = (u8)(hash & 0x7F);
+    const u64 NUM_GROUPS = set->capacity / TUNDRA_HSHSET_GROUP_WIDTH;
+
+    u64 group = (hash >> 7) & (NUM_GROUPS - 1);
+
+    // First tombstone seen along the probe, reused as the insert slot so
+    // chains do not grow while erased slots sit unused.
+    i64 first_deleted = -1;
+
+    while(true)
+    {
+        const u64 LANE = *(const u64*)(set->ctrl +
+            group * TUNDRA_HSHSET_GROUP_WIDTH);
+
+        // Visit every slot in the group whose control byte matches the
+        // hash's low 7 bits.
+        u64 candidates = TUNDRA_INT_FUNC_NAME(match_byte)(LANE, CTRL_BYTE);
+
+        while(candidates != 0)
+        {
+            const u64 SLOT = group * TUNDRA_HSHSET_GROUP_WIDTH +
+                ((u64)Tundra_get_num_trail_zeros(candidates) >> 3);
+
+            if(TUNDRA_KEY_EQ(set->keys[SLOT], key)) { return false; }
+
+            candidates &= candidates - 1;
+        }
+
+        if(first_deleted < 0)
+        {
+            const u64 DELETED = TUNDRA_INT_FUNC_NAME(match_byte)(LANE,
+                TUNDRA_HSHSET_CTRL_DELETED);
+
+            if(DELETED != 0)
+            {
+                first_deleted = (i64)(group * TUNDRA_HSHSET_GROUP_WIDTH +
+                    ((u64)Tundra_get_num_trail_zeros(DELETED) >> 3));
+            }
+        }
+
+        const u64 EMPTY = TUNDRA_INT_FUNC_NAME(match_byte)(LANE,
+            TUNDRA_HSHSET_CTRL_EMPTY);
+
+        if(EMPTY != 0)
+        {
+            // Key is absent. Fill the earliest tombstone on the probe if one
+            // was passed, otherwise the first empty slot here.
+            u64 slot;
+
+            if(first_deleted >= 0) { slot = (u64)first_deleted; }
+
+            else
+            {
+                slot = group * TUNDRA_HSHSET_GROUP_WIDTH +
+                    ((u64)Tundra_get_num_trail_zeros(EMPTY) >> 3);
+                ++set->num_occupied;
+            }
+
+            set->ctrl[slot] = CTRL_BYTE;
+            set->keys[slot] = key;
+            ++set->num_keys;
+            return true;
+        }
+
+        group = (group + 1) & (NUM_GROUPS - 1);
+    }
+}
+
+
+// Public ----------------------------------------------------------------------
+
+static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_SET_NAME *set)
+{
+    TUNDRA_INT_FUNC_NAME(init)(set, TUNDRA_HSHSET_DEF_CAP);
+}
+
+// Initializes inside `arena` so the set's storage is bump allocated and dies
+// in O(1) with the arena's reset. Growth rebuilds come from the arena only
+// while a scope on it is active; frees of arena owned memory are no-ops.
+static inline void TUNDRA_FUNC_NAME(init_in)(TUNDRA_SET_NAME *set,
+    Tundra_ScratchArena *arena)
+{
+    Tundra_ScrArena_push_scope(arena);
+    TUNDRA_FUNC_NAME(init)(set);
+    Tundra_ScrArena_pop_scope();
+}
+
+static inline void TUNDRA_FUNC_NAME(init_cap)(TUNDRA_SET_NAME *set,
+    u64 init_cap)
+{
+    if(init_cap == 0)
+    {
+        TUNDRA_FATAL("init_cap cannot be 0.\n");
+        return;
+    }
+
+    init_cap = Tundra_ceil_pow2(init_cap);
+
+    if(init_cap < TUNDRA_HSHSET_DEF_CAP)
+    {
+        init_cap = TUNDRA_HSHSET_DEF_CAP;
+    }
+
+    TUNDRA_INT_FUNC_NAME(init)(set, init_cap);
+}
+
+/**
+ * @brief Adds a key to the set, no-op if it is already present.
+ *
+ * @param set Set to add to.
+ * @param key Key to add.
+ *
+ * @return bool True if the key was newly added, false if it was already
+ * present.
+ */
+static inline bool TUNDRA_FUNC_NAME(add)(TUNDRA_SET_NAME *set,
+    TUNDRA_KEY key)
+{
+    if((set->num_occupied + 1) * 8 > set->capacity * set->load_limit)
+    {
+        TUNDRA_INT_FUNC_NAME(rebuild)(set, set->capacity * 2);
+    }
+
+    return TUNDRA_INT_FUNC_NAME(add_hashed)(set, key,
+        TUNDRA_HASH_FUNC(key));
+}
+
+/**
+ * @brief Sizes the set for an expected number of keys in one rebuild.
+ *
+ * After reserving, adding up to `expected_count` distinct keys performs no
+ * further expansion. No-op if the set is already large enough.
+ *
+ * @param set Set to reserve in.
+ * @param expected_count Expected number of keys.
+ */
+static inline void TUNDRA_FUNC_NAME(reserve)(TUNDRA_SET_NAME *set,
+    u64 expected_count)
+{
+    const u64 REQ_CAP = Tundra_ceil_pow2(
+        expected_count * 8 / set->load_limit + 1);
+
+    if(REQ_CAP <= set->capacity) { return; }
+
+    TUNDRA_INT_FUNC_NAME(rebuild)(set, REQ_CAP);
+}
+
+/**
+ * @brief Sets the load-factor limit (out of 8) of the set.
+ *
+ * Lower limits trade memory for shorter probes; higher limits pack the set
+ * denser. Takes effect on the next add.
+ *
+ * @param set Set to tune.
+ * @param load_limit New limit, in (0, 8).
+ */
+static inline void TUNDRA_FUNC_NAME(set_load_limit)(TUNDRA_SET_NAME *set,
+    u64 load_limit)
+{
+    TUNDRA_RT_ASSERT(load_limit > 0 && load_limit < 8,
+        "\"load_limit\" must be in (0, 8).\n");
+
+    set->load_limit = load_limit;
+}
+
+/**
+ * @brief Returns true if a key is present in the set.
+ *
+ * @param set Set to search.
+ * @param key Key to search for.
+ *
+ * @return bool True if the key is present.
+ */
+static inline bool TUNDRA_FUNC_NAME(contains)(const TUNDRA_SET_NAME *set,
+    TUNDRA_KEY key)
+{
+    const u64 HASH = TUNDRA_HASH_FUNC(key);
+
+    const u8 CTRL_BYTE = (u8)(HASH & 0x7F);
+    const u64 NUM_GROUPS = set->capacity / TUNDRA_HSHSET_GROUP_WIDTH;
+
+    u64 group = (HASH >> 7) & (NUM_GROUPS - 1);
+
+    while(true)
+    {
+        const u64 LANE = *(const u64*)(set->ctrl +
+            group * TUNDRA_HSHSET_GROUP_WIDTH);
+
+        u64 candidates = TUNDRA_INT_FUNC_NAME(match_byte)(LANE, CTRL_BYTE);
+
+        while(candidates != 0)
+        {
+            const u64 SLOT = group * TUNDRA_HSHSET_GROUP_WIDTH +
+                ((u64)Tundra_get_num_trail_zeros(candidates) >> 3);
+
+            if(TUNDRA_KEY_EQ(set->keys[SLOT], key)) { return true; }
+
+            candidates &= candidates - 1;
+        }
+
+        // An empty slot anywhere in the group ends the probe; the key would
+        // have been placed no later than here.
+        if(TUNDRA_INT_FUNC_NAME(match_byte)(LANE,
+            TUNDRA_HSHSET_CTRL_EMPTY) != 0)
+        {
+            return false;
+        }
+
+        group = (group + 1) & (NUM_GROUPS - 1);
+    }
+}
+
+/**
+ * @brief Removes a key from the set.
+ *
+ * The slot is tombstoned; its space is reclaimed on the next expansion.
+ *
+ * @param set Set to remove from.
+ * @param key Key to remove.
+ *
+ * @return bool True if the key was present and removed.
+ */
+static inline bool TUNDRA_FUNC_NAME(erase)(TUNDRA_SET_NAME *set,
+    TUNDRA_KEY key)
+{
+    const u64 HASH = TUNDRA_HASH_FUNC(key);
+
+    const u8 CTRL_BYTE = (u8)(HASH & 0x7F);
+    const u64 NUM_GROUPS = set->capacity / TUNDRA_HSHSET_GROUP_WIDTH;
+
+    u64 group = (HASH >> 7) & (NUM_GROUPS - 1);
+
+    while(true)
+    {
+        const u64 LANE = *(const u64*)(set->ctrl +
+            group * TUNDRA_HSHSET_GROUP_WIDTH);
+
+        u64 candidates = TUNDRA_INT_FUNC_NAME(match_byte)(LANE, CTRL_BYTE);
+
+        while(candidates != 0)
+        {
+            const u64 SLOT = group * TUNDRA_HSHSET_GROUP_WIDTH +
+                ((u64)Tundra_get_num_trail_zeros(candidates) >> 3);
+
+            if(TUNDRA_KEY_EQ(set->keys[SLOT], key))
+            {
+                set->ctrl[SLOT] = TUNDRA_HSHSET_CTRL_DELETED;
+                --set->num_keys;
+                return true;
+            }
+
+            candidates &= candidates - 1;
+        }
+
+        if(TUNDRA_INT_FUNC_NAME(match_byte)(LANE,
+            TUNDRA_HSHSET_CTRL_EMPTY) != 0)
+        {
+            return false;
+        }
+
+        group = (group + 1) & (NUM_GROUPS - 1);
+    }
+}
+
+/**
+ * @brief Returns the number of keys in the set.
+ *
+ * @param set Set to query.
+ *
+ * @return u64 Number of keys.
+ */
+static inline u64 TUNDRA_FUNC_NAME(size)(const TUNDRA_SET_NAME *set)
+{
+    return set->num_keys;
+}
+
+static inline void TUNDRA_FUNC_NAME(init_copy)(TUNDRA_SET_NAME *dst,
+    const TUNDRA_SET_NAME *src)
+{
+    *dst = *src;
+
+    dst->ctrl = (u8*)Tundra_alloc_copy_mem((const void*)src->ctrl,
+        src->capacity, src->capacity);
+
+    dst->keys = (TUNDRA_KEY*)Tundra_alloc_copy_mem(
+        (const void*)src->keys,
+        src->capacity * sizeof(TUNDRA_KEY),
+        src->capacity * sizeof(TUNDRA_KEY));
+}
+
+static inline void TUNDRA_FUNC_NAME(free)(TUNDRA_SET_NAME *set)
+{
+    Tundra_free_mem(set->ctrl);
+    Tundra_free_mem(set->keys);
+
+    set->ctrl = NULL;
+    set->keys = NULL;
+    set->capacity = 0;
+    set->num_keys = 0;
+    set->num_occupied = 0;
+}
+
+
+#ifdef __cplusplus
+} // Extern "C"
+#endif
+
+#undef TUNDRA_SET_NAME
+#undef TUNDRA_FUNC_NAME
+#undef TUNDRA_INT_FUNC_NAME
+#undef TUNDRA_KEY_EQ
@@ -4,9 +4,9 @@
  * @brief Key-value container providing constant-time access.
  * @version 0.1
  * @date 2026-07-13
- * 
+ *
  * @copyright Copyright (c) 2026
- * 
+ *
  */
 
 #ifndef TUNDRA_HASHTABLE_H
@@ -14,18 +14,28 @@
 #define TUNDRA_HSHTBL_DEF_CAP 16
 
 // Ratio (out of 10) of used/capacity elements in the top of the table, where if
-// exceeded will be expanded and rehashed. 
+// exceeded will be expanded and rehashed.
 #define TUNDRA_HSHTBL_TOP_LIMIT 7
 
 // Proportion (out of 10) of the total table capacity that will be allocated for
 // the top of the table, where the remaining space is reserved for the cellar.
 #define TUNDRA_HSHTBL_TOP_PROPORTION 8
+
+// Number of top slots of the prior entry array each mutating operation
+// evacuates while an incremental rehash is in flight. Higher finishes the
+// rehash sooner, lower spreads its cost thinner.
+#define TUNDRA_HSHTBL_MIGRATE_STEP 8
 #endif
 
 #include "tundra/common/TypeDef.h"
+#include "tundra/common/ErrorDef.h"
 #include "tundra/internal/MacroHelper.h"
 #include "tundra/utils/MemAlloc.h"
 #include "tundra/utils/MemUtils.h"
+#include "tundra/utils/Math.h"
+#include "tundra/utils/ScratchArena.h"
+#include "tundra/utils/FileHandling.h"
+#include "tundra/containers/DynamicStackU64.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -51,6 +61,61 @@ extern "C" {
 #error TUNDRA_HASH_FUNC not defined.
 #endif
 
+// Key equality; defaults to the == operator for integral keys. Instantiations
+// with struct or pointer-to-content keys define their own.
+#ifndef TUNDRA_KEY_EQ
+#define TUNDRA_KEY_EQ(first, second) ((first) == (second))
+#endif
+
+// When 1, each Entry stores the full 64 bit hash of its key. Expansion then
+// re-places entries from the stored hash with no TUNDRA_HASH_FUNC call, and
+// lookups compare hashes before keys so mismatched entries are rejected
+// without touching the key. Worth the extra 8 bytes per Entry whenever
+// hashing or comparing a key is more than trivial.
+#ifndef TUNDRA_HSHTBL_CACHE_HASH
+#define TUNDRA_HSHTBL_CACHE_HASH 0
+#endif
+
+// When 1, the table keeps a one-entry inline cache of the last entry a
+// lookup hit, checked with a single key compare before any hashing or
+// probing. A generation counter bumped on every mutation invalidates the
+// cached pointer without touching it. Worth 24 bytes per table for
+// read-mostly tables whose lookups repeat keys.
+#ifndef TUNDRA_HSHTBL_HOT_CACHE
+#define TUNDRA_HSHTBL_HOT_CACHE 0
+#endif
+
+#ifndef TUNDRA_HSHTBL_PERSIST_H
+#define TUNDRA_HSHTBL_PERSIST_H
+
+// Identifies a persisted hash table file, "TNDRTBL1" in little endian.
+#define TUNDRA_HSHTBL_FILE_MAGIC 0x314C425452444E54ULL
+
+/**
+ * On-disk header of a persisted hash table, followed immediately by the raw
+ * entry array (top and cellar, exactly as in memory since collision chains
+ * are cellar indices rather than pointers) and then the freed-cellar-index
+ * list. Every field is a u64 so the entries start 64 byte aligned.
+ */
+typedef struct
+{
+    u64 magic;
+
+    // sizeof the instantiation's Entry; rejects opening a file persisted by
+    // an incompatible instantiation (different key/value types or hash
+    // caching setting).
+    u64 entry_bytes;
+
+    u64 top_capacity;
+    u64 cellar_capacity;
+    u64 num_entries_top;
+    u64 next_avail_cell_idx;
+    u64 num_avail_cellar_idxs;
+    u64 reserved;
+} InTundra_HshTblFileHeader;
+
+#endif
+
 // Type and Function Name Macros -----------------------------------------------
 #define TUNDRA_TBL_NAME TUNDRA_CONCAT3(Tundra_HashTable, TUNDRA_KEYNAME, \
     TUNDRA_VALNAME)
@@ -62,6 +127,30 @@ extern "C" {
 #define TUNDRA_INT_FUNC_NAME(name) TUNDRA_CONCAT4(InTundra_HshTbl, \
     TUNDRA_KEYNAME, TUNDRA_VALNAME, _##name)
 
+// Hash comparison half of an entry/key match; compiles away when hashes are
+// not cached.
+#if TUNDRA_HSHTBL_CACHE_HASH
+#define TUNDRA_INT_HSHTBL_HASH_MATCHES(entry_ptr, hash_val) \
+    ((entry_ptr)->hash == (hash_val))
+#else
+#define TUNDRA_INT_HSHTBL_HASH_MATCHES(entry_ptr, hash_val) 1
+#endif
+
+// Inline cache maintenance; all compile away when the cache is disabled.
+// A mutation bumps the generation so the cached pointer stops matching,
+// which stays safe even when the mutation reallocates the entry array.
+#if TUNDRA_HSHTBL_HOT_CACHE
+#define TUNDRA_INT_HSHTBL_BUMP_GEN(tbl) ((void)++(tbl)->gen)
+#define TUNDRA_INT_HSHTBL_FILL_HOT(tbl, entry) \
+    ((tbl)->hot_entry = (entry), (tbl)->hot_gen = (tbl)->gen)
+#define TUNDRA_INT_HSHTBL_INVAL_HOT(tbl) \
+    ((tbl)->hot_entry = NULL, (tbl)->hot_gen = (tbl)->gen - 1)
+#else
+#define TUNDRA_INT_HSHTBL_BUMP_GEN(tbl) ((void)0)
+#define TUNDRA_INT_HSHTBL_FILL_HOT(tbl, entry) ((void)0)
+#define TUNDRA_INT_HSHTBL_INVAL_HOT(tbl) ((void)0)
+#endif
+
 // Containers ------------------------------------------------------------------
 
 typedef struct
@@ -69,12 +158,18 @@ typedef struct
     TUNDRA_KEY key;
     TUNDRA_VAL val;
 
-    // If this integer is greater than 0, it represents the index inside the 
-    // cellar of the next Entry in the collision chain. If this int is -2, the
-    // Entry is non initialized/used and a new Entry can be placed here. If -1,
-    // this Entry is valid and holds an added key/value pair, and there is no
-    // collision chain attached to this Entry yet since the status is not 
-    // greater than 0.
+#if TUNDRA_HSHTBL_CACHE_HASH
+    // Full hash of `key`, cached so expansion and lookup filtering never
+    // re-hash.
+    u64 hash;
+#endif
+
+    // If this integer is greater than 0, it represents one plus the index
+    // inside the cellar of the next Entry in the collision chain. If this int
+    // is -2, the Entry is non initialized/used and a new Entry can be placed
+    // here. If -1, this Entry is valid and holds an added key/value pair, and
+    // there is no collision chain attached to this Entry yet since the status
+    // is not greater than 0.
     i64 status;
 } TUNDRA_ENTRY_NAME;
 
@@ -82,49 +177,463 @@ typedef struct
 {
     // Array of all Entrys (including the Cellar at the end).
     TUNDRA_ENTRY_NAME *data;
-    
-    // Number of valid Entrys in the top of the table. 
+
+    // Number of valid Entrys in the top of the table.
     u64 num_entries_top;
 
     // Capacity in Entrys of the top of the table.
-    u64 top_capacity; 
-    
+    u64 top_capacity;
+
     // Capacity in Entrys of the cellar of the table.
     u64 cellar_capacity;
 
-    // Index inside the cellar of the next empty position, when the 
+    // Index inside the cellar of the next empty position, when the
     // `avail_cellar_idxs` stack is empty.
     u64 next_avail_cell_idx;
 
     // Indexes inside the cellar that have been freed and can be reused.
     Tundra_DynamicStackU64 avail_cellar_idxs;
 
+    // Ratio (out of 10) of used/capacity entries in the top of the table
+    // that triggers expansion. Defaults to TUNDRA_HSHTBL_TOP_LIMIT.
+    u64 top_limit;
+
+    // Prior entry array of an in-flight incremental rehash, still serving
+    // lookups for keys not yet moved. NULL when no rehash is in flight.
+    TUNDRA_ENTRY_NAME *old_data;
+
+    // Capacity in Entrys of the top of `old_data`; its chains still resolve
+    // against this.
+    u64 old_top_capacity;
+
+    // Total capacity in Entrys (Top + Cellar) of `old_data`.
+    u64 old_total_capacity;
+
+    // Next top index of `old_data` to evacuate.
+    u64 migrate_pos;
+
+#if TUNDRA_HSHTBL_HOT_CACHE
+    // Entry the last lookup hit, valid only while `hot_gen` equals `gen`;
+    // checked before hashing so repeated-key lookups skip the probe.
+    TUNDRA_ENTRY_NAME *hot_entry;
+
+    // Mutation generation; bumped by every add, rebuild and free.
+    u64 gen;
+
+    // Value of `gen` when `hot_entry` was cached.
+    u64 hot_gen;
+#endif
+
 } TUNDRA_TBL_NAME;
 
 
 // Internal Methods ------------------------------------------------------------
 
 /**
- * @brief Internal init method called by public init methods. Allocates initial 
+ * @brief Internal init method called by public init methods. Allocates initial
  * memory for `init_cap` elems (split into top and cellar) and sets container
  * components.
- * 
+ *
  * Assumes `init_cap` is a power of 2.
- * 
+ *
  * @param tbl Table to initialize.
  * @param init_cap Initial capacity in elems (Top + Cellar)
  */
-#include "tundra/utils/ConsoleIO.h"
-static inline void TUNDRA_INT_FUNC_NAME(init)(TUNDRA_TBL_NAME *tbl, 
+static inline void TUNDRA_INT_FUNC_NAME(init)(TUNDRA_TBL_NAME *tbl,
     u64 init_cap)
 {
     tbl->num_entries_top = 0;
-    tbl->top_capacity = 
+    tbl->top_capacity =
         (u64)((float)init_cap * (TUNDRA_HSHTBL_TOP_PROPORTION / 10.0f));
     tbl->cellar_capacity = init_cap - tbl->top_capacity;
     tbl->next_avail_cell_idx = 0;
 
+    tbl->data = (TUNDRA_ENTRY_NAME*)Tundra_alloc_mem(
+        init_cap * sizeof(TUNDRA_ENTRY_NAME));
+
+    for(u64 i = 0; i < init_cap; ++i) { tbl->data[i].status = -2; }
+
     Tundra_DynStkU64_init(&tbl->avail_cellar_idxs);
+
+    tbl->top_limit = TUNDRA_HSHTBL_TOP_LIMIT;
+
+    tbl->old_data = NULL;
+    tbl->old_top_capacity = 0;
+    tbl->old_total_capacity = 0;
+    tbl->migrate_pos = 0;
+
+#if TUNDRA_HSHTBL_HOT_CACHE
+    tbl->gen = 1;
+#endif
+    TUNDRA_INT_HSHTBL_INVAL_HOT(tbl);
+}
+
+/**
+ * @brief Places a key/value pair whose hash is already known, updating the
+ * value in place if the key is present.
+ *
+ * Declared ahead so the expand path below can re-place entries through it.
+ *
+ * @param tbl Table to add to.
+ * @param key Key to add.
+ * @param val Value to add.
+ * @param hash Full hash of `key`.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(add_hashed)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_KEY key, TUNDRA_VAL val, u64 hash);
+
+/**
+ * @brief Rebuilds the live entry array at a new capacity, re-placing every
+ * entry in it.
+ *
+ * When hashes are cached each entry is re-placed from its stored hash; the
+ * key is never re-hashed.
+ *
+ * The prior array of an in-flight incremental rehash is left alone; its
+ * entries keep resolving against it until migration moves them.
+ *
+ * Assumes `new_cap` is a power of 2 large enough for the current entries.
+ *
+ * @param tbl Table to rebuild.
+ * @param new_cap New capacity in Entrys (Top + Cellar).
+ */
+static inline void TUNDRA_INT_FUNC_NAME(rebuild)(TUNDRA_TBL_NAME *tbl,
+    u64 new_cap)
+{
+    TUNDRA_ENTRY_NAME *old_data = tbl->data;
+
+    const u64 OLD_TOTAL = tbl->top_capacity + tbl->cellar_capacity;
+    const u64 TOP_LIMIT = tbl->top_limit;
+
+    TUNDRA_ENTRY_NAME *mig_data = tbl->old_data;
+    const u64 MIG_TOP = tbl->old_top_capacity;
+    const u64 MIG_TOTAL = tbl->old_total_capacity;
+    const u64 MIG_POS = tbl->migrate_pos;
+
+    Tundra_DynStkU64_free(&tbl->avail_cellar_idxs);
+
+    TUNDRA_INT_FUNC_NAME(init)(tbl, new_cap);
+
+    tbl->top_limit = TOP_LIMIT;
+
+    tbl->old_data = mig_data;
+    tbl->old_top_capacity = MIG_TOP;
+    tbl->old_total_capacity = MIG_TOTAL;
+    tbl->migrate_pos = MIG_POS;
+
+    for(u64 i = 0; i < OLD_TOTAL; ++i)
+    {
+        if(old_data[i].status == -2) { continue; }
+
+#if TUNDRA_HSHTBL_CACHE_HASH
+        TUNDRA_INT_FUNC_NAME(add_hashed)(tbl, old_data[i].key,
+            old_data[i].val, old_data[i].hash);
+#else
+        TUNDRA_INT_FUNC_NAME(add_hashed)(tbl, old_data[i].key,
+            old_data[i].val, TUNDRA_HASH_FUNC(old_data[i].key));
+#endif
+    }
+
+    Tundra_free_mem(old_data);
+}
+
+static inline void TUNDRA_INT_FUNC_NAME(add_hashed)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_KEY key, TUNDRA_VAL val, u64 hash)
+{
+    TUNDRA_INT_HSHTBL_BUMP_GEN(tbl);
+
+    TUNDRA_ENTRY_NAME *entry = &tbl->data[hash % tbl->top_capacity];
+
+    if(entry->status == -2)
+    {
+        entry->key = key;
+        entry->val = val;
+        entry->status = -1;
+
+#if TUNDRA_HSHTBL_CACHE_HASH
+        entry->hash = hash;
+#endif
+
+        ++tbl->num_entries_top;
+        return;
+    }
+
+    // Walk the collision chain; a hash mismatch skips the key compare
+    // entirely when hashes are cached.
+    while(true)
+    {
+        if(TUNDRA_INT_HSHTBL_HASH_MATCHES(entry, hash) &&
+            TUNDRA_KEY_EQ(entry->key, key))
+        {
+            entry->val = val;
+            return;
+        }
+
+        if(entry->status > 0)
+        {
+            entry = &tbl->data[tbl->top_capacity + (u64)entry->status - 1];
+            continue;
+        }
+
+        break;
+    }
+
+    // Key is absent; append a new Entry to the chain from the cellar.
+
+    u64 cell_idx;
+
+    if(!Tundra_DynStkU64_is_empty(&tbl->avail_cellar_idxs))
+    {
+        cell_idx = *Tundra_DynStkU64_top(&tbl->avail_cellar_idxs);
+        Tundra_DynStkU64_pop(&tbl->avail_cellar_idxs);
+    }
+
+    else if(tbl->next_avail_cell_idx < tbl->cellar_capacity)
+    {
+        cell_idx = tbl->next_avail_cell_idx++;
+    }
+
+    else
+    {
+        // Cellar is full; expand and re-place through the larger table.
+        TUNDRA_INT_FUNC_NAME(rebuild)(tbl,
+            (tbl->top_capacity + tbl->cellar_capacity) * 2);
+        TUNDRA_INT_FUNC_NAME(add_hashed)(tbl, key, val, hash);
+        return;
+    }
+
+    TUNDRA_ENTRY_NAME *cell_entry = &tbl->data[tbl->top_capacity + cell_idx];
+
+    cell_entry->key = key;
+    cell_entry->val = val;
+    cell_entry->status = -1;
+
+#if TUNDRA_HSHTBL_CACHE_HASH
+    cell_entry->hash = hash;
+#endif
+
+    entry->status = (i64)cell_idx + 1;
+}
+
+/**
+ * @brief Returns the entry holding a key inside one entry array, NULL if the
+ * key is not present there.
+ *
+ * @param data Entry array to search.
+ * @param top_capacity Top capacity of `data`.
+ * @param key Key to search for.
+ * @param hash Full hash of `key`.
+ *
+ * @return Entry holding the key, NULL if absent.
+ */
+static inline TUNDRA_ENTRY_NAME* TUNDRA_INT_FUNC_NAME(find_hashed)(
+    TUNDRA_ENTRY_NAME *data, u64 top_capacity, TUNDRA_KEY key, u64 hash)
+{
+    TUNDRA_ENTRY_NAME *entry = &data[hash % top_capacity];
+
+    if(entry->status == -2) { return NULL; }
+
+    while(true)
+    {
+        if(TUNDRA_INT_HSHTBL_HASH_MATCHES(entry, hash) &&
+            TUNDRA_KEY_EQ(entry->key, key))
+        { return entry; }
+
+        if(entry->status > 0)
+        {
+            entry = &data[top_capacity + (u64)entry->status - 1];
+            continue;
+        }
+
+        return NULL;
+    }
+}
+
+/**
+ * @brief Removes a key from one entry array, compacting its collision chain
+ * so no dead link is left behind.
+ *
+ * When the removed entry has a chain behind it, the chain's next entry is
+ * pulled up into its slot and that entry's cellar cell is released, so probe
+ * lengths shrink on every erase instead of accumulating tombstones under
+ * insert/erase churn.
+ *
+ * `live` is false when erasing from the prior array of an in-flight rehash:
+ * its cells are never reused, so the freed-cell list and top entry count are
+ * not maintained for it.
+ *
+ * @param tbl Table the array belongs to.
+ * @param data Entry array to erase from.
+ * @param top_capacity Top capacity of `data`.
+ * @param key Key to erase.
+ * @param hash Full hash of `key`.
+ * @param live True when `data` is the table's live array.
+ *
+ * @return bool True if the key was present and removed.
+ */
+static inline bool TUNDRA_INT_FUNC_NAME(erase_hashed)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_ENTRY_NAME *data, u64 top_capacity, TUNDRA_KEY key, u64 hash,
+    bool live)
+{
+    TUNDRA_ENTRY_NAME *entry = &data[hash % top_capacity];
+
+    if(entry->status == -2) { return false; }
+
+    TUNDRA_ENTRY_NAME *prev = NULL;
+
+    while(true)
+    {
+        if(TUNDRA_INT_HSHTBL_HASH_MATCHES(entry, hash) &&
+            TUNDRA_KEY_EQ(entry->key, key))
+        { break; }
+
+        if(entry->status > 0)
+        {
+            prev = entry;
+            entry = &data[top_capacity + (u64)entry->status - 1];
+            continue;
+        }
+
+        return false;
+    }
+
+    if(entry->status > 0)
+    {
+        // Pull the chain's next entry up into this slot and release its
+        // cell; the chain shortens by one.
+        const u64 CELL_IDX = (u64)entry->status - 1;
+        TUNDRA_ENTRY_NAME *next = &data[top_capacity + CELL_IDX];
+
+        entry->key = next->key;
+        entry->val = next->val;
+
+#if TUNDRA_HSHTBL_CACHE_HASH
+        entry->hash = next->hash;
+#endif
+
+        entry->status = next->status;
+        next->status = -2;
+
+        if(live)
+        { Tundra_DynStkU64_push_val(&tbl->avail_cellar_idxs, CELL_IDX); }
+
+        return true;
+    }
+
+    entry->status = -2;
+
+    if(prev != NULL)
+    {
+        // Entry was a chain tail in the cellar; detach it and release its
+        // cell.
+        prev->status = -1;
+
+        if(live)
+        {
+            Tundra_DynStkU64_push_val(&tbl->avail_cellar_idxs,
+                (u64)(entry - (data + top_capacity)));
+        }
+
+        return true;
+    }
+
+    if(live) { --tbl->num_entries_top; }
+
+    return true;
+}
+
+/**
+ * @brief Starts an incremental rehash into fresh arrays of `new_cap`,
+ * leaving every current entry in the prior array to be moved a bounded chunk
+ * at a time by later mutating operations.
+ *
+ * Assumes no rehash is already in flight and `new_cap` is a power of 2.
+ *
+ * @param tbl Table to start rehashing.
+ * @param new_cap New capacity in Entrys (Top + Cellar).
+ */
+static inline void TUNDRA_INT_FUNC_NAME(migrate_begin)(TUNDRA_TBL_NAME *tbl,
+    u64 new_cap)
+{
+    TUNDRA_ENTRY_NAME *old_data = tbl->data;
+
+    const u64 OLD_TOP = tbl->top_capacity;
+    const u64 OLD_TOTAL = tbl->top_capacity + tbl->cellar_capacity;
+    const u64 TOP_LIMIT = tbl->top_limit;
+
+    // The prior array is never added to again, so its freed-cell list is
+    // done.
+    Tundra_DynStkU64_free(&tbl->avail_cellar_idxs);
+
+    TUNDRA_INT_FUNC_NAME(init)(tbl, new_cap);
+
+    tbl->top_limit = TOP_LIMIT;
+    tbl->old_data = old_data;
+    tbl->old_top_capacity = OLD_TOP;
+    tbl->old_total_capacity = OLD_TOTAL;
+    tbl->migrate_pos = 0;
+}
+
+/**
+ * @brief Moves a bounded number of top slots from the prior array of an
+ * in-flight rehash into the live arrays, freeing the prior array once the
+ * last slot is evacuated.
+ *
+ * A slot's whole collision chain moves with it, so chains of unmoved keys
+ * are never walked through an evacuated link.
+ *
+ * @param tbl Table with a rehash in flight.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(migrate_step)(TUNDRA_TBL_NAME *tbl)
+{
+    u64 num_scanned = 0;
+
+    while(tbl->migrate_pos < tbl->old_top_capacity &&
+        num_scanned < TUNDRA_HSHTBL_MIGRATE_STEP)
+    {
+        TUNDRA_ENTRY_NAME *entry = &tbl->old_data[tbl->migrate_pos];
+
+        ++tbl->migrate_pos;
+        ++num_scanned;
+
+        if(entry->status == -2) { continue; }
+
+        while(true)
+        {
+            const i64 NEXT = entry->status;
+
+            entry->status = -2;
+
+#if TUNDRA_HSHTBL_CACHE_HASH
+            TUNDRA_INT_FUNC_NAME(add_hashed)(tbl, entry->key, entry->val,
+                entry->hash);
+#else
+            TUNDRA_INT_FUNC_NAME(add_hashed)(tbl, entry->key, entry->val,
+                TUNDRA_HASH_FUNC(entry->key));
+#endif
+
+            if(NEXT <= 0) { break; }
+
+            entry = &tbl->old_data[tbl->old_top_capacity + (u64)NEXT - 1];
+        }
+    }
+
+    if(tbl->migrate_pos >= tbl->old_top_capacity)
+    {
+        Tundra_free_mem(tbl->old_data);
+        tbl->old_data = NULL;
+    }
+}
+
+/**
+ * @brief Completes an in-flight incremental rehash synchronously. No-op when
+ * none is in flight.
+ *
+ * @param tbl Table to drain.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(migrate_drain)(TUNDRA_TBL_NAME *tbl)
+{
+    while(tbl->old_data != NULL) { TUNDRA_INT_FUNC_NAME(migrate_step)(tbl); }
 }
 
 
@@ -135,6 +644,17 @@ static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_TBL_NAME *tbl)
     TUNDRA_INT_FUNC_NAME(init)(tbl, TUNDRA_HSHTBL_DEF_CAP);
 }
 
+// Initializes inside `arena` so the table's storage is bump allocated and
+// dies in O(1) with the arena's reset. Growth rehashes come from the arena
+// only while a scope on it is active; frees of arena owned memory are no-ops.
+static inline void TUNDRA_FUNC_NAME(init_in)(TUNDRA_TBL_NAME *tbl,
+    Tundra_ScratchArena *arena)
+{
+    Tundra_ScrArena_push_scope(arena);
+    TUNDRA_FUNC_NAME(init)(tbl);
+    Tundra_ScrArena_pop_scope();
+}
+
 static inline void TUNDRA_FUNC_NAME(init_cap)(TUNDRA_TBL_NAME *tbl,
     u64 init_cap)
 {
@@ -145,17 +665,206 @@ static inline void TUNDRA_FUNC_NAME(init_cap)(TUNDRA_TBL_NAME *tbl,
     }
 
     init_cap = Tundra_ceil_pow2(init_cap);
-    
+
     TUNDRA_INT_FUNC_NAME(init)(tbl, init_cap);
 }
 
-static inline void TUNDRA_FUNC_NAME(init_copy)(TUNDRA_TBL_NAME *dst, 
+/**
+ * @brief Adds a key/value pair, updating the value in place if the key is
+ * already present.
+ *
+ * Expansion is incremental: when the load limit is hit, fresh arrays are
+ * allocated and later mutating operations each move a bounded chunk of
+ * entries over, so no single add pays for re-placing the whole table.
+ *
+ * @param tbl Table to add to.
+ * @param key Key to add.
+ * @param val Value to add.
+ */
+static inline void TUNDRA_FUNC_NAME(add)(TUNDRA_TBL_NAME *tbl, TUNDRA_KEY key,
+    TUNDRA_VAL val)
+{
+    if(tbl->old_data != NULL) { TUNDRA_INT_FUNC_NAME(migrate_step)(tbl); }
+
+    if(tbl->num_entries_top * 10 >= tbl->top_capacity * tbl->top_limit)
+    {
+        // Rare with a sane step count: the previous rehash has not finished
+        // by the time the next one is due; finish it before starting over.
+        TUNDRA_INT_FUNC_NAME(migrate_drain)(tbl);
+
+        TUNDRA_INT_FUNC_NAME(migrate_begin)(tbl,
+            (tbl->top_capacity + tbl->cellar_capacity) * 2);
+    }
+
+    const u64 HASH = TUNDRA_HASH_FUNC(key);
+
+    // A copy still sitting in the prior array must not survive there, or a
+    // later erase of this key would resurrect it.
+    if(tbl->old_data != NULL)
+    {
+        TUNDRA_INT_FUNC_NAME(erase_hashed)(tbl, tbl->old_data,
+            tbl->old_top_capacity, key, HASH, false);
+    }
+
+    TUNDRA_INT_FUNC_NAME(add_hashed)(tbl, key, val, HASH);
+}
+
+/**
+ * @brief Sizes the table for an expected number of entries in one rebuild.
+ *
+ * After reserving, adding up to `expected_count` distinct keys performs no
+ * further expansion, so a bulk load is one allocation and one pass. No-op if
+ * the table is already large enough.
+ *
+ * @param tbl Table to reserve in.
+ * @param expected_count Expected number of entries.
+ */
+static inline void TUNDRA_FUNC_NAME(reserve)(TUNDRA_TBL_NAME *tbl,
+    u64 expected_count)
+{
+    TUNDRA_INT_FUNC_NAME(migrate_drain)(tbl);
+
+    // Total capacity whose top section keeps `expected_count` entries under
+    // the load limit.
+    const u64 REQ_CAP = Tundra_ceil_pow2(expected_count * 100 /
+        (tbl->top_limit * TUNDRA_HSHTBL_TOP_PROPORTION) + 1);
+
+    if(REQ_CAP <= tbl->top_capacity + tbl->cellar_capacity) { return; }
+
+    TUNDRA_INT_FUNC_NAME(rebuild)(tbl, REQ_CAP);
+}
+
+/**
+ * @brief Sets the load-factor limit (out of 10) of the table's top section.
+ *
+ * Lower limits trade memory for shorter collision chains; higher limits pack
+ * the table denser. Takes effect on the next add.
+ *
+ * @param tbl Table to tune.
+ * @param top_limit New limit, in (0, 10).
+ */
+static inline void TUNDRA_FUNC_NAME(set_top_limit)(TUNDRA_TBL_NAME *tbl,
+    u64 top_limit)
+{
+    TUNDRA_RT_ASSERT(top_limit > 0 && top_limit < 10,
+        "\"top_limit\" must be in (0, 10).\n");
+
+    tbl->top_limit = top_limit;
+}
+
+/**
+ * @brief Returns a pointer to the value stored under a key, NULL if the key
+ * is not present.
+ *
+ * The pointer is invalidated by any later add that expands the table.
+ *
+ * @param tbl Table to search.
+ * @param key Key to search for.
+ *
+ * @return Pointer to the value, NULL if absent.
+ */
+static inline TUNDRA_VAL* TUNDRA_FUNC_NAME(get)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_KEY key)
+{
+#if TUNDRA_HSHTBL_HOT_CACHE
+    // One key compare resolves a repeat of the last hit key, no hash, no
+    // probe.
+    if(tbl->hot_gen == tbl->gen && TUNDRA_KEY_EQ(tbl->hot_entry->key, key))
+    { return &tbl->hot_entry->val; }
+#endif
+
+    const u64 HASH = TUNDRA_HASH_FUNC(key);
+
+    TUNDRA_ENTRY_NAME *entry = TUNDRA_INT_FUNC_NAME(find_hashed)(tbl->data,
+        tbl->top_capacity, key, HASH);
+
+    // Keys an in-flight rehash has not moved yet still resolve against the
+    // prior array.
+    if(entry == NULL && tbl->old_data != NULL)
+    {
+        entry = TUNDRA_INT_FUNC_NAME(find_hashed)(tbl->old_data,
+            tbl->old_top_capacity, key, HASH);
+    }
+
+    if(entry == NULL) { return NULL; }
+
+    TUNDRA_INT_HSHTBL_FILL_HOT(tbl, entry);
+    return &entry->val;
+}
+
+/**
+ * @brief Returns true if a key is present in the table.
+ *
+ * @param tbl Table to search.
+ * @param key Key to search for.
+ *
+ * @return bool True if the key is present.
+ */
+static inline bool TUNDRA_FUNC_NAME(contains)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_KEY key)
+{
+    return TUNDRA_FUNC_NAME(get)(tbl, key) != NULL;
+}
+
+/**
+ * @brief Removes a key from the table, returning whether it was present.
+ *
+ * The erased entry's collision chain is compacted rather than tombstoned, so
+ * probe lengths do not degrade under sustained insert/erase churn and the
+ * vacated cell is reusable immediately.
+ *
+ * @param tbl Table to erase from.
+ * @param key Key to erase.
+ *
+ * @return bool True if the key was present and removed.
+ */
+static inline bool TUNDRA_FUNC_NAME(erase)(TUNDRA_TBL_NAME *tbl,
+    TUNDRA_KEY key)
+{
+    TUNDRA_INT_HSHTBL_BUMP_GEN(tbl);
+
+    if(tbl->old_data != NULL) { TUNDRA_INT_FUNC_NAME(migrate_step)(tbl); }
+
+    const u64 HASH = TUNDRA_HASH_FUNC(key);
+
+    if(TUNDRA_INT_FUNC_NAME(erase_hashed)(tbl, tbl->data, tbl->top_capacity,
+        key, HASH, true))
+    { return true; }
+
+    if(tbl->old_data != NULL)
+    {
+        return TUNDRA_INT_FUNC_NAME(erase_hashed)(tbl, tbl->old_data,
+            tbl->old_top_capacity, key, HASH, false);
+    }
+
+    return false;
+}
+
+static inline void TUNDRA_FUNC_NAME(init_copy)(TUNDRA_TBL_NAME *dst,
     const TUNDRA_TBL_NAME *src)
 {
-    // Shallow copy initially, we will deep copy required members next. 
+    // Shallow copy initially, we will deep copy required members next.
     *dst = *src;
 
-    
+    const u64 TOTAL = src->top_capacity + src->cellar_capacity;
+
+    dst->data = (TUNDRA_ENTRY_NAME*)Tundra_alloc_copy_mem(
+        (const void*)src->data, TOTAL * sizeof(TUNDRA_ENTRY_NAME),
+        TOTAL * sizeof(TUNDRA_ENTRY_NAME));
+
+    Tundra_DynStkU64_init_copy(&dst->avail_cellar_idxs,
+        &src->avail_cellar_idxs);
+
+    if(src->old_data != NULL)
+    {
+        dst->old_data = (TUNDRA_ENTRY_NAME*)Tundra_alloc_copy_mem(
+            (const void*)src->old_data,
+            src->old_total_capacity * sizeof(TUNDRA_ENTRY_NAME),
+            src->old_total_capacity * sizeof(TUNDRA_ENTRY_NAME));
+    }
+
+    // The shallow copy carried a pointer into the source's entries.
+    TUNDRA_INT_HSHTBL_INVAL_HOT(dst);
 }
 
 
@@ -164,15 +873,195 @@ static inline void TUNDRA_FUNC_NAME(free)(TUNDRA_TBL_NAME *tbl)
     Tundra_free_mem(tbl->data);
     tbl->data = NULL;
 
+    if(tbl->old_data != NULL)
+    {
+        Tundra_free_mem(tbl->old_data);
+        tbl->old_data = NULL;
+    }
+
     tbl->num_entries_top = 0;
     tbl->top_capacity = 0;
     tbl->cellar_capacity = 0;
     tbl->next_avail_cell_idx = 0;
 
     Tundra_DynStkU64_free(&tbl->avail_cellar_idxs);
+
+    TUNDRA_INT_HSHTBL_BUMP_GEN(tbl);
+    TUNDRA_INT_HSHTBL_INVAL_HOT(tbl);
 }
 
+/**
+ * @brief Persists a table to a file in its flat in-memory layout: a 64 byte
+ * header, the raw entry array (top and cellar) and the freed-cellar-index
+ * list. Collision chains are cellar indices rather than pointers, so the
+ * entries are written untranslated and a later `open_mapped` serves lookups
+ * straight out of the mapped file.
+ *
+ * The file is only readable by an instantiation with the same key/value
+ * types and hash caching setting; `open_mapped` rejects anything else.
+ *
+ * Completes any in-flight incremental rehash first, since the flat layout
+ * holds exactly one entry array.
+ *
+ * @param tbl Table to persist.
+ * @param path Relative to current directory path of the file to write,
+ * created if it does not exist and truncated if it does.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+static inline i64 TUNDRA_FUNC_NAME(save)(TUNDRA_TBL_NAME *tbl,
+    const char *path)
+{
+    TUNDRA_INT_FUNC_NAME(migrate_drain)(tbl);
+
+    Tundra_File file;
 
-#ifdef __cplusplus
+    i64 result = Tundra_File_open(&file, path,
+        TUNDRA_FILE_OPEN_MODE_WRITEONLY, TUNDRA_FILE_WRITE_BEHAVIOR_NONE,
+        true, true);
+    if(result < 0) { return result; }
+
+    InTundra_HshTblFileHeader header;
+    header.magic = TUNDRA_HSHTBL_FILE_MAGIC;
+    header.entry_bytes = sizeof(TUNDRA_ENTRY_NAME);
+    header.top_capacity = tbl->top_capacity;
+    header.cellar_capacity = tbl->cellar_capacity;
+    header.num_entries_top = tbl->num_entries_top;
+    header.next_avail_cell_idx = tbl->next_avail_cell_idx;
+    header.num_avail_cellar_idxs =
+        Tundra_DynStkU64_size(&tbl->avail_cellar_idxs);
+    header.reserved = 0;
+
+    result = Tundra_File_write_raw_array(&file, &header, sizeof(header));
+
+    if(result >= 0)
+    {
+        result = Tundra_File_write_raw_array(&file, tbl->data,
+            (tbl->top_capacity + tbl->cellar_capacity) *
+            sizeof(TUNDRA_ENTRY_NAME));
+    }
+
+    if(result >= 0 && header.num_avail_cellar_idxs > 0)
+    {
+        result = Tundra_File_write_raw_array(&file,
+            Tundra_DynArrU64_data(&tbl->avail_cellar_idxs.dyn_arr),
+            header.num_avail_cellar_idxs * sizeof(u64));
+    }
+
+    if(result < 0) { Tundra_File_close(&file); return result; }
+
+    return Tundra_File_close(&file);
+}
+
+/**
+ * @brief Opens a file written by `save` and serves the table straight out of
+ * a read only mapping of it, no deserialization: `data` points straight into
+ * the mapped view, 64 byte aligned since the header is eight u64s.
+ *
+ * The mapped table supports lookups only (`get` / `contains`); adding to
+ * it, erasing from it or calling `free` on it is undefined. Release it with `close_mapped`,
+ * passing back the view and byte count output here.
+ *
+ * @param tbl Uninitialized table to populate from the mapping.
+ * @param path Relative to current directory path of the file to open.
+ * @param view_output Populated with the mapped view, for `close_mapped`.
+ * @param num_bytes_output Populated with the view's byte size, for
+ * `close_mapped`.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+static inline i64 TUNDRA_FUNC_NAME(open_mapped)(TUNDRA_TBL_NAME *tbl,
+    const char *path, const void **view_output, u64 *num_bytes_output)
+{
+    Tundra_File file;
+
+    i64 result = Tundra_File_open(&file, path,
+        TUNDRA_FILE_OPEN_MODE_READONLY, TUNDRA_FILE_WRITE_BEHAVIOR_NONE,
+        false, false);
+    if(result < 0) { return result; }
+
+    const void *view;
+    u64 num_bytes;
+
+    result = Tundra_File_map(&file, &view, &num_bytes);
+    Tundra_File_close(&file);
+    if(result < 0) { return result; }
+
+    const InTundra_HshTblFileHeader *header =
+        (const InTundra_HshTblFileHeader*)view;
+
+    // Reject files that are too small, not hash table files, were written by
+    // an incompatible instantiation, or were truncated after their header.
+    if(num_bytes < sizeof(InTundra_HshTblFileHeader) ||
+        header->magic != TUNDRA_HSHTBL_FILE_MAGIC ||
+        header->entry_bytes != sizeof(TUNDRA_ENTRY_NAME) ||
+        num_bytes < sizeof(InTundra_HshTblFileHeader) +
+            (header->top_capacity + header->cellar_capacity) *
+            sizeof(TUNDRA_ENTRY_NAME))
+    {
+        Tundra_File_unmap(view, num_bytes);
+        return -TUNDRA_ERR_INVARG;
+    }
+
+    tbl->data = (TUNDRA_ENTRY_NAME*)((const u8*)view +
+        sizeof(InTundra_HshTblFileHeader));
+    tbl->num_entries_top = header->num_entries_top;
+    tbl->top_capacity = header->top_capacity;
+    tbl->cellar_capacity = header->cellar_capacity;
+    tbl->next_avail_cell_idx = header->next_avail_cell_idx;
+    tbl->top_limit = TUNDRA_HSHTBL_TOP_LIMIT;
+
+    tbl->old_data = NULL;
+    tbl->old_top_capacity = 0;
+    tbl->old_total_capacity = 0;
+    tbl->migrate_pos = 0;
+
+    // Lookups never touch the freed-index stack, so it stays empty rather
+    // than copying the persisted list out of the view.
+    Tundra_DynStkU64_init(&tbl->avail_cellar_idxs);
+
+#if TUNDRA_HSHTBL_HOT_CACHE
+    tbl->gen = 1;
+#endif
+    TUNDRA_INT_HSHTBL_INVAL_HOT(tbl);
+
+    *view_output = view;
+    *num_bytes_output = num_bytes;
+    return 0;
+}
+
+/**
+ * @brief Releases a table opened with `open_mapped`, unmapping the view its
+ * entries live in.
+ *
+ * @param tbl Mapped table to release.
+ * @param view View output by `open_mapped`.
+ * @param num_bytes Byte size output by `open_mapped`.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+static inline i64 TUNDRA_FUNC_NAME(close_mapped)(TUNDRA_TBL_NAME *tbl,
+    const void *view, u64 num_bytes)
+{
+    Tundra_DynStkU64_free(&tbl->avail_cellar_idxs);
+    tbl->data = NULL;
+
+    return Tundra_File_unmap(view, num_bytes);
 }
+
+
+#ifdef __cplusplus
+} // Extern "C"
 #endif
+
+#undef TUNDRA_TBL_NAME
+#undef TUNDRA_ENTRY_NAME
+#undef TUNDRA_FUNC_NAME
+#undef TUNDRA_INT_FUNC_NAME
+#undef TUNDRA_INT_HSHTBL_HASH_MATCHES
+#undef TUNDRA_INT_HSHTBL_BUMP_GEN
+#undef TUNDRA_INT_HSHTBL_FILL_HOT
+#undef TUNDRA_INT_HSHTBL_INVAL_HOT
+#undef TUNDRA_KEY_EQ
+#undef TUNDRA_HSHTBL_CACHE_HASH
+#undef TUNDRA_HSHTBL_HOT_CACHE
@@ -0,0 +1,411 @@
+/**
+ * @file Heap.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Binary heap priority queue over a flat DynamicArray.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TYPE
+#error TUNDRA_TYPE not defined.
+#endif
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/internal/MacroHelper.h"
+#include "tundra/utils/FatalHandler.h"
+#include "tundra/utils/ScratchArena.h"
+
+#ifndef TUNDRA_HEAP_H
+#define TUNDRA_HEAP_H
+#endif
+
+// Ordering predicate; true if `first` should sit closer to the top of the
+// Heap than `second`. The default yields a min-heap.
+#ifndef TUNDRA_HEAP_BEFORE
+#define TUNDRA_HEAP_BEFORE(first, second) ((first) < (second))
+#endif
+
+
+// Type and Function Name Macros -----------------------------------------------
+#define TUNDRA_NAME TUNDRA_CONCAT(Tundra_Heap, TUNDRA_TYPENAME)
+#define TUNDRA_DYNARR_NAME TUNDRA_CONCAT(Tundra_DynamicArray, TUNDRA_TYPENAME)
+
+#define TUNDRA_FUNC_NAME(name) TUNDRA_CONCAT3(Tundra_Heap, TUNDRA_TYPENAME, \
+    _##name)
+#define TUNDRA_INT_FUNC_NAME(name) TUNDRA_CONCAT3(InTundra_Heap, \
+    TUNDRA_TYPENAME, _##name)
+#define TUNDRA_DYNARR_FUNC_NAME(name) TUNDRA_CONCAT3(Tundra_DynArr, \
+    TUNDRA_TYPENAME, _##name)
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Containers ------------------------------------------------------------------
+
+/**
+ * @brief Binary heap priority queue over a flat array of elements.
+ *
+ * The element the ordering predicate places first is always at the top;
+ * pushes and pops are O(log n), bulk construction from existing elements is
+ * O(n), and replacing the top for merge loops is a single sift instead of a
+ * pop plus push.
+ *
+ * Must be initialized using any of the `init` methods before use. Must be
+ * freed using the `free` method when no longer needed.
+ *
+ * Elements are byte copied during sifting; custom element handling (copy,
+ * free, move) is not supported.
+ *
+ * Internals are read-only.
+ */
+typedef struct TUNDRA_NAME
+{
+    // Underlying DynamicArray used for storing elements in heap order.
+    TUNDRA_DYNARR_NAME dyn_arr;
+
+} TUNDRA_NAME;
+
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Sifts the element at `index` up toward the top until its parent
+ * orders before it.
+ *
+ * @param heap Heap to sift in.
+ * @param index Index of the element to sift.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(sift_up)(TUNDRA_NAME *heap, u64 index)
+{
+    TUNDRA_TYPE *data = heap->dyn_arr.data;
+
+    while(index > 0)
+    {
+        const u64 PARENT = (index - 1) / 2;
+
+        if(!TUNDRA_HEAP_BEFORE(data[index], data[PARENT])) { break; }
+
+        TUNDRA_TYPE swap = data[PARENT];
+        data[PARENT] = data[index];
+        data[index] = swap;
+
+        index = PARENT;
+    }
+}
+
+/**
+ * @brief Sifts the element at `index` down away from the top until neither
+ * child orders before it.
+ *
+ * @param heap Heap to sift in.
+ * @param index Index of the element to sift.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(sift_down)(TUNDRA_NAME *heap,
+    u64 index)
+{
+    TUNDRA_TYPE *data = heap->dyn_arr.data;
+
+    const u64 NUM_ELEM = heap->dyn_arr.num_elem;
+
+    while(true)
+    {
+        const u64 LEFT = 2 * index + 1;
+        const u64 RIGHT = LEFT + 1;
+
+        u64 first = index;
+
+        if(LEFT < NUM_ELEM && TUNDRA_HEAP_BEFORE(data[LEFT], data[first]))
+        {
+            first = LEFT;
+        }
+
+        if(RIGHT < NUM_ELEM && TUNDRA_HEAP_BEFORE(data[RIGHT], data[first]))
+        {
+            first = RIGHT;
+        }
+
+        if(first == index) { return; }
+
+        TUNDRA_TYPE swap = data[first];
+        data[first] = data[index];
+        data[index] = swap;
+
+        index = first;
+    }
+}
+
+/**
+ * @brief Restores the heap ordering over every element in O(n) by sifting
+ * down from the last parent.
+ *
+ * @param heap Heap to restore.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(heapify)(TUNDRA_NAME *heap)
+{
+    const u64 NUM_ELEM = heap->dyn_arr.num_elem;
+
+    if(NUM_ELEM < 2) { return; }
+
+    for(u64 index = NUM_ELEM / 2; index-- > 0;)
+    {
+        TUNDRA_INT_FUNC_NAME(sift_down)(heap, index);
+    }
+}
+
+
+// Public Methods --------------------------------------------------------------
+
+/**
+ * @brief Initializes a Heap with default capacity. Allocates memory and sets
+ * internal components.
+ *
+ * Only initialize a Heap once. If an already initialized Heap is called with
+ * init, undefined behavior may occur.
+ *
+ * @param heap Heap to init.
+ */
+static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_NAME *heap)
+{
+    TUNDRA_DYNARR_FUNC_NAME(init)(&heap->dyn_arr);
+}
+
+/**
+ * @brief Initializes a Heap with default capacity inside `arena`, bump
+ * allocating its storage so the arena's reset reclaims it in O(1).
+ *
+ * Growth reallocates within the arena while it has room and migrates to the
+ * regular allocator once it runs out; `free` stays safe to call either way,
+ * frees of arena owned memory are absorbed as no-ops.
+ *
+ * Only initialize a Heap once. If an already initialized Heap is called with
+ * init, undefined behavior may occur.
+ *
+ * @param heap Heap to init.
+ * @param arena Scratch arena to allocate from.
+ */
+static inline void TUNDRA_FUNC_NAME(init_in)(TUNDRA_NAME *heap,
+    Tundra_ScratchArena *arena)
+{
+    Tundra_ScrArena_push_scope(arena);
+    TUNDRA_FUNC_NAME(init)(heap);
+    Tundra_ScrArena_pop_scope();
+}
+
+/**
+ * @brief Initializes a Heap with set capacity. Allocates memory and sets
+ * internal components.
+ *
+ * If `init_cap` is 0, the Heap is initialized with default capacity.
+ *
+ * Only initialize a Heap once. If an already initialized Heap is called with
+ * init, undefined behavior may occur.
+ *
+ * @param heap Heap to init.
+ * @param init_cap Specified initial capacity.
+ */
+static inline void TUNDRA_FUNC_NAME(init_cap)(TUNDRA_NAME *heap, u64 init_cap)
+{
+    TUNDRA_DYNARR_FUNC_NAME(init_cap)(&heap->dyn_arr, init_cap);
+}
+
+/**
+ * @brief Initializes a Heap from initial elems, which are copied in and
+ * heap-ordered with a bulk O(n) heapify rather than n pushes.
+ *
+ * Only initialize a Heap once. If an already initialized Heap is called with
+ * init, undefined behavior may occur.
+ *
+ * @param heap Heap to init.
+ * @param elems Array of elements to copy in.
+ * @param num_elem Number of elements in `elems`.
+ */
+static inline void TUNDRA_FUNC_NAME(init_elems)(TUNDRA_NAME *heap,
+    const TUNDRA_TYPE *elems, u64 num_elem)
+{
+    TUNDRA_DYNARR_FUNC_NAME(init_elems)(&heap->dyn_arr, elems, num_elem);
+
+    TUNDRA_INT_FUNC_NAME(heapify)(heap);
+}
+
+/**
+ * @brief Initializes a Heap by deep copying another Heap.
+ *
+ * `src` must be an initialized Heap, and `dst` must be uninitialized.
+ *
+ * @param dst Heap to deep copy to, must be uninitialized.
+ * @param src Heap to source from, must be initialized.
+ */
+static inline void TUNDRA_FUNC_NAME(init_copy)(TUNDRA_NAME *dst,
+    const TUNDRA_NAME *src)
+{
+    TUNDRA_DYNARR_FUNC_NAME(init_copy)(&dst->dyn_arr, &src->dyn_arr);
+}
+
+/**
+ * @brief Frees memory allocated for an initialized Heap.
+ *
+ * After calling this method, the Heap must not be used unless reinitialized.
+ *
+ * @param heap Initialized Heap to free.
+ */
+static inline void TUNDRA_FUNC_NAME(free)(TUNDRA_NAME *heap)
+{
+    TUNDRA_DYNARR_FUNC_NAME(free)(&heap->dyn_arr);
+}
+
+/**
+ * @brief Clears the Heap of all elements. The capacity remains unchanged.
+ *
+ * @param heap Heap to clear.
+ */
+static inline void TUNDRA_FUNC_NAME(clear)(TUNDRA_NAME *heap)
+{
+    TUNDRA_DYNARR_FUNC_NAME(clear)(&heap->dyn_arr);
+}
+
+/**
+ * @brief Adds an element to the Heap by copying it, expanding if necessary.
+ *
+ * @param heap Heap to push to.
+ * @param elem Pointer to the element to copy in.
+ */
+static inline void TUNDRA_FUNC_NAME(push_copy)(TUNDRA_NAME *heap,
+    const TUNDRA_TYPE *elem)
+{
+    TUNDRA_DYNARR_FUNC_NAME(add_copy)(&heap->dyn_arr, elem);
+
+    TUNDRA_INT_FUNC_NAME(sift_up)(heap, heap->dyn_arr.num_elem - 1);
+}
+
+static inline void TUNDRA_FUNC_NAME(push_val)(TUNDRA_NAME *heap,
+    TUNDRA_TYPE elem)
+{
+    TUNDRA_DYNARR_FUNC_NAME(add_val)(&heap->dyn_arr, elem);
+
+    TUNDRA_INT_FUNC_NAME(sift_up)(heap, heap->dyn_arr.num_elem - 1);
+}
+
+/**
+ * @brief Removes the element at the top of the Heap.
+ *
+ * A fatal is thrown if the Heap is empty with the Heap unmodified.
+ *
+ * @param heap Heap to pop from.
+ */
+static inline void TUNDRA_FUNC_NAME(pop)(TUNDRA_NAME *heap)
+{
+    if(heap->dyn_arr.num_elem == 0)
+    {
+        TUNDRA_FATAL("Attempted to pop but the Heap was empty.");
+        return;
+    }
+
+    --heap->dyn_arr.num_elem;
+
+    if(heap->dyn_arr.num_elem == 0) { return; }
+
+    heap->dyn_arr.data[0] = heap->dyn_arr.data[heap->dyn_arr.num_elem];
+
+    TUNDRA_INT_FUNC_NAME(sift_down)(heap, 0);
+}
+
+/**
+ * @brief Replaces the element at the top of the Heap with a copy of `elem`
+ * and restores ordering with a single sift down.
+ *
+ * For loops that pop one element and push the next one from the same source
+ * (k-way merge, timer re-arm), this halves the sifting a pop plus push would
+ * do.
+ *
+ * A fatal is thrown if the Heap is empty with the Heap unmodified.
+ *
+ * @param heap Heap to replace in.
+ * @param elem Pointer to the element to copy in.
+ */
+static inline void TUNDRA_FUNC_NAME(replace_top_copy)(TUNDRA_NAME *heap,
+    const TUNDRA_TYPE *elem)
+{
+    if(heap->dyn_arr.num_elem == 0)
+    {
+        TUNDRA_FATAL("Attempted to replace the top but the Heap was empty.");
+        return;
+    }
+
+    heap->dyn_arr.data[0] = *elem;
+
+    TUNDRA_INT_FUNC_NAME(sift_down)(heap, 0);
+}
+
+static inline void TUNDRA_FUNC_NAME(replace_top_val)(TUNDRA_NAME *heap,
+    TUNDRA_TYPE elem)
+{
+    TUNDRA_FUNC_NAME(replace_top_copy)(heap, &elem);
+}
+
+/**
+ * @brief Returns a const-pointer to the element at the top of the Heap.
+ *
+ * @attention For fast access, this method does not perform a check if the
+ * Heap is empty. It is the user's responsibility to ensure the Heap is not
+ * empty.
+ *
+ * @param heap Heap to query.
+ *
+ * @return const TUNDRA_TYPE* Const-pointer to the top element.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(top)(
+    const TUNDRA_NAME *heap)
+{
+    return (const TUNDRA_TYPE*)heap->dyn_arr.data;
+}
+
+/**
+ * @brief Returns true if the Heap holds no elements.
+ *
+ * @param heap Heap to query.
+ *
+ * @return bool True if empty.
+ */
+static inline bool TUNDRA_FUNC_NAME(is_empty)(const TUNDRA_NAME *heap)
+{
+    return heap->dyn_arr.num_elem == 0;
+}
+
+/**
+ * @brief Returns the number of elements in the Heap.
+ *
+ * @param heap Heap to query.
+ *
+ * @return `u64` Number of elements.
+ */
+static inline u64 TUNDRA_FUNC_NAME(size)(const TUNDRA_NAME *heap)
+{
+    return heap->dyn_arr.num_elem;
+}
+
+/**
+ * @brief Returns the current capacity of the Heap.
+ *
+ * @param heap Heap to query.
+ *
+ * @return `u64` Current capacity.
+ */
+static inline u64 TUNDRA_FUNC_NAME(capacity)(const TUNDRA_NAME *heap)
+{
+    return heap->dyn_arr.cap;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+
+#undef TUNDRA_NAME
+#undef TUNDRA_DYNARR_NAME
+#undef TUNDRA_FUNC_NAME
+#undef TUNDRA_INT_FUNC_NAME
+#undef TUNDRA_DYNARR_FUNC_NAME
+#undef TUNDRA_HEAP_BEFORE
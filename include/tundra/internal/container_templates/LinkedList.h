@@ -17,6 +17,7 @@
 #include "tundra/utils/MemUtils.h"
 #include "tundra/utils/FatalHandler.h"
 #include "tundra/utils/Math.h"
+#include "tundra/utils/ScratchArena.h"
 
 #ifndef TUNDRA_LNKLST_H
 #define TUNDRA_LNKLST_H
@@ -97,9 +98,12 @@ static const u64 TUNDRA_MAX_ELEMS_NAME =
  */
 typedef struct TUNDRA_LIST_NAME
 {
-    // Indexes inside the array of Nodes that have been freed and can be reused.
-    Tundra_DynamicStacku64 freed_idxs; 
-    
+    // Head of the intrusive chain of freed Node slots, threaded through their
+    // `next` members so recycling needs no side allocation. Holds
+    // TUNDRA_SENTINEL_IDX when no slot has been freed.
+    u64 free_head_idx;
+
+
     // Array of nodes.
     TUNDRA_NODE_NAME *nodes;
 
@@ -143,7 +147,7 @@ typedef struct TUNDRA_ITER_NAME
 static inline void TUNDRA_INT_FUNC_NAME(init)(
     TUNDRA_LIST_NAME *list, u64 init_cap)
 {
-    Tundra_DynStku64_init(&list->freed_idxs);
+    list->free_head_idx = TUNDRA_SENTINEL_IDX;
 
     const u64 INIT_CAP_BYTE = Tundra_ceil_pow2(init_cap * TUNDRA_NODE_SIZE);
 
@@ -205,6 +209,28 @@ static inline void TUNDRA_INT_FUNC_NAME(copy_nodes)(const TUNDRA_LIST_NAME *src,
     }
 }
 
+/**
+ * @brief Copies the intrusive free chain from `src` to `dst`, along with its
+ * head index.
+ *
+ * `copy_nodes` only walks the live chain, so the `next` members threading the
+ * freed slots are replicated here.
+ *
+ * @param src List to source the free chain from.
+ * @param dst List to copy the free chain to.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(copy_free_chain)(
+    const TUNDRA_LIST_NAME *src, TUNDRA_LIST_NAME *dst)
+{
+    dst->free_head_idx = src->free_head_idx;
+
+    for(u64 free_idx = src->free_head_idx; free_idx != TUNDRA_SENTINEL_IDX;
+        free_idx = src->nodes[free_idx].next)
+    {
+        dst->nodes[free_idx].next = src->nodes[free_idx].next;
+    }
+}
+
 #if TUNDRA_NEEDS_CUSTOM_FREE
 /**
  * @brief Frees all Nodes in a List by iterating through each one calling the 
@@ -239,9 +265,9 @@ static inline void TUNDRA_INT_FUNC_NAME(custom_free_nodes)
 static inline void TUNDRA_INT_FUNC_NAME(alloc_move_mem)(TUNDRA_LIST_NAME *list, 
     u64 new_cap_bytes)
 {
-    // Clear the freed indexes since we are moving all the existing Nodes into
-    // one consecutive line in the new memory. 
-    Tundra_DynStku64_clear(&list->freed_idxs);
+    // Drop the free chain since we are moving all the existing Nodes into
+    // one consecutive line in the new memory.
+    list->free_head_idx = TUNDRA_SENTINEL_IDX;
 
     TUNDRA_NODE_NAME *new_mem = 
         (TUNDRA_NODE_NAME*)Tundra_alloc_mem(new_cap_bytes);
@@ -341,20 +367,20 @@ static inline void TUNDRA_INT_FUNC_NAME(check_handle_exp)(
 static inline u64 TUNDRA_INT_FUNC_NAME(get_avail_index)(
     TUNDRA_LIST_NAME *list)
 {
-    // If there are no available indexes that have been freed.
-    if(Tundra_DynStku64_is_empty(&list->freed_idxs))
+    // If no slots have been freed for reuse.
+    if(list->free_head_idx == TUNDRA_SENTINEL_IDX)
     {
-        // Since there are no freed positions inside the array of Nodes, the 
-        // first available position will always be at the end of the filled 
-        // array of Nodes. We add 1 here to account for the Sentinel taking 
+        // Since there are no freed positions inside the array of Nodes, the
+        // first available position will always be at the end of the filled
+        // array of Nodes. We add 1 here to account for the Sentinel taking
         // up the zeroth index.
         return list->num_node + 1;
     }
 
-    // -- Fetch an available index from the stack of freed indexes. --
+    // -- Pop the head of the intrusive free chain. --
 
-    const u64 avail_index = *Tundra_DynStku64_front_cst(&list->freed_idxs);
-    Tundra_DynStku64_pop(&list->freed_idxs);
+    const u64 avail_index = list->free_head_idx;
+    list->free_head_idx = list->nodes[avail_index].next;
     return avail_index;
 }
 /**
@@ -369,12 +395,12 @@ static inline u64 TUNDRA_INT_FUNC_NAME(get_avail_index)(
 static inline u64 TUNDRA_INT_FUNC_NAME(find_idx_from_tail)(
     const TUNDRA_LIST_NAME *list, u64 pos)
 {
-    // Start parsing at the last Node in the List.
+    // Start parsing at the Sentinel and walk backwards through the tail.
     u64 parsed_idx = TUNDRA_SENTINEL_IDX;
 
     for(u64 i = 0; i < list->num_node - pos; ++i)
     {
-        parsed_idx = list->nodes[parsed_idx].next;
+        parsed_idx = list->nodes[parsed_idx].prev;
     }
 
     return parsed_idx;
@@ -761,6 +787,29 @@ static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_LIST_NAME *list)
     TUNDRA_INT_FUNC_NAME(init)(list, TUNDRA_LNKLST_DEF_CAP);
 }
 
+/**
+ * @brief Initializes a List with default capacity inside `arena`, so its node
+ * storage is bump allocated and reclaimed in O(1) when the arena is reset.
+ *
+ * Expansion allocates a fresh node block, which comes from the arena only
+ * while a scope on it is active; otherwise it comes from the regular
+ * allocator and the old arena bytes wait for reset. `free` stays safe to call
+ * either way, frees of arena owned memory are absorbed as no-ops.
+ *
+ * Only initialize a List once. If an already initialized List is called with
+ * init, undefined behavior may occur.
+ *
+ * @param list List to init.
+ * @param arena Scratch arena to allocate from.
+ */
+static inline void TUNDRA_FUNC_NAME(init_in)(TUNDRA_LIST_NAME *list,
+    Tundra_ScratchArena *arena)
+{
+    Tundra_ScrArena_push_scope(arena);
+    TUNDRA_FUNC_NAME(init)(list);
+    Tundra_ScrArena_pop_scope();
+}
+
 /**
  * @brief Initializes a List with set capacity. Allocates memory and sets
  * internal components.
@@ -797,7 +846,7 @@ static inline void TUNDRA_FUNC_NAME(init_cap)(TUNDRA_LIST_NAME *list,
 static inline void TUNDRA_FUNC_NAME(init_elems)(TUNDRA_LIST_NAME *list, 
     const TUNDRA_TYPE *elems, u64 num_elem)
 {
-    Tundra_DynStku64_init(&list->freed_idxs);
+    list->free_head_idx = TUNDRA_SENTINEL_IDX;
 
     // Number of elements needed for allocating with the Sentinel.
     const u64 NUM_ELEM_W_SENT = num_elem + 1;
@@ -860,14 +909,13 @@ static inline void TUNDRA_FUNC_NAME(init_elems)(TUNDRA_LIST_NAME *list,
 static inline void TUNDRA_FUNC_NAME(init_copy)(const TUNDRA_LIST_NAME *src,
     TUNDRA_LIST_NAME *dst) 
 {
-    // Shallow copy initially, we will deep copy required members next. 
+    // Shallow copy initially, we will deep copy required members next.
     *dst = *src;
 
-    Tundra_DynStku64_init_copy(&src->freed_idxs, &dst->freed_idxs);
-
     dst->nodes = (TUNDRA_NODE_NAME*)Tundra_alloc_mem(src->cap_bytes);
 
     TUNDRA_INT_FUNC_NAME(copy_nodes)(src, dst);
+    TUNDRA_INT_FUNC_NAME(copy_free_chain)(src, dst);
 }
 
 /**
@@ -892,8 +940,6 @@ static inline void TUNDRA_FUNC_NAME(init_move)(TUNDRA_LIST_NAME *src,
 
 static inline void TUNDRA_FUNC_NAME(free)(TUNDRA_LIST_NAME *list)
 {
-    Tundra_DynStku64_free(&list->freed_idxs);
-    
 #if TUNDRA_NEEDS_CUSTOM_FREE
 
     TUNDRA_INT_FUNC_NAME(custom_free_nodes)(list);
@@ -925,8 +971,6 @@ static inline void TUNDRA_FUNC_NAME(copy)(const TUNDRA_LIST_NAME *src,
 {
     if(dst == src) { return; }
 
-    Tundra_DynStku64_copy(&src->freed_idxs, &dst->freed_idxs);
-
     // If capacity bytes do not match, reallocate dst to match src.
     if(dst->cap_bytes != src->cap_bytes)
     {
@@ -937,6 +981,7 @@ static inline void TUNDRA_FUNC_NAME(copy)(const TUNDRA_LIST_NAME *src,
     }
 
     TUNDRA_INT_FUNC_NAME(copy_nodes)(src, dst);
+    TUNDRA_INT_FUNC_NAME(copy_free_chain)(src, dst);
     dst->num_node = src->num_node;
 }
 
@@ -971,7 +1016,7 @@ static inline void TUNDRA_FUNC_NAME(move)(TUNDRA_LIST_NAME *src,
  */
 static inline void TUNDRA_FUNC_NAME(clear)(TUNDRA_LIST_NAME *list)
 {
-    Tundra_DynStku64_clear(&list->freed_idxs);
+    list->free_head_idx = TUNDRA_SENTINEL_IDX;
 
 #if TUNDRA_NEEDS_CUSTOM_FREE
     
@@ -1334,8 +1379,9 @@ static inline void TUNDRA_FUNC_NAME(erase_front)(TUNDRA_LIST_NAME *list)
     // Update the Node after the head Node to point back to the Sentinel.
     list->nodes[node_to_free->next].prev = TUNDRA_SENTINEL_IDX;
 
-    // Add the erased index to the stack of freed indexes.
-    Tundra_DynStku64_push_by_init(&list->freed_idxs, HEAD_NODE_IDX);
+    // Thread the erased slot onto the intrusive free chain.
+    node_to_free->next = list->free_head_idx;
+    list->free_head_idx = HEAD_NODE_IDX;
 
     --list->num_node;
 }
@@ -1373,8 +1419,9 @@ static inline void TUNDRA_FUNC_NAME(erase_back)(TUNDRA_LIST_NAME *list)
     // Update hte Node before the tail Node to point next to the Sentinel.
     list->nodes[node_to_free->prev].next = TUNDRA_SENTINEL_IDX;
 
-    // Add the erased index to the stack of freed indexes.
-    Tundra_DynStku64_push_by_init(&list->freed_idxs, TAIL_NODE_IDX);
+    // Thread the erased slot onto the intrusive free chain.
+    node_to_free->next = list->free_head_idx;
+    list->free_head_idx = TAIL_NODE_IDX;
 
     --list->num_node;
 }
@@ -1419,8 +1466,9 @@ static inline void TUNDRA_FUNC_NAME(erase_at_index)(TUNDRA_LIST_NAME *list,
     // Node is pointing back to.
     list->nodes[node_at_erase_idx->next].prev = node_at_erase_idx->prev;
 
-    // Add the erased index to the stack of freed indexes.
-    Tundra_DynStku64_push_by_init(&list->freed_idxs, IDX_OF_NODE_AT_ERASE_POS);
+    // Thread the erased slot onto the intrusive free chain.
+    node_at_erase_idx->next = list->free_head_idx;
+    list->free_head_idx = IDX_OF_NODE_AT_ERASE_POS;
 
     --list->num_node;
 }
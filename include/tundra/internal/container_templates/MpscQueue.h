@@ -0,0 +1,396 @@
+/**
+ * @file MpscQueue.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Lock-free bounded multi-producer single-consumer queue.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TYPE
+#error TUNDRA_TYPE not defined.
+#endif
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/common/Core.h"
+#include "tundra/common/Atomics.h"
+#include "tundra/internal/MacroHelper.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/Math.h"
+#include "tundra/utils/FatalHandler.h"
+
+#ifndef TUNDRA_MPSCQ_H
+#define TUNDRA_MPSCQ_H
+#define TUNDRA_MPSCQ_DEF_CAP 256
+TUNDRA_CT_ASSERT(TUNDRA_IS_POW2(TUNDRA_MPSCQ_DEF_CAP));
+#endif
+
+
+// Type and Function Name Macros -----------------------------------------------
+#define TUNDRA_NAME TUNDRA_CONCAT(Tundra_MpscQueue, TUNDRA_TYPENAME)
+#define TUNDRA_CELL_NAME TUNDRA_CONCAT(InTundra_MpscQCell, TUNDRA_TYPENAME)
+
+#define TUNDRA_FUNC_NAME(name) TUNDRA_CONCAT3(Tundra_MpscQ, TUNDRA_TYPENAME, \
+    _##name)
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Containers ------------------------------------------------------------------
+
+/**
+ * One slot of the ring. The sequence number encodes whose turn the cell is:
+ * it equals the producer ticket when the cell is free, that ticket plus one
+ * once the element is written, and advances by the capacity when consumed.
+ */
+typedef struct TUNDRA_CELL_NAME
+{
+    u64 seq;
+    TUNDRA_TYPE elem;
+} TUNDRA_CELL_NAME;
+
+/**
+ * @brief Lock-free bounded queue for several producing threads and exactly
+ * one consuming thread.
+ *
+ * A power of 2 ring of sequenced cells; producers claim tickets on the
+ * enqueue cursor and stamp each cell's sequence number when its element is
+ * in place, so the consumer never observes a claimed-but-unwritten slot.
+ * The cursors sit on separate cache lines to keep producers and the
+ * consumer from bouncing the same line. The capacity is fixed: a push onto
+ * a full queue fails rather than blocking or resizing.
+ *
+ * Bulk push and pop move whole spans under a single cursor update each,
+ * amortizing the atomic traffic that bounds throughput at high producer
+ * counts.
+ *
+ * Must be initialized using any of the `init` methods before use. Must be
+ * freed using the `free` method when no longer needed. `pop` methods and
+ * `free` may only be called from the single consumer thread.
+ *
+ * Elements are byte copied; custom element handling (copy, free, move) is
+ * not supported and should be done by the user through external calls.
+ *
+ * Internals are read-only.
+ */
+typedef struct TUNDRA_NAME
+{
+    // Pointer to the heap allocated ring of sequenced cells.
+    TUNDRA_CELL_NAME *cells;
+
+    // Capacity of the ring in elements, always a power of 2.
+    u64 cap;
+
+    // Next producer ticket; claimed with atomic ops by producing threads.
+    u64 enq_pos;
+    u8 enq_padding[TUNDRA_CACHELINE_BYTES - sizeof(u64)];
+
+    // Next consumer ticket; written only by the consumer thread, read by
+    // producers to bound how far ahead they may claim.
+    u64 deq_pos;
+    u8 deq_padding[TUNDRA_CACHELINE_BYTES - sizeof(u64)];
+} TUNDRA_NAME;
+
+
+// Public Methods --------------------------------------------------------------
+
+/**
+ * @brief Initializes a Queue with set capacity, rounded up to a power of 2.
+ * Allocates memory and sets internal components.
+ *
+ * If `init_cap` is 0, the Queue is initialized with default capacity.
+ *
+ * Only initialize a Queue once. If an already initialized Queue is called
+ * with init, undefined behavior may occur.
+ *
+ * @param queue Queue to init.
+ * @param init_cap Specified capacity in elements.
+ */
+static inline void TUNDRA_FUNC_NAME(init_cap)(TUNDRA_NAME *queue,
+    u64 init_cap)
+{
+    init_cap = (init_cap == 0) ? TUNDRA_MPSCQ_DEF_CAP :
+        Tundra_ceil_pow2(init_cap);
+
+    queue->cells = (TUNDRA_CELL_NAME*)Tundra_alloc_mem(
+        init_cap * sizeof(TUNDRA_CELL_NAME));
+
+    // Each cell starts free for the ticket matching its index.
+    for(u64 i = 0; i < init_cap; ++i) { queue->cells[i].seq = i; }
+
+    queue->cap = init_cap;
+    queue->enq_pos = 0;
+    queue->deq_pos = 0;
+}
+
+/**
+ * @brief Initializes a Queue with default capacity. Allocates memory and
+ * sets internal components.
+ *
+ * Only initialize a Queue once. If an already initialized Queue is called
+ * with init, undefined behavior may occur.
+ *
+ * @param queue Queue to init.
+ */
+static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_NAME *queue)
+{
+    TUNDRA_FUNC_NAME(init_cap)(queue, TUNDRA_MPSCQ_DEF_CAP);
+}
+
+/**
+ * @brief Frees memory allocated for an initialized Queue.
+ *
+ * May only be called once no producer can still be pushing. After calling
+ * this method, the Queue must not be used unless reinitialized.
+ *
+ * @param queue Initialized Queue to free.
+ */
+static inline void TUNDRA_FUNC_NAME(free)(TUNDRA_NAME *queue)
+{
+    Tundra_free_mem((void*)queue->cells);
+
+    queue->cells = NULL;
+    queue->cap = 0;
+    queue->enq_pos = 0;
+    queue->deq_pos = 0;
+}
+
+/**
+ * @brief Attempts to add an element to the back of the Queue by copying it.
+ *
+ * Safe to call from any thread. Fails without blocking if the Queue is
+ * full.
+ *
+ * @param queue Queue to push to.
+ * @param elem Pointer to the element to copy in.
+ *
+ * @return bool True if the element was queued, false if the Queue is full.
+ */
+static inline bool TUNDRA_FUNC_NAME(try_push_copy)(TUNDRA_NAME *queue,
+    const TUNDRA_TYPE *elem)
+{
+    const u64 MASK = queue->cap - 1;
+
+    u64 pos = Tundra_atm_load_u64(&queue->enq_pos, TUNDRA_ATM_RELAXED);
+
+    while(true)
+    {
+        TUNDRA_CELL_NAME *cell = queue->cells + (pos & MASK);
+
+        const u64 SEQ = Tundra_atm_load_u64(&cell->seq,
+            TUNDRA_ATM_ACQUIRE);
+
+        // The cell is free for this ticket; claim the ticket and fill it.
+        if(SEQ == pos)
+        {
+            if(Tundra_atm_cas_u64(&queue->enq_pos, &pos, pos + 1,
+                TUNDRA_ATM_RELAXED, TUNDRA_ATM_RELAXED))
+            {
+                cell->elem = *elem;
+                Tundra_atm_store_u64(&cell->seq, pos + 1,
+                    TUNDRA_ATM_RELEASE);
+                return true;
+            }
+
+            // Lost the ticket to another producer; `pos` was refreshed by
+            // the failed CAS.
+            continue;
+        }
+
+        // The cell still holds an unconsumed element from a full lap ago.
+        if(SEQ < pos) { return false; }
+
+        // Another producer claimed this ticket; move to the current one.
+        pos = Tundra_atm_load_u64(&queue->enq_pos, TUNDRA_ATM_RELAXED);
+    }
+}
+
+static inline bool TUNDRA_FUNC_NAME(try_push_val)(TUNDRA_NAME *queue,
+    TUNDRA_TYPE elem)
+{
+    return TUNDRA_FUNC_NAME(try_push_copy)(queue, &elem);
+}
+
+/**
+ * @brief Attempts to add `num_elem` elements to the back of the Queue in
+ * one span, claiming all their tickets with a single atomic update.
+ *
+ * Safe to call from any thread. All-or-nothing: fails without queueing
+ * anything if the Queue lacks room for the whole span.
+ *
+ * @param queue Queue to push to.
+ * @param elems Array of elements to copy in.
+ * @param num_elem Number of elements in `elems`.
+ *
+ * @return bool True if the span was queued, false if there was no room.
+ */
+static inline bool TUNDRA_FUNC_NAME(try_push_mult)(TUNDRA_NAME *queue,
+    const TUNDRA_TYPE *elems, u64 num_elem)
+{
+    if(num_elem > queue->cap) { return false; }
+
+    const u64 MASK = queue->cap - 1;
+
+    u64 pos = Tundra_atm_load_u64(&queue->enq_pos, TUNDRA_ATM_RELAXED);
+
+    while(true)
+    {
+        // Room is judged against the consumer cursor; it only moves
+        // forward, so a span that fits at the snapshot still fits after
+        // the claim. Every claimed cell has then already been consumed a
+        // lap ago and is free for its ticket.
+        const u64 DEQ = Tundra_atm_load_u64(&queue->deq_pos,
+            TUNDRA_ATM_ACQUIRE);
+
+        if(pos + num_elem > DEQ + queue->cap) { return false; }
+
+        if(Tundra_atm_cas_u64(&queue->enq_pos, &pos, pos + num_elem,
+            TUNDRA_ATM_RELAXED, TUNDRA_ATM_RELAXED))
+        { break; }
+    }
+
+    for(u64 i = 0; i < num_elem; ++i)
+    {
+        TUNDRA_CELL_NAME *cell = queue->cells + ((pos + i) & MASK);
+
+        cell->elem = elems[i];
+        Tundra_atm_store_u64(&cell->seq, pos + i + 1, TUNDRA_ATM_RELEASE);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Attempts to remove the element at the front of the Queue, copying
+ * it to `dst`.
+ *
+ * May only be called from the single consumer thread. Fails without
+ * blocking if the Queue is empty.
+ *
+ * @param queue Queue to pop from.
+ * @param dst Location to copy the popped element to.
+ *
+ * @return bool True if an element was popped, false if the Queue is empty.
+ */
+static inline bool TUNDRA_FUNC_NAME(try_pop)(TUNDRA_NAME *queue,
+    TUNDRA_TYPE *dst)
+{
+    const u64 POS = queue->deq_pos;
+
+    TUNDRA_CELL_NAME *cell = queue->cells + (POS & (queue->cap - 1));
+
+    // A cell is readable once its producer stamped it with ticket + 1;
+    // anything else means the front element is not (fully) written yet.
+    if(Tundra_atm_load_u64(&cell->seq, TUNDRA_ATM_ACQUIRE) != POS + 1)
+    { return false; }
+
+    *dst = cell->elem;
+
+    // Mark the cell free for the producer one lap ahead, then publish the
+    // new consumer cursor for producers' room checks.
+    Tundra_atm_store_u64(&cell->seq, POS + queue->cap, TUNDRA_ATM_RELEASE);
+    Tundra_atm_store_u64(&queue->deq_pos, POS + 1, TUNDRA_ATM_RELEASE);
+
+    return true;
+}
+
+/**
+ * @brief Removes up to `max_elem` elements from the front of the Queue,
+ * copying them to `dst` in order under a single cursor update.
+ *
+ * May only be called from the single consumer thread. Stops early at the
+ * first element whose producer has not finished writing it.
+ *
+ * @param queue Queue to pop from.
+ * @param dst Array to copy the popped elements to.
+ * @param max_elem Maximum number of elements to pop.
+ *
+ * @return u64 Number of elements popped, 0 if the Queue is empty.
+ */
+static inline u64 TUNDRA_FUNC_NAME(pop_mult)(TUNDRA_NAME *queue,
+    TUNDRA_TYPE *dst, u64 max_elem)
+{
+    const u64 MASK = queue->cap - 1;
+    const u64 POS = queue->deq_pos;
+
+    u64 num_popped = 0;
+
+    while(num_popped < max_elem)
+    {
+        TUNDRA_CELL_NAME *cell =
+            queue->cells + ((POS + num_popped) & MASK);
+
+        if(Tundra_atm_load_u64(&cell->seq, TUNDRA_ATM_ACQUIRE) !=
+            POS + num_popped + 1)
+        { break; }
+
+        dst[num_popped] = cell->elem;
+
+        Tundra_atm_store_u64(&cell->seq, POS + num_popped + queue->cap,
+            TUNDRA_ATM_RELEASE);
+
+        ++num_popped;
+    }
+
+    if(num_popped > 0)
+    {
+        Tundra_atm_store_u64(&queue->deq_pos, POS + num_popped,
+            TUNDRA_ATM_RELEASE);
+    }
+
+    return num_popped;
+}
+
+/**
+ * @brief Returns the number of elements in the Queue at the moment of the
+ * call; concurrent pushes make the value stale immediately.
+ *
+ * @param queue Queue to query.
+ *
+ * @return `u64` Number of elements.
+ */
+static inline u64 TUNDRA_FUNC_NAME(size)(const TUNDRA_NAME *queue)
+{
+    const u64 ENQ = Tundra_atm_load_u64(&queue->enq_pos,
+        TUNDRA_ATM_RELAXED);
+    const u64 DEQ = Tundra_atm_load_u64(&queue->deq_pos,
+        TUNDRA_ATM_RELAXED);
+
+    return ENQ - DEQ;
+}
+
+/**
+ * @brief Returns true if the Queue held no elements at the moment of the
+ * call; concurrent pushes make the value stale immediately.
+ *
+ * @param queue Queue to query.
+ *
+ * @return bool True if empty.
+ */
+static inline bool TUNDRA_FUNC_NAME(is_empty)(const TUNDRA_NAME *queue)
+{
+    return TUNDRA_FUNC_NAME(size)(queue) == 0;
+}
+
+/**
+ * @brief Returns the fixed capacity of the Queue.
+ *
+ * @param queue Queue to query.
+ *
+ * @return `u64` Capacity in elements.
+ */
+static inline u64 TUNDRA_FUNC_NAME(capacity)(const TUNDRA_NAME *queue)
+{
+    return queue->cap;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+
+#undef TUNDRA_NAME
+#undef TUNDRA_CELL_NAME
+#undef TUNDRA_FUNC_NAME
@@ -0,0 +1,153 @@
+/**
+ * @file ParallelReduce.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Task-pool parallel reduction companion for the array containers.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TYPE
+#error TUNDRA_TYPE not defined.
+#endif
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/common/Atomics.h"
+#include "tundra/internal/MacroHelper.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/TaskPool.h"
+
+
+// Type and Function Name Macros -----------------------------------------------
+#define TUNDRA_DYNARR_NAME TUNDRA_CONCAT(Tundra_DynamicArray, TUNDRA_TYPENAME)
+
+#define TUNDRA_PARTIAL_NAME TUNDRA_CONCAT3(InTundra_ParRd, TUNDRA_TYPENAME, \
+    _Partial)
+#define TUNDRA_SPAN_CTX_NAME TUNDRA_CONCAT3(InTundra_ParRd, TUNDRA_TYPENAME, \
+    _SpanCtx)
+#define TUNDRA_INT_FUNC_NAME(name) TUNDRA_CONCAT3(InTundra_ParRd, \
+    TUNDRA_TYPENAME, _##name)
+#define TUNDRA_FUNC_NAME(name) TUNDRA_CONCAT3(Tundra_DynArr, \
+    TUNDRA_TYPENAME, _##name)
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * One span's partial sum, padded to its own cache line so neighboring spans
+ * accumulating at the same time do not false-share.
+ */
+typedef struct
+{
+    TUNDRA_TYPE value;
+} __attribute__((aligned(TUNDRA_CACHELINE_BYTES))) TUNDRA_PARTIAL_NAME;
+
+/**
+ * Shared context of one reduction: the element data and the partial slot
+ * table the spans write into.
+ */
+typedef struct
+{
+    const TUNDRA_TYPE *data;
+    TUNDRA_PARTIAL_NAME *partials;
+    u64 grain;
+} TUNDRA_SPAN_CTX_NAME;
+
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Sums one span of elements into the span's own partial slot.
+ *
+ * Spans are cut at `grain` boundaries from iteration 0, so `begin / grain`
+ * is the span's slot index.
+ *
+ * @param begin First element index of the span.
+ * @param end One past the last element index of the span.
+ * @param user_data The reduction's TUNDRA_SPAN_CTX_NAME.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(span)(u64 begin, u64 end,
+    void *user_data)
+{
+    TUNDRA_SPAN_CTX_NAME *ctx = (TUNDRA_SPAN_CTX_NAME*)user_data;
+
+    const TUNDRA_TYPE *data = ctx->data;
+
+    TUNDRA_TYPE sum = (TUNDRA_TYPE)0;
+
+    for(u64 i = begin; i < end; ++i) { sum += data[i]; }
+
+    ctx->partials[begin / ctx->grain].value = sum;
+}
+
+
+// Public Methods --------------------------------------------------------------
+
+/**
+ * @brief Sums the array's elements across the pool's workers.
+ *
+ * The range is split into spans reduced in parallel, each into its own
+ * cache-line-padded partial, and the partials are folded on the calling
+ * thread. Short arrays are summed inline without touching the pool.
+ *
+ * The array must not be modified while the reduction runs.
+ *
+ * @param arr Array to reduce.
+ * @param pool Pool to run the spans on.
+ *
+ * @return TUNDRA_TYPE Sum of every element, 0 if the array is empty.
+ */
+static inline TUNDRA_TYPE TUNDRA_FUNC_NAME(parallel_reduce)(
+    const TUNDRA_DYNARR_NAME *arr, Tundra_TaskPool *pool)
+{
+    const u64 NUM_ELEM = arr->num_elem;
+
+    // Several spans per worker so uneven finish times level out.
+    u64 grain = NUM_ELEM / (pool->num_workers * 8);
+
+    if(grain == 0) { grain = 1; }
+
+    const u64 NUM_SPANS = (NUM_ELEM + grain - 1) / grain;
+
+    if(NUM_SPANS <= 1)
+    {
+        TUNDRA_TYPE sum = (TUNDRA_TYPE)0;
+
+        for(u64 i = 0; i < NUM_ELEM; ++i) { sum += arr->data[i]; }
+
+        return sum;
+    }
+
+    TUNDRA_PARTIAL_NAME *partials = (TUNDRA_PARTIAL_NAME*)
+        Tundra_alloc_mem_aligned(NUM_SPANS * sizeof(TUNDRA_PARTIAL_NAME),
+            TUNDRA_CACHELINE_BYTES);
+
+    TUNDRA_SPAN_CTX_NAME ctx;
+    ctx.data = arr->data;
+    ctx.partials = partials;
+    ctx.grain = grain;
+
+    Tundra_parallel_for(pool, 0, NUM_ELEM, grain,
+        TUNDRA_INT_FUNC_NAME(span), &ctx);
+
+    TUNDRA_TYPE sum = (TUNDRA_TYPE)0;
+
+    for(u64 i = 0; i < NUM_SPANS; ++i) { sum += partials[i].value; }
+
+    Tundra_free_mem((void*)partials);
+
+    return sum;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+
+#undef TUNDRA_DYNARR_NAME
+#undef TUNDRA_PARTIAL_NAME
+#undef TUNDRA_SPAN_CTX_NAME
+#undef TUNDRA_INT_FUNC_NAME
+#undef TUNDRA_FUNC_NAME
@@ -0,0 +1,259 @@
+/**
+ * @file Pool.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Fixed-size object pool for fast uniform allocations with no
+ * per-object overhead.
+ * @version 0.1
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "tundra/internal/MacroHelper.h"
+#include "tundra/common/TypeDef.h"
+#include "tundra/internal/LargeMemAlloc.h"
+#include "tundra/utils/FatalHandler.h"
+#include "tundra/common/Core.h"
+
+#ifndef TUNDRA_POOL_H
+#define TUNDRA_POOL_H
+#define TUNDRA_POOL_DEF_SLAB_ELEMS 64
+#endif
+
+
+// Type and Function Name Macros -----------------------------------------------
+
+#define TUNDRA_NAME TUNDRA_CONCAT(Tundra_Pool, TUNDRA_TYPENAME)
+#define TUNDRA_SLOT_NAME TUNDRA_CONCAT(InTundra_PoolSlot, TUNDRA_TYPENAME)
+#define TUNDRA_SLAB_NAME TUNDRA_CONCAT(InTundra_PoolSlab, TUNDRA_TYPENAME)
+
+#define TUNDRA_FUNC_NAME(name) TUNDRA_CONCAT3(Tundra_Pool, TUNDRA_TYPENAME, \
+    _##name)
+#define TUNDRA_INT_FUNC_NAME(name) TUNDRA_CONCAT3(InTundra_Pool, \
+    TUNDRA_TYPENAME, _##name)
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Containers ------------------------------------------------------------------
+
+/**
+ * @brief A single slot of the pool. Live slots hold an element, freed slots
+ * reuse their own bytes to hold the free list link, so no per-object header is
+ * needed.
+ */
+typedef union TUNDRA_SLOT_NAME
+{
+    TUNDRA_TYPE datum;
+
+    // Next freed slot in the intrusive free list, only meaningful while the
+    // slot is released.
+    union TUNDRA_SLOT_NAME *next_free;
+} TUNDRA_SLOT_NAME;
+
+/**
+ * @brief A bulk-allocated slab of slots. Slabs are chained so the pool can
+ * release them all when freed. Slots follow this header directly in the same
+ * allocation.
+ */
+typedef struct TUNDRA_SLAB_NAME
+{
+    struct TUNDRA_SLAB_NAME *next_slab;
+} TUNDRA_SLAB_NAME;
+
+/**
+ * @brief Fixed-size object pool for allocating many uniform objects with no
+ * per-object header or size-class rounding.
+ *
+ * Objects are carved from bulk-allocated slabs and recycled through an
+ * intrusive free list threaded through released slots, so acquiring and
+ * releasing are both a pointer swap. Released objects keep their memory until
+ * the whole pool is freed.
+ *
+ * Acquired memory is uninitialized, and every acquired object must be
+ * released back to its own pool (never through `Tundra_free_mem`).
+ */
+typedef struct TUNDRA_NAME
+{
+    // Most recently released slot, head of the intrusive free list.
+    TUNDRA_SLOT_NAME *free_head;
+
+    // Most recently allocated slab, head of the slab chain.
+    TUNDRA_SLAB_NAME *slab_head;
+
+    // Number of slots each slab holds.
+    u64 slab_num_elem;
+
+    // Number of slots carved from the head slab so far.
+    u64 head_slab_used;
+} TUNDRA_NAME;
+
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Returns a pointer to the slot array of a slab, which sits directly
+ * after the slab header.
+ *
+ * @param slab Slab to get the slots of.
+ *
+ * @return TUNDRA_SLOT_NAME* Pointer to the slab's first slot.
+ */
+static inline TUNDRA_SLOT_NAME* TUNDRA_INT_FUNC_NAME(slab_slots)(
+    TUNDRA_SLAB_NAME *slab)
+{
+    return (TUNDRA_SLOT_NAME*)((u8*)slab + sizeof(TUNDRA_SLAB_NAME));
+}
+
+/**
+ * @brief Bulk-allocates a new slab and pushes it onto the pool's slab chain.
+ *
+ * @param pool Pool to grow.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(add_slab)(TUNDRA_NAME *pool)
+{
+    TUNDRA_SLAB_NAME *slab = (TUNDRA_SLAB_NAME*)InTundra_LgMemAlc_malloc(
+        sizeof(TUNDRA_SLAB_NAME) +
+        pool->slab_num_elem * sizeof(TUNDRA_SLOT_NAME));
+
+    slab->next_slab = pool->slab_head;
+
+    pool->slab_head = slab;
+    pool->head_slab_used = 0;
+}
+
+
+// Public Methods --------------------------------------------------------------
+
+/**
+ * @brief Initializes a Pool with a set number of slots per slab. The first
+ * slab is allocated up front.
+ *
+ * If `slab_num_elem` is 0, the default slab size is used.
+ *
+ * Only initialize a Pool once. If an already initialized Pool is called with
+ * init, undefined behavior may occur.
+ *
+ * @param pool Pool to init.
+ * @param slab_num_elem Number of objects each slab holds.
+ */
+static inline void TUNDRA_FUNC_NAME(init_cap)(TUNDRA_NAME *pool,
+    u64 slab_num_elem)
+{
+    pool->free_head = NULL;
+    pool->slab_head = NULL;
+    pool->slab_num_elem = (slab_num_elem == 0) ?
+        TUNDRA_POOL_DEF_SLAB_ELEMS : slab_num_elem;
+
+    TUNDRA_INT_FUNC_NAME(add_slab)(pool);
+}
+
+/**
+ * @brief Initializes a Pool with the default number of slots per slab.
+ *
+ * Only initialize a Pool once. If an already initialized Pool is called with
+ * init, undefined behavior may occur.
+ *
+ * @param pool Pool to init.
+ */
+static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_NAME *pool)
+{
+    TUNDRA_FUNC_NAME(init_cap)(pool, TUNDRA_POOL_DEF_SLAB_ELEMS);
+}
+
+/**
+ * @brief Acquires an object from the Pool, reusing a released slot when one
+ * is available and carving from the head slab (growing the slab chain if
+ * needed) otherwise.
+ *
+ * The returned memory is uninitialized.
+ *
+ * @param pool Pool to acquire from.
+ *
+ * @return TUNDRA_TYPE* Pointer to the acquired object.
+ */
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(acquire)(TUNDRA_NAME *pool)
+{
+    // Reuse the most recently released slot if there is one.
+    if(pool->free_head != NULL)
+    {
+        TUNDRA_SLOT_NAME *slot = pool->free_head;
+        pool->free_head = slot->next_free;
+
+        return &slot->datum;
+    }
+
+    // No released slots, carve the next unused slot from the head slab.
+    if(pool->head_slab_used == pool->slab_num_elem)
+    {
+        TUNDRA_INT_FUNC_NAME(add_slab)(pool);
+    }
+
+    TUNDRA_SLOT_NAME *slot =
+        TUNDRA_INT_FUNC_NAME(slab_slots)(pool->slab_head) +
+        pool->head_slab_used;
+
+    ++pool->head_slab_used;
+
+    return &slot->datum;
+}
+
+/**
+ * @brief Releases an object back to the Pool, making its slot reusable by a
+ * later acquire.
+ *
+ * The object must have been acquired from this Pool. Its memory is not
+ * returned to the allocator until the whole Pool is freed.
+ *
+ * @param pool Pool the object was acquired from.
+ * @param elem Object to release.
+ */
+static inline void TUNDRA_FUNC_NAME(release)(TUNDRA_NAME *pool,
+    TUNDRA_TYPE *elem)
+{
+    TUNDRA_SLOT_NAME *slot = (TUNDRA_SLOT_NAME*)elem;
+
+    slot->next_free = pool->free_head;
+    pool->free_head = slot;
+}
+
+/**
+ * @brief Frees every slab of the Pool at once, invalidating all objects
+ * acquired from it.
+ *
+ * Elements that need custom free handling must be handled by the caller
+ * before the Pool is freed, the Pool does not track which slots are live.
+ *
+ * @param pool Pool to free.
+ */
+static inline void TUNDRA_FUNC_NAME(free)(TUNDRA_NAME *pool)
+{
+    TUNDRA_SLAB_NAME *slab = pool->slab_head;
+
+    while(slab != NULL)
+    {
+        TUNDRA_SLAB_NAME *next = slab->next_slab;
+
+        InTundra_LgMemAlc_free((void*)slab);
+
+        slab = next;
+    }
+
+    pool->free_head = NULL;
+    pool->slab_head = NULL;
+    pool->head_slab_used = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+// Clean up macro definitions.
+#undef TUNDRA_NAME
+#undef TUNDRA_SLOT_NAME
+#undef TUNDRA_SLAB_NAME
+#undef TUNDRA_FUNC_NAME
+#undef TUNDRA_INT_FUNC_NAME
@@ -0,0 +1,561 @@
+/**
+ * @file RingBuffer.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Power-of-2 capacity ring buffer for first-in first-out queues.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TYPE
+#error TUNDRA_TYPE not defined.
+#endif
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/common/Core.h"
+#include "tundra/common/NumLimits.h"
+#include "tundra/internal/MacroHelper.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/MemUtils.h"
+#include "tundra/utils/Math.h"
+#include "tundra/utils/FatalHandler.h"
+#include "tundra/utils/ScratchArena.h"
+
+#ifndef TUNDRA_RINGBUF_H
+#define TUNDRA_RINGBUF_H
+#define TUNDRA_RINGBUF_DEF_CAP 8
+TUNDRA_CT_ASSERT(TUNDRA_IS_POW2(TUNDRA_RINGBUF_DEF_CAP));
+#endif
+
+
+// Type and Function Name Macros -----------------------------------------------
+#define TUNDRA_NAME TUNDRA_CONCAT(Tundra_RingBuffer, TUNDRA_TYPENAME)
+
+#define TUNDRA_FUNC_NAME(name) TUNDRA_CONCAT3(Tundra_RingBuf, TUNDRA_TYPENAME, \
+    _##name)
+#define TUNDRA_INT_FUNC_NAME(name) TUNDRA_CONCAT3(InTundra_RingBuf, \
+    TUNDRA_TYPENAME, _##name)
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Containers ------------------------------------------------------------------
+
+/**
+ * @brief Automatic resizing first-in first-out queue over a power of 2
+ * capacity ring of elements.
+ *
+ * Elements are pushed at the back and popped from the front; both are O(1)
+ * with wraparound handled by masking, so popping never shifts memory the way
+ * front-erasing a DynamicArray does. Bulk push and pop move whole contiguous
+ * spans with at most two copies each.
+ *
+ * Must be initialized using any of the `init` methods before use. Must be
+ * freed using the `free` method when no longer needed.
+ *
+ * Elements are byte copied; custom element handling (copy, free, move) is not
+ * supported and should be done by the user through external calls.
+ *
+ * Internals are read-only.
+ */
+typedef struct TUNDRA_NAME
+{
+    // Pointer to heap allocated ring of the elements.
+    TUNDRA_TYPE *data;
+
+    // Index of the front element inside the ring.
+    u64 head;
+
+    // Number of elements currently queued.
+    u64 num_elem;
+
+    // Current capacity of the ring in elements, always a power of 2.
+    u64 cap;
+} TUNDRA_NAME;
+
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Grows the ring to `new_cap` elements, re-linearizing the queued
+ * elements to the start of the new memory.
+ *
+ * Assumes `new_cap` is a power of 2 greater than the current capacity.
+ *
+ * @param buf Buffer to grow.
+ * @param new_cap New capacity in elems, power of 2.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(grow)(TUNDRA_NAME *buf, u64 new_cap)
+{
+    if(new_cap > TUNDRA_UINT64_MAX / sizeof(TUNDRA_TYPE))
+    {
+        TUNDRA_FATAL("Capacity overflow on expansion.");
+        return;
+    }
+
+    TUNDRA_TYPE *new_mem =
+        (TUNDRA_TYPE*)Tundra_alloc_mem(new_cap * sizeof(TUNDRA_TYPE));
+
+    // Number of queued elements between the head and the end of the ring; the
+    // rest wrapped around to the start.
+    const u64 NUM_TAIL = buf->cap - buf->head < buf->num_elem ?
+        buf->cap - buf->head : buf->num_elem;
+
+    Tundra_copy_mem_fwd
+    (
+        (const void*)(buf->data + buf->head),
+        (void*)new_mem,
+        NUM_TAIL * sizeof(TUNDRA_TYPE)
+    );
+
+    Tundra_copy_mem_fwd
+    (
+        (const void*)buf->data,
+        (void*)(new_mem + NUM_TAIL),
+        (buf->num_elem - NUM_TAIL) * sizeof(TUNDRA_TYPE)
+    );
+
+    Tundra_free_mem((void*)buf->data);
+
+    buf->data = new_mem;
+    buf->head = 0;
+    buf->cap = new_cap;
+}
+
+/**
+ * @brief Checks if the Buffer has filled its capacity, growing it if it has.
+ *
+ * @param buf Buffer to handle.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(check_handle_exp)(TUNDRA_NAME *buf)
+{
+    if(buf->num_elem < buf->cap) { return; }
+
+    TUNDRA_INT_FUNC_NAME(grow)(buf, 2 * buf->cap);
+}
+
+
+// Public Methods --------------------------------------------------------------
+
+/**
+ * @brief Initializes a Buffer with default capacity. Allocates memory and
+ * sets internal components.
+ *
+ * Only initialize a Buffer once. If an already initialized Buffer is called
+ * with init, undefined behavior may occur.
+ *
+ * @param buf Buffer to init.
+ */
+static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_NAME *buf)
+{
+    buf->data = (TUNDRA_TYPE*)Tundra_alloc_mem(
+        TUNDRA_RINGBUF_DEF_CAP * sizeof(TUNDRA_TYPE));
+
+    buf->head = 0;
+    buf->num_elem = 0;
+    buf->cap = TUNDRA_RINGBUF_DEF_CAP;
+}
+
+/**
+ * @brief Initializes a Buffer with default capacity inside `arena`, bump
+ * allocating its storage so the arena's reset reclaims it in O(1).
+ *
+ * Growth allocates fresh storage, which only comes from the arena while a
+ * scope on it is active; otherwise it comes from the regular allocator and
+ * the old arena bytes wait for reset. `free` stays safe to call either way,
+ * frees of arena owned memory are absorbed as no-ops.
+ *
+ * Only initialize a Buffer once. If an already initialized Buffer is called
+ * with init, undefined behavior may occur.
+ *
+ * @param buf Buffer to init.
+ * @param arena Scratch arena to allocate from.
+ */
+static inline void TUNDRA_FUNC_NAME(init_in)(TUNDRA_NAME *buf,
+    Tundra_ScratchArena *arena)
+{
+    Tundra_ScrArena_push_scope(arena);
+    TUNDRA_FUNC_NAME(init)(buf);
+    Tundra_ScrArena_pop_scope();
+}
+
+/**
+ * @brief Initializes a Buffer with set capacity, rounded up to a power of 2.
+ * Allocates memory and sets internal components.
+ *
+ * If `init_cap` is 0, the Buffer is initialized with default capacity.
+ *
+ * Only initialize a Buffer once. If an already initialized Buffer is called
+ * with init, undefined behavior may occur.
+ *
+ * @param buf Buffer to init.
+ * @param init_cap Specified initial capacity.
+ */
+static inline void TUNDRA_FUNC_NAME(init_cap)(TUNDRA_NAME *buf, u64 init_cap)
+{
+    init_cap = (init_cap == 0) ? TUNDRA_RINGBUF_DEF_CAP :
+        Tundra_ceil_pow2(init_cap);
+
+    buf->data =
+        (TUNDRA_TYPE*)Tundra_alloc_mem(init_cap * sizeof(TUNDRA_TYPE));
+
+    buf->head = 0;
+    buf->num_elem = 0;
+    buf->cap = init_cap;
+}
+
+/**
+ * @brief Initializes a Buffer by deep copying another Buffer. The copy is
+ * re-linearized, its queued elements starting at the front of the ring.
+ *
+ * `src` must be an initialized Buffer, and `dst` must be uninitialized.
+ *
+ * @param dst Buffer to deep copy to, must be uninitialized.
+ * @param src Buffer to source from, must be initialized.
+ */
+static inline void TUNDRA_FUNC_NAME(init_copy)(TUNDRA_NAME *dst,
+    const TUNDRA_NAME *src)
+{
+    dst->data =
+        (TUNDRA_TYPE*)Tundra_alloc_mem(src->cap * sizeof(TUNDRA_TYPE));
+
+    const u64 NUM_TAIL = src->cap - src->head < src->num_elem ?
+        src->cap - src->head : src->num_elem;
+
+    Tundra_copy_mem_fwd
+    (
+        (const void*)(src->data + src->head),
+        (void*)dst->data,
+        NUM_TAIL * sizeof(TUNDRA_TYPE)
+    );
+
+    Tundra_copy_mem_fwd
+    (
+        (const void*)src->data,
+        (void*)(dst->data + NUM_TAIL),
+        (src->num_elem - NUM_TAIL) * sizeof(TUNDRA_TYPE)
+    );
+
+    dst->head = 0;
+    dst->num_elem = src->num_elem;
+    dst->cap = src->cap;
+}
+
+/**
+ * @brief Frees memory allocated for an initialized Buffer.
+ *
+ * After calling this method, the Buffer must not be used unless
+ * reinitialized.
+ *
+ * @param buf Initialized Buffer to free.
+ */
+static inline void TUNDRA_FUNC_NAME(free)(TUNDRA_NAME *buf)
+{
+    Tundra_free_mem((void*)buf->data);
+
+    buf->data = NULL;
+    buf->head = 0;
+    buf->num_elem = 0;
+    buf->cap = 0;
+}
+
+/**
+ * @brief Clears the Buffer of all elements. The capacity remains unchanged.
+ *
+ * @param buf Buffer to clear.
+ */
+static inline void TUNDRA_FUNC_NAME(clear)(TUNDRA_NAME *buf)
+{
+    buf->head = 0;
+    buf->num_elem = 0;
+}
+
+/**
+ * @brief Adds an element to the back of the Buffer by copying it, expanding
+ * if necessary.
+ *
+ * @param buf Buffer to push to.
+ * @param elem Pointer to the element to copy in.
+ */
+static inline void TUNDRA_FUNC_NAME(push_copy)(TUNDRA_NAME *buf,
+    const TUNDRA_TYPE *elem)
+{
+    TUNDRA_INT_FUNC_NAME(check_handle_exp)(buf);
+
+    buf->data[(buf->head + buf->num_elem) & (buf->cap - 1)] = *elem;
+
+    ++buf->num_elem;
+}
+
+static inline void TUNDRA_FUNC_NAME(push_val)(TUNDRA_NAME *buf,
+    TUNDRA_TYPE elem)
+{
+    TUNDRA_INT_FUNC_NAME(check_handle_exp)(buf);
+
+    buf->data[(buf->head + buf->num_elem) & (buf->cap - 1)] = elem;
+
+    ++buf->num_elem;
+}
+
+/**
+ * @brief Adds `num_elem` elements to the back of the Buffer by copying them,
+ * expanding if necessary.
+ *
+ * The elements are copied in at most two contiguous spans.
+ *
+ * @param buf Buffer to push to.
+ * @param elems Array of elements to copy in.
+ * @param num_elem Number of elements in `elems`.
+ */
+static inline void TUNDRA_FUNC_NAME(push_mult_copy)(TUNDRA_NAME *buf,
+    const TUNDRA_TYPE *elems, u64 num_elem)
+{
+    if(buf->num_elem + num_elem > buf->cap)
+    {
+        TUNDRA_INT_FUNC_NAME(grow)(buf,
+            Tundra_ceil_pow2(buf->num_elem + num_elem));
+    }
+
+    const u64 MASK = buf->cap - 1;
+    const u64 TAIL = (buf->head + buf->num_elem) & MASK;
+
+    // Elements that fit between the tail and the end of the ring; the rest
+    // wrap around to the start.
+    const u64 NUM_FIT = buf->cap - TAIL < num_elem ? buf->cap - TAIL :
+        num_elem;
+
+    Tundra_copy_mem_fwd
+    (
+        (const void*)elems,
+        (void*)(buf->data + TAIL),
+        NUM_FIT * sizeof(TUNDRA_TYPE)
+    );
+
+    Tundra_copy_mem_fwd
+    (
+        (const void*)(elems + NUM_FIT),
+        (void*)buf->data,
+        (num_elem - NUM_FIT) * sizeof(TUNDRA_TYPE)
+    );
+
+    buf->num_elem += num_elem;
+}
+
+/**
+ * @brief Removes the element at the front of the Buffer.
+ *
+ * A fatal is thrown if the Buffer is empty with the Buffer unmodified.
+ *
+ * @param buf Buffer to pop from.
+ */
+static inline void TUNDRA_FUNC_NAME(pop)(TUNDRA_NAME *buf)
+{
+    if(buf->num_elem == 0)
+    {
+        TUNDRA_FATAL("Attempted to pop but the Buffer was empty.");
+        return;
+    }
+
+    buf->head = (buf->head + 1) & (buf->cap - 1);
+    --buf->num_elem;
+}
+
+/**
+ * @brief Removes `num_elem` elements from the front of the Buffer, copying
+ * them to `dst` in order.
+ *
+ * The elements are copied out in at most two contiguous spans. A fatal is
+ * thrown if the Buffer holds fewer than `num_elem` elements with the Buffer
+ * unmodified.
+ *
+ * @param buf Buffer to pop from.
+ * @param dst Array to copy the popped elements to.
+ * @param num_elem Number of elements to pop.
+ */
+static inline void TUNDRA_FUNC_NAME(pop_mult)(TUNDRA_NAME *buf,
+    TUNDRA_TYPE *dst, u64 num_elem)
+{
+    if(num_elem > buf->num_elem)
+    {
+        TUNDRA_FATAL("Attempted to pop \"%llu\" elements but the Buffer holds "
+            "\"%llu\".", num_elem, buf->num_elem);
+        return;
+    }
+
+    const u64 NUM_TAIL = buf->cap - buf->head < num_elem ?
+        buf->cap - buf->head : num_elem;
+
+    Tundra_copy_mem_fwd
+    (
+        (const void*)(buf->data + buf->head),
+        (void*)dst,
+        NUM_TAIL * sizeof(TUNDRA_TYPE)
+    );
+
+    Tundra_copy_mem_fwd
+    (
+        (const void*)buf->data,
+        (void*)(dst + NUM_TAIL),
+        (num_elem - NUM_TAIL) * sizeof(TUNDRA_TYPE)
+    );
+
+    buf->head = (buf->head + num_elem) & (buf->cap - 1);
+    buf->num_elem -= num_elem;
+}
+
+/**
+ * @brief Returns a pointer to the element at the front of the Buffer.
+ *
+ * @attention For fast access, this method does not perform a check if the
+ * Buffer is empty. It is the user's responsibility to ensure the Buffer is
+ * not empty.
+ *
+ * @param buf Buffer to query.
+ *
+ * @return TUNDRA_TYPE* Pointer to the front element.
+ */
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(front_mut)(TUNDRA_NAME *buf)
+{
+    return buf->data + buf->head;
+}
+
+/**
+ * @brief Returns a const-pointer to the element at the front of the Buffer.
+ *
+ * @attention For fast access, this method does not perform a check if the
+ * Buffer is empty. It is the user's responsibility to ensure the Buffer is
+ * not empty.
+ *
+ * @param buf Buffer to query.
+ *
+ * @return const TUNDRA_TYPE* Const-pointer to the front element.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(front)(
+    const TUNDRA_NAME *buf)
+{
+    return (const TUNDRA_TYPE*)(buf->data + buf->head);
+}
+
+/**
+ * @brief Returns a pointer to the element at the back of the Buffer.
+ *
+ * @attention For fast access, this method does not perform a check if the
+ * Buffer is empty. It is the user's responsibility to ensure the Buffer is
+ * not empty.
+ *
+ * @param buf Buffer to query.
+ *
+ * @return TUNDRA_TYPE* Pointer to the back element.
+ */
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(back_mut)(TUNDRA_NAME *buf)
+{
+    return buf->data + ((buf->head + buf->num_elem - 1) & (buf->cap - 1));
+}
+
+/**
+ * @brief Returns a const-pointer to the element at the back of the Buffer.
+ *
+ * @attention For fast access, this method does not perform a check if the
+ * Buffer is empty. It is the user's responsibility to ensure the Buffer is
+ * not empty.
+ *
+ * @param buf Buffer to query.
+ *
+ * @return const TUNDRA_TYPE* Const-pointer to the back element.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(back)(
+    const TUNDRA_NAME *buf)
+{
+    return (const TUNDRA_TYPE*)(buf->data +
+        ((buf->head + buf->num_elem - 1) & (buf->cap - 1)));
+}
+
+/**
+ * @brief Returns a const-pointer to the queued element `index` places behind
+ * the front.
+ *
+ * @attention For fast access, this method does not perform a bounds check on
+ * `index`. It is the user's responsibility to ensure the index is valid.
+ *
+ * @param buf Buffer to index into.
+ * @param index Index to get element, 0 being the front.
+ *
+ * @return const TUNDRA_TYPE* Const-pointer to the element at `index`.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(at_nochk)(
+    const TUNDRA_NAME *buf, u64 index)
+{
+    return (const TUNDRA_TYPE*)(buf->data +
+        ((buf->head + index) & (buf->cap - 1)));
+}
+
+/**
+ * @brief Returns a const-pointer to the queued element `index` places behind
+ * the front with bounds checking.
+ *
+ * A fatal is thrown if the index is out of range, returning NULL.
+ *
+ * @param buf Buffer to index into.
+ * @param index Index to get element, 0 being the front.
+ *
+ * @return const TUNDRA_TYPE* Const-pointer to the element at `index`.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(at)(
+    const TUNDRA_NAME *buf, u64 index)
+{
+    if(index >= buf->num_elem)
+    {
+        TUNDRA_FATAL("Index \"%llu\" out of bounds for Buffer of size "
+            "\"%llu\".", index, buf->num_elem);
+        return NULL;
+    }
+
+    return TUNDRA_FUNC_NAME(at_nochk)(buf, index);
+}
+
+/**
+ * @brief Returns true if the Buffer holds no elements.
+ *
+ * @param buf Buffer to query.
+ *
+ * @return bool True if empty.
+ */
+static inline bool TUNDRA_FUNC_NAME(is_empty)(const TUNDRA_NAME *buf)
+{
+    return buf->num_elem == 0;
+}
+
+/**
+ * @brief Returns the number of elements in the Buffer.
+ *
+ * @param buf Buffer to query.
+ *
+ * @return `u64` Number of elements.
+ */
+static inline u64 TUNDRA_FUNC_NAME(size)(const TUNDRA_NAME *buf)
+{
+    return buf->num_elem;
+}
+
+/**
+ * @brief Returns the current capacity of the Buffer.
+ *
+ * @param buf Buffer to query.
+ *
+ * @return `u64` Current capacity.
+ */
+static inline u64 TUNDRA_FUNC_NAME(capacity)(const TUNDRA_NAME *buf)
+{
+    return buf->cap;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+
+#undef TUNDRA_NAME
+#undef TUNDRA_FUNC_NAME
+#undef TUNDRA_INT_FUNC_NAME
@@ -0,0 +1,549 @@
+/**
+ * @file SlotMap.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Generational handle container with dense storage and O(1) access.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TYPE
+#error TUNDRA_TYPE not defined.
+#endif
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/common/NumLimits.h"
+#include "tundra/internal/MacroHelper.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/MemUtils.h"
+#include "tundra/utils/Math.h"
+#include "tundra/utils/FatalHandler.h"
+#include "tundra/utils/ScratchArena.h"
+
+#ifndef TUNDRA_SLOTMAP_H
+#define TUNDRA_SLOTMAP_H
+#define TUNDRA_SLOTMAP_DEF_CAP 4
+
+// Slot value marking the end of the intrusive free chain.
+#define TUNDRA_SLOTMAP_NIL 0xFFFFFFFFU
+#endif
+
+
+// Type and Function Name Macros -----------------------------------------------
+#define TUNDRA_NAME TUNDRA_CONCAT(Tundra_SlotMap, TUNDRA_TYPENAME)
+
+#define TUNDRA_FUNC_NAME(name) TUNDRA_CONCAT3(Tundra_SlotMap, \
+    TUNDRA_TYPENAME, _##name)
+#define TUNDRA_INT_FUNC_NAME(name) TUNDRA_CONCAT3(InTundra_SlotMap, \
+    TUNDRA_TYPENAME, _##name)
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Containers ------------------------------------------------------------------
+
+/**
+ * @brief Generational handle container: O(1) insert, erase and lookup with
+ * stable handles and dense value storage.
+ *
+ * Adding an element mints a packed u64 handle (slot index in the low 32 bits,
+ * the slot's generation in the high 32). The values themselves live in a
+ * dense array with no holes, so iteration runs over contiguous memory at full
+ * cache speed; erasing swap-pops the dense array and bumps the slot's
+ * generation, which invalidates every outstanding handle to it in O(1)
+ * without a hash probe per access.
+ *
+ * Generations wrap after 2^32 erases of the same slot, at which point a
+ * handle from that long ago would read as valid again.
+ *
+ * Must be initialized using any of the `init` methods before use. Must be
+ * freed using the `free` method when no longer needed.
+ *
+ * Elements are byte copied; custom element handling (copy, free, move) is not
+ * supported and should be done by the user through external calls.
+ *
+ * Internals are read-only.
+ */
+typedef struct TUNDRA_NAME
+{
+    // Dense heap allocated array of the elements, no holes.
+    TUNDRA_TYPE *data;
+
+    // Slot index owning each dense element, parallel to `data`. Used to fix
+    // the moved element's slot on a swap-pop erase.
+    u32 *dense_to_slot;
+
+    // Sparse slot array. The high 32 bits of each entry hold the slot's
+    // generation, the low 32 hold its dense index while occupied or the next
+    // free slot (TUNDRA_SLOTMAP_NIL terminated) while on the free chain.
+    u64 *slots;
+
+    // Number of elements currently added.
+    u64 num_elem;
+
+    // Number of elements the dense arrays can hold before resizing.
+    u64 cap;
+
+    // Number of slots in the sparse array.
+    u64 slot_cap;
+
+    // Head of the intrusive chain of free slots, TUNDRA_SLOTMAP_NIL if every
+    // slot is occupied.
+    u32 free_head;
+} TUNDRA_NAME;
+
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Doubles the dense arrays once `num_elem` has reached `cap`.
+ *
+ * @param map Map to handle.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(check_handle_dense_exp)(
+    TUNDRA_NAME *map)
+{
+    if(map->num_elem < map->cap) { return; }
+
+    const u64 NEW_CAP = 2 * map->cap;
+
+    map->data = (TUNDRA_TYPE*)Tundra_realloc_mem((void*)map->data,
+        NEW_CAP * sizeof(TUNDRA_TYPE));
+    map->dense_to_slot = (u32*)Tundra_realloc_mem((void*)map->dense_to_slot,
+        NEW_CAP * sizeof(u32));
+
+    map->cap = NEW_CAP;
+}
+
+/**
+ * @brief Pops a free slot, doubling the sparse array and chaining the new
+ * slots when none are free.
+ *
+ * @param map Map to take a slot from.
+ *
+ * @return u32 Index of the claimed slot.
+ */
+static inline u32 TUNDRA_INT_FUNC_NAME(claim_slot)(TUNDRA_NAME *map)
+{
+    if(map->free_head == TUNDRA_SLOTMAP_NIL)
+    {
+        const u64 OLD_SLOT_CAP = map->slot_cap;
+        const u64 NEW_SLOT_CAP = 2 * OLD_SLOT_CAP;
+
+        if(NEW_SLOT_CAP > TUNDRA_SLOTMAP_NIL)
+        {
+            TUNDRA_FATAL("Slot index overflow on expansion.");
+        }
+
+        map->slots = (u64*)Tundra_realloc_mem((void*)map->slots,
+            NEW_SLOT_CAP * sizeof(u64));
+
+        // Thread the new slots into a fresh free chain, generation 0.
+        for(u64 i = OLD_SLOT_CAP; i < NEW_SLOT_CAP - 1; ++i)
+        {
+            map->slots[i] = (u64)(i + 1);
+        }
+
+        map->slots[NEW_SLOT_CAP - 1] = (u64)TUNDRA_SLOTMAP_NIL;
+
+        map->free_head = (u32)OLD_SLOT_CAP;
+        map->slot_cap = NEW_SLOT_CAP;
+    }
+
+    const u32 SLOT = map->free_head;
+
+    map->free_head = (u32)(map->slots[SLOT] & 0xFFFFFFFFU);
+
+    return SLOT;
+}
+
+/**
+ * @brief Claims a slot for a new dense element and returns the minted handle.
+ *
+ * The element itself is left for the caller to write at index
+ * `map->num_elem - 1`.
+ *
+ * @param map Map to add to.
+ *
+ * @return u64 Handle to the new element.
+ */
+static inline u64 TUNDRA_INT_FUNC_NAME(prepare_add)(TUNDRA_NAME *map)
+{
+    TUNDRA_INT_FUNC_NAME(check_handle_dense_exp)(map);
+
+    const u32 SLOT = TUNDRA_INT_FUNC_NAME(claim_slot)(map);
+
+    const u64 GENERATION = map->slots[SLOT] >> 32;
+
+    // Point the slot at the new dense tail, keeping its generation.
+    map->slots[SLOT] = (GENERATION << 32) | map->num_elem;
+
+    map->dense_to_slot[map->num_elem] = SLOT;
+    ++map->num_elem;
+
+    return (GENERATION << 32) | SLOT;
+}
+
+/**
+ * @brief Returns the dense index a handle maps to, or the map's size if the
+ * handle is stale or out of range.
+ *
+ * @param map Map to resolve against.
+ * @param handle Handle to resolve.
+ *
+ * @return u64 Dense index, the map's size if invalid.
+ */
+static inline u64 TUNDRA_INT_FUNC_NAME(resolve)(const TUNDRA_NAME *map,
+    u64 handle)
+{
+    const u32 SLOT = (u32)(handle & 0xFFFFFFFFU);
+
+    if(SLOT >= map->slot_cap) { return map->num_elem; }
+
+    const u64 SLOT_ENTRY = map->slots[SLOT];
+
+    // A stale handle's generation no longer matches the slot's.
+    if((SLOT_ENTRY >> 32) != (handle >> 32)) { return map->num_elem; }
+
+    const u64 DENSE_IDX = SLOT_ENTRY & 0xFFFFFFFFU;
+
+    // A free slot's low bits hold the next free index; the bounds check
+    // rejects them since a free slot can never point inside the dense array
+    // with a matching generation, except transiently after 2^32 generations.
+    return (DENSE_IDX < map->num_elem &&
+        map->dense_to_slot[DENSE_IDX] == SLOT) ? DENSE_IDX : map->num_elem;
+}
+
+
+// Public Methods --------------------------------------------------------------
+
+/**
+ * @brief Initializes a Map with default capacity. Allocates memory and sets
+ * internal components.
+ *
+ * Only initialize a Map once. If an already initialized Map is called with
+ * init, undefined behavior may occur.
+ *
+ * @param map Map to init.
+ */
+static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_NAME *map)
+{
+    map->data = (TUNDRA_TYPE*)Tundra_alloc_mem(
+        TUNDRA_SLOTMAP_DEF_CAP * sizeof(TUNDRA_TYPE));
+    map->dense_to_slot = (u32*)Tundra_alloc_mem(
+        TUNDRA_SLOTMAP_DEF_CAP * sizeof(u32));
+    map->slots = (u64*)Tundra_alloc_mem(
+        TUNDRA_SLOTMAP_DEF_CAP * sizeof(u64));
+
+    // Thread every slot into the free chain, generation 0.
+    for(u64 i = 0; i < TUNDRA_SLOTMAP_DEF_CAP - 1; ++i)
+    {
+        map->slots[i] = (u64)(i + 1);
+    }
+
+    map->slots[TUNDRA_SLOTMAP_DEF_CAP - 1] = (u64)TUNDRA_SLOTMAP_NIL;
+
+    map->num_elem = 0;
+    map->cap = TUNDRA_SLOTMAP_DEF_CAP;
+    map->slot_cap = TUNDRA_SLOTMAP_DEF_CAP;
+    map->free_head = 0;
+}
+
+/**
+ * @brief Initializes a Map with default capacity inside `arena`, bump
+ * allocating its storage so the arena's reset reclaims it in O(1).
+ *
+ * Growth reallocates within the arena while it has room and migrates to the
+ * regular allocator once it runs out; `free` stays safe to call either way,
+ * frees of arena owned memory are absorbed as no-ops.
+ *
+ * Only initialize a Map once. If an already initialized Map is called with
+ * init, undefined behavior may occur.
+ *
+ * @param map Map to init.
+ * @param arena Scratch arena to allocate from.
+ */
+static inline void TUNDRA_FUNC_NAME(init_in)(TUNDRA_NAME *map,
+    Tundra_ScratchArena *arena)
+{
+    Tundra_ScrArena_push_scope(arena);
+    TUNDRA_FUNC_NAME(init)(map);
+    Tundra_ScrArena_pop_scope();
+}
+
+/**
+ * @brief Initializes a Map by deep copying another Map.
+ *
+ * Outstanding handles of `src` are valid on the copy as well.
+ *
+ * `src` must be an initialized Map, and `dst` must be uninitialized.
+ *
+ * @param src Map to source from, must be initialized.
+ * @param dst Map to deep copy to, must be uninitialized.
+ */
+static inline void TUNDRA_FUNC_NAME(init_copy)(const TUNDRA_NAME *src,
+    TUNDRA_NAME *dst)
+{
+    *dst = *src;
+
+    dst->data = (TUNDRA_TYPE*)Tundra_alloc_copy_mem((const void*)src->data,
+        src->cap * sizeof(TUNDRA_TYPE), src->num_elem * sizeof(TUNDRA_TYPE));
+    dst->dense_to_slot = (u32*)Tundra_alloc_copy_mem(
+        (const void*)src->dense_to_slot, src->cap * sizeof(u32),
+        src->num_elem * sizeof(u32));
+    dst->slots = (u64*)Tundra_alloc_copy_mem((const void*)src->slots,
+        src->slot_cap * sizeof(u64), src->slot_cap * sizeof(u64));
+}
+
+/**
+ * @brief Frees memory allocated for an initialized Map.
+ *
+ * After calling this method, the Map must not be used unless reinitialized.
+ *
+ * @param map Initialized Map to free.
+ */
+static inline void TUNDRA_FUNC_NAME(free)(TUNDRA_NAME *map)
+{
+    Tundra_free_mem((void*)map->data);
+    Tundra_free_mem((void*)map->dense_to_slot);
+    Tundra_free_mem((void*)map->slots);
+
+    map->data = NULL;
+    map->dense_to_slot = NULL;
+    map->slots = NULL;
+    map->num_elem = 0;
+    map->cap = 0;
+    map->slot_cap = 0;
+    map->free_head = TUNDRA_SLOTMAP_NIL;
+}
+
+/**
+ * @brief Clears the Map of all elements and invalidates every outstanding
+ * handle. The capacity remains unchanged.
+ *
+ * Every slot's generation is bumped so stale handles miss.
+ *
+ * @param map Map to clear.
+ */
+static inline void TUNDRA_FUNC_NAME(clear)(TUNDRA_NAME *map)
+{
+    // Rebuild the free chain over every slot, bumping each generation.
+    for(u64 i = 0; i < map->slot_cap; ++i)
+    {
+        const u64 GENERATION = (map->slots[i] >> 32) + 1;
+        const u64 NEXT_FREE = (i + 1 < map->slot_cap) ?
+            (i + 1) : (u64)TUNDRA_SLOTMAP_NIL;
+
+        map->slots[i] = (GENERATION << 32) | NEXT_FREE;
+    }
+
+    map->num_elem = 0;
+    map->free_head = 0;
+}
+
+/**
+ * @brief Adds an element to the Map by copying it in and returns its handle.
+ *
+ * @param map Map to add to.
+ * @param elem Pointer to the element to copy in.
+ *
+ * @return u64 Handle to the added element.
+ */
+static inline u64 TUNDRA_FUNC_NAME(add_copy)(TUNDRA_NAME *map,
+    const TUNDRA_TYPE *elem)
+{
+    const u64 HANDLE = TUNDRA_INT_FUNC_NAME(prepare_add)(map);
+
+    map->data[map->num_elem - 1] = *elem;
+
+    return HANDLE;
+}
+
+/**
+ * @brief Adds an element to the Map by value and returns its handle.
+ *
+ * @param map Map to add to.
+ * @param elem Element to add.
+ *
+ * @return u64 Handle to the added element.
+ */
+static inline u64 TUNDRA_FUNC_NAME(add_val)(TUNDRA_NAME *map,
+    TUNDRA_TYPE elem)
+{
+    const u64 HANDLE = TUNDRA_INT_FUNC_NAME(prepare_add)(map);
+
+    map->data[map->num_elem - 1] = elem;
+
+    return HANDLE;
+}
+
+/**
+ * @brief Erases the element a handle refers to, no-op returning false if the
+ * handle is stale.
+ *
+ * The dense array is swap-popped, so erasure is O(1) and iteration order is
+ * not preserved. The erased slot's generation is bumped, invalidating every
+ * outstanding handle to it.
+ *
+ * @param map Map to erase from.
+ * @param handle Handle to erase.
+ *
+ * @return bool True if an element was erased.
+ */
+static inline bool TUNDRA_FUNC_NAME(erase)(TUNDRA_NAME *map, u64 handle)
+{
+    const u64 DENSE_IDX = TUNDRA_INT_FUNC_NAME(resolve)(map, handle);
+
+    if(DENSE_IDX == map->num_elem) { return false; }
+
+    const u32 SLOT = (u32)(handle & 0xFFFFFFFFU);
+    const u64 LAST_IDX = map->num_elem - 1;
+
+    // Swap-pop the dense arrays and repoint the moved element's slot.
+    if(DENSE_IDX != LAST_IDX)
+    {
+        map->data[DENSE_IDX] = map->data[LAST_IDX];
+
+        const u32 MOVED_SLOT = map->dense_to_slot[LAST_IDX];
+
+        map->dense_to_slot[DENSE_IDX] = MOVED_SLOT;
+        map->slots[MOVED_SLOT] =
+            (map->slots[MOVED_SLOT] & 0xFFFFFFFF00000000ULL) | DENSE_IDX;
+    }
+
+    --map->num_elem;
+
+    // Bump the generation and thread the slot onto the free chain.
+    const u64 GENERATION = (map->slots[SLOT] >> 32) + 1;
+
+    map->slots[SLOT] = (GENERATION << 32) | map->free_head;
+    map->free_head = SLOT;
+
+    return true;
+}
+
+/**
+ * @brief Returns a pointer to the element a handle refers to, NULL if the
+ * handle is stale.
+ *
+ * The pointer is invalidated by any add or erase; re-resolve the handle
+ * instead of holding the pointer.
+ *
+ * @param map Map to look up in.
+ * @param handle Handle to resolve.
+ *
+ * @return TUNDRA_TYPE* Pointer to the element, NULL if the handle is stale.
+ */
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(get_mut)(TUNDRA_NAME *map,
+    u64 handle)
+{
+    const u64 DENSE_IDX = TUNDRA_INT_FUNC_NAME(resolve)(map, handle);
+
+    return (DENSE_IDX == map->num_elem) ? NULL : &map->data[DENSE_IDX];
+}
+
+/**
+ * @brief Returns a const-pointer to the element a handle refers to, NULL if
+ * the handle is stale.
+ *
+ * The pointer is invalidated by any add or erase; re-resolve the handle
+ * instead of holding the pointer.
+ *
+ * @param map Map to look up in.
+ * @param handle Handle to resolve.
+ *
+ * @return const TUNDRA_TYPE* Pointer to the element, NULL if the handle is
+ * stale.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(get)(
+    const TUNDRA_NAME *map, u64 handle)
+{
+    const u64 DENSE_IDX = TUNDRA_INT_FUNC_NAME(resolve)(map, handle);
+
+    return (DENSE_IDX == map->num_elem) ? NULL : &map->data[DENSE_IDX];
+}
+
+/**
+ * @brief Returns true if a handle still refers to a live element.
+ *
+ * @param map Map to check against.
+ * @param handle Handle to check.
+ *
+ * @return bool True if the handle is valid.
+ */
+static inline bool TUNDRA_FUNC_NAME(is_valid)(const TUNDRA_NAME *map,
+    u64 handle)
+{
+    return TUNDRA_INT_FUNC_NAME(resolve)(map, handle) != map->num_elem;
+}
+
+/**
+ * @brief Returns a pointer to the dense element array for iteration.
+ *
+ * The first `size` elements are live, contiguous and hole free; order is
+ * unspecified and changes on erase.
+ *
+ * @param map Map to query.
+ *
+ * @return TUNDRA_TYPE* Pointer to the dense elements.
+ */
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(data)(TUNDRA_NAME *map)
+{
+    return map->data;
+}
+
+/**
+ * @brief Returns the handle owning the dense element at `index`.
+ *
+ * Useful for erasing while iterating the dense array.
+ *
+ * @attention For fast access, this method does not perform a bounds check on
+ * `index`. It is the user's responsibility to ensure the index is valid.
+ *
+ * @param map Map to query.
+ * @param index Dense index of the element.
+ *
+ * @return u64 Handle of the element.
+ */
+static inline u64 TUNDRA_FUNC_NAME(handle_at)(const TUNDRA_NAME *map,
+    u64 index)
+{
+    const u32 SLOT = map->dense_to_slot[index];
+
+    return ((map->slots[SLOT] >> 32) << 32) | SLOT;
+}
+
+/**
+ * @brief Returns the number of elements in the Map.
+ *
+ * @param map Map to query.
+ *
+ * @return u64 Number of elements.
+ */
+static inline u64 TUNDRA_FUNC_NAME(size)(const TUNDRA_NAME *map)
+{
+    return map->num_elem;
+}
+
+/**
+ * @brief Returns the current dense capacity of the Map.
+ *
+ * @param map Map to query.
+ *
+ * @return u64 Current capacity.
+ */
+static inline u64 TUNDRA_FUNC_NAME(capacity)(const TUNDRA_NAME *map)
+{
+    return map->cap;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+
+#undef TUNDRA_NAME
+#undef TUNDRA_FUNC_NAME
+#undef TUNDRA_INT_FUNC_NAME
@@ -0,0 +1,590 @@
+/**
+ * @file SmallArray.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Contiguous container with inline storage that spills to the heap only
+ * past a fixed capacity.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TYPE
+#error TUNDRA_TYPE not defined.
+#endif
+
+#ifndef TUNDRA_CAPACITY
+#error TUNDRA_CAPACITY not defined.
+#endif
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/common/NumLimits.h"
+#include "tundra/internal/MacroHelper.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/MemUtils.h"
+#include "tundra/utils/Math.h"
+#include "tundra/utils/FatalHandler.h"
+
+#ifndef TUNDRA_SMALLARR_H
+#define TUNDRA_SMALLARR_H
+#endif
+
+
+// Type and Function Name Macros -----------------------------------------------
+#define TUNDRA_NAME TUNDRA_CONCAT3(Tundra_SmallArray, TUNDRA_CAPACITY, \
+    TUNDRA_TYPENAME)
+
+#define TUNDRA_FUNC_NAME(name) TUNDRA_CONCAT4(Tundra_SmArr, TUNDRA_CAPACITY, \
+    TUNDRA_TYPENAME, _##name)
+#define TUNDRA_INT_FUNC_NAME(name) TUNDRA_CONCAT4(InTundra_SmArr, \
+    TUNDRA_CAPACITY, TUNDRA_TYPENAME, _##name)
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Containers ------------------------------------------------------------------
+
+/**
+ * @brief Automatic resizing contiguous container that stores its first
+ * TUNDRA_CAPACITY elements inline, allocating heap memory only once that
+ * capacity is exceeded.
+ *
+ * Must be initialized using any of the `init` methods before use. Must be
+ * freed using the `free` method when no longer needed; the free is a no-op
+ * unless the container has spilled to the heap.
+ *
+ * Since the data pointer aims back into the container while storage is
+ * inline, a SmallArray must not be byte copied or moved to another address.
+ * Use `init_copy` to duplicate one.
+ *
+ * Like the fixed Array, the SmallArray does not handle custom element
+ * handling (copy, free, move); elements are byte copied. Any custom handling
+ * should be done by the user through external calls.
+ *
+ * Internals are read-only.
+ */
+typedef struct TUNDRA_NAME
+{
+    // Pointer to the elements; aims at `inline_elems` until the container
+    // spills, heap memory after.
+    TUNDRA_TYPE *data;
+
+    // Number of indexable elements currently added to the Array.
+    u64 num_elem;
+
+    // Current number of elements that can be added to the Array before
+    // spilling or resizing is required.
+    u64 cap;
+
+    // Inline storage for the first TUNDRA_CAPACITY elements.
+    TUNDRA_TYPE inline_elems[TUNDRA_CAPACITY];
+} TUNDRA_NAME;
+
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Returns true if the Array's elements live on the heap rather than in
+ * the inline storage.
+ *
+ * @param arr Array to query.
+ *
+ * @return bool True if spilled to the heap.
+ */
+static inline bool TUNDRA_INT_FUNC_NAME(is_spilled)(const TUNDRA_NAME *arr)
+{
+    return arr->data != arr->inline_elems;
+}
+
+/**
+ * @brief Grows the Array's storage to hold at least `min_cap` elements,
+ * spilling the inline elements to the heap on the first growth.
+ *
+ * Assumes `min_cap` is greater than the current capacity.
+ *
+ * @param arr Array to grow.
+ * @param min_cap Minimum capacity in elems.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(grow)(TUNDRA_NAME *arr, u64 min_cap)
+{
+    if(min_cap > TUNDRA_UINT64_MAX / sizeof(TUNDRA_TYPE))
+    {
+        TUNDRA_FATAL("Capacity overflow on expansion.");
+        return;
+    }
+
+    const u64 NEW_CAP_BYTES = Tundra_ceil_pow2(min_cap * sizeof(TUNDRA_TYPE));
+
+    // First growth; the inline elements must be copied out to the new heap
+    // block.
+    if(!TUNDRA_INT_FUNC_NAME(is_spilled)(arr))
+    {
+        TUNDRA_TYPE *new_mem = (TUNDRA_TYPE*)Tundra_alloc_mem(NEW_CAP_BYTES);
+
+        Tundra_copy_mem_fwd
+        (
+            (const void*)arr->data,
+            (void*)new_mem,
+            arr->num_elem * sizeof(TUNDRA_TYPE)
+        );
+
+        arr->data = new_mem;
+    }
+
+    // Already on the heap; realloc grows in place when the block's allocation
+    // slack allows.
+    else
+    {
+        arr->data =
+            (TUNDRA_TYPE*)Tundra_realloc_mem((void*)arr->data, NEW_CAP_BYTES);
+    }
+
+    arr->cap = NEW_CAP_BYTES / sizeof(TUNDRA_TYPE);
+}
+
+/**
+ * @brief Checks if an Array has filled its capacity, growing it if it has.
+ *
+ * @param arr Array to handle.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(check_handle_exp)(TUNDRA_NAME *arr)
+{
+    if(arr->num_elem < arr->cap) { return; }
+
+    TUNDRA_INT_FUNC_NAME(grow)(arr, 2 * arr->cap);
+}
+
+
+// Public Methods --------------------------------------------------------------
+
+/**
+ * @brief Initializes an Array. Sets internal components; no memory is
+ * allocated until the inline capacity is exceeded.
+ *
+ * Only initialize an Array once. If an already initialized Array is called
+ * with init, undefined behavior may occur.
+ *
+ * @param arr Array to init.
+ */
+static inline void TUNDRA_FUNC_NAME(init)(TUNDRA_NAME *arr)
+{
+    arr->data = arr->inline_elems;
+    arr->num_elem = 0;
+    arr->cap = TUNDRA_CAPACITY;
+}
+
+/**
+ * @brief Initializes an Array with initial elems, which are byte copied in.
+ * Memory is only allocated if `num_elem` exceeds the inline capacity.
+ *
+ * Only initialize an Array once. If an already initialized Array is called
+ * with init, undefined behavior may occur.
+ *
+ * @param arr Array to init.
+ * @param elems Array of elements to copy in.
+ * @param num_elem Number of elements in `elems`.
+ */
+static inline void TUNDRA_FUNC_NAME(init_elems)(TUNDRA_NAME *arr,
+    const TUNDRA_TYPE *elems, u64 num_elem)
+{
+    TUNDRA_FUNC_NAME(init)(arr);
+
+    if(num_elem > TUNDRA_CAPACITY)
+    {
+        TUNDRA_INT_FUNC_NAME(grow)(arr, num_elem);
+    }
+
+    Tundra_copy_mem_fwd
+    (
+        (const void*)elems,
+        (void*)arr->data,
+        num_elem * sizeof(TUNDRA_TYPE)
+    );
+
+    arr->num_elem = num_elem;
+}
+
+/**
+ * @brief Initializes an Array by deep copying another Array.
+ *
+ * `src` must be an initialized Array, and `dst` must be uninitialized.
+ *
+ * @param dst Array to deep copy to, must be uninitialized.
+ * @param src Array to source from, must be initialized.
+ */
+static inline void TUNDRA_FUNC_NAME(init_copy)(TUNDRA_NAME *dst,
+    const TUNDRA_NAME *src)
+{
+    TUNDRA_FUNC_NAME(init_elems)(dst, src->data, src->num_elem);
+}
+
+/**
+ * @brief Frees any heap memory an initialized Array has spilled into and
+ * resets it to its inline storage.
+ *
+ * After calling this method the Array is empty but remains initialized and
+ * usable, unlike the heap-only containers.
+ *
+ * @param arr Initialized Array to free.
+ */
+static inline void TUNDRA_FUNC_NAME(free)(TUNDRA_NAME *arr)
+{
+    if(TUNDRA_INT_FUNC_NAME(is_spilled)(arr))
+    {
+        Tundra_free_mem((void*)arr->data);
+    }
+
+    arr->data = arr->inline_elems;
+    arr->num_elem = 0;
+    arr->cap = TUNDRA_CAPACITY;
+}
+
+/**
+ * @brief Clears the Array of all elements. The capacity remains unchanged.
+ *
+ * @param arr Array to clear.
+ */
+static inline void TUNDRA_FUNC_NAME(clear)(TUNDRA_NAME *arr)
+{
+    arr->num_elem = 0;
+}
+
+/**
+ * @brief Adds an element to the end of the Array by copying it, spilling to
+ * the heap if the capacity is exceeded.
+ *
+ * `elem` cannot be a pointer inside the Array's memory. If the Array needs to
+ * grow to add the element, previous memory is invalidated, including anything
+ * pointing to it.
+ *
+ * @param arr Array to add to.
+ * @param elem Pointer to the element to copy in.
+ */
+static inline void TUNDRA_FUNC_NAME(add_copy)(TUNDRA_NAME *arr,
+    const TUNDRA_TYPE *elem)
+{
+    TUNDRA_INT_FUNC_NAME(check_handle_exp)(arr);
+
+    arr->data[arr->num_elem] = *elem;
+
+    ++arr->num_elem;
+}
+
+static inline void TUNDRA_FUNC_NAME(add_val)(TUNDRA_NAME *arr,
+    TUNDRA_TYPE elem)
+{
+    TUNDRA_INT_FUNC_NAME(check_handle_exp)(arr);
+
+    arr->data[arr->num_elem] = elem;
+
+    ++arr->num_elem;
+}
+
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(add_uninit)(TUNDRA_NAME *arr)
+{
+    TUNDRA_INT_FUNC_NAME(check_handle_exp)(arr);
+
+    return arr->data + arr->num_elem++;
+}
+
+/**
+ * @brief Ensures the Array has the capacity to store `num_extra_elem`
+ * additional elements, growing it if it does not.
+ *
+ * @param arr Array to reserve for.
+ * @param num_extra_elem Number of extra elements.
+ */
+static inline void TUNDRA_FUNC_NAME(reserve)(TUNDRA_NAME *arr,
+    u64 num_extra_elem)
+{
+    if(arr->cap - arr->num_elem >= num_extra_elem) { return; }
+
+    if(num_extra_elem > TUNDRA_UINT64_MAX - arr->num_elem)
+    {
+        TUNDRA_FATAL("Capacity overflow on reserve.");
+        return;
+    }
+
+    TUNDRA_INT_FUNC_NAME(grow)(arr, arr->num_elem + num_extra_elem);
+}
+
+/**
+ * @brief Removes an element at an index and shifts subsequent elements back
+ * by one.
+ *
+ * A fatal is thrown if the index is out of range with the Array unmodified.
+ *
+ * @param arr Array to erase from.
+ * @param index Index to erase.
+ */
+static inline void TUNDRA_FUNC_NAME(erase)(TUNDRA_NAME *arr, u64 index)
+{
+    if(index >= arr->num_elem)
+    {
+        TUNDRA_FATAL("Index \"%llu\" out of bounds for Array of size \"%llu\".",
+            index, arr->num_elem);
+        return;
+    }
+
+    Tundra_copy_mem_fwd(
+        (const void*)(arr->data + index + 1),
+        (void*)(arr->data + index),
+        (arr->num_elem - index - 1) * sizeof(TUNDRA_TYPE)
+    );
+
+    --arr->num_elem;
+}
+
+/**
+ * @brief Removes the element at the end of the Array.
+ *
+ * A fatal is thrown if the Array is empty with the Array unmodified.
+ *
+ * @param arr Array to erase from.
+ */
+static inline void TUNDRA_FUNC_NAME(erase_back)(TUNDRA_NAME *arr)
+{
+    if(arr->num_elem == 0)
+    {
+        TUNDRA_FATAL("Attempted to erase but the Array was empty.");
+        return;
+    }
+
+    --arr->num_elem;
+}
+
+/**
+ * @brief Removes the element at the specified index by swapping it with the
+ * last element, then decreasing the size.
+ *
+ * This method provides O(1) removal time but does not preserve element order.
+ * Use this method when the Array's order is not important.
+ *
+ * A fatal is thrown if the index is out of range with the Array unmodified.
+ *
+ * @param arr Array to erase from.
+ * @param index Index of the element to remove.
+ */
+static inline void TUNDRA_FUNC_NAME(swap_pop)(TUNDRA_NAME *arr, u64 index)
+{
+    if(index >= arr->num_elem)
+    {
+        TUNDRA_FATAL("Index \"%llu\" out of bounds for Array of size \"%llu\".",
+            index, arr->num_elem);
+        return;
+    }
+
+    arr->data[index] = arr->data[arr->num_elem - 1];
+
+    --arr->num_elem;
+}
+
+/**
+ * @brief Returns a pointer to the element at `index`.
+ *
+ * @attention For fast access, this method does not perform a bounds check on
+ * `index`. It is the user's responsibility to ensure the index is valid.
+ *
+ * @param arr Array to index into.
+ * @param index Index to get element.
+ *
+ * @return TUNDRA_TYPE* Pointer to the element at `index`.
+ */
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(at_mut_nochk)(TUNDRA_NAME *arr,
+    u64 index)
+{
+    return arr->data + index;
+}
+
+/**
+ * @brief Returns a const-pointer to the element at `index`.
+ *
+ * @attention For fast access, this method does not perform a bounds check on
+ * `index`. It is the user's responsibility to ensure the index is valid.
+ *
+ * @param arr Array to index into.
+ * @param index Index to get element.
+ *
+ * @return const TUNDRA_TYPE* Const-pointer to the element at `index`.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(at_nochk)(
+    const TUNDRA_NAME *arr, u64 index)
+{
+    return (const TUNDRA_TYPE*)(arr->data + index);
+}
+
+/**
+ * @brief Returns a pointer to the element at `index` with bounds checking.
+ *
+ * A fatal is thrown if the index is out of range with the Array unmodified,
+ * returning NULL.
+ *
+ * @param arr Array to index into.
+ * @param index Index to get element.
+ *
+ * @return TUNDRA_TYPE* Pointer to the element at `index`.
+ */
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(at_mut)(const TUNDRA_NAME *arr,
+    u64 index)
+{
+    if(index >= arr->num_elem)
+    {
+        TUNDRA_FATAL("Index \"%llu\" out of bounds for Array of size \"%llu\".",
+            index, arr->num_elem);
+        return NULL;
+    }
+
+    return arr->data + index;
+}
+
+/**
+ * @brief Returns a const-pointer to the element at `index` with bounds
+ * checking.
+ *
+ * A fatal is thrown if the index is out of range with the Array unmodified,
+ * returning NULL.
+ *
+ * @param arr Array to index into.
+ * @param index Index to get element.
+ *
+ * @return const TUNDRA_TYPE* Const-pointer to the element at `index`.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(at)(
+    const TUNDRA_NAME *arr, u64 index)
+{
+    if(index >= arr->num_elem)
+    {
+        TUNDRA_FATAL("Index \"%llu\" out of bounds for Array of size \"%llu\".",
+            index, arr->num_elem);
+        return NULL;
+    }
+
+    return (const TUNDRA_TYPE*)(arr->data + index);
+}
+
+/**
+ * @brief Returns a pointer to the first element of the Array.
+ *
+ * @attention For fast access, this method does not perform a check if the
+ * Array is empty. It is the user's responsibility to ensure the Array is not
+ * empty.
+ *
+ * @param arr Array to query.
+ *
+ * @return TUNDRA_TYPE* Pointer to the first element.
+ */
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(front_mut)(TUNDRA_NAME *arr)
+{
+    return arr->data;
+}
+
+/**
+ * @brief Returns a const-pointer to the first element of the Array.
+ *
+ * @attention For fast access, this method does not perform a check if the
+ * Array is empty. It is the user's responsibility to ensure the Array is not
+ * empty.
+ *
+ * @param arr Array to query.
+ *
+ * @return const TUNDRA_TYPE* Const-pointer to the first element.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(front)(
+    const TUNDRA_NAME *arr)
+{
+    return (const TUNDRA_TYPE*)arr->data;
+}
+
+/**
+ * @brief Returns a pointer to the last element of the Array.
+ *
+ * @attention For fast access, this method does not perform a check if the
+ * Array is empty. It is the user's responsibility to ensure the Array is not
+ * empty.
+ *
+ * @param arr Array to query.
+ *
+ * @return TUNDRA_TYPE* Pointer to the last element.
+ */
+static inline TUNDRA_TYPE* TUNDRA_FUNC_NAME(back_mut)(TUNDRA_NAME *arr)
+{
+    return arr->data + (arr->num_elem - 1);
+}
+
+/**
+ * @brief Returns a const-pointer to the last element of the Array.
+ *
+ * @attention For fast access, this method does not perform a check if the
+ * Array is empty. It is the user's responsibility to ensure the Array is not
+ * empty.
+ *
+ * @param arr Array to query.
+ *
+ * @return const TUNDRA_TYPE* Const-pointer to the last element.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(back)(
+    const TUNDRA_NAME *arr)
+{
+    return (const TUNDRA_TYPE*)(arr->data + (arr->num_elem - 1));
+}
+
+/**
+ * @brief Returns a read-only pointer to the data the Array handles.
+ *
+ * As this may be a handle to internal Array data, calling this function to
+ * get the data pointer then altering the Array may invalidate said pointer.
+ *
+ * @param arr Array to inspect.
+ *
+ * @return Read-only pointer to the Array's internal data.
+ */
+static inline const TUNDRA_TYPE* TUNDRA_FUNC_NAME(data)(const TUNDRA_NAME *arr)
+{
+    return (const TUNDRA_TYPE*)arr->data;
+}
+
+/**
+ * @brief Returns true if the Array's elements have spilled to the heap.
+ *
+ * @param arr Array to query.
+ *
+ * @return bool True if spilled to the heap.
+ */
+static inline bool TUNDRA_FUNC_NAME(is_spilled)(const TUNDRA_NAME *arr)
+{
+    return TUNDRA_INT_FUNC_NAME(is_spilled)(arr);
+}
+
+/**
+ * @brief Returns the number of elements in the Array.
+ *
+ * @param arr Array to query.
+ *
+ * @return `u64` Number of elements.
+ */
+static inline u64 TUNDRA_FUNC_NAME(size)(const TUNDRA_NAME *arr)
+{
+    return arr->num_elem;
+}
+
+/**
+ * @brief Returns the current capacity of the Array.
+ *
+ * @param arr Array to query.
+ *
+ * @return `u64` Current capacity.
+ */
+static inline u64 TUNDRA_FUNC_NAME(capacity)(const TUNDRA_NAME *arr)
+{
+    return arr->cap;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+
+#undef TUNDRA_NAME
+#undef TUNDRA_FUNC_NAME
+#undef TUNDRA_INT_FUNC_NAME
@@ -0,0 +1,500 @@
+/**
+ * @file Sort.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief In-place introspective sort companion for the array containers.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TYPE
+#error TUNDRA_TYPE not defined.
+#endif
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/common/BitUtils.h"
+#include "tundra/internal/MacroHelper.h"
+#include "tundra/utils/MemAlloc.h"
+
+#ifndef TUNDRA_SORT_H
+#define TUNDRA_SORT_H
+
+// Runs at or below this length are insertion sorted instead of partitioned.
+#define TUNDRA_SORT_SMALL_RUN 24
+
+#endif
+
+// Ordering predicate; true if `first` should come before `second` in the
+// sorted output. The default sorts ascending.
+#ifndef TUNDRA_SORT_BEFORE
+#define TUNDRA_SORT_BEFORE(first, second) ((first) < (second))
+#endif
+
+#if TUNDRA_SORT_RADIX
+
+// Maps an element to the u64 key the radix sort orders by. The default works
+// for unsigned integer types; signed or float keys need a order-preserving
+// mapping (ie. flipping the sign bit for i64).
+#ifndef TUNDRA_SORT_KEY
+#define TUNDRA_SORT_KEY(elem) ((u64)(elem))
+#endif
+
+#endif // TUNDRA_SORT_RADIX
+
+
+// Type and Function Name Macros -----------------------------------------------
+#define TUNDRA_DYNARR_NAME TUNDRA_CONCAT(Tundra_DynamicArray, TUNDRA_TYPENAME)
+
+#define TUNDRA_SORT_NAME TUNDRA_CONCAT(Tundra_Sort, TUNDRA_TYPENAME)
+#define TUNDRA_RADIX_NAME TUNDRA_CONCAT(Tundra_RadixSort, TUNDRA_TYPENAME)
+#define TUNDRA_LOWER_BOUND_NAME TUNDRA_CONCAT(Tundra_LowerBound, \
+    TUNDRA_TYPENAME)
+#define TUNDRA_EYTZ_BUILD_NAME TUNDRA_CONCAT(Tundra_EytzingerBuild, \
+    TUNDRA_TYPENAME)
+#define TUNDRA_EYTZ_SEARCH_NAME TUNDRA_CONCAT(Tundra_EytzingerLowerBound, \
+    TUNDRA_TYPENAME)
+#define TUNDRA_INT_FUNC_NAME(name) TUNDRA_CONCAT3(InTundra_Sort, \
+    TUNDRA_TYPENAME, _##name)
+#define TUNDRA_DYNARR_FUNC_NAME(name) TUNDRA_CONCAT3(Tundra_DynArr, \
+    TUNDRA_TYPENAME, _##name)
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Insertion sorts `elems`, used for small runs where partitioning
+ * overhead dominates.
+ *
+ * @param elems Elements to sort.
+ * @param num_elem Number of elements.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(insertion)(TUNDRA_TYPE *elems,
+    u64 num_elem)
+{
+    for(u64 pos = 1; pos < num_elem; ++pos)
+    {
+        TUNDRA_TYPE held = elems[pos];
+
+        u64 dst = pos;
+
+        while(dst > 0 && TUNDRA_SORT_BEFORE(held, elems[dst - 1]))
+        {
+            elems[dst] = elems[dst - 1];
+            --dst;
+        }
+
+        elems[dst] = held;
+    }
+}
+
+/**
+ * @brief Sifts the element at `index` down inside a max-ordered heap of
+ * `num_elem` elements.
+ *
+ * @param elems Heap elements.
+ * @param index Index of the element to sift.
+ * @param num_elem Number of elements in the heap.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(heap_sift)(TUNDRA_TYPE *elems,
+    u64 index, u64 num_elem)
+{
+    while(true)
+    {
+        const u64 LEFT = 2 * index + 1;
+        const u64 RIGHT = LEFT + 1;
+
+        u64 last = index;
+
+        if(LEFT < num_elem && TUNDRA_SORT_BEFORE(elems[last], elems[LEFT]))
+        {
+            last = LEFT;
+        }
+
+        if(RIGHT < num_elem && TUNDRA_SORT_BEFORE(elems[last], elems[RIGHT]))
+        {
+            last = RIGHT;
+        }
+
+        if(last == index) { return; }
+
+        TUNDRA_TYPE swap = elems[last];
+        elems[last] = elems[index];
+        elems[index] = swap;
+
+        index = last;
+    }
+}
+
+/**
+ * @brief Heap sorts `elems`, the O(n log n) fallback once partitioning has
+ * degraded past the depth limit on adversarial patterns.
+ *
+ * @param elems Elements to sort.
+ * @param num_elem Number of elements.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(heap_sort)(TUNDRA_TYPE *elems,
+    u64 num_elem)
+{
+    for(u64 index = num_elem / 2; index-- > 0;)
+    {
+        TUNDRA_INT_FUNC_NAME(heap_sift)(elems, index, num_elem);
+    }
+
+    for(u64 end = num_elem; end-- > 1;)
+    {
+        TUNDRA_TYPE swap = elems[end];
+        elems[end] = elems[0];
+        elems[0] = swap;
+
+        TUNDRA_INT_FUNC_NAME(heap_sift)(elems, 0, end);
+    }
+}
+
+/**
+ * @brief Recursively sorts `elems`: insertion sort on small runs, median of 3
+ * Hoare partitioning otherwise, and a heap sort fallback when the recursion
+ * depth shows the pattern is defeating the pivot choice.
+ *
+ * @param elems Elements to sort.
+ * @param num_elem Number of elements.
+ * @param depth_left Remaining partition depth before falling back.
+ */
+static inline void TUNDRA_INT_FUNC_NAME(introsort)(TUNDRA_TYPE *elems,
+    u64 num_elem, u64 depth_left)
+{
+    while(num_elem > TUNDRA_SORT_SMALL_RUN)
+    {
+        if(depth_left == 0)
+        {
+            TUNDRA_INT_FUNC_NAME(heap_sort)(elems, num_elem);
+            return;
+        }
+
+        --depth_left;
+
+        // Median of first, middle and last as the pivot, sorted into place so
+        // the ends also act as sentinels for the partition scans.
+        TUNDRA_TYPE *first = elems;
+        TUNDRA_TYPE *mid = elems + num_elem / 2;
+        TUNDRA_TYPE *last = elems + num_elem - 1;
+
+        if(TUNDRA_SORT_BEFORE(*mid, *first))
+        {
+            TUNDRA_TYPE swap = *mid; *mid = *first; *first = swap;
+        }
+
+        if(TUNDRA_SORT_BEFORE(*last, *mid))
+        {
+            TUNDRA_TYPE swap = *last; *last = *mid; *mid = swap;
+
+            if(TUNDRA_SORT_BEFORE(*mid, *first))
+            {
+                swap = *mid; *mid = *first; *first = swap;
+            }
+        }
+
+        const TUNDRA_TYPE PIVOT = *mid;
+
+        // Hoare partition.
+        u64 low = 0;
+        u64 high = num_elem - 1;
+
+        while(true)
+        {
+            do { ++low; } while(TUNDRA_SORT_BEFORE(elems[low], PIVOT));
+            do { --high; } while(TUNDRA_SORT_BEFORE(PIVOT, elems[high]));
+
+            if(low >= high) { break; }
+
+            TUNDRA_TYPE swap = elems[low];
+            elems[low] = elems[high];
+            elems[high] = swap;
+        }
+
+        // Recurse into the smaller side, loop on the larger to bound the
+        // stack at O(log n).
+        const u64 NUM_LEFT = high + 1;
+
+        if(NUM_LEFT < num_elem - NUM_LEFT)
+        {
+            TUNDRA_INT_FUNC_NAME(introsort)(elems, NUM_LEFT, depth_left);
+
+            elems += NUM_LEFT;
+            num_elem -= NUM_LEFT;
+        }
+        else
+        {
+            TUNDRA_INT_FUNC_NAME(introsort)(elems + NUM_LEFT,
+                num_elem - NUM_LEFT, depth_left);
+
+            num_elem = NUM_LEFT;
+        }
+    }
+
+    TUNDRA_INT_FUNC_NAME(insertion)(elems, num_elem);
+}
+
+
+// Public Methods --------------------------------------------------------------
+
+/**
+ * @brief Sorts `elems` in place with the ordering predicate inlined at
+ * generation time, skipping the copy-out and comparator callbacks a libc
+ * qsort costs.
+ *
+ * Introspective: insertion sort on small runs, median of 3 quicksort
+ * otherwise, heap sort fallback on adversarial patterns, so the worst case
+ * stays O(n log n).
+ *
+ * @param elems Elements to sort.
+ * @param num_elem Number of elements.
+ */
+static inline void TUNDRA_SORT_NAME(TUNDRA_TYPE *elems, u64 num_elem)
+{
+    if(num_elem < 2) { return; }
+
+    // Depth limit of 2 * log2(n) partitions before the heap sort fallback.
+    TUNDRA_INT_FUNC_NAME(introsort)(elems, num_elem,
+        2 * (u64)Tundra_get_msb_pos(num_elem));
+}
+
+/**
+ * @brief Sorts the elements of a DynamicArray in place.
+ *
+ * @param arr Array to sort.
+ */
+static inline void TUNDRA_DYNARR_FUNC_NAME(sort)(TUNDRA_DYNARR_NAME *arr)
+{
+    TUNDRA_SORT_NAME(arr->data, arr->num_elem);
+}
+
+/**
+ * @brief Returns the index of the first element of sorted `elems` that is not
+ * ordered before `target`, `num_elem` if every element is.
+ *
+ * Branchless binary search: each halving step adjusts the base with a
+ * predicated add the compiler lowers to a conditional move, so lookups on
+ * tables too large to predict cost no branch misses. A sorted array plus this
+ * search replaces a read-only hash table with zero metadata memory.
+ *
+ * `elems` must be sorted by the ordering predicate.
+ *
+ * @param elems Sorted elements to search.
+ * @param num_elem Number of elements.
+ * @param target Value to search for.
+ *
+ * @return u64 Index of the lower bound, `num_elem` if none.
+ */
+static inline u64 TUNDRA_LOWER_BOUND_NAME(const TUNDRA_TYPE *elems,
+    u64 num_elem, TUNDRA_TYPE target)
+{
+    if(num_elem == 0) { return 0; }
+
+    u64 low = 0;
+    u64 len = num_elem;
+
+    while(len > 1)
+    {
+        const u64 HALF = len / 2;
+
+        // Predicated add instead of a branch per probe.
+        low += TUNDRA_SORT_BEFORE(elems[low + HALF - 1], target) ? HALF : 0;
+        len -= HALF;
+    }
+
+    return low + (TUNDRA_SORT_BEFORE(elems[low], target) ? 1 : 0);
+}
+
+/**
+ * @brief Returns the index of the lower bound of `target` in sorted `arr`,
+ * the array's size if every element is ordered before it.
+ *
+ * @param arr Sorted array to search.
+ * @param target Value to search for.
+ *
+ * @return u64 Index of the lower bound, the array's size if none.
+ */
+static inline u64 TUNDRA_DYNARR_FUNC_NAME(lower_bound)(
+    const TUNDRA_DYNARR_NAME *arr, TUNDRA_TYPE target)
+{
+    return TUNDRA_LOWER_BOUND_NAME(arr->data, arr->num_elem, target);
+}
+
+/**
+ * @brief Recursively fills `dst` in Eytzinger order from `src` by an in-order
+ * walk of the implicit tree.
+ *
+ * @param src Sorted source elements.
+ * @param dst Destination in Eytzinger order.
+ * @param num_elem Number of elements.
+ * @param src_pos Next source index to consume.
+ * @param node One-based index of the implicit tree node to fill.
+ *
+ * @return u64 Source index after the subtree is consumed.
+ */
+static inline u64 TUNDRA_INT_FUNC_NAME(eytz_fill)(const TUNDRA_TYPE *src,
+    TUNDRA_TYPE *dst, u64 num_elem, u64 src_pos, u64 node)
+{
+    if(node > num_elem) { return src_pos; }
+
+    src_pos = TUNDRA_INT_FUNC_NAME(eytz_fill)(src, dst, num_elem, src_pos,
+        2 * node);
+
+    dst[node - 1] = src[src_pos++];
+
+    return TUNDRA_INT_FUNC_NAME(eytz_fill)(src, dst, num_elem, src_pos,
+        2 * node + 1);
+}
+
+/**
+ * @brief Rewrites sorted `src` into `dst` in Eytzinger (breadth-first heap)
+ * order for the Eytzinger search variant.
+ *
+ * The layout packs each probe path's early levels into the same cache lines,
+ * which is worth it on very hot tables searched far more often than built.
+ * `dst` must hold `num_elem` elements and must not overlap `src`.
+ *
+ * @param src Sorted source elements.
+ * @param dst Destination array to build the layout in.
+ * @param num_elem Number of elements.
+ */
+static inline void TUNDRA_EYTZ_BUILD_NAME(const TUNDRA_TYPE *src,
+    TUNDRA_TYPE *dst, u64 num_elem)
+{
+    TUNDRA_INT_FUNC_NAME(eytz_fill)(src, dst, num_elem, 0, 1);
+}
+
+/**
+ * @brief Returns the index of the lower bound of `target` in Eytzinger-laid
+ * `elems`, `num_elem` if every element is ordered before it.
+ *
+ * The descent is branchless (the comparison feeds the child index directly)
+ * and the returned index is into the Eytzinger layout, not sorted order.
+ *
+ * @param elems Elements in Eytzinger order.
+ * @param num_elem Number of elements.
+ * @param target Value to search for.
+ *
+ * @return u64 Eytzinger index of the lower bound, `num_elem` if none.
+ */
+static inline u64 TUNDRA_EYTZ_SEARCH_NAME(const TUNDRA_TYPE *elems,
+    u64 num_elem, TUNDRA_TYPE target)
+{
+    u64 node = 1;
+
+    while(node <= num_elem)
+    {
+        node = 2 * node + (TUNDRA_SORT_BEFORE(elems[node - 1], target) ?
+            1 : 0);
+    }
+
+    // The descent's final right turns are undone by shifting out the trailing
+    // set bits, landing on the last node where the search went left.
+    node >>= Tundra_get_num_trail_zeros(~node) + 1;
+
+    return (node == 0) ? num_elem : node - 1;
+}
+
+#if TUNDRA_SORT_RADIX
+
+/**
+ * @brief Sorts `elems` in place by an 8 bit, 8 pass least-significant-digit
+ * radix over the u64 key of each element.
+ *
+ * O(n) in the element count with no comparisons at all, which beats the
+ * comparison sort once runs get large; a scratch buffer of `num_elem`
+ * elements is allocated for the ping-pong passes. Passes whose key byte is
+ * identical across all elements are skipped.
+ *
+ * @param elems Elements to sort.
+ * @param num_elem Number of elements.
+ */
+static inline void TUNDRA_RADIX_NAME(TUNDRA_TYPE *elems, u64 num_elem)
+{
+    if(num_elem < 2) { return; }
+
+    TUNDRA_TYPE *scratch =
+        (TUNDRA_TYPE*)Tundra_alloc_mem(num_elem * sizeof(TUNDRA_TYPE));
+
+    TUNDRA_TYPE *src = elems;
+    TUNDRA_TYPE *dst = scratch;
+
+    for(u64 shift = 0; shift < 64; shift += 8)
+    {
+        u64 counts[256] = {0};
+
+        for(u64 pos = 0; pos < num_elem; ++pos)
+        {
+            ++counts[(TUNDRA_SORT_KEY(src[pos]) >> shift) & 0xFF];
+        }
+
+        // Every element shares this key byte; the pass would be a copy.
+        if(counts[(TUNDRA_SORT_KEY(src[0]) >> shift) & 0xFF] == num_elem)
+        {
+            continue;
+        }
+
+        u64 dst_pos = 0;
+
+        for(u64 bucket = 0; bucket < 256; ++bucket)
+        {
+            const u64 NUM_IN_BUCKET = counts[bucket];
+
+            counts[bucket] = dst_pos;
+            dst_pos += NUM_IN_BUCKET;
+        }
+
+        for(u64 pos = 0; pos < num_elem; ++pos)
+        {
+            dst[counts[(TUNDRA_SORT_KEY(src[pos]) >> shift) & 0xFF]++] =
+                src[pos];
+        }
+
+        TUNDRA_TYPE *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    // An even number of performed passes ends back in the caller's memory;
+    // odd ends in the scratch and must be copied back.
+    if(src != elems)
+    {
+        for(u64 pos = 0; pos < num_elem; ++pos) { elems[pos] = src[pos]; }
+    }
+
+    Tundra_free_mem((void*)scratch);
+}
+
+/**
+ * @brief Sorts the elements of a DynamicArray in place by radix.
+ *
+ * @param arr Array to sort.
+ */
+static inline void TUNDRA_DYNARR_FUNC_NAME(radix_sort)(TUNDRA_DYNARR_NAME *arr)
+{
+    TUNDRA_RADIX_NAME(arr->data, arr->num_elem);
+}
+
+#endif // TUNDRA_SORT_RADIX
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+
+#undef TUNDRA_DYNARR_NAME
+#undef TUNDRA_SORT_NAME
+#undef TUNDRA_RADIX_NAME
+#undef TUNDRA_LOWER_BOUND_NAME
+#undef TUNDRA_EYTZ_BUILD_NAME
+#undef TUNDRA_EYTZ_SEARCH_NAME
+#undef TUNDRA_INT_FUNC_NAME
+#undef TUNDRA_DYNARR_FUNC_NAME
+#undef TUNDRA_SORT_BEFORE
+#if TUNDRA_SORT_RADIX
+#undef TUNDRA_SORT_KEY
+#endif
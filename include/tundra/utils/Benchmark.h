@@ -0,0 +1,138 @@
+/**
+ * @file Benchmark.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Microbenchmark harness: registration, sampling and reporting.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_BENCHMARK_H
+#define TUNDRA_BENCHMARK_H
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/utils/FileHandling.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Keeps `value` observably alive so the compiler cannot delete the
+ * computation that produced it.
+ *
+ * Wrap the result of every benchmarked expression whose value is otherwise
+ * unused.
+ */
+#define TUNDRA_BENCH_KEEP(value) \
+    __asm__ volatile("" : : "g"(value) : "memory")
+
+/**
+ * @brief Forces all pending memory writes to be considered observed, so
+ * stores cannot be sunk out of the measured region.
+ */
+#define TUNDRA_BENCH_CLOBBER() __asm__ volatile("" : : : "memory")
+
+/**
+ * @brief Body of one benchmark: run the measured operation `num_iter` times.
+ *
+ * The harness scales `num_iter` so one call spans at least a millisecond,
+ * then times whole calls; per-iteration setup should live outside the
+ * iteration loop where possible.
+ */
+typedef void (*Tundra_BenchFn)(u64 num_iter, void *user_data);
+
+/**
+ * @brief Registers a benchmark with the harness.
+ *
+ * Usually called through `TUNDRA_BENCHMARK` rather than directly. Up to 256
+ * benchmarks can be registered; further registrations fatal.
+ *
+ * @param name Name reported for the benchmark.
+ * @param fn Benchmark body.
+ * @param user_data Opaque pointer passed through to `fn`.
+ */
+void Tundra_Bench_register(const char *name, Tundra_BenchFn fn,
+    void *user_data);
+
+/**
+ * @brief Defines and registers a benchmark function in one step.
+ *
+ * Usage:
+ *
+ * TUNDRA_BENCHMARK(bench_sum_u64)
+ * {
+ *     for(u64 i = 0; i < num_iter; ++i)
+ *     { TUNDRA_BENCH_KEEP(Tundra_sum_u64_arr(data, NUM_ELEM)); }
+ * }
+ *
+ * The function receives `num_iter` and `user_data` (NULL when registered
+ * this way) as parameters.
+ */
+#define TUNDRA_BENCHMARK(func) \
+    static void func(u64 num_iter, void *user_data); \
+    __attribute__((constructor)) \
+    static void InTundra_bench_register_##func(void) \
+    { Tundra_Bench_register(#func, func, NULL); } \
+    static void func(u64 num_iter, void *user_data)
+
+/**
+ * @brief Runs every registered benchmark and reports the results.
+ *
+ * Each benchmark is warmed up, its iteration count scaled until one timed
+ * call spans at least a millisecond, then sampled repeatedly; min, median,
+ * mean and standard deviation of the per-iteration time are reported in
+ * picosecond resolution.
+ *
+ * `human_out` receives an aligned text summary, `csv_out` a CSV table with
+ * a header row; either may be NULL to skip that form. When hardware counters
+ * are accessible (see PerfCounter.h), per-iteration cycles, cache misses and
+ * branch misses from one extra counted call are reported alongside the
+ * timings.
+ *
+ * @param human_out Open file for the human readable report, or NULL.
+ * @param csv_out Open file for the CSV report, or NULL.
+ *
+ * @return u64 Number of benchmarks run.
+ */
+u64 Tundra_Bench_run_all(Tundra_File *human_out, Tundra_File *csv_out);
+
+/**
+ * @brief Writes the results of the last `Tundra_Bench_run_all` as a machine
+ * readable baseline.
+ *
+ * The first line records the revision label and the current clock
+ * calibration (nanoseconds per million cycles), each following line one
+ * benchmark's name, iteration count and median picoseconds per iteration.
+ *
+ * @param file Open file to write the baseline to.
+ * @param revision Revision label recorded in the header, e.g. a git hash;
+ * NULL records "unknown".
+ *
+ * @return u64 Number of benchmark results written.
+ */
+u64 Tundra_Bench_save_baseline(Tundra_File *file, const char *revision);
+
+/**
+ * @brief Compares the results of the last `Tundra_Bench_run_all` against a
+ * previously saved baseline and reports per-benchmark deltas to standard
+ * output.
+ *
+ * A benchmark regresses when its median exceeds the baseline median by more
+ * than `threshold_pct` percent. Benchmarks absent from the baseline are
+ * reported as new and never count as regressions. Return the result from
+ * main (or exit nonzero on it) to gate a release.
+ *
+ * @param file Open baseline file to read.
+ * @param threshold_pct Slowdown in percent a benchmark may show before it
+ * counts as a regression.
+ *
+ * @return u64 Number of benchmarks that breached the threshold.
+ */
+u64 Tundra_Bench_compare_baseline(Tundra_File *file, u64 threshold_pct);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file Compress.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Fast LZ-class block compression and the output filter built on it.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_COMPRESS_H
+#define TUNDRA_COMPRESS_H
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/containers/DynamicArrayU8.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @brief Returns the worst case compressed size of `num_bytes` of input, the
+ * minimum destination capacity `Tundra_Cmprs_compress_block` requires.
+ *
+ * Incompressible input expands slightly from the sequence framing.
+ *
+ * @param num_bytes Input byte count.
+ *
+ * @return u64 Worst case compressed byte count.
+ */
+u64 Tundra_Cmprs_max_compressed_size(u64 num_bytes);
+
+/**
+ * @brief Compresses a block of bytes with a byte-oriented LZ scheme: greedy
+ * matching of 4+ byte repeats within a 64KB window, literals copied through
+ * untouched. Compression and decompression both run at memory-bound speeds,
+ * trading ratio for keeping the write path CPU-light.
+ *
+ * `dst_capacity` must be at least `Tundra_Cmprs_max_compressed_size` of
+ * `num_bytes`. The output is a raw block with no framing; pair it with the
+ * input's byte count for decompression.
+ *
+ * @param src Bytes to compress.
+ * @param num_bytes Number of bytes to compress.
+ * @param dst Destination for the compressed block.
+ * @param dst_capacity Byte capacity of `dst`.
+ *
+ * @return `i64` Compressed byte count if non negative, otherwise an error
+ * code.
+ */
+i64 Tundra_Cmprs_compress_block(const u8 *src, u64 num_bytes, u8 *dst,
+    u64 dst_capacity);
+
+/**
+ * @brief Decompresses a block produced by `Tundra_Cmprs_compress_block`.
+ *
+ * Every copy is bounds checked against both buffers, so a corrupt or
+ * truncated block fails with `-TUNDRA_ERR_INVARG` rather than reading or
+ * writing out of bounds.
+ *
+ * @param src Compressed block.
+ * @param num_bytes Byte count of the compressed block.
+ * @param dst Destination for the decompressed bytes.
+ * @param dst_capacity Byte capacity of `dst`.
+ *
+ * @return `i64` Decompressed byte count if non negative, otherwise an error
+ * code.
+ */
+i64 Tundra_Cmprs_decompress_block(const u8 *src, u64 num_bytes, u8 *dst,
+    u64 dst_capacity);
+
+/**
+ * @brief Output buffer filter stage (see `InTundra_OBuff_set_filter`) that
+ * compresses each flushed batch into a framed block, replacing piping output
+ * through an external compressor process.
+ *
+ * Each batch becomes one frame: a u32 payload byte count, a u32 stored byte
+ * count whose high bit marks a batch that did not shrink and was stored raw,
+ * then the stored bytes. Decode a stream of frames back with
+ * `Tundra_Cmprs_decompress_frames`. Pass NULL as the filter's user data.
+ *
+ * @param bytes Payload batch to compress.
+ * @param num_bytes Number of payload bytes.
+ * @param out Receives the framed block.
+ * @param user_data Unused, pass NULL.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_Cmprs_write_filter(const u8 *bytes, u64 num_bytes,
+    Tundra_DynamicArrayU8 *out, void *user_data);
+
+/**
+ * @brief Decodes a buffer of frames written through
+ * `Tundra_Cmprs_write_filter`, appending the decompressed payload to `out`.
+ *
+ * @param src Framed compressed bytes.
+ * @param num_bytes Byte count of `src`.
+ * @param out Receives the decompressed payload.
+ *
+ * @return `i64` Decompressed byte count if non negative, otherwise an error
+ * code.
+ */
+i64 Tundra_Cmprs_decompress_frames(const u8 *src, u64 num_bytes,
+    Tundra_DynamicArrayU8 *out);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // TUNDRA_COMPRESS_H
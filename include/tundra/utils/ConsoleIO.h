@@ -53,6 +53,17 @@ i64 Tundra_print_cstr(const char *cstr);
  */
 i64 Tundra_print_cstr_w_len(const char *cstr, u64 length);
 
+/**
+ * @brief Outputs a `Tundra_CStr` to standard output. The CStr already
+ * carries its length, so nothing is rescanned.
+ *
+ * @param cstr CStr to output.
+ *
+ * @return Error code of write. Negative return values are error codes,
+ * non negative values are the number of bytes successfully outputted.
+ */
+i64 Tundra_print_CStr(Tundra_CStr cstr);
+
 /**
  * @brief Outputs a single char to standard output.
  * 
@@ -153,16 +164,94 @@ i64 Tundra_print_i8(i8 num);
  */
 i64 Tundra_print_float(float num);
 
+/**
+ * @brief Outputs one value of any printable type to standard output,
+ * dispatching to the matching Tundra_print method at compile time.
+ *
+ * Note that character literals have type `int` in C and print as numbers;
+ * pass a one character string or a `char` typed value instead.
+ *
+ * @param value Value to output.
+ *
+ * @return `i64` Number of bytes printed if the return is non negative,
+ * otherwise it is an error code.
+ */
+#define Tundra_print(value) _Generic((value), \
+    char: Tundra_print_char, \
+    char*: Tundra_print_cstr, \
+    const char*: Tundra_print_cstr, \
+    Tundra_CStr: Tundra_print_CStr, \
+    u8: Tundra_print_u8, \
+    i8: Tundra_print_i8, \
+    u16: Tundra_print_u16, \
+    i16: Tundra_print_i16, \
+    u32: Tundra_print_u32, \
+    int: Tundra_print_int, \
+    u64: Tundra_print_u64, \
+    i64: Tundra_print_i64, \
+    float: Tundra_print_float, \
+    double: Tundra_print_float)(value)
+
+// Internal plumbing for Tundra_printl: the argument list is walked by the
+// preprocessor, so every segment becomes a direct typed print call with no
+// format string parsed at runtime.
+#define INTUNDRA_PRINTL_CAT(a, b) a##b
+#define INTUNDRA_PRINTL_SELECT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, \
+    _11, _12, name, ...) name
+#define INTUNDRA_PRINTL_1(a) Tundra_print(a)
+#define INTUNDRA_PRINTL_2(a, ...) \
+    (Tundra_print(a), INTUNDRA_PRINTL_1(__VA_ARGS__))
+#define INTUNDRA_PRINTL_3(a, ...) \
+    (Tundra_print(a), INTUNDRA_PRINTL_2(__VA_ARGS__))
+#define INTUNDRA_PRINTL_4(a, ...) \
+    (Tundra_print(a), INTUNDRA_PRINTL_3(__VA_ARGS__))
+#define INTUNDRA_PRINTL_5(a, ...) \
+    (Tundra_print(a), INTUNDRA_PRINTL_4(__VA_ARGS__))
+#define INTUNDRA_PRINTL_6(a, ...) \
+    (Tundra_print(a), INTUNDRA_PRINTL_5(__VA_ARGS__))
+#define INTUNDRA_PRINTL_7(a, ...) \
+    (Tundra_print(a), INTUNDRA_PRINTL_6(__VA_ARGS__))
+#define INTUNDRA_PRINTL_8(a, ...) \
+    (Tundra_print(a), INTUNDRA_PRINTL_7(__VA_ARGS__))
+#define INTUNDRA_PRINTL_9(a, ...) \
+    (Tundra_print(a), INTUNDRA_PRINTL_8(__VA_ARGS__))
+#define INTUNDRA_PRINTL_10(a, ...) \
+    (Tundra_print(a), INTUNDRA_PRINTL_9(__VA_ARGS__))
+#define INTUNDRA_PRINTL_11(a, ...) \
+    (Tundra_print(a), INTUNDRA_PRINTL_10(__VA_ARGS__))
+#define INTUNDRA_PRINTL_12(a, ...) \
+    (Tundra_print(a), INTUNDRA_PRINTL_11(__VA_ARGS__))
+
+/**
+ * @brief Outputs up to 12 values of any printable type to standard output.
+ *
+ * The compile-time counterpart of `Tundra_printf` for formats known when the
+ * code is written: instead of a format string parsed at runtime, the message
+ * is passed pre-split into literal segments and typed values, e.g.
+ * `Tundra_printl("loaded ", num_files, " files\n")`, and each segment
+ * compiles to a direct typed print call. Keep `Tundra_printf` for formats
+ * built at runtime.
+ *
+ * @param ... Values to output, in order.
+ *
+ * @return `i64` Result of the last print; negative returns are error codes.
+ */
+#define Tundra_printl(...) INTUNDRA_PRINTL_SELECT(__VA_ARGS__, \
+    INTUNDRA_PRINTL_12, INTUNDRA_PRINTL_11, INTUNDRA_PRINTL_10, \
+    INTUNDRA_PRINTL_9, INTUNDRA_PRINTL_8, INTUNDRA_PRINTL_7, \
+    INTUNDRA_PRINTL_6, INTUNDRA_PRINTL_5, INTUNDRA_PRINTL_4, \
+    INTUNDRA_PRINTL_3, INTUNDRA_PRINTL_2, INTUNDRA_PRINTL_1)(__VA_ARGS__)
+
 /**
  * @brief Outputs a formatted message to standard output. Negative return values
- * are error codes, non negative values are the number of bytes successfully 
+ * are error codes, non negative values are the number of bytes successfully
  * outputted.
- * 
+ *
  * @param format Formatted message to output.
  * @param ... Arguments for the formatted message.
- * 
- * @return `i64` Number of bytes printed if the return is non negative, otherwise 
- * it is an error code. 
+ *
+ * @return `i64` Number of bytes printed if the return is non negative, otherwise
+ * it is an error code.
  */
 i64 Tundra_printf(const char *format, ...);
 
@@ -276,6 +365,35 @@ i64 Tundra_readin_i64(i64 *read_result_output);
 
 float Tundra_readin_float(i64 *read_result_output);
 
+/**
+ * @brief Enables or disables asynchronous log mode. If the return is
+ * negative, it's an error code.
+ *
+ * While enabled, the print family stages finished messages into a lock-free
+ * ring instead of the stdout buffer, so logging threads never block on a
+ * flush and never race each other. Staged messages reach stdout when a
+ * consumer calls `Tundra_drain_log` (or `Tundra_flush_stdout`); exactly one
+ * thread may consume at a time. Disabling drains whatever is staged.
+ *
+ * @param enable True to stage prints, false to write them directly.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_set_async_log(bool enable);
+
+/**
+ * @brief Drains every staged log message to standard output in one batch and
+ * flushes. Only meaningful in async log mode. If the return is negative,
+ * it's an error code. Otherwise it is the number of bytes drained.
+ *
+ * This is the consumer half of the async pipeline; call it from exactly one
+ * thread at a time.
+ *
+ * @return `i64` Number of bytes drained if the return is non negative,
+ * otherwise it is an error code.
+ */
+i64 Tundra_drain_log(void);
+
 /**
  * @brief Flushes standard output buffer, outputting any buffered content.
  */
@@ -285,8 +403,8 @@ void Tundra_clear_stdin(void);
 
 /**
  * @brief Initializes ConsoleOutput handling.
- * 
- * Must be called (done so internally) before any ConsoleOutput use.
+ *
+ * Optional pre-warm; the console buffers initialize themselves on first use.
  */
 void InTundra_ConIO_init(void);
 
@@ -0,0 +1,114 @@
+/**
+ * @file DirHandling.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Methods for enumerating the entries of a directory.
+ * @version 0.1
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef TUNDRA_DIRHANDLING_H
+#define TUNDRA_DIRHANDLING_H
+
+#include "tundra/internal/IOInterface.h"
+#include "tundra/containers/String.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Entry types reported by the kernel, matching its d_type values. UNKNOWN
+// means the filesystem did not report a type; stat the entry to find out.
+#define TUNDRA_DIR_ENTRY_UNKNOWN 0
+#define TUNDRA_DIR_ENTRY_FIFO 1
+#define TUNDRA_DIR_ENTRY_CHAR_DEVICE 2
+#define TUNDRA_DIR_ENTRY_DIRECTORY 4
+#define TUNDRA_DIR_ENTRY_BLOCK_DEVICE 6
+#define TUNDRA_DIR_ENTRY_FILE 8
+#define TUNDRA_DIR_ENTRY_SYMLINK 10
+#define TUNDRA_DIR_ENTRY_SOCKET 12
+
+typedef i64 Tundra_DirEntryType;
+
+// One directory entry yielded by `Tundra_Dir_next`. The name view points
+// into the Dir's batch buffer and is only valid until the next call to
+// `Tundra_Dir_next` or `Tundra_Dir_close`; copy it to keep it.
+typedef struct
+{
+    // Entry name, null terminated, without any path prefix.
+    Tundra_StringView name;
+
+    // Inode number of the entry.
+    u64 inode;
+
+    // One of the TUNDRA_DIR_ENTRY defines.
+    Tundra_DirEntryType type;
+} Tundra_DirEntry;
+
+/**
+ * @brief An open directory being enumerated. Entries are fetched from the
+ * kernel in large batches and handed out one at a time without per-entry
+ * allocation.
+ *
+ * Open with `Tundra_Dir_open`, iterate with `Tundra_Dir_next` and close with
+ * `Tundra_Dir_close`.
+ */
+typedef struct
+{
+    InTundra_IOHandle handle;
+
+    // Heap allocated batch buffer the kernel fills with packed entries.
+    u8 *data;
+
+    // Byte position of the next unread entry in the batch.
+    u64 read_pos;
+
+    // Number of valid bytes in the batch.
+    u64 end_pos;
+} Tundra_Dir;
+
+/**
+ * @brief Opens a directory for enumeration. If the return is negative, it's
+ * an error code.
+ *
+ * The `path` to the directory is a relative path from the current directory.
+ *
+ * @param dir Dir to initialize.
+ * @param path Path to the directory, relative to current directory.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_Dir_open(Tundra_Dir *dir, const char *path);
+
+/**
+ * @brief Yields the next entry of an open directory, including the `.` and
+ * `..` entries. Returns 1 when an entry was produced, 0 when the directory
+ * is exhausted, and a negative error code on failure.
+ *
+ * The yielded name view points into the Dir's batch buffer and is
+ * invalidated by the next call; copy it to keep it.
+ *
+ * @param dir Dir to read from.
+ * @param entry_output Receives the entry.
+ *
+ * @return `i64` 1 if an entry was produced, 0 at the end of the directory,
+ * otherwise an error code.
+ */
+i64 Tundra_Dir_next(Tundra_Dir *dir, Tundra_DirEntry *entry_output);
+
+/**
+ * @brief Closes an open Dir and releases its batch buffer.
+ *
+ * @param dir Dir to close.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_Dir_close(Tundra_Dir *dir);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -15,6 +15,7 @@
 
 #include "tundra/internal/IOInterface.h"
 #include "tundra/internal/IOBuffer.h"
+#include "tundra/containers/String.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,11 +34,51 @@ extern "C" {
 // Writes to a file are always placed at the end of the file.
 #define TUNDRA_FILE_WRITE_BEHAVIOR_APPEND 1024
 
+// Writes bypass the page cache (O_DIRECT), for bulk sequential exports that
+// would otherwise evict everyone else's cached data. Combine with the other
+// write behaviors. The file's output buffer is block aligned and flushed in
+// whole blocks; the zero pad on the final partial block is trimmed when the
+// file is closed. Intended for write-only files written sequentially from
+// the start; buffered reads on a direct file will fail alignment checks.
+#define TUNDRA_FILE_WRITE_BEHAVIOR_DIRECT 16384
+
 typedef i64 Tundra_FileOpenMode;
 
 // typedef i64 Tundra_FileOpenBehavior;
 typedef i64 Tundra_FileWriteBehavior;
 
+// Output stays buffered until the buffer fills or the user flushes. Default.
+#define TUNDRA_FILE_FLUSH_POLICY_MANUAL 0
+// Every write drains the buffer to the kernel immediately.
+#define TUNDRA_FILE_FLUSH_POLICY_EVERY_WRITE 1
+// The buffer drains once it holds at least the configured byte threshold.
+#define TUNDRA_FILE_FLUSH_POLICY_BYTE_THRESHOLD 2
+// The buffer drains at a self-tuned threshold: flush latency is measured,
+// and the threshold shrinks when the latency target is violated and grows
+// back toward the buffer capacity when the device keeps up.
+#define TUNDRA_FILE_FLUSH_POLICY_ADAPTIVE 3
+
+typedef i64 Tundra_FileFlushPolicy;
+
+// Default flush latency target for the adaptive flush policy, in
+// microseconds. Local disks run near full batches under it while network
+// filesystems get pushed toward smaller, more frequent flushes.
+#define TUNDRA_FILE_ADAPTIVE_TARGET_DEF_US 500U
+
+// Access-pattern hints for Tundra_File_advise, matching the kernel's
+// posix_fadvise values.
+#define TUNDRA_FILE_ADVICE_NORMAL 0
+#define TUNDRA_FILE_ADVICE_RANDOM 1
+// Reads will be sequential; the kernel raises its readahead window.
+#define TUNDRA_FILE_ADVICE_SEQUENTIAL 2
+// The range will be needed soon; the kernel starts reading it in now.
+#define TUNDRA_FILE_ADVICE_WILLNEED 3
+// The range won't be needed again; the kernel may drop it from the page
+// cache, keeping one-pass scans from evicting everyone else's data.
+#define TUNDRA_FILE_ADVICE_DONTNEED 4
+
+typedef i64 Tundra_FileAdvice;
+
 typedef enum
 {
     INTUNDRA_FILE_OPERATION_NONE,
@@ -57,6 +98,27 @@ typedef struct
     InTundra_File_Operation last_op;
     i64 file_byte_size;
     i64 cursor_pos;
+
+    // When output is drained to the kernel; see the flush policy defines.
+    Tundra_FileFlushPolicy flush_policy;
+
+    // Buffered byte count that triggers a drain under the byte threshold
+    // policy. The adaptive policy stores its current self-tuned threshold
+    // here.
+    u64 flush_threshold_bytes;
+
+    // Flush latency the adaptive policy tunes against, in nanoseconds.
+    u64 adaptive_target_ns;
+
+    // Latency window the adaptive policy accumulates between retunes:
+    // flushes observed, cycles and bytes they took.
+    u64 adaptive_window_flushes;
+    u64 adaptive_window_cycles;
+    u64 adaptive_window_bytes;
+
+    // True if the io buffers were leased from the shared buffer pool and are
+    // owed back to it on close.
+    bool buffs_pooled;
 } Tundra_File;
 
 /**
@@ -117,10 +179,34 @@ void Tundra_File_check_readerr(i64 result);
 //  * 
 //  * @return `i64` Success if non negative, otherwise error code. 
 //  */
-i64 Tundra_File_open(Tundra_File *file, const char *path, 
-    Tundra_FileOpenMode open_mode, Tundra_FileWriteBehavior write_behavior, 
+i64 Tundra_File_open(Tundra_File *file, const char *path,
+    Tundra_FileOpenMode open_mode, Tundra_FileWriteBehavior write_behavior,
     bool create_if_noexist, bool clear_file);
 
+/**
+ * @brief Opens a file like `Tundra_File_open`, with an explicit io buffer
+ * capacity instead of the 64 KiB default.
+ *
+ * Both the read and write buffers of the file are created with
+ * `buff_capacity` bytes. Larger capacities mean fewer syscalls for workloads
+ * that stream many small reads or writes; smaller capacities keep memory down
+ * for files that are only touched occasionally. Passing 0 uses the default
+ * capacity.
+ *
+ * @param file Uninitialized Tundra_File to populate with the opened file data.
+ * @param path Relative to current directory path to the file to open.
+ * @param open_mode Open mode for opening, ie Readonly, Writeonly.
+ * @param write_behavior Write behavior for opening, ie Appending / Truncating.
+ * @param create_if_noexist Create the file if it does not exist.
+ * @param clear_file Clear the file's contents on open.
+ * @param buff_capacity Byte capacity for the file's io buffers, 0 for default.
+ *
+ * @return `i64` Success if non negative, otherwise error code.
+ */
+i64 Tundra_File_open_buffered(Tundra_File *file, const char *path,
+    Tundra_FileOpenMode open_mode, Tundra_FileWriteBehavior write_behavior,
+    bool create_if_noexist, bool clear_file, u64 buff_capacity);
+
 /**
  * @brief Writes a C String buffer to an open file. If the return is negative,
  * it's an error code. Otherwise it is the number of bytes successfully written.
@@ -133,6 +219,162 @@ i64 Tundra_File_open(Tundra_File *file, const char *path,
  */
 i64 Tundra_File_write_cstr(Tundra_File *file, const char *cstr);
 
+/**
+ * @brief Writes several memory segments to an open file in a single syscall.
+ * If the return is negative, it's an error code. Otherwise it is the total
+ * number of bytes successfully written across all segments.
+ *
+ * Useful for interleaved payloads like header/body pairs, which would
+ * otherwise cost one write per segment.
+ *
+ * @param file File to write to.
+ * @param vecs Segments to write, in order.
+ * @param num_vecs Number of segments.
+ *
+ * @return `i64` Total bytes written if non negative, otherwise it is an
+ * error code.
+ */
+i64 Tundra_File_writev(Tundra_File *file, const Tundra_IOVec *vecs,
+    u64 num_vecs);
+
+/**
+ * @brief Copies a byte range between two open files inside the kernel,
+ * without the data passing through userspace. If the return is negative,
+ * it's an error code. Otherwise it is the number of bytes copied, which is
+ * short only when the source range ends early.
+ *
+ * Uses copy_file_range, falling back to sendfile across filesystems, so
+ * copies run at disk bandwidth rather than bouncing every byte through a
+ * read/write loop. Neither file's cursor moves.
+ *
+ * @param src File to copy from.
+ * @param src_offset Absolute byte offset in `src` to copy from.
+ * @param dst File to copy to.
+ * @param dst_offset Absolute byte offset in `dst` to copy to.
+ * @param num_bytes Number of bytes to copy.
+ *
+ * @return `i64` Number of bytes copied if non negative, otherwise it is an
+ * error code.
+ */
+i64 Tundra_File_copy_range(Tundra_File *src, u64 src_offset,
+    Tundra_File *dst, u64 dst_offset, u64 num_bytes);
+
+/**
+ * @brief Copies an entire file to a new path inside the kernel. The
+ * destination is created if it does not exist and cleared if it does. If the
+ * return is negative, it's an error code. Otherwise it is the number of
+ * bytes copied.
+ *
+ * @param src_path Path of the file to copy.
+ * @param dst_path Path to copy the file to.
+ *
+ * @return `i64` Number of bytes copied if non negative, otherwise it is an
+ * error code.
+ */
+i64 Tundra_copy_file(const char *src_path, const char *dst_path);
+
+/**
+ * @brief Reads an entire file into `out` with one exact allocation and one
+ * large read, bypassing the io buffers entirely. If the return is negative,
+ * it's an error code. Otherwise it is the number of bytes read.
+ *
+ * `out` must be an initialized String; its previous contents are replaced
+ * through `Tundra_Str_take_buffer`, so the bytes land in their final place
+ * with no intermediate copies.
+ *
+ * @param path Path of the file to read.
+ * @param out String receiving the file's contents.
+ *
+ * @return `i64` Number of bytes read if non negative, otherwise it is an
+ * error code.
+ */
+i64 Tundra_File_read_all(const char *path, Tundra_String *out);
+
+/**
+ * @brief Writes `num_bytes` from `bytes` as the entire contents of the file
+ * at `path`, bypassing the io buffers entirely. The file is created if it
+ * does not exist and cleared if it does. If the return is negative, it's an
+ * error code. Otherwise it is the number of bytes written.
+ *
+ * @param path Path of the file to write.
+ * @param bytes Bytes to write.
+ * @param num_bytes Number of bytes to write.
+ *
+ * @return `i64` Number of bytes written if non negative, otherwise it is an
+ * error code.
+ */
+i64 Tundra_File_write_all(const char *path, const void *bytes, u64 num_bytes);
+
+/**
+ * @brief Maps the entire contents of an open file into memory as a zero-copy
+ * read-only view. If the return is negative, it's an error code. Otherwise
+ * the view pointer and its byte length are written to the outputs.
+ *
+ * Parsers can run directly over the view without the per-chunk syscall and
+ * copy of buffered reads, which matters for multi-gigabyte files. The view
+ * stays valid after the file is closed; release it with `Tundra_File_unmap`.
+ * Mapping an empty file fails, the kernel rejects zero-length mappings.
+ *
+ * @param file File to map.
+ * @param view_output Receives the address of the read-only view.
+ * @param num_bytes_output Receives the byte length of the view.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_File_map(Tundra_File *file, const void **view_output,
+    u64 *num_bytes_output);
+
+/**
+ * @brief Releases a view created by `Tundra_File_map`. If the return is
+ * negative, it's an error code.
+ *
+ * @param view View to release.
+ * @param num_bytes Byte length the view was created with.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_File_unmap(const void *view, u64 num_bytes);
+
+/**
+ * @brief Reads bytes from an open file at an absolute byte offset without
+ * moving the file's cursor. If the return is negative, it's an error code.
+ * Otherwise it is the number of bytes successfully read.
+ *
+ * One syscall per call and no cursor state, so multiple threads may issue
+ * positional reads on the same file concurrently. Bypasses the file's read
+ * buffer.
+ *
+ * @param file File to read from.
+ * @param buffer Memory to read into.
+ * @param num_bytes Number of bytes to read.
+ * @param offset Absolute byte offset to read from.
+ *
+ * @return `i64` Number of bytes read if non negative, otherwise it is an
+ * error code.
+ */
+i64 Tundra_File_read_at(Tundra_File *file, void *buffer, u64 num_bytes,
+    u64 offset);
+
+/**
+ * @brief Writes bytes to an open file at an absolute byte offset without
+ * moving the file's cursor. If the return is negative, it's an error code.
+ * Otherwise it is the number of bytes successfully written.
+ *
+ * Buffered output is flushed first so this write lands after earlier buffered
+ * ones. Input already buffered from a previous read is not invalidated; avoid
+ * positional writes to regions currently being read through the cursor API.
+ *
+ * @param file File to write to.
+ * @param bytes Bytes to write.
+ * @param num_bytes Number of bytes to write.
+ * @param offset Absolute byte offset to write at.
+ *
+ * @return `i64` Number of bytes written if non negative, otherwise it is an
+ * error code.
+ */
+i64 Tundra_File_write_at(Tundra_File *file, const void *bytes, u64 num_bytes,
+    u64 offset);
+
 /**
  * @brief Writes a char to an open file. If the return is negative, it's an 
  * error code. Otherwise it is the number of bytes successfully written.
@@ -262,6 +504,52 @@ i64 Tundra_File_write_i8(Tundra_File *file, i8 num);
  */
 i64 Tundra_File_write_float(Tundra_File *file, float num);
 
+/**
+ * @brief Writes a whole array of fixed-width values to an open file in their
+ * native byte representation, no text conversion. If the return is negative,
+ * it's an error code. Otherwise it is the number of bytes written.
+ *
+ * The fast path for checkpoint-style binary files consumed by another
+ * Tundra process: values are little endian and read back with
+ * `Tundra_File_readin_bytes` or the readin_raw methods.
+ *
+ * @param file File to write to.
+ * @param elems Array of values to write.
+ * @param num_bytes Total byte size of the array.
+ *
+ * @return `i64` Number of bytes written if non negative, otherwise it is an
+ * error code.
+ */
+i64 Tundra_File_write_raw_array(Tundra_File *file, const void *elems,
+    u64 num_bytes);
+
+// Write a single fixed-width value in its native little endian byte
+// representation, skipping decimal conversion. Return semantics match the
+// text write methods above.
+i64 Tundra_File_write_raw_u64(Tundra_File *file, u64 num);
+i64 Tundra_File_write_raw_i64(Tundra_File *file, i64 num);
+i64 Tundra_File_write_raw_u32(Tundra_File *file, u32 num);
+i64 Tundra_File_write_raw_int(Tundra_File *file, int num);
+i64 Tundra_File_write_raw_u16(Tundra_File *file, u16 num);
+i64 Tundra_File_write_raw_i16(Tundra_File *file, i16 num);
+i64 Tundra_File_write_raw_u8(Tundra_File *file, u8 num);
+i64 Tundra_File_write_raw_i8(Tundra_File *file, i8 num);
+i64 Tundra_File_write_raw_float(Tundra_File *file, float num);
+
+// Read back a single fixed-width value written by the write_raw methods.
+// The read result (bytes consumed, or an error code) lands in
+// `read_result_output` if provided, matching Tundra_File_readin_bytes.
+u64 Tundra_File_readin_raw_u64(Tundra_File *file, i64 *read_result_output);
+i64 Tundra_File_readin_raw_i64(Tundra_File *file, i64 *read_result_output);
+u32 Tundra_File_readin_raw_u32(Tundra_File *file, i64 *read_result_output);
+int Tundra_File_readin_raw_int(Tundra_File *file, i64 *read_result_output);
+u16 Tundra_File_readin_raw_u16(Tundra_File *file, i64 *read_result_output);
+i16 Tundra_File_readin_raw_i16(Tundra_File *file, i64 *read_result_output);
+u8 Tundra_File_readin_raw_u8(Tundra_File *file, i64 *read_result_output);
+i8 Tundra_File_readin_raw_i8(Tundra_File *file, i64 *read_result_output);
+float Tundra_File_readin_raw_float(Tundra_File *file,
+    i64 *read_result_output);
+
 /**
  * @brief Writes a formatted C String to an open file. If the return is 
  * negative, it's an error code. Otherwise it is the number of bytes 
@@ -308,6 +596,60 @@ void Tundra_File_readin_bytes(Tundra_File *file, void *buffer, u64 num_bytes,
 
 char Tundra_File_readin_char(Tundra_File *file, i64 *read_result_output);
 
+/**
+ * @brief Reads the next newline-terminated line from an open file as a
+ * zero-copy view into the file's input buffer. If the return is negative -1,
+ * the end of the file was reached. Any other negative return is an error
+ * code. Otherwise it is the number of bytes consumed from the file.
+ *
+ * The view excludes the newline and is only valid until the next read on
+ * this file. The line is copied only when it straddles a buffer refill;
+ * lines longer than the file's buffer capacity fail. Far faster than a
+ * readin_char loop for line-oriented parsing.
+ *
+ * @param file File to read from.
+ * @param line_output Receives the view of the line, excluding the newline.
+ *
+ * @return `i64` Bytes consumed if non negative, -1 at end of file, otherwise
+ * an error code.
+ */
+i64 Tundra_File_readin_line(Tundra_File *file, Tundra_StringView *line_output);
+
+/**
+ * @brief Reads up to `max_elems` whitespace-separated u64s from an open file
+ * into `output` in one bulk pass over the input buffer. If the return is
+ * negative, it's an error code. Otherwise it is the number of elements
+ * parsed, which stops short at the end of the file.
+ *
+ * Far faster than looping `Tundra_File_readin_u64` for numeric columns.
+ *
+ * @param file File to read from.
+ * @param output Receives the parsed values.
+ * @param max_elems Capacity of `output`.
+ *
+ * @return `i64` Number of elements parsed if the return is non negative,
+ * otherwise it is an error code.
+ */
+/**
+ * @brief Writes an array of u64s to an open file as separator-joined text in
+ * one buffered write.
+ *
+ * The whole column is converted into a single buffer first, so there is no
+ * per-element call or capacity-check overhead.
+ *
+ * @param file File to write to.
+ * @param vals Values to write.
+ * @param num_vals Number of values.
+ * @param sep Separator character placed between values.
+ *
+ * @return `i64` Bytes written if non negative, otherwise an error code.
+ */
+i64 Tundra_File_write_u64_array(Tundra_File *file, const u64 *vals,
+    u64 num_vals, char sep);
+
+i64 Tundra_File_readin_u64_array(Tundra_File *file, u64 *output,
+    u64 max_elems);
+
 /**
  * @brief Flushes buffered text to the open file's handle.
  * 
@@ -366,6 +708,133 @@ i64 Tundra_File_close(Tundra_File *file);
  */
 u64 Tundra_File_get_size(const Tundra_File *file);
 
+// Metadata snapshot of an open file, filled by Tundra_File_get_info.
+typedef struct
+{
+    u64 byte_size; // Size of the file in bytes.
+    u64 num_blocks; // Number of 512 byte blocks allocated to the file.
+    i64 mod_time_sec; // Last modification time, seconds since the epoch.
+    i64 mod_time_nsec; // Nanosecond portion of the modification time.
+} Tundra_FileInfo;
+
+/**
+ * @brief Retrieves an open file's size, allocated blocks and modification
+ * time with a single fstat syscall, no cursor movement involved. If the
+ * return is negative, it's an error code.
+ *
+ * Buffered output is flushed first so the reported size includes it, and the
+ * file's cached size is refreshed from the result.
+ *
+ * @param file File to inspect.
+ * @param info_output Receives the metadata.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_File_get_info(Tundra_File *file, Tundra_FileInfo *info_output);
+
+/**
+ * @brief Makes an open file's written data durable. Drains the output buffer
+ * to the kernel, then issues an fdatasync so the data reaches stable
+ * storage. If the return is negative, it's an error code.
+ *
+ * For group commit, batch many buffered records and sync once; one sync per
+ * record caps throughput at the device's sync latency.
+ *
+ * @param file File to sync.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_File_sync(Tundra_File *file);
+
+/**
+ * @brief Configures when an open file's output buffer drains to the kernel.
+ *
+ * Manual (the default) drains only when the buffer fills or on an explicit
+ * flush; every-write drains after each write call; byte threshold drains
+ * once at least `byte_threshold` bytes are buffered. Draining makes data
+ * visible to the kernel but not durable, pair a policy with
+ * `Tundra_File_sync` for durability.
+ *
+ * The adaptive policy measures the latency of its own flushes and retunes
+ * the drain threshold between a page and the buffer capacity once per
+ * window of flushes, off the write path: batches grow while the device
+ * absorbs them under the latency target and shrink when the target is
+ * violated, so one binary is right on both a local NVMe disk and a
+ * network filesystem. Tuning starts at the buffer capacity and restarts
+ * whenever the policy is set.
+ *
+ * @param file File to configure.
+ * @param policy Flush policy to apply.
+ * @param byte_threshold Trigger size for the byte threshold policy, or the
+ * flush latency target in microseconds for the adaptive policy, 0 for
+ * `TUNDRA_FILE_ADAPTIVE_TARGET_DEF_US`. Ignored by the other policies.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_File_set_flush_policy(Tundra_File *file,
+    Tundra_FileFlushPolicy policy, u64 byte_threshold);
+
+/**
+ * @brief Configures the shared io buffer pool. While enabled, files opened
+ * with a matching buffer capacity lease their io buffers from the pool on
+ * open and return them on close, making open/close allocation free once the
+ * pool is warm.
+ *
+ * The free list is prewarmed with `max_buffers` buffer pairs and never holds
+ * more than that, capping the memory retained by the pool. Opens with a
+ * different capacity, and direct-mode opens, bypass the pool. Passing 0 for
+ * `max_buffers` disables the pool and frees everything it holds; files that
+ * leased buffers before a reconfigure still return them safely on close.
+ *
+ * @param buff_capacity Buffer capacity pooled leases use, 0 for the file
+ * default.
+ * @param max_buffers Maximum buffer pairs retained by the pool, 0 to disable.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_File_set_buffer_pool(u64 buff_capacity, u64 max_buffers);
+
+/**
+ * @brief Enables or disables background read-ahead on an open file. While
+ * enabled, a fill thread keeps `num_buffers` buffers of the file's io buffer
+ * capacity read ahead of the cursor, and buffered reads drain completed
+ * buffers instead of stalling on the device. If the return is negative, it's
+ * an error code.
+ *
+ * Intended for sequential one-pass consumers like decompress-and-parse
+ * pipelines, where it overlaps the device reads with the processing that
+ * kernel readahead alone cannot hide on a cold file. Read-ahead starts at
+ * the cursor; `TUNDRA_IOBUFF_PREFETCH_DEF_BUFFERS` is a good count for most
+ * pipelines. Seeking the cursor restarts the read-ahead at the new
+ * position; writing through the cursor API stops it. Direct-mode files are
+ * not supported.
+ *
+ * @param file File to configure.
+ * @param num_buffers Read-ahead buffers to keep filled, 0 to disable.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_File_set_prefetch(Tundra_File *file, u64 num_buffers);
+
+/**
+ * @brief Hints the kernel about the upcoming access pattern for a byte range
+ * of an open file. If the return is negative, it's an error code.
+ *
+ * Read-only opens already advise SEQUENTIAL over the whole file; use this
+ * for WILLNEED prefetching ahead of a scan, or DONTNEED behind one to keep a
+ * one-pass read from polluting the page cache.
+ *
+ * @param file File to advise on.
+ * @param offset Absolute byte offset the hint starts at.
+ * @param num_bytes Length of the hinted range, 0 for everything from
+ * `offset` on.
+ * @param advice One of the TUNDRA_FILE_ADVICE values.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_File_advise(Tundra_File *file, u64 offset, u64 num_bytes,
+    Tundra_FileAdvice advice);
+
 #ifdef __cplusplus
 }
 #endif
@@ -37,7 +37,88 @@ u64 Tundra_clamp_max_u64(u64 num, u64 max);
 i64 Tundra_clamp_min_i64(i64 num, i64 min);
 i64 Tundra_clamp_max_i64(i64 num, i64 max);
 
-/** 
+/**
+ * @brief Clamps every element of `data` into the range [`min`, `max`] in
+ * place.
+ *
+ * The branchless element loop vectorizes onto packed min/max instructions,
+ * clamping a full vector of elements per iteration rather than branching
+ * twice per element.
+ *
+ * `min` must not be greater than `max`.
+ *
+ * @param data Elements to clamp in place.
+ * @param num_elem Number of elements in `data`.
+ * @param min Smallest value to clamp up to.
+ * @param max Largest value to clamp down to.
+ */
+void Tundra_clamp_arr_u8(u8 *data, u64 num_elem, u8 min, u8 max);
+void Tundra_clamp_arr_i8(i8 *data, u64 num_elem, i8 min, i8 max);
+void Tundra_clamp_arr_u16(u16 *data, u64 num_elem, u16 min, u16 max);
+void Tundra_clamp_arr_i16(i16 *data, u64 num_elem, i16 min, i16 max);
+void Tundra_clamp_arr_u32(u32 *data, u64 num_elem, u32 min, u32 max);
+void Tundra_clamp_arr_i32(i32 *data, u64 num_elem, i32 min, i32 max);
+void Tundra_clamp_arr_u64(u64 *data, u64 num_elem, u64 min, u64 max);
+void Tundra_clamp_arr_i64(i64 *data, u64 num_elem, i64 min, i64 max);
+void Tundra_clamp_arr_float(float *data, u64 num_elem, float min, float max);
+void Tundra_clamp_arr_double(double *data, u64 num_elem, double min,
+    double max);
+
+/**
+ * @brief Returns the smallest element of `elems`.
+ *
+ * Reduces through four independent accumulators so the loop vectorizes and
+ * iterations overlap instead of serializing on one compare chain.
+ *
+ * `num_elem` must be greater than 0.
+ *
+ * @param elems Elements to reduce.
+ * @param num_elem Number of elements in `elems`.
+ *
+ * @return Smallest element.
+ */
+u64 Tundra_min_u64_arr(const u64 *elems, u64 num_elem);
+i64 Tundra_min_i64_arr(const i64 *elems, u64 num_elem);
+float Tundra_min_float_arr(const float *elems, u64 num_elem);
+double Tundra_min_double_arr(const double *elems, u64 num_elem);
+
+/**
+ * @brief Returns the largest element of `elems`.
+ *
+ * Reduces through four independent accumulators so the loop vectorizes and
+ * iterations overlap instead of serializing on one compare chain.
+ *
+ * `num_elem` must be greater than 0.
+ *
+ * @param elems Elements to reduce.
+ * @param num_elem Number of elements in `elems`.
+ *
+ * @return Largest element.
+ */
+u64 Tundra_max_u64_arr(const u64 *elems, u64 num_elem);
+i64 Tundra_max_i64_arr(const i64 *elems, u64 num_elem);
+float Tundra_max_float_arr(const float *elems, u64 num_elem);
+double Tundra_max_double_arr(const double *elems, u64 num_elem);
+
+/**
+ * @brief Returns the sum of the elements of `elems`, 0 if `num_elem` is 0.
+ *
+ * Reduces through four independent accumulators so the loop vectorizes and
+ * iterations overlap instead of serializing on one add chain. The float and
+ * double variants therefore sum in a different association order than a
+ * serial loop, which can change the rounding of the result.
+ *
+ * @param elems Elements to reduce.
+ * @param num_elem Number of elements in `elems`.
+ *
+ * @return Sum of the elements.
+ */
+u64 Tundra_sum_u64_arr(const u64 *elems, u64 num_elem);
+i64 Tundra_sum_i64_arr(const i64 *elems, u64 num_elem);
+float Tundra_sum_float_arr(const float *elems, u64 num_elem);
+double Tundra_sum_double_arr(const double *elems, u64 num_elem);
+
+/**
  * @brief Returns the smallest power of two greater than or equal to `num`.
  * 
  * `num` must be greater than 0.
@@ -16,6 +16,40 @@
 extern "C" {
 #endif
 
+// Number of small allocator size classes reported in Tundra_MemStats. Index 0
+// is the 16 byte class, each following index doubles (up through 4096 bytes).
+#define TUNDRA_MEM_STATS_NUM_SIZE_CLASSES 9
+
+/**
+ * @brief Snapshot of allocator counters, filled by `Tundra_get_mem_stats`.
+ *
+ * Counters are maintained with negligible hot-path cost, so polling them from
+ * a monitoring thread is cheap. Values read while other threads allocate are
+ * a best-effort snapshot, not an atomic one.
+ */
+typedef struct Tundra_MemStats
+{
+    // -- Small allocator (arena-carved blocks up to the max size class) --
+
+    u64 small_num_arenas; // Arenas mapped across all threads.
+    u64 small_arena_bytes; // Total bytes of os memory backing the arenas.
+    u64 small_used_bytes; // Bytes carved from the arenas, headers included.
+    u64 small_peak_arena_bytes; // High-water mark of `small_arena_bytes`.
+
+    // Freed blocks sitting in each size class bin, waiting for reuse.
+    u64 small_freed_bin_counts[TUNDRA_MEM_STATS_NUM_SIZE_CLASSES];
+
+    // -- Large allocator (per-allocation os blocks) --
+
+    u64 large_live_blocks; // Blocks currently handed out to the user.
+    u64 large_live_bytes; // Total os bytes backing the live blocks.
+    u64 large_peak_live_bytes; // High-water mark of `large_live_bytes`.
+    u64 large_cache_hits; // Allocations served from the freed-block cache.
+    u64 large_cache_misses; // Allocations that required an os round trip.
+    u64 large_cached_blocks; // Freed blocks currently sitting in the cache.
+    u64 large_cached_bytes; // Total os bytes backing the cached blocks.
+} Tundra_MemStats;
+
 // Internal Methods ----------------------------------------------------------------
 
 /**
@@ -49,15 +83,88 @@ u64 InTundra_calc_new_capacity_by_doubling(u64 required_bytes,
  */
 void* Tundra_alloc_mem(u64 num_bytes);
 
+/**
+ * Allocate a block of memory at least `num_bytes` in size whose address is
+ * aligned to `alignment`.
+ *
+ * Useful for buffers that need more than the default alignment, such as
+ * cacheline-padded structures or memory fed to wide SIMD loads. The returned
+ * block is freed with `Tundra_free_mem` like any other allocation.
+ *
+ * @param num_bytes Minimum number of bytes to allocate (must be > 0).
+ * @param alignment Required address alignment (must be a power of 2).
+ * @return void* Pointer to the aligned allocated block. Caller owns the
+ *    memory and must free it.
+ */
+void* Tundra_alloc_mem_aligned(u64 num_bytes, u64 alignment);
+
+/**
+ * Allocate a block of memory at least `num_bytes` in size whose pages are
+ * placed on numa node `node`, best effort.
+ *
+ * On multi socket machines remote memory costs noticeably more per access
+ * than local memory, so buffers a pinned worker hammers (arenas, queues, io
+ * buffers) should live on that worker's node. Placement is preferred rather
+ * than strict: under memory pressure on the node the kernel falls back to
+ * another one instead of failing. Node numbers run from 0 to
+ * `Tundra_get_num_numa_nodes() - 1`; threads that pin themselves with
+ * `Tundra_Thread_set_self_affinity` get local placement of everything they
+ * allocate afterward automatically and rarely need this explicit form.
+ *
+ * The block always comes from whole fresh os pages, so it is page aligned
+ * and best suited to large, long lived buffers. Freed with `Tundra_free_mem`
+ * like any other allocation.
+ *
+ * @param num_bytes Minimum number of bytes to allocate (must be > 0).
+ * @param node Numa node the block's pages should live on.
+ * @return void* Pointer to the allocated block, page aligned. Caller owns
+ *    the memory and must free it.
+ */
+void* Tundra_alloc_mem_on_node(u64 num_bytes, u32 node);
+
+/**
+ * Allocate a block of memory at least `num_bytes` in size with every byte
+ * zero-initialized.
+ *
+ * Much cheaper than allocating and zeroing manually for big buffers: fresh
+ * blocks from the large allocator arrive from the os already zeroed and are
+ * not touched at all, so only recycled blocks pay for a clear.
+ *
+ * @param num_bytes Minimum number of bytes to allocate (must be > 0).
+ * @return void* Pointer to the zeroed allocated block. Caller owns the
+ *    memory and must free it.
+ */
+void* Tundra_alloc_mem_zeroed(u64 num_bytes);
+
 /**
  * @brief Frees a block of memory allocated by Tundra.
- * 
+ *
  * no-op if a NULL is passed.
  *
  * @param mem_ptr Pointer to the memory block.
  */
 void Tundra_free_mem(void *mem_ptr);
 
+/**
+ * @brief Resizes a block of memory allocated by Tundra to hold at least
+ * `num_bytes`, returning the (possibly moved) block.
+ *
+ * Allocations are rounded up internally (to a size class or an os alignment
+ * increment), so a block often owns more bytes than were requested. When the
+ * new size fits inside that slack the block is grown in place and the
+ * original pointer is returned with no copying. Otherwise a new block is
+ * allocated, existing bytes are copied over and the old block is freed.
+ *
+ * Passing NULL behaves like `Tundra_alloc_mem`.
+ *
+ * @param mem_ptr Pointer to the memory block, or NULL.
+ * @param num_bytes Minimum number of bytes the block must hold (must be > 0).
+ *
+ * @return void* Pointer to the resized block. Any previous pointer to the
+ * block must be considered invalidated.
+ */
+void* Tundra_realloc_mem(void *mem_ptr, u64 num_bytes);
+
 /**
  * Allocate a memory block whose capacity is the smallest power of two
  * greater than or equal to num_bytes, and set the output pointers.
@@ -87,7 +194,79 @@ void* Tundra_alloc_copy_mem(const void *src, u64 num_alloc_bytes,
     u64 num_copy_bytes);
 
 /**
- * Ensure the block pointed to by *mem_out has capacity for num_used_bytes + 
+ * Set the limits of the cache that holds freed large allocations for reuse.
+ *
+ * Large allocations (ones beyond the small allocator's size classes) are
+ * cached on free and handed back by later allocations of the same size,
+ * skipping an os round trip. By default blocks up to 1 MiB are cached, 3 per
+ * size; workloads that cycle bigger buffers can widen the limits (up to an
+ * internal bound of 2 MiB), and passing 0 for either limit disables caching.
+ *
+ * @param max_block_bytes Largest allocation byte size allowed into the cache.
+ * @param max_blocks_per_size Most cached blocks kept per allocation size.
+ */
+void Tundra_set_mem_cache_limits(u64 max_block_bytes, u8 max_blocks_per_size);
+
+/**
+ * Release the physical memory of cached freed blocks back to the os while
+ * keeping them reusable.
+ *
+ * Call after a burst of large frees: later allocations of the cached sizes
+ * still skip the os round trip, but cold cached blocks stop counting toward
+ * the process's resident memory.
+ */
+void Tundra_trim_mem_cache(void);
+
+/**
+ * Sample large allocations into guard-page protected blocks, trapping
+ * buffer overruns in production builds without sanitizer overhead.
+ *
+ * While the rate is nonzero, one in every `rate` large allocations (ones
+ * beyond the small allocator's size classes) is laid out directly against a
+ * page the process cannot touch, so writing past the block's usable size
+ * faults at the overrunning instruction instead of silently corrupting a
+ * neighbor. Normal allocations are untouched, so the aggregate cost is one
+ * extra page and an mprotect per sampled allocation; at a rate in the
+ * thousands a rare overrun that a sanitizer build would never be deployed
+ * to catch surfaces within days of production traffic, with a crash dump
+ * pointing at the guilty write.
+ *
+ * The payload is placed as close to the guard page as 16 byte alignment
+ * allows, so an overrun crosses at most 15 slack bytes before trapping.
+ * Passing 0 (the default) disables sampling.
+ *
+ * @param rate Sampling rate, every `rate`-th large allocation is guarded.
+ *    0 to disable.
+ */
+void Tundra_set_mem_guard_rate(u64 rate);
+
+/**
+ * Write a report of the allocator's live allocations to an io handle,
+ * grouped by block size, for catching memory leaks.
+ *
+ * Tracking must be compiled in by building the library with
+ * TUNDRA_TRACK_ALLOCS defined; otherwise the report is a single notice that
+ * tracking is disabled. Defining TUNDRA_TRACK_ALLOC_SITES as well appends
+ * sampled allocation call site addresses to the report.
+ *
+ * @param out_handle Io handle the report is written to (1 is stdout).
+ */
+void Tundra_dump_mem_stats(i64 out_handle);
+
+/**
+ * Fill a Tundra_MemStats snapshot with the allocator's current counters.
+ *
+ * Aggregates small allocator arena usage and bin occupancy across all
+ * threads with the large allocator's live block totals, cache hit rate and
+ * high-water marks, letting monitoring code alert on allocator pressure
+ * before an out-of-memory fatal.
+ *
+ * @param stats_out Stats struct to fill.
+ */
+void Tundra_get_mem_stats(Tundra_MemStats *stats_out);
+
+/**
+ * Ensure the block pointed to by *mem_out has capacity for num_used_bytes +
  * num_reserve_bytes. If not, reallocate (doubling capacity until sufficient) 
  * and update *mem_out and *capacity_out.
  *
@@ -67,6 +67,39 @@ void Tundra_copy_mem_safe(const void *src, void *dst, u64 num_bytes);
  */
 void Tundra_zero_out_mem(void *mem, u64 num_bytes);
 
+/**
+ * @brief Sets `num_bytes` in `mem` to `value`.
+ *
+ * @param mem Memory block to fill.
+ * @param value Byte value to store across the range.
+ * @param num_bytes Number of bytes to fill.
+ */
+void Tundra_fill_mem(void *mem, u8 value, u64 num_bytes);
+
+/**
+ * @brief Fills `mem` with `num_elems` repetitions of a 4 byte pattern.
+ *
+ * Useful for initializing sentinel-filled tables whose entries are wider
+ * than a byte. `mem` must be 4 byte aligned.
+ *
+ * @param mem Memory block to fill.
+ * @param value 4 byte pattern to store across the range.
+ * @param num_elems Number of pattern repetitions to store.
+ */
+void Tundra_fill_mem_u32(void *mem, u32 value, u64 num_elems);
+
+/**
+ * @brief Fills `mem` with `num_elems` repetitions of an 8 byte pattern.
+ *
+ * Useful for initializing sentinel-filled tables whose entries are wider
+ * than a byte. `mem` must be 8 byte aligned.
+ *
+ * @param mem Memory block to fill.
+ * @param value 8 byte pattern to store across the range.
+ * @param num_elems Number of pattern repetitions to store.
+ */
+void Tundra_fill_mem_u64(void *mem, u64 value, u64 num_elems);
+
 /**
  * @brief Compares `num_bytes` from `first` and `second`, returning true if 
  * both contain `num_bytes` bytes and said bytes are equal.
@@ -77,6 +110,88 @@ void Tundra_zero_out_mem(void *mem, u64 num_bytes);
  */
 bool Tundra_cmp_mem(const void *first, const void *second, u64 num_bytes);
 
+/**
+ * @brief Compares `num_bytes` from `first` and `second` byte by byte,
+ * returning their ordering.
+ *
+ * Bytes are compared as unsigned values in address order, so the result
+ * matches a lexicographic comparison of the two regions. Comparison runs 16
+ * bytes at a time with a scalar tail, locating the first differing byte with
+ * a trailing-zero count rather than a byte walk.
+ *
+ * @param first First memory block.
+ * @param second Second memory block.
+ * @param num_bytes Number of bytes to compare.
+ *
+ * @return i32 Negative if `first` orders below `second`, 0 if the regions are
+ * equal, positive if `first` orders above `second`.
+ */
+i32 Tundra_compare_mem(const void *first, const void *second, u64 num_bytes);
+
+/**
+ * @brief Returns true if `num_bytes` from `first` and `second` are equal.
+ *
+ * Equality-only fast path: compares 16 bytes at a time with a scalar tail and
+ * returns on the first difference, without computing an ordering.
+ *
+ * @param first First memory block.
+ * @param second Second memory block.
+ * @param num_bytes Number of bytes to compare.
+ *
+ * @return bool True if the regions are byte-for-byte equal.
+ */
+bool Tundra_compare_mem_eq(const void *first, const void *second,
+    u64 num_bytes);
+
+/**
+ * @brief Returns the index of the first occurrence of `value` in `mem`, or -1
+ * if the range holds none.
+ *
+ * Scans 16 bytes per iteration with a scalar tail, using the SWAR zero-byte
+ * test against a broadcast of `value` and locating the match with a
+ * trailing-zero count rather than a byte walk.
+ *
+ * @param mem Memory block to scan.
+ * @param num_bytes Number of bytes to scan.
+ * @param value Byte value to search for.
+ *
+ * @return `i64` Index of the first occurrence, or -1 if there is none.
+ */
+i64 Tundra_find_byte(const void *mem, u64 num_bytes, u8 value);
+
+/**
+ * @brief Returns the index of the last occurrence of `value` in `mem`, or -1
+ * if the range holds none.
+ *
+ * Same wide scan as `Tundra_find_byte`, walking from the end of the range and
+ * locating the match with a leading-zero count.
+ *
+ * @param mem Memory block to scan.
+ * @param num_bytes Number of bytes to scan.
+ * @param value Byte value to search for.
+ *
+ * @return `i64` Index of the last occurrence, or -1 if there is none.
+ */
+i64 Tundra_rfind_byte(const void *mem, u64 num_bytes, u8 value);
+
+/**
+ * @brief Returns the index of the first occurrence of the byte sequence
+ * `pattern` inside `mem`, or -1 if it does not occur.
+ *
+ * Vector-scans for the pattern's first byte with `Tundra_find_byte`, then
+ * confirms each candidate with the wide equality compare. An empty pattern
+ * matches at index 0.
+ *
+ * @param mem Memory block to scan.
+ * @param num_bytes Number of bytes to scan.
+ * @param pattern Byte sequence to search for.
+ * @param num_pattern_bytes Number of bytes in `pattern`.
+ *
+ * @return `i64` Index of the first occurrence, or -1 if there is none.
+ */
+i64 Tundra_find_bytes(const void *mem, u64 num_bytes, const void *pattern,
+    u64 num_pattern_bytes);
+
 /**
  * @brief Remove a contiguous range of bytes by shifting trailing bytes down.
  *
@@ -96,12 +211,13 @@ void Tundra_erase_shift_left(void *mem, u64 index,
     u64 num_erase_bytes, u64 tot_bytes);
 
 /**
- * @brief Returns the number of characters in a null terminated C String, not 
- * including the null terminator. 
- * 
- * Must perform a linear walk over the string. Passing a string with no null
- * terminator is undefined.  
- * 
+ * @brief Returns the number of characters in a null terminated C String, not
+ * including the null terminator.
+ *
+ * The terminator is scanned for in aligned 16 byte blocks (bytewise compare
+ * plus movemask), so the walk runs well past a byte per cycle. Passing a
+ * string with no null terminator is undefined.
+ *
  * @param cstr String to parse.
  * 
  * @return `u64` Number of characters in the string, excluding the null 
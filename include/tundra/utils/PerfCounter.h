@@ -0,0 +1,89 @@
+/**
+ * @file PerfCounter.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Hardware performance counters around code regions via
+ * perf_event_open.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_PERFCOUNTER_H
+#define TUNDRA_PERFCOUNTER_H
+
+#include "tundra/common/TypeDef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A set of per-thread hardware counters: cycles, cache misses and branch
+ * misses. Counters run from open to close; deltas over a code region are
+ * taken with a begin/end pair, so no syscalls land inside the region beyond
+ * the three counter reads on each side.
+ */
+typedef struct Tundra_PerfCounter
+{
+    i64 cycles_fd;
+    i64 cache_miss_fd;
+    i64 branch_miss_fd;
+
+    // Counter values captured at the last `begin`.
+    u64 begin_cycles;
+    u64 begin_cache_misses;
+    u64 begin_branch_misses;
+} Tundra_PerfCounter;
+
+/**
+ * Counter deltas over one begin/end region.
+ */
+typedef struct Tundra_PerfResult
+{
+    u64 cycles;
+    u64 cache_misses;
+    u64 branch_misses;
+} Tundra_PerfResult;
+
+/**
+ * @brief Opens the counter set for the calling thread, userspace events only.
+ *
+ * Hardware counters can be unavailable (kernel.perf_event_paranoid, VMs,
+ * containers); a false return means no counters were opened and the
+ * begin/end pair reports zero deltas. `close` is safe either way.
+ *
+ * @param ctr Counter set to open.
+ *
+ * @return bool True if all counters opened.
+ */
+bool Tundra_PerfCtr_open(Tundra_PerfCounter *ctr);
+
+/**
+ * @brief Captures current counter values as the start of a region.
+ *
+ * @param ctr Open counter set.
+ */
+void Tundra_PerfCtr_begin(Tundra_PerfCounter *ctr);
+
+/**
+ * @brief Captures current counter values and outputs the deltas since the
+ * last `begin`.
+ *
+ * @param ctr Open counter set.
+ * @param result_out Deltas over the region.
+ */
+void Tundra_PerfCtr_end(Tundra_PerfCounter *ctr,
+    Tundra_PerfResult *result_out);
+
+/**
+ * @brief Closes the counter set. Safe to call on a set that failed to open.
+ *
+ * @param ctr Counter set to close.
+ */
+void Tundra_PerfCtr_close(Tundra_PerfCounter *ctr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,88 @@
+/**
+ * @file Rng.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Fast non-cryptographic random number generation (xoshiro256++).
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_RNG_H
+#define TUNDRA_RNG_H
+
+#include "tundra/common/TypeDef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief xoshiro256++ generator state.
+ *
+ * Per-instance state with no hidden globals or locks; give each thread its
+ * own generator for contention-free random numbers. Not cryptographically
+ * secure.
+ *
+ * Must be initialized using the `init` method before use. No free is needed.
+ *
+ * Internals are read-only.
+ */
+typedef struct Tundra_Rng
+{
+    // Generator state, never all zero after init.
+    u64 state[4];
+} Tundra_Rng;
+
+/**
+ * @brief Initializes a generator from a seed.
+ *
+ * Any seed is valid, including 0; the state is expanded through splitmix64
+ * so it is never all zero. The same seed always yields the same sequence.
+ *
+ * @param rng Generator to init.
+ * @param seed Seed to expand into the state.
+ */
+void Tundra_Rng_init(Tundra_Rng *rng, u64 seed);
+
+/**
+ * @brief Returns the next random u64 of the generator's sequence.
+ *
+ * @param rng Generator to advance.
+ *
+ * @return u64 Random number.
+ */
+u64 Tundra_Rng_next_u64(Tundra_Rng *rng);
+
+/**
+ * @brief Returns an unbiased random u64 in the range [0, `bound`).
+ *
+ * Uses Lemire's multiply-shift rejection method: the common case is one
+ * multiply with no divide, and the rare rejection loop removes the modulo
+ * bias of masking or remainder approaches.
+ *
+ * `bound` must be greater than 0.
+ *
+ * @param rng Generator to advance.
+ * @param bound Exclusive upper bound, must be greater than 0.
+ *
+ * @return u64 Random number in [0, `bound`).
+ */
+u64 Tundra_Rng_range_u64(Tundra_Rng *rng, u64 bound);
+
+/**
+ * @brief Fills `data` with `num_bytes` random bytes.
+ *
+ * Bulk variant of `next_u64`: writes whole u64s and patches the tail, so the
+ * per-call overhead is paid once per 8 bytes.
+ *
+ * @param rng Generator to advance.
+ * @param data Buffer to fill.
+ * @param num_bytes Number of bytes to fill.
+ */
+void Tundra_Rng_fill(Tundra_Rng *rng, void *data, u64 num_bytes);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,213 @@
+/**
+ * @file ScratchArena.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Bump allocated scratch arena with O(1) whole-arena reset.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_SCRATCHARENA_H
+#define TUNDRA_SCRATCHARENA_H
+
+#include "tundra/common/TypeDef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * A scratch arena is for short-lived allocations that all die together, such
+ * as per-frame or per-request work. Allocations are carved by bumping a single
+ * offset with no per-block headers, and the entire arena is reclaimed at once
+ * by resetting that offset instead of freeing blocks one at a time.
+ *
+ * Containers can live on a scratch arena without modification through scopes.
+ * While a scope is active, every allocation made by the calling thread
+ * (including ones made internally by containers) is bumped from the scoped
+ * arena, and frees of scratch-owned memory become no-ops:
+ *
+ *     Tundra_ScrArena_push_scope(&arena);
+ *     Tundra_DynArrInt_init(&arr);
+ *     // ... use arr, no frees required ...
+ *     Tundra_ScrArena_pop_scope();
+ *     Tundra_ScrArena_reset(&arena); // reclaims everything at once
+ *
+ * The generated containers also expose an `init_in` method that scopes the
+ * arena for just their init, binding their initial storage to it without
+ * wrapping the surrounding code in a scope.
+ *
+ * If a scoped allocation does not fit in the arena it falls back to the
+ * regular allocator, so oversized requests still succeed (and must be freed
+ * normally, which happens automatically when containers free themselves).
+ *
+ * Arenas are owned by the thread that created them and must not be shared
+ * across threads.
+ */
+typedef struct Tundra_ScratchArena
+{
+    u8 *base_ptr; // Pointer to the arena's allocated memory start.
+    u64 used_bytes; // Number of bytes currently bumped off the arena.
+    u64 total_size_bytes; // Total size in bytes the arena holds.
+
+    // Offset of the most recent allocation, used to grow the last block in
+    // place on reallocation.
+    u64 last_alloc_offset;
+
+    // Next live scratch arena owned by the calling thread, internal.
+    struct Tundra_ScratchArena *next_live;
+
+    // Arena that was scoped before this one, restored on pop. Internal.
+    struct Tundra_ScratchArena *prev_scope;
+} Tundra_ScratchArena;
+
+/**
+ * Saved bump state of a scratch arena, captured with `Tundra_ScrArena_snapshot`
+ * and reapplied with `Tundra_ScrArena_restore` to abandon everything bumped
+ * in between.
+ */
+typedef struct
+{
+    u64 used_bytes;
+    u64 last_alloc_offset;
+} Tundra_ScrArenaSnapshot;
+
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Bumps an allocation from the calling thread's scoped arena, if any.
+ *
+ * Returns NULL if no scope is active or the arena lacks room, in which case
+ * the caller should fall through to the regular allocator.
+ *
+ * @param num_bytes Number of bytes to allocate.
+ *
+ * @return void* Pointer to the bumped memory, NULL if not handled.
+ */
+void* InTundra_ScrArena_scope_alloc(u64 num_bytes);
+
+/**
+ * @brief No-op "free" of scratch-owned memory.
+ *
+ * Returns true if `ptr` lives inside one of the calling thread's live scratch
+ * arenas, meaning the free is absorbed (scratch memory is reclaimed by reset,
+ * not per-block frees). Returns false if the pointer is not scratch-owned.
+ *
+ * @param ptr Pointer to check.
+ *
+ * @return bool True if the free was absorbed.
+ */
+bool InTundra_ScrArena_try_free(void *ptr);
+
+/**
+ * @brief Reallocates scratch-owned memory within its owning arena.
+ *
+ * The most recent allocation is grown in place by bumping the offset further.
+ * Older blocks are bump-allocated anew and copied, with the old bytes left
+ * behind until the arena is reset. Returns NULL if `ptr` is not scratch-owned.
+ *
+ * @param ptr Pointer to scratch-owned memory.
+ * @param num_bytes Minimum number of bytes the block must hold.
+ *
+ * @return void* Pointer to the resized block, NULL if not handled.
+ */
+void* InTundra_ScrArena_realloc(void *ptr, u64 num_bytes);
+
+
+// Public Methods --------------------------------------------------------------
+
+/**
+ * @brief Initializes a scratch arena with at least `num_bytes` of capacity,
+ * allocating its memory from the os.
+ *
+ * Only initialize an arena once. The capacity is rounded up to an increment
+ * of the os alloc alignment.
+ *
+ * @param arena Arena to initialize.
+ * @param num_bytes Minimum capacity in bytes (must be > 0).
+ */
+void Tundra_ScrArena_init(Tundra_ScratchArena *arena, u64 num_bytes);
+
+/**
+ * @brief Bump-allocates memory from a scratch arena.
+ *
+ * Falls back to the regular allocator if the arena lacks room, so the
+ * returned pointer is always valid. Scratch-owned memory must not be freed
+ * individually, it is reclaimed by `Tundra_ScrArena_reset`.
+ *
+ * @param arena Arena to allocate from.
+ * @param num_bytes Number of bytes to allocate (must be > 0).
+ *
+ * @return void* Pointer to the allocated memory.
+ */
+void* Tundra_ScrArena_alloc(Tundra_ScratchArena *arena, u64 num_bytes);
+
+/**
+ * @brief Reclaims every allocation in the arena at once by resetting its bump
+ * offset.
+ *
+ * All memory previously bumped from the arena is invalidated.
+ *
+ * @param arena Arena to reset.
+ */
+void Tundra_ScrArena_reset(Tundra_ScratchArena *arena);
+
+/**
+ * @brief Captures an arena's current bump state so speculative work bumped
+ * after this point can be rolled back in O(1) with
+ * `Tundra_ScrArena_restore`.
+ *
+ * @param arena Arena to snapshot.
+ *
+ * @return Tundra_ScrArenaSnapshot Saved bump state.
+ */
+Tundra_ScrArenaSnapshot Tundra_ScrArena_snapshot(
+    const Tundra_ScratchArena *arena);
+
+/**
+ * @brief Rolls an arena back to a snapshot, abandoning every allocation
+ * bumped since it was captured.
+ *
+ * The snapshot must have been taken from this arena, and the arena must not
+ * have been reset or freed since. Allocations that fell back to the regular
+ * allocator because the arena lacked room are not rolled back and must still
+ * be freed normally.
+ *
+ * @param arena Arena to roll back.
+ * @param snapshot Snapshot to restore.
+ */
+void Tundra_ScrArena_restore(Tundra_ScratchArena *arena,
+    Tundra_ScrArenaSnapshot snapshot);
+
+/**
+ * @brief Releases a scratch arena's memory back to the os.
+ *
+ * The arena must not be scoped when freed, pop its scope first.
+ *
+ * @param arena Arena to free.
+ */
+void Tundra_ScrArena_free(Tundra_ScratchArena *arena);
+
+/**
+ * @brief Makes `arena` the calling thread's scoped arena, redirecting the
+ * thread's allocations into it until the scope is popped.
+ *
+ * Scopes nest, pushing a second arena saves the first, which is restored on
+ * pop.
+ *
+ * @param arena Arena to scope.
+ */
+void Tundra_ScrArena_push_scope(Tundra_ScratchArena *arena);
+
+/**
+ * @brief Pops the calling thread's current arena scope, restoring the
+ * previously scoped arena if any.
+ */
+void Tundra_ScrArena_pop_scope(void);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // TUNDRA_SCRATCHARENA_H
@@ -0,0 +1,100 @@
+/**
+ * @file Stats.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Compile-time-gated hot-path event counters.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_STATS_H
+#define TUNDRA_STATS_H
+
+#include "tundra/common/TypeDef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Counters incremented at library choke points when the library is built with
+ * `TUNDRA_STATS` defined. Each increment is a single relaxed atomic add;
+ * without the define every increment site compiles to nothing.
+ */
+typedef enum
+{
+    // Trips through InTundra_syscall.
+    TUNDRA_STAT_SYSCALL,
+
+    // Output buffer flushes to the OS.
+    TUNDRA_STAT_OBUFF_FLUSH,
+
+    // Blocks carved from small allocator arenas.
+    TUNDRA_STAT_SML_BLOCK_CREATE,
+
+    // Large allocator freed-block cache hits and misses.
+    TUNDRA_STAT_LG_CACHE_HIT,
+    TUNDRA_STAT_LG_CACHE_MISS,
+
+    TUNDRA_STAT_NUM_COUNTERS
+} Tundra_StatCounter;
+
+#ifdef TUNDRA_STATS
+
+extern u64 InTundra_stat_counts[TUNDRA_STAT_NUM_COUNTERS];
+
+/**
+ * @brief Increments a hot-path counter. Compiles to nothing unless the
+ * library is built with `TUNDRA_STATS`.
+ *
+ * @param counter `Tundra_StatCounter` enumerator name without the
+ * `TUNDRA_STAT_` prefix, e.g. `TUNDRA_STAT_INCR(SYSCALL)`.
+ */
+#define TUNDRA_STAT_INCR(counter) \
+    ((void)__atomic_fetch_add(&InTundra_stat_counts[TUNDRA_STAT_##counter], \
+        1, __ATOMIC_RELAXED))
+
+#else // TUNDRA_STATS
+
+#define TUNDRA_STAT_INCR(counter) ((void)0)
+
+#endif // TUNDRA_STATS
+
+/**
+ * @brief Outputs every hot-path counter to standard output. If the library
+ * was built without `TUNDRA_STATS`, outputs a note saying so instead.
+ */
+void Tundra_dump_stats(void);
+
+// Number of accounting slots when syscall tracing is on; syscall numbers at
+// or past the last slot share it.
+#define TUNDRA_SYSCALL_TRACE_SLOTS 512
+
+#ifdef TUNDRA_SYSCALL_TRACE
+
+/**
+ * Per-syscall-number invocation counts and cumulative cycles spent in the
+ * trap, filled by `InTundra_syscall` when the library is built with
+ * `TUNDRA_SYSCALL_TRACE`.
+ */
+extern u64 InTundra_syscall_trace_counts[TUNDRA_SYSCALL_TRACE_SLOTS];
+extern u64 InTundra_syscall_trace_cycles[TUNDRA_SYSCALL_TRACE_SLOTS];
+
+#endif // TUNDRA_SYSCALL_TRACE
+
+/**
+ * @brief Outputs count, total and mean latency for every syscall number
+ * used so far to standard output, in syscall number order. If the library
+ * was built without `TUNDRA_SYSCALL_TRACE`, outputs a note saying so
+ * instead.
+ *
+ * Calibrates the cycle counter to report latencies in nanoseconds, so the
+ * call itself costs around a millisecond; intended for shutdown.
+ */
+void Tundra_dump_syscall_trace(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -14,6 +14,7 @@
 
 #include "tundra/common/TypeDef.h"
 #include "tundra/utils/MemAlloc.h"
+#include "tundra/containers/String.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,12 +36,28 @@ extern "C" {
 #define TUNDRA_MAX_CHARS_TO_REPRESENT_FLOAT \
     TUNDRA_MAX_CHARS_TO_REPRESENT_FLOAT_INT_PART + 1 + TUNDRA_FLOAT_PRECISION
 
-// #define INTUNDRA_FLOAT_ROUNDING_CONSTANT 0.0005f
+// Shortest round-trip output: sign, 17 digits, decimal point and up to a
+// 5 character exponent suffix.
+#define TUNDRA_MAX_CHARS_TO_REPRESENT_DOUBLE 24
 
-extern float InTundra_float_rounding_constant;
+#define TUNDRA_MAX_CHARS_TO_REPRESENT_U64_HEX 16
+#define TUNDRA_MAX_CHARS_TO_REPRESENT_U64_BIN 64
 
-// u64 InTundra_int_to_cstr_helper(u64 num, char *buffer, char *output, 
-//     bool negative_num);
+// u64 InTundra_int_to_cstr_helper(u64 num, char *output, bool negative_num);
+
+/**
+ * @brief Returns the number of decimal digits needed to represent `num`.
+ *
+ * Computed from the bit width and a power-of-ten table rather than a divide
+ * loop, so formatting code can know its output length up front.
+ *
+ * `num` of 0 counts as one digit.
+ *
+ * @param num Num to measure.
+ *
+ * @return `u8` Number of decimal digits, 1 through 20.
+ */
+u8 Tundra_u64_digit_count(u64 num);
 
 /**
  * @brief Converts an u64 to a heap allocated C string . Caller manages the 
@@ -132,6 +149,16 @@ Tundra_CStr Tundra_i8_to_cstr(i8 num);
  */
 Tundra_CStr Tundra_float_to_cstr(float num);
 
+/**
+ * @brief Converts a double to a heap allocated C string . Caller manages the 
+ * allocated memory.
+ * 
+ * @param num Num to convert.
+ * 
+ * @return Tundra_CStr Heap allocated CStr, caller is responsible for memory.
+ */
+Tundra_CStr Tundra_double_to_cstr(double num);
+
 /**
  * @brief Converts an u64 to a C string placing the results in the provided 
  * buffer.  
@@ -259,8 +286,106 @@ u64 Tundra_u8_to_cstr_buf(u8 num, char *output);
  */
 u64 Tundra_i8_to_cstr_buf(i8 num, char *output);
 
+/**
+ * @brief Converts a float to a C string placing the results in the provided
+ * buffer and returning the length of the converted string.
+ *
+ * Output is the shortest decimal string that parses back to exactly `num`,
+ * in plain notation for moderate exponents and `d.ddde±x` notation
+ * otherwise. Ensure that the `output` buffer is at least
+ * `TUNDRA_MAX_CHARS_TO_REPRESENT_FLOAT + 1` bytes long, the + 1 is for the
+ * null terminator.
+ *
+ * @param num Num to convert.
+ * @param output Buffer to place converted characters into.
+ *
+ * @return Number of characters in the converted string, not including the
+ * null terminator. If return is 0, conversion failed.
+ */
 u64 Tundra_float_to_cstr_buf(float num, char *output);
 
+/**
+ * @brief Converts a double to a C string placing the results in the provided
+ * buffer and returning the length of the converted string.
+ *
+ * Same shortest round-trip output as `Tundra_float_to_cstr_buf`. Ensure that
+ * the `output` buffer is at least `TUNDRA_MAX_CHARS_TO_REPRESENT_DOUBLE + 1`
+ * bytes long, the + 1 is for the null terminator.
+ *
+ * @param num Num to convert.
+ * @param output Buffer to place converted characters into.
+ *
+ * @return Number of characters in the converted string, not including the
+ * null terminator. If return is 0, conversion failed.
+ */
+u64 Tundra_double_to_cstr_buf(double num, char *output);
+
+/**
+ * @brief Converts an u64 to hexadecimal, placing the results in the provided
+ * buffer and returning the length of the converted string.
+ *
+ * Digits are lowercase with no `0x` prefix. With `leading_zeros` the output
+ * is always 16 characters; without, it is only the significant digits.
+ * Ensure that the `output` buffer is at least
+ * `TUNDRA_MAX_CHARS_TO_REPRESENT_U64_HEX + 1` bytes long, the + 1 is for the
+ * null terminator.
+ *
+ * @param num Num to convert.
+ * @param output Buffer to place converted characters into.
+ * @param leading_zeros True to zero pad to the full 16 digits.
+ *
+ * @return Number of characters in the converted string, not including the
+ * null terminator. If return is 0, conversion failed.
+ */
+u64 Tundra_u64_to_hex_buf(u64 num, char *output, bool leading_zeros);
+
+/**
+ * @brief Converts an u64 to binary, placing the results in the provided
+ * buffer and returning the length of the converted string.
+ *
+ * With `leading_zeros` the output is always 64 characters; without, it is
+ * only the significant bits. Ensure that the `output` buffer is at least
+ * `TUNDRA_MAX_CHARS_TO_REPRESENT_U64_BIN + 1` bytes long, the + 1 is for the
+ * null terminator.
+ *
+ * @param num Num to convert.
+ * @param output Buffer to place converted characters into.
+ * @param leading_zeros True to zero pad to the full 64 bits.
+ *
+ * @return Number of characters in the converted string, not including the
+ * null terminator. If return is 0, conversion failed.
+ */
+u64 Tundra_u64_to_bin_buf(u64 num, char *output, bool leading_zeros);
+
+/**
+ * @brief Converts a whole array of u64s into one separator-joined String.
+ *
+ * The output is sized once up front from the digit counts, then every value
+ * is converted straight into the final buffer, so a column writes with one
+ * allocation and no per-element call overhead. `output` must be
+ * uninitialized; this initializes it.
+ *
+ * @param vals Values to convert.
+ * @param num_vals Number of values.
+ * @param sep Separator character placed between values.
+ * @param output Receives the joined text.
+ */
+void Tundra_u64_array_to_cstr(const u64 *vals, u64 num_vals, char sep,
+    Tundra_String *output);
+
+/**
+ * @brief Converts a whole array of i64s into one separator-joined String.
+ *
+ * Same single-allocation batch conversion as `Tundra_u64_array_to_cstr`.
+ *
+ * @param vals Values to convert.
+ * @param num_vals Number of values.
+ * @param sep Separator character placed between values.
+ * @param output Receives the joined text.
+ */
+void Tundra_i64_array_to_cstr(const i64 *vals, u64 num_vals, char sep,
+    Tundra_String *output);
+
 u8 Tundra_str_to_u8(const char *str);
 
 i8 Tundra_str_to_i8(const char *str);
@@ -275,6 +400,18 @@ int Tundra_str_to_int(const char *str);
 
 u64 Tundra_str_to_u64(const char *str);
 
+/**
+ * @brief Converts a hexadecimal string to an u64.
+ *
+ * Accepts upper or lowercase digits and an optional `0x`/`0X` prefix.
+ * Throws a Fatal on invalid characters or more than 16 digits.
+ *
+ * @param str String to parse.
+ *
+ * @return `u64` Parsed value.
+ */
+u64 Tundra_hex_to_u64(const char *str);
+
 i64 Tundra_str_to_i64(const char *str);
 
 float Tundra_str_to_float(const char *str);
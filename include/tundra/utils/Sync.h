@@ -0,0 +1,151 @@
+/**
+ * @file Sync.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Futex-backed blocking coordination: mutex and event primitives.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_SYNC_H
+#define TUNDRA_SYNC_H
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/common/Atomics.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Lightweight mutual-exclusion lock. Zero-initialized means unlocked, so
+ * static mutexes need no init call. The uncontended lock and unlock are a
+ * single atomic each; the kernel is only entered when a thread actually
+ * has to sleep.
+ *
+ * Not recursive: locking a mutex the calling thread already holds
+ * deadlocks.
+ */
+typedef struct Tundra_Mutex
+{
+    // 0 unlocked, 1 locked, 2 locked with at least one sleeping waiter.
+    u32 state;
+} Tundra_Mutex;
+
+/**
+ * Wakeable event for consumers that sleep until work arrives. Waiters park
+ * on the notify counter; every notify bumps it and wakes them.
+ *
+ * A wait may return spuriously or consume a notify meant for earlier work,
+ * so always wait in a loop that re-checks the real condition:
+ *
+ * while(!work_available())
+ * { Tundra_Event_wait(&event); }
+ *
+ * Zero-initialized means ready for use, so static events need no init
+ * call.
+ */
+typedef struct Tundra_Event
+{
+    // Count of notifies so far; waiters sleep until it moves.
+    u32 seq;
+} Tundra_Event;
+
+
+// Internal Methods ------------------------------------------------------------
+
+/**
+ * @brief Contended-path lock: marks the mutex contended and sleeps until
+ * it can be taken.
+ *
+ * @param mutex Mutex to lock.
+ */
+void InTundra_Mutex_lock_slow(Tundra_Mutex *mutex);
+
+/**
+ * @brief Contended-path unlock: releases the mutex and wakes one sleeping
+ * waiter.
+ *
+ * @param mutex Mutex to unlock.
+ */
+void InTundra_Mutex_unlock_slow(Tundra_Mutex *mutex);
+
+
+// Public Methods --------------------------------------------------------------
+
+/**
+ * @brief Acquires the mutex, sleeping in the kernel if another thread
+ * holds it.
+ *
+ * @param mutex Mutex to lock.
+ */
+static inline void Tundra_Mutex_lock(Tundra_Mutex *mutex)
+{
+    u32 expected = 0;
+
+    if(Tundra_atm_cas_u32(&mutex->state, &expected, 1, TUNDRA_ATM_ACQUIRE,
+        TUNDRA_ATM_RELAXED))
+    { return; }
+
+    InTundra_Mutex_lock_slow(mutex);
+}
+
+/**
+ * @brief Attempts to acquire the mutex without blocking.
+ *
+ * @param mutex Mutex to lock.
+ *
+ * @return bool True if the mutex was acquired.
+ */
+static inline bool Tundra_Mutex_try_lock(Tundra_Mutex *mutex)
+{
+    u32 expected = 0;
+
+    return Tundra_atm_cas_u32(&mutex->state, &expected, 1,
+        TUNDRA_ATM_ACQUIRE, TUNDRA_ATM_RELAXED);
+}
+
+/**
+ * @brief Releases the mutex, waking one sleeping waiter if any built up.
+ *
+ * Must only be called by the thread that holds the mutex.
+ *
+ * @param mutex Mutex to unlock.
+ */
+static inline void Tundra_Mutex_unlock(Tundra_Mutex *mutex)
+{
+    // 1 -> 0 means nobody was sleeping and no wake is needed; anything
+    // else was the contended state.
+    if(Tundra_atm_fetch_sub_u32(&mutex->state, 1, TUNDRA_ATM_RELEASE) != 1)
+    { InTundra_Mutex_unlock_slow(mutex); }
+}
+
+/**
+ * @brief Blocks until the event is next notified.
+ *
+ * May return spuriously; wait in a loop re-checking the condition the
+ * event stands for.
+ *
+ * @param event Event to wait on.
+ */
+void Tundra_Event_wait(Tundra_Event *event);
+
+/**
+ * @brief Notifies the event, waking one waiting thread.
+ *
+ * @param event Event to notify.
+ */
+void Tundra_Event_notify_one(Tundra_Event *event);
+
+/**
+ * @brief Notifies the event, waking every waiting thread.
+ *
+ * @param event Event to notify.
+ */
+void Tundra_Event_notify_all(Tundra_Event *event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
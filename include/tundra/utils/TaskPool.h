@@ -0,0 +1,153 @@
+/**
+ * @file TaskPool.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Work-stealing task scheduler over the thread and futex primitives.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TASKPOOL_H
+#define TUNDRA_TASKPOOL_H
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/utils/Sync.h"
+#include "tundra/utils/ScratchArena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Body of one task.
+ *
+ * `scratch` is the running worker's scratch arena: allocate freely from it,
+ * everything the task bumps is reclaimed when it returns. Memory bumped from
+ * it must not outlive the task.
+ */
+typedef void (*Tundra_TaskFn)(void *user_data, Tundra_ScratchArena *scratch);
+
+/**
+ * @brief Body of one span of a parallel-for, covering iterations
+ * [`begin`, `end`).
+ */
+typedef void (*Tundra_ParallelForFn)(u64 begin, u64 end, void *user_data);
+
+/**
+ * A submitted task. The struct is the handle: it must stay alive and in
+ * place until `wait` on it returns, and may be reused for another submit
+ * afterwards.
+ */
+typedef struct Tundra_Task
+{
+    Tundra_TaskFn fn;
+    void *user_data;
+
+    // Futex word flipped to 1 when the task finishes.
+    u32 done_futex;
+
+    // Next task in the external submission list, internal.
+    struct Tundra_Task *next;
+} Tundra_Task;
+
+/**
+ * @brief Pool of worker threads executing submitted tasks.
+ *
+ * Each worker owns a work-stealing deque: tasks submitted from a worker go
+ * to its own deque and are taken newest-first for cache warmth, while idle
+ * workers steal oldest-first from the others. Tasks submitted from threads
+ * outside the pool land on a shared injection list the workers drain.
+ * Workers that find no work back off through a pause loop before sleeping
+ * on a futex, so an idle pool costs nothing.
+ *
+ * Tasks may submit further tasks and wait on them; a worker that waits
+ * lends itself to the pool and keeps executing other tasks, so nested
+ * parallelism cannot deadlock the pool.
+ *
+ * Internals are read-only.
+ */
+typedef struct Tundra_TaskPool
+{
+    // Worker state, one per thread, allocated at init.
+    struct InTundra_TaskWorker *workers;
+    u64 num_workers;
+
+    // External submissions, pushed under the lock and drained by workers.
+    Tundra_Task *inject_head;
+    Tundra_Task *inject_tail;
+    Tundra_Mutex inject_lock;
+
+    // Bumped on every submit and completion; idle workers sleep on it.
+    u32 work_seq;
+
+    // Cleared to stop the workers during free.
+    bool running;
+} Tundra_TaskPool;
+
+/**
+ * @brief Initializes the pool and spawns its worker threads.
+ *
+ * @param pool Pool to init.
+ * @param num_workers Number of worker threads; 0 spawns one per cpu the
+ * calling thread may run on.
+ */
+void Tundra_TaskPool_init(Tundra_TaskPool *pool, u64 num_workers);
+
+/**
+ * @brief Stops the workers, joins them and frees the pool's memory.
+ *
+ * Every submitted task must have been waited on first.
+ *
+ * @param pool Pool to free.
+ */
+void Tundra_TaskPool_free(Tundra_TaskPool *pool);
+
+/**
+ * @brief Submits a task running `fn(user_data, scratch)` to the pool.
+ *
+ * Safe to call from any thread, including from inside a running task.
+ *
+ * @param pool Pool to run the task on.
+ * @param task Handle for the submission; stays in use until `wait`.
+ * @param fn Task body.
+ * @param user_data Opaque pointer passed to the body.
+ */
+void Tundra_TaskPool_submit(Tundra_TaskPool *pool, Tundra_Task *task,
+    Tundra_TaskFn fn, void *user_data);
+
+/**
+ * @brief Blocks until the task finishes.
+ *
+ * Called from a worker of the same pool, executes other tasks while
+ * waiting instead of sleeping the worker.
+ *
+ * @param pool Pool the task was submitted to.
+ * @param task Task to wait for.
+ */
+void Tundra_TaskPool_wait(Tundra_TaskPool *pool, Tundra_Task *task);
+
+/**
+ * @brief Runs `fn` over [`begin`, `end`) on the pool and returns once every
+ * iteration has finished.
+ *
+ * The range is cut into consecutive spans of `grain` iterations starting at
+ * `begin` (the last span may be short), so a span's chunk index is
+ * (span_begin - begin) / grain. The calling thread runs the first span
+ * itself and helps with the rest while waiting.
+ *
+ * @param pool Pool to run the spans on.
+ * @param begin First iteration.
+ * @param end One past the last iteration.
+ * @param grain Iterations per span; 0 picks a grain from the range length
+ * and worker count.
+ * @param fn Span body.
+ * @param user_data Opaque pointer passed to every span.
+ */
+void Tundra_parallel_for(Tundra_TaskPool *pool, u64 begin, u64 end,
+    u64 grain, Tundra_ParallelForFn fn, void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
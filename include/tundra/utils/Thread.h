@@ -0,0 +1,121 @@
+/**
+ * @file Thread.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Minimal thread spawning, joining and affinity over the clone3
+ * syscall.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_THREAD_H
+#define TUNDRA_THREAD_H
+
+#include "tundra/common/TypeDef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Stack size given to each spawned thread.
+#define TUNDRA_THREAD_STACK_BYTES (1024 * 1024)
+
+/**
+ * @brief Body of one thread. Returning from the body terminates the thread.
+ */
+typedef void (*Tundra_ThreadFn)(void *user_data);
+
+/**
+ * A spawned thread. The struct holds the join futex word the kernel clears
+ * when the thread exits, so it must stay alive and in place until `join`
+ * returns.
+ *
+ * Spawned threads get their own thread-local storage block, sized from the
+ * executable's TLS segment, so the library's thread-local state (like the
+ * small allocator's arena chain) is per thread as usual. Only library code
+ * should run on these threads; libc is not initialized for them.
+ */
+typedef struct Tundra_Thread
+{
+    i64 tid;
+
+    // Kernel-owned: holds the child's tid while it runs, cleared and
+    // futex-woken on exit.
+    u32 join_futex;
+
+    // Set and futex-woken by the thread once it is running; lets `join`
+    // tell a thread that has not started yet apart from one that exited.
+    u32 started;
+
+    void *stack_mem;
+    void *tls_mem;
+
+    Tundra_ThreadFn fn;
+    void *user_data;
+} Tundra_Thread;
+
+/**
+ * @brief Spawns a thread running `fn(user_data)`.
+ *
+ * The stack and thread-local storage are library allocations, released by
+ * `join`. Every spawned thread must be joined.
+ *
+ * @param thread Thread to spawn into.
+ * @param fn Thread body.
+ * @param user_data Opaque pointer passed to the body.
+ *
+ * @return bool True if the thread was created.
+ */
+bool Tundra_Thread_spawn(Tundra_Thread *thread, Tundra_ThreadFn fn,
+    void *user_data);
+
+/**
+ * @brief Blocks until the thread's body returns, then releases its stack
+ * and thread-local storage.
+ *
+ * @param thread Thread to join.
+ */
+void Tundra_Thread_join(Tundra_Thread *thread);
+
+/**
+ * @brief Pins a spawned thread to the cpus set in `cpu_mask` (bit n is
+ * cpu n, cpus 0-63).
+ *
+ * Memory policy is per thread and only a thread can set its own, so pinning
+ * from outside does not install the numa placement `set_self_affinity`
+ * does; workers wanting socket-local memory should pin themselves from
+ * their body.
+ *
+ * @param thread Thread to pin.
+ * @param cpu_mask Allowed cpu set, at least one bit set.
+ *
+ * @return bool True if the affinity was applied.
+ */
+bool Tundra_Thread_set_affinity(const Tundra_Thread *thread, u64 cpu_mask);
+
+/**
+ * @brief Pins the calling thread to the cpus set in `cpu_mask`.
+ *
+ * Also sets the thread's default memory placement to prefer the numa node
+ * it lands on, so everything the thread faults in afterward (arena growth,
+ * task deques, io buffers) is socket local on multi node machines. The
+ * placement half is best effort.
+ *
+ * @param cpu_mask Allowed cpu set, at least one bit set.
+ *
+ * @return bool True if the affinity was applied.
+ */
+bool Tundra_Thread_set_self_affinity(u64 cpu_mask);
+
+/**
+ * @brief Returns the kernel thread id of the calling thread.
+ *
+ * @return i64 Thread id.
+ */
+i64 Tundra_Thread_self_id(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,115 @@
+/**
+ * @file Time.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Cycle counter and monotonic clock access for timing and benchmarks.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TIME_H
+#define TUNDRA_TIME_H
+
+#include "tundra/common/SystemInfo.h"
+#include "tundra/common/TypeDef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef TUNDRA_SYS_x86_64
+
+/**
+ * @brief Returns the current cycle counter (rdtsc).
+ *
+ * Unserialized: the read can reorder with surrounding instructions. Use the
+ * `start`/`end` variants to fence a measured region, or this one where a few
+ * cycles of skew do not matter.
+ *
+ * @return u64 Current cycle count.
+ */
+static inline u64 Tundra_get_cycles(void)
+{
+    u32 low, high;
+
+    __asm__ volatile("rdtsc" : "=a"(low), "=d"(high));
+
+    return ((u64)high << 32) | low;
+}
+
+/**
+ * @brief Returns the cycle counter for the start of a measured region.
+ *
+ * An lfence ahead of the read keeps earlier instructions from leaking past
+ * the timestamp into the measured region.
+ *
+ * @return u64 Current cycle count.
+ */
+static inline u64 Tundra_get_cycles_start(void)
+{
+    u32 low, high;
+
+    __asm__ volatile("lfence\n\trdtsc" : "=a"(low), "=d"(high));
+
+    return ((u64)high << 32) | low;
+}
+
+/**
+ * @brief Returns the cycle counter for the end of a measured region.
+ *
+ * rdtscp waits for prior instructions to complete before reading, and the
+ * trailing lfence keeps later instructions from starting before the read.
+ *
+ * @return u64 Current cycle count.
+ */
+static inline u64 Tundra_get_cycles_end(void)
+{
+    u32 low, high;
+
+    __asm__ volatile("rdtscp\n\tlfence" : "=a"(low), "=d"(high) : : "rcx");
+
+    return ((u64)high << 32) | low;
+}
+
+#else // TUNDRA_SYS_x86_64
+#error Not Implemented
+#endif // TUNDRA_SYS_x86_64
+
+/**
+ * @brief Returns the monotonic clock in nanoseconds since an arbitrary
+ * fixed point.
+ *
+ * Reads clock_gettime through the vDSO when resolvable, so the common path
+ * is a plain function call with no kernel trap; falls back to the raw
+ * syscall otherwise.
+ *
+ * @return u64 Monotonic nanoseconds.
+ */
+u64 Tundra_get_monotonic_ns(void);
+
+/**
+ * @brief Measures the cycle counter against the monotonic clock and caches
+ * the rate used by `Tundra_cycles_to_ns`.
+ *
+ * Busy-waits roughly a millisecond. Called automatically by the first
+ * `Tundra_cycles_to_ns`; call it explicitly at startup to keep that cost out
+ * of measured code.
+ */
+void Tundra_calibrate_cycle_rate(void);
+
+/**
+ * @brief Converts a cycle count to nanoseconds using the calibrated rate.
+ *
+ * Calibrates on first use if `Tundra_calibrate_cycle_rate` has not run.
+ *
+ * @param cycles Cycle count to convert.
+ *
+ * @return u64 Nanoseconds.
+ */
+u64 Tundra_cycles_to_ns(u64 cycles);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
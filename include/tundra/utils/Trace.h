@@ -0,0 +1,101 @@
+/**
+ * @file Trace.h
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Compile-time-gated scope tracing into per-thread ring buffers.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TUNDRA_TRACE_H
+#define TUNDRA_TRACE_H
+
+#include "tundra/common/TypeDef.h"
+#include "tundra/internal/MacroHelper.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Number of events each thread's ring holds; a power of 2. Once full the
+// oldest events are overwritten, so a flush always shows the most recent
+// window of activity.
+#define TUNDRA_TRACE_RING_EVENTS 4096
+
+#ifdef TUNDRA_TRACE
+
+/**
+ * @brief Records one begin or end event into the calling thread's ring.
+ *
+ * Called through the TUNDRA_TRACE_ macros rather than directly. `name` must
+ * be a string literal or other pointer that stays valid until the flush;
+ * only the pointer is stored.
+ *
+ * @param name Scope name.
+ * @param phase 0 for begin, 1 for end.
+ */
+void InTundra_trace_emit(const char *name, u8 phase);
+
+/**
+ * @brief Cleanup hook that closes a scope opened by TUNDRA_TRACE_SCOPE.
+ *
+ * @param name Pointer to the scope's stashed name.
+ */
+static inline void InTundra_trace_scope_end(const char *const *name)
+{
+    InTundra_trace_emit(*name, 1);
+}
+
+/**
+ * Emits a begin event now and the matching end event when the enclosing
+ * block exits, through any path. One event is a timestamped ring write with
+ * no locks and no allocation, cheap enough for io and allocator paths that
+ * sampling profilers are too coarse to catch.
+ *
+ * Compiles to nothing unless the library is built with `TUNDRA_TRACE`.
+ */
+#define TUNDRA_TRACE_SCOPE(name) \
+    __attribute__((cleanup(InTundra_trace_scope_end))) \
+    const char *TUNDRA_CONCAT(tundra_trace_scope_, __LINE__) = (name); \
+    InTundra_trace_emit((name), 0)
+
+/**
+ * Emits a begin event; pair with TUNDRA_TRACE_END of the same name for
+ * regions that do not line up with a block, like a handoff between
+ * functions.
+ */
+#define TUNDRA_TRACE_BEGIN(name) InTundra_trace_emit((name), 0)
+
+// Emits the end event matching an earlier TUNDRA_TRACE_BEGIN.
+#define TUNDRA_TRACE_END(name) InTundra_trace_emit((name), 1)
+
+#else // TUNDRA_TRACE
+
+#define TUNDRA_TRACE_SCOPE(name) ((void)0)
+#define TUNDRA_TRACE_BEGIN(name) ((void)0)
+#define TUNDRA_TRACE_END(name) ((void)0)
+
+#endif // TUNDRA_TRACE
+
+/**
+ * @brief Writes every thread's buffered events to a file as Chrome
+ * trace-event JSON, loadable in chrome://tracing or Perfetto.
+ *
+ * Cycle timestamps are converted to microseconds with the calibrated cycle
+ * rate. Threads still emitting while the flush walks their rings can
+ * overwrite events under it; flush from a quiet point for an exact window.
+ * If the library was built without `TUNDRA_TRACE` the file holds an empty
+ * event array.
+ *
+ * @param path Relative to current directory path of the file to write,
+ * created if it does not exist and truncated if it does.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+i64 Tundra_trace_flush(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,412 @@
+/**
+ * @file Benchmark.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Microbenchmark harness: registration, sampling and reporting.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/Benchmark.h"
+#include "tundra/utils/ConsoleIO.h"
+#include "tundra/utils/PerfCounter.h"
+#include "tundra/utils/StringConversion.h"
+#include "tundra/utils/Time.h"
+#include "tundra/utils/FatalHandler.h"
+
+#define MAX_BENCHMARKS 256
+
+// Every timed call must span at least this long so timer resolution and
+// call overhead disappear into the measurement.
+#define MIN_SAMPLE_NS 1000000ULL
+
+#define NUM_SAMPLES 15
+
+typedef struct
+{
+    const char *name;
+    Tundra_BenchFn fn;
+    void *user_data;
+} RegisteredBench;
+
+static RegisteredBench benches[MAX_BENCHMARKS];
+static u64 num_bench = 0;
+
+// Results of the last run_all, kept for baseline save/compare.
+static const char *result_names[MAX_BENCHMARKS];
+static u64 result_iters[MAX_BENCHMARKS];
+static u64 result_median_ps[MAX_BENCHMARKS];
+static u64 num_results = 0;
+
+// Byte capacity for a loaded baseline file.
+#define BASELINE_BUFFER_BYTES 65536
+
+void Tundra_Bench_register(const char *name, Tundra_BenchFn fn,
+    void *user_data)
+{
+    if(num_bench == MAX_BENCHMARKS)
+    {
+        TUNDRA_FATAL("Benchmark registry is full.");
+        return;
+    }
+
+    benches[num_bench].name = name;
+    benches[num_bench].fn = fn;
+    benches[num_bench].user_data = user_data;
+    ++num_bench;
+}
+
+// Times one call of `bench` at `num_iter` iterations, in nanoseconds.
+static u64 time_one_sample(const RegisteredBench *bench, u64 num_iter)
+{
+    const u64 START = Tundra_get_cycles_start();
+
+    bench->fn(num_iter, bench->user_data);
+
+    return Tundra_cycles_to_ns(Tundra_get_cycles_end() - START);
+}
+
+// Integer square root by Newton's method, for the stddev.
+static u64 isqrt_u64(u64 num)
+{
+    if(num < 2) { return num; }
+
+    u64 guess = num / 2;
+    u64 next = (guess + num / guess) / 2;
+
+    while(next < guess)
+    {
+        guess = next;
+        next = (guess + num / guess) / 2;
+    }
+
+    return guess;
+}
+
+// Writes a picosecond count as nanoseconds with three decimal places.
+static void write_ps_as_ns(Tundra_File *file, u64 ps)
+{
+    Tundra_File_write_u64(file, ps / 1000);
+    Tundra_File_write_char(file, '.');
+
+    const u64 FRAC = ps % 1000;
+
+    Tundra_File_write_char(file, (char)('0' + FRAC / 100));
+    Tundra_File_write_char(file, (char)('0' + FRAC / 10 % 10));
+    Tundra_File_write_char(file, (char)('0' + FRAC % 10));
+}
+
+static void write_human_field(Tundra_File *file, const char *label, u64 ps)
+{
+    Tundra_File_write_cstr(file, label);
+    write_ps_as_ns(file, ps);
+    Tundra_File_write_cstr(file, "ns");
+}
+
+// Writes a per-iteration hardware counter field; `milli` is counts per
+// iteration in thousandths.
+static void write_perf_field(Tundra_File *file, const char *label, u64 milli)
+{
+    Tundra_File_write_cstr(file, label);
+    write_ps_as_ns(file, milli);
+}
+
+u64 Tundra_Bench_run_all(Tundra_File *human_out, Tundra_File *csv_out)
+{
+    // Keep the calibration busy-wait out of the first benchmark's samples.
+    Tundra_calibrate_cycle_rate();
+
+    // Hardware counters are a best effort; perf access is often restricted,
+    // in which case the perf columns report zero.
+    Tundra_PerfCounter perf_ctr;
+
+    const bool HAVE_PERF = Tundra_PerfCtr_open(&perf_ctr);
+
+    if(csv_out != NULL)
+    {
+        Tundra_File_write_cstr(csv_out,
+            "name,iterations,samples,min_ps,median_ps,mean_ps,stddev_ps,"
+            "cycles_milli_per_iter,cache_miss_milli_per_iter,"
+            "branch_miss_milli_per_iter\n");
+    }
+
+    for(u64 bench_idx = 0; bench_idx < num_bench; ++bench_idx)
+    {
+        const RegisteredBench *BENCH = &benches[bench_idx];
+
+        // Scale the iteration count until one call spans MIN_SAMPLE_NS;
+        // these scaling calls double as warmup.
+        u64 num_iter = 1;
+
+        while(time_one_sample(BENCH, num_iter) < MIN_SAMPLE_NS)
+        {
+            num_iter *= 2;
+        }
+
+        // Per-iteration picoseconds for each sample, kept sorted by
+        // insertion so the median and min fall out directly.
+        u64 samples_ps[NUM_SAMPLES];
+
+        for(u64 sample_idx = 0; sample_idx < NUM_SAMPLES; ++sample_idx)
+        {
+            const u64 SAMPLE_PS =
+                time_one_sample(BENCH, num_iter) * 1000 / num_iter;
+
+            u64 insert_idx = sample_idx;
+
+            while(insert_idx > 0 && samples_ps[insert_idx - 1] > SAMPLE_PS)
+            {
+                samples_ps[insert_idx] = samples_ps[insert_idx - 1];
+                --insert_idx;
+            }
+
+            samples_ps[insert_idx] = SAMPLE_PS;
+        }
+
+        const u64 MIN_PS = samples_ps[0];
+        const u64 MEDIAN_PS = samples_ps[NUM_SAMPLES / 2];
+
+        u64 sum_ps = 0;
+
+        for(u64 i = 0; i < NUM_SAMPLES; ++i) { sum_ps += samples_ps[i]; }
+
+        const u64 MEAN_PS = sum_ps / NUM_SAMPLES;
+
+        u64 sum_sq_dev = 0;
+
+        for(u64 i = 0; i < NUM_SAMPLES; ++i)
+        {
+            const u64 DEV = (samples_ps[i] > MEAN_PS) ?
+                samples_ps[i] - MEAN_PS : MEAN_PS - samples_ps[i];
+
+            sum_sq_dev += DEV * DEV;
+        }
+
+        const u64 STDDEV_PS = isqrt_u64(sum_sq_dev / NUM_SAMPLES);
+
+        // One extra counted call for the hardware counters, kept outside the
+        // timed samples so the counter reads never land in a timing.
+        Tundra_PerfResult perf = {0, 0, 0};
+
+        if(HAVE_PERF)
+        {
+            Tundra_PerfCtr_begin(&perf_ctr);
+            BENCH->fn(num_iter, BENCH->user_data);
+            Tundra_PerfCtr_end(&perf_ctr, &perf);
+        }
+
+        const u64 CYC_MILLI = perf.cycles * 1000 / num_iter;
+        const u64 CMISS_MILLI = perf.cache_misses * 1000 / num_iter;
+        const u64 BMISS_MILLI = perf.branch_misses * 1000 / num_iter;
+
+        result_names[bench_idx] = BENCH->name;
+        result_iters[bench_idx] = num_iter;
+        result_median_ps[bench_idx] = MEDIAN_PS;
+
+        if(human_out != NULL)
+        {
+            Tundra_File_write_cstr(human_out, BENCH->name);
+            Tundra_File_write_cstr(human_out, "  iters=");
+            Tundra_File_write_u64(human_out, num_iter);
+            write_human_field(human_out, "  min=", MIN_PS);
+            write_human_field(human_out, "  median=", MEDIAN_PS);
+            write_human_field(human_out, "  mean=", MEAN_PS);
+            write_human_field(human_out, "  stddev=", STDDEV_PS);
+
+            if(HAVE_PERF)
+            {
+                write_perf_field(human_out, "  cyc/iter=", CYC_MILLI);
+                write_perf_field(human_out, "  cmiss/iter=", CMISS_MILLI);
+                write_perf_field(human_out, "  bmiss/iter=", BMISS_MILLI);
+            }
+
+            Tundra_File_write_char(human_out, '\n');
+        }
+
+        if(csv_out != NULL)
+        {
+            Tundra_File_write_cstr(csv_out, BENCH->name);
+            Tundra_File_write_char(csv_out, ',');
+            Tundra_File_write_u64(csv_out, num_iter);
+            Tundra_File_write_char(csv_out, ',');
+            Tundra_File_write_u64(csv_out, NUM_SAMPLES);
+            Tundra_File_write_char(csv_out, ',');
+            Tundra_File_write_u64(csv_out, MIN_PS);
+            Tundra_File_write_char(csv_out, ',');
+            Tundra_File_write_u64(csv_out, MEDIAN_PS);
+            Tundra_File_write_char(csv_out, ',');
+            Tundra_File_write_u64(csv_out, MEAN_PS);
+            Tundra_File_write_char(csv_out, ',');
+            Tundra_File_write_u64(csv_out, STDDEV_PS);
+            Tundra_File_write_char(csv_out, ',');
+            Tundra_File_write_u64(csv_out, CYC_MILLI);
+            Tundra_File_write_char(csv_out, ',');
+            Tundra_File_write_u64(csv_out, CMISS_MILLI);
+            Tundra_File_write_char(csv_out, ',');
+            Tundra_File_write_u64(csv_out, BMISS_MILLI);
+            Tundra_File_write_char(csv_out, '\n');
+        }
+    }
+
+    Tundra_PerfCtr_close(&perf_ctr);
+
+    num_results = num_bench;
+
+    if(human_out != NULL) { Tundra_File_flush(human_out); }
+    if(csv_out != NULL) { Tundra_File_flush(csv_out); }
+
+    return num_bench;
+}
+
+u64 Tundra_Bench_save_baseline(Tundra_File *file, const char *revision)
+{
+    Tundra_File_write_cstr(file, "tundra_bench_baseline,");
+    Tundra_File_write_cstr(file,
+        (revision != NULL) ? revision : "unknown");
+    Tundra_File_write_char(file, ',');
+    Tundra_File_write_u64(file, Tundra_cycles_to_ns(1000000));
+    Tundra_File_write_char(file, '\n');
+
+    for(u64 i = 0; i < num_results; ++i)
+    {
+        Tundra_File_write_cstr(file, result_names[i]);
+        Tundra_File_write_char(file, ',');
+        Tundra_File_write_u64(file, result_iters[i]);
+        Tundra_File_write_char(file, ',');
+        Tundra_File_write_u64(file, result_median_ps[i]);
+        Tundra_File_write_char(file, '\n');
+    }
+
+    Tundra_File_flush(file);
+
+    return num_results;
+}
+
+// Returns true if `cstr` matches the text from `begin` up to `end`.
+static bool name_matches(const char *cstr, const char *begin,
+    const char *end)
+{
+    while(begin < end && *cstr != '\0' && *cstr == *begin)
+    {
+        ++cstr;
+        ++begin;
+    }
+
+    return begin == end && *cstr == '\0';
+}
+
+// Finds the median recorded in the baseline for `name`, or 0 if the
+// benchmark is not in the baseline. Lines are "name,iterations,median_ps".
+static u64 baseline_median_for(const char *text, u64 num_bytes,
+    const char *name)
+{
+    const char *pos = text;
+    const char *end = text + num_bytes;
+
+    // Skip the header line.
+    while(pos < end && *pos != '\n') { ++pos; }
+
+    while(pos < end)
+    {
+        ++pos;
+
+        const char *name_begin = pos;
+
+        while(pos < end && *pos != ',' && *pos != '\n') { ++pos; }
+
+        if(pos == end || *pos == '\n') { continue; }
+
+        const bool MATCHES = name_matches(name, name_begin, pos);
+
+        // Step over the iteration field to the median.
+        ++pos;
+
+        while(pos < end && *pos != ',' && *pos != '\n') { ++pos; }
+
+        if(pos == end || *pos == '\n') { continue; }
+
+        ++pos;
+
+        const char *median_begin = pos;
+
+        while(pos < end && *pos != '\n') { ++pos; }
+
+        if(MATCHES)
+        {
+            // Terminate the field in place for conversion, restoring the
+            // newline after so later lookups still see whole lines.
+            char *term = (char*)pos;
+            const char OLD = *term;
+
+            *term = '\0';
+
+            const u64 MEDIAN = Tundra_str_to_u64(median_begin);
+
+            *term = OLD;
+
+            return MEDIAN;
+        }
+    }
+
+    return 0;
+}
+
+u64 Tundra_Bench_compare_baseline(Tundra_File *file, u64 threshold_pct)
+{
+    static char text[BASELINE_BUFFER_BYTES];
+
+    i64 num_read;
+
+    Tundra_File_readin_bytes(file, text, BASELINE_BUFFER_BYTES - 1,
+        &num_read);
+
+    if(num_read <= 0)
+    {
+        Tundra_printf("baseline compare: baseline file is empty or "
+            "unreadable.\n");
+        Tundra_flush_stdout();
+        return 0;
+    }
+
+    text[num_read] = '\0';
+
+    Tundra_printf("baseline compare (threshold %lu%%):\n", threshold_pct);
+
+    u64 num_regressed = 0;
+
+    for(u64 i = 0; i < num_results; ++i)
+    {
+        const u64 BASE_PS = baseline_median_for(text, (u64)num_read,
+            result_names[i]);
+
+        if(BASE_PS == 0)
+        {
+            Tundra_printf("  %s: new, no baseline entry\n",
+                result_names[i]);
+            continue;
+        }
+
+        const u64 CUR_PS = result_median_ps[i];
+
+        // Signed delta in percent of the baseline.
+        const bool SLOWER = CUR_PS > BASE_PS;
+        const u64 DELTA_PCT = (SLOWER ?
+            (CUR_PS - BASE_PS) : (BASE_PS - CUR_PS)) * 100 / BASE_PS;
+
+        Tundra_printf("  %s: base=%lups cur=%lups %c%lu%%",
+            result_names[i], BASE_PS, CUR_PS, SLOWER ? '+' : '-',
+            DELTA_PCT);
+
+        if(SLOWER && DELTA_PCT > threshold_pct)
+        {
+            Tundra_printf("  REGRESSION");
+            ++num_regressed;
+        }
+
+        Tundra_printf("\n");
+    }
+
+    Tundra_flush_stdout();
+
+    return num_regressed;
+}
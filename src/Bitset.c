@@ -0,0 +1,205 @@
+/**
+ * @file Bitset.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Dynamic set of bits packed into u64 words with word-level scans.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/containers/Bitset.h"
+#include "tundra/common/BitUtils.h"
+#include "tundra/common/Core.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/MemUtils.h"
+
+
+// Methods ---------------------------------------------------------------------
+
+// -- Local Helper Methods --
+
+/**
+ * @brief Returns the number of words needed to hold `num_bits` bits.
+ *
+ * @param num_bits Number of bits.
+ *
+ * @return u64 Number of words.
+ */
+static u64 words_for_bits(u64 num_bits)
+{
+    return (num_bits + 63) / 64;
+}
+
+/**
+ * @brief Clears any bits past `num_bits` in the last word so the scan and
+ * count methods never see stale tail bits.
+ *
+ * @param set Bitset to mask.
+ */
+static void mask_tail(Tundra_Bitset *set)
+{
+    const u64 TAIL_BITS = set->num_bits % 64;
+
+    if(TAIL_BITS == 0 || set->num_words == 0) { return; }
+
+    set->words[set->num_bits / 64] &= (1ULL << TAIL_BITS) - 1;
+}
+
+
+// -- Public Methods --
+
+void Tundra_Bitset_init(Tundra_Bitset *set, u64 num_bits)
+{
+    set->num_bits = num_bits;
+    set->num_words = words_for_bits(num_bits);
+
+    set->words = (u64*)Tundra_alloc_mem_zeroed(set->num_words * sizeof(u64));
+}
+
+void Tundra_Bitset_init_copy(Tundra_Bitset *dst, const Tundra_Bitset *src)
+{
+    dst->num_bits = src->num_bits;
+    dst->num_words = src->num_words;
+
+    dst->words = (u64*)Tundra_alloc_copy_mem((const void*)src->words,
+        src->num_words * sizeof(u64), src->num_words * sizeof(u64));
+}
+
+void Tundra_Bitset_free(Tundra_Bitset *set)
+{
+    Tundra_free_mem((void*)set->words);
+
+    set->words = NULL;
+    set->num_bits = 0;
+    set->num_words = 0;
+}
+
+void Tundra_Bitset_resize(Tundra_Bitset *set, u64 num_bits)
+{
+    const u64 NEW_NUM_WORDS = words_for_bits(num_bits);
+
+    if(NEW_NUM_WORDS > set->num_words)
+    {
+        u64 *new_words = (u64*)Tundra_alloc_copy_mem(
+            (const void*)set->words, NEW_NUM_WORDS * sizeof(u64),
+            set->num_words * sizeof(u64));
+
+        Tundra_zero_out_mem((void*)(new_words + set->num_words),
+            (NEW_NUM_WORDS - set->num_words) * sizeof(u64));
+
+        Tundra_free_mem((void*)set->words);
+        set->words = new_words;
+        set->num_words = NEW_NUM_WORDS;
+    }
+
+    // Shrinking may leave set bits past the new size; clear the dropped
+    // whole words and mask the tail of the new last word.
+    if(NEW_NUM_WORDS < set->num_words)
+    {
+        Tundra_zero_out_mem((void*)(set->words + NEW_NUM_WORDS),
+            (set->num_words - NEW_NUM_WORDS) * sizeof(u64));
+    }
+
+    set->num_bits = num_bits;
+
+    mask_tail(set);
+}
+
+void Tundra_Bitset_set_all(Tundra_Bitset *set)
+{
+    Tundra_fill_mem((void*)set->words, 0xFF, set->num_words * sizeof(u64));
+
+    mask_tail(set);
+}
+
+void Tundra_Bitset_clear_all(Tundra_Bitset *set)
+{
+    Tundra_zero_out_mem((void*)set->words, set->num_words * sizeof(u64));
+}
+
+u64 Tundra_Bitset_count(const Tundra_Bitset *set)
+{
+    u64 count = 0;
+
+    for(u64 word_idx = 0; word_idx < set->num_words; ++word_idx)
+    {
+        count += Tundra_get_num_set_bits(set->words[word_idx]);
+    }
+
+    return count;
+}
+
+i64 Tundra_Bitset_find_first_set(const Tundra_Bitset *set)
+{
+    for(u64 word_idx = 0; word_idx < set->num_words; ++word_idx)
+    {
+        if(set->words[word_idx] != 0)
+        {
+            return (i64)(word_idx * 64 +
+                Tundra_get_num_trail_zeros(set->words[word_idx]));
+        }
+    }
+
+    return -1;
+}
+
+i64 Tundra_Bitset_find_first_clear(const Tundra_Bitset *set)
+{
+    for(u64 word_idx = 0; word_idx < set->num_words; ++word_idx)
+    {
+        const u64 INVERTED = ~set->words[word_idx];
+
+        if(INVERTED != 0)
+        {
+            const u64 BIT_IDX = word_idx * 64 +
+                Tundra_get_num_trail_zeros(INVERTED);
+
+            // The tail of the last word inverts to set bits past num_bits.
+            return BIT_IDX < set->num_bits ? (i64)BIT_IDX : -1;
+        }
+    }
+
+    return -1;
+}
+
+void Tundra_Bitset_and(Tundra_Bitset *dst, const Tundra_Bitset *first,
+    const Tundra_Bitset *second)
+{
+    TUNDRA_RT_ASSERT(dst->num_bits == first->num_bits &&
+        dst->num_bits == second->num_bits,
+        "Bitset sizes do not match.\n");
+
+    for(u64 word_idx = 0; word_idx < dst->num_words; ++word_idx)
+    {
+        dst->words[word_idx] = first->words[word_idx] &
+            second->words[word_idx];
+    }
+}
+
+void Tundra_Bitset_or(Tundra_Bitset *dst, const Tundra_Bitset *first,
+    const Tundra_Bitset *second)
+{
+    TUNDRA_RT_ASSERT(dst->num_bits == first->num_bits &&
+        dst->num_bits == second->num_bits,
+        "Bitset sizes do not match.\n");
+
+    for(u64 word_idx = 0; word_idx < dst->num_words; ++word_idx)
+    {
+        dst->words[word_idx] = first->words[word_idx] |
+            second->words[word_idx];
+    }
+}
+
+void Tundra_Bitset_xor(Tundra_Bitset *dst, const Tundra_Bitset *first,
+    const Tundra_Bitset *second)
+{
+    TUNDRA_RT_ASSERT(dst->num_bits == first->num_bits &&
+        dst->num_bits == second->num_bits,
+        "Bitset sizes do not match.\n");
+
+    for(u64 word_idx = 0; word_idx < dst->num_words; ++word_idx)
+    {
+        dst->words[word_idx] = first->words[word_idx] ^
+            second->words[word_idx];
+    }
+}
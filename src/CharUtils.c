@@ -0,0 +1,247 @@
+/**
+ * @file CharUtils.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Methods for reading certain properties of chars such as whether they
+ * are alphanumeric, are a digit, etc.
+ * @version 0.1
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "tundra/common/CharUtils.h"
+
+// High bit of every byte lane, set in any byte that is not 7 bit ASCII.
+#define HIGH_BITS 0x8080808080808080ULL
+
+bool Tundra_is_ascii(const char *text, u64 num_bytes)
+{
+    const u8 *bytes = (const u8*)text;
+
+    u64 pos = 0;
+
+    // Two unaligned 8 byte lanes per iteration; any set high bit means a
+    // non-ASCII byte somewhere in the chunk.
+    while(pos + 16 <= num_bytes)
+    {
+        const u64 COMBINED = *(const u64*)(bytes + pos) |
+            *(const u64*)(bytes + pos + 8);
+
+        if((COMBINED & HIGH_BITS) != 0) { return false; }
+
+        pos += 16;
+    }
+
+    // Scalar tail.
+    for(; pos < num_bytes; ++pos)
+    {
+        if(bytes[pos] >= 0x80) { return false; }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Returns true if `byte` is a UTF-8 continuation byte (10xxxxxx).
+ *
+ * @param byte Byte to check.
+ *
+ * @return bool True if the byte is a continuation byte.
+ */
+static bool is_continuation(u8 byte)
+{
+    return (byte & 0xC0) == 0x80;
+}
+
+bool Tundra_utf8_validate(const char *text, u64 num_bytes)
+{
+    const u8 *bytes = (const u8*)text;
+
+    u64 pos = 0;
+
+    while(pos < num_bytes)
+    {
+        // Skip ASCII runs 8 bytes at a time; this is the whole input for
+        // most real text, so the per-byte cases below stay off the hot path.
+        while(pos + 8 <= num_bytes &&
+            (*(const u64*)(bytes + pos) & HIGH_BITS) == 0)
+        {
+            pos += 8;
+        }
+
+        if(pos >= num_bytes) { break; }
+
+        const u8 LEAD = bytes[pos];
+
+        if(LEAD < 0x80)
+        {
+            ++pos;
+            continue;
+        }
+
+        // Two byte sequence: C2..DF. C0 and C1 would be overlong encodings
+        // of ASCII.
+        if(LEAD >= 0xC2 && LEAD <= 0xDF)
+        {
+            if(pos + 2 > num_bytes || !is_continuation(bytes[pos + 1]))
+            {
+                return false;
+            }
+
+            pos += 2;
+            continue;
+        }
+
+        // Three byte sequence: E0..EF, with a restricted second byte on E0
+        // (overlong) and ED (UTF-16 surrogates).
+        if(LEAD >= 0xE0 && LEAD <= 0xEF)
+        {
+            if(pos + 3 > num_bytes) { return false; }
+
+            const u8 SECOND = bytes[pos + 1];
+
+            const u8 SECOND_MIN = LEAD == 0xE0 ? 0xA0 : 0x80;
+            const u8 SECOND_MAX = LEAD == 0xED ? 0x9F : 0xBF;
+
+            if(SECOND < SECOND_MIN || SECOND > SECOND_MAX ||
+                !is_continuation(bytes[pos + 2]))
+            {
+                return false;
+            }
+
+            pos += 3;
+            continue;
+        }
+
+        // Four byte sequence: F0..F4, with a restricted second byte on F0
+        // (overlong) and F4 (code points above U+10FFFF).
+        if(LEAD >= 0xF0 && LEAD <= 0xF4)
+        {
+            if(pos + 4 > num_bytes) { return false; }
+
+            const u8 SECOND = bytes[pos + 1];
+
+            const u8 SECOND_MIN = LEAD == 0xF0 ? 0x90 : 0x80;
+            const u8 SECOND_MAX = LEAD == 0xF4 ? 0x8F : 0xBF;
+
+            if(SECOND < SECOND_MIN || SECOND > SECOND_MAX ||
+                !is_continuation(bytes[pos + 2]) ||
+                !is_continuation(bytes[pos + 3]))
+            {
+                return false;
+            }
+
+            pos += 4;
+            continue;
+        }
+
+        // Stray continuation byte or invalid lead (C0, C1, F5..FF).
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Returns a mask with 0x80 set in every byte of `lane` whose value is
+ * a 7 bit ASCII byte in [`min`, `max`].
+ *
+ * Adding `0x80 - n` to a 7 bit byte carries into its high bit exactly when
+ * the byte is at least `n`, giving both range bounds without a byte walk.
+ * Bytes with the high bit already set are masked out of the result.
+ *
+ * @param lane 8 bytes to classify.
+ * @param min Lowest matching byte value, at most 0x7F.
+ * @param max Highest matching byte value, at most 0x7F.
+ *
+ * @return u64 Match flags, 0x80 per matching byte.
+ */
+static u64 range_flags(u64 lane, u8 min, u8 max)
+{
+    const u64 LOW_BITS = 0x0101010101010101ULL;
+
+    const u64 SEVEN = lane & 0x7F7F7F7F7F7F7F7FULL;
+
+    const u64 GE_MIN = SEVEN + (u64)(0x80 - min) * LOW_BITS;
+    const u64 GT_MAX = SEVEN + (u64)(0x7F - max) * LOW_BITS;
+
+    return GE_MIN & ~GT_MAX & ~lane & HIGH_BITS;
+}
+
+void Tundra_to_lower_mem(void *mem, u64 num_bytes)
+{
+    u8 *bytes = (u8*)mem;
+
+    u64 pos = 0;
+
+    // The case bit (0x20) is the match flag shifted down two places, so the
+    // whole lane converts with one or.
+    while(pos + 8 <= num_bytes)
+    {
+        u64 lane = *(const u64*)(bytes + pos);
+
+        lane |= range_flags(lane, 'A', 'Z') >> 2;
+
+        *(u64*)(bytes + pos) = lane;
+        pos += 8;
+    }
+
+    // Scalar tail.
+    for(; pos < num_bytes; ++pos)
+    {
+        if(bytes[pos] >= 'A' && bytes[pos] <= 'Z') { bytes[pos] |= 0x20; }
+    }
+}
+
+void Tundra_to_upper_mem(void *mem, u64 num_bytes)
+{
+    u8 *bytes = (u8*)mem;
+
+    u64 pos = 0;
+
+    while(pos + 8 <= num_bytes)
+    {
+        u64 lane = *(const u64*)(bytes + pos);
+
+        lane &= ~(range_flags(lane, 'a', 'z') >> 2);
+
+        *(u64*)(bytes + pos) = lane;
+        pos += 8;
+    }
+
+    // Scalar tail.
+    for(; pos < num_bytes; ++pos)
+    {
+        if(bytes[pos] >= 'a' && bytes[pos] <= 'z')
+        {
+            bytes[pos] &= (u8)~0x20;
+        }
+    }
+}
+
+u64 Tundra_count_byte_range(const void *mem, u64 num_bytes, u8 min, u8 max)
+{
+    const u8 *bytes = (const u8*)mem;
+
+    u64 count = 0;
+    u64 pos = 0;
+
+    // One flag bit per matching byte, so a popcount of the flags is the
+    // match count for the lane.
+    while(pos + 8 <= num_bytes)
+    {
+        count += (u64)__builtin_popcountll(
+            range_flags(*(const u64*)(bytes + pos), min, max));
+
+        pos += 8;
+    }
+
+    // Scalar tail.
+    for(; pos < num_bytes; ++pos)
+    {
+        if(bytes[pos] >= min && bytes[pos] <= max) { ++count; }
+    }
+
+    return count;
+}
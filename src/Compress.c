@@ -0,0 +1,364 @@
+/**
+ * @file Compress.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Fast LZ-class block compression and the output filter built on it.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/Compress.h"
+#include "tundra/common/ErrorDef.h"
+#include "tundra/utils/MemUtils.h"
+
+// Block format: a stream of sequences, each a token byte, the literal bytes,
+// then the match. The token's high nibble is the literal count and its low
+// nibble the match length minus MIN_MATCH; a nibble of 15 is extended with
+// 255-valued bytes until one below 255 closes the count. The match is a two
+// byte little endian backwards offset followed by any length extension. The
+// final sequence is literals only, marked by the stream ending after them.
+
+
+// Shortest repeat worth encoding; a sequence spends at least 3 bytes on its
+// token and offset.
+#define MIN_MATCH 4
+
+// How far back a match may reach, the largest offset two bytes can hold.
+#define WINDOW_BYTES 65535
+
+// Log2 of the match-candidate table's entry count.
+#define HASH_BITS 12
+
+// Matching stops this many bytes before the input's end, leaving a tail
+// where 4 byte candidate loads and match extension cannot overrun.
+#define SEARCH_END_MARGIN 12
+
+// High bit of a frame's stored-count field, marking a batch that did not
+// shrink and was stored raw.
+#define FRAME_RAW_FLAG 0x80000000U
+
+
+// Methods ---------------------------------------------------------------------
+
+// -- Local Helper Methods --
+
+/**
+ * @brief Hashes 4 input bytes into a match-candidate table slot.
+ *
+ * @param seq 4 bytes of input.
+ *
+ * @return u32 Table slot.
+ */
+static u32 hash4(u32 seq)
+{
+    return (seq * 2654435761U) >> (32 - HASH_BITS);
+}
+
+/**
+ * @brief Emits one sequence: the literal run, then the match unless
+ * `match_len` is 0 for the stream-closing literals-only sequence.
+ *
+ * The caller guarantees the destination has worst case room.
+ *
+ * @param out Destination cursor.
+ * @param literals Literal bytes to copy through.
+ * @param num_literals Number of literal bytes.
+ * @param offset Backwards offset of the match, at most WINDOW_BYTES.
+ * @param match_len Length of the match, 0 for the final sequence.
+ *
+ * @return u8* Advanced destination cursor.
+ */
+static u8* emit_sequence(u8 *out, const u8 *literals, u64 num_literals,
+    u64 offset, u64 match_len)
+{
+    u8 *token = out;
+    ++out;
+    *token = 0;
+
+    if(num_literals >= 15)
+    {
+        *token = 15 << 4;
+
+        u64 rem = num_literals - 15;
+
+        while(rem >= 255) { *out = 255; ++out; rem -= 255; }
+
+        *out = (u8)rem;
+        ++out;
+    }
+    else { *token = (u8)(num_literals << 4); }
+
+    Tundra_copy_mem_fwd(literals, out, num_literals);
+    out += num_literals;
+
+    if(match_len == 0) { return out; }
+
+    *out = (u8)(offset & 0xFF);
+    ++out;
+    *out = (u8)(offset >> 8);
+    ++out;
+
+    const u64 MATCH_CODE = match_len - MIN_MATCH;
+
+    if(MATCH_CODE >= 15)
+    {
+        *token |= 15;
+
+        u64 rem = MATCH_CODE - 15;
+
+        while(rem >= 255) { *out = 255; ++out; rem -= 255; }
+
+        *out = (u8)rem;
+        ++out;
+    }
+    else { *token |= (u8)MATCH_CODE; }
+
+    return out;
+}
+
+
+// -- Public Methods --
+
+u64 Tundra_Cmprs_max_compressed_size(u64 num_bytes)
+{
+    // One token, the literal count extension at one byte per 255 literals,
+    // and slack for both extension terminators.
+    return num_bytes + (num_bytes / 255) + 16;
+}
+
+i64 Tundra_Cmprs_compress_block(const u8 *src, u64 num_bytes, u8 *dst,
+    u64 dst_capacity)
+{
+    if(dst_capacity < Tundra_Cmprs_max_compressed_size(num_bytes))
+    {
+        return -TUNDRA_ERR_INVARG;
+    }
+
+    // Most recent position each 4 byte hash was seen at, plus 1 so 0 means
+    // empty.
+    u32 table[1 << HASH_BITS] = {0};
+
+    u8 *out = dst;
+    u64 pos = 0;
+    u64 lit_start = 0;
+
+    if(num_bytes > SEARCH_END_MARGIN)
+    {
+        const u64 SEARCH_END = num_bytes - SEARCH_END_MARGIN;
+
+        while(pos < SEARCH_END)
+        {
+            const u32 SEQ = *(const u32*)(src + pos);
+            const u32 SLOT = hash4(SEQ);
+            const u64 CAND = table[SLOT];
+
+            table[SLOT] = (u32)(pos + 1);
+
+            // Greedy: take the first in-window candidate whose 4 bytes
+            // really match and extend it as far as it goes.
+            if(CAND != 0 && pos + 1 - CAND <= WINDOW_BYTES &&
+                *(const u32*)(src + CAND - 1) == SEQ)
+            {
+                const u64 MATCH_POS = CAND - 1;
+
+                u64 match_len = MIN_MATCH;
+
+                while(pos + match_len < num_bytes &&
+                    src[MATCH_POS + match_len] == src[pos + match_len])
+                {
+                    ++match_len;
+                }
+
+                out = emit_sequence(out, src + lit_start, pos - lit_start,
+                    pos - MATCH_POS, match_len);
+
+                pos += match_len;
+                lit_start = pos;
+                continue;
+            }
+
+            ++pos;
+        }
+    }
+
+    // Close the stream with the remaining bytes as literals.
+    out = emit_sequence(out, src + lit_start, num_bytes - lit_start, 0, 0);
+
+    return (i64)(out - dst);
+}
+
+i64 Tundra_Cmprs_decompress_block(const u8 *src, u64 num_bytes, u8 *dst,
+    u64 dst_capacity)
+{
+    u64 in = 0;
+    u64 out = 0;
+
+    while(in < num_bytes)
+    {
+        const u8 TOKEN = src[in];
+        ++in;
+
+        u64 lit_len = TOKEN >> 4;
+
+        if(lit_len == 15)
+        {
+            u8 ext;
+
+            do
+            {
+                if(in >= num_bytes) { return -TUNDRA_ERR_INVARG; }
+
+                ext = src[in];
+                ++in;
+                lit_len += ext;
+            } while(ext == 255);
+        }
+
+        if(lit_len > num_bytes - in || lit_len > dst_capacity - out)
+        {
+            return -TUNDRA_ERR_INVARG;
+        }
+
+        Tundra_copy_mem_fwd(src + in, dst + out, lit_len);
+        in += lit_len;
+        out += lit_len;
+
+        // The stream ending right after literals closes it.
+        if(in == num_bytes) { break; }
+
+        if(num_bytes - in < 2) { return -TUNDRA_ERR_INVARG; }
+
+        const u64 OFFSET = (u64)src[in] | ((u64)src[in + 1] << 8);
+        in += 2;
+
+        if(OFFSET == 0 || OFFSET > out) { return -TUNDRA_ERR_INVARG; }
+
+        u64 match_len = (u64)(TOKEN & 15) + MIN_MATCH;
+
+        if((TOKEN & 15) == 15)
+        {
+            u8 ext;
+
+            do
+            {
+                if(in >= num_bytes) { return -TUNDRA_ERR_INVARG; }
+
+                ext = src[in];
+                ++in;
+                match_len += ext;
+            } while(ext == 255);
+        }
+
+        if(match_len > dst_capacity - out) { return -TUNDRA_ERR_INVARG; }
+
+        const u8 *from = dst + out - OFFSET;
+
+        // An offset shorter than the match overlaps its own output and must
+        // replicate byte by byte.
+        if(OFFSET >= match_len)
+        {
+            Tundra_copy_mem_fwd(from, dst + out, match_len);
+        }
+        else
+        {
+            for(u64 i = 0; i < match_len; ++i) { dst[out + i] = from[i]; }
+        }
+
+        out += match_len;
+    }
+
+    return (i64)out;
+}
+
+i64 Tundra_Cmprs_write_filter(const u8 *bytes, u64 num_bytes,
+    Tundra_DynamicArrayU8 *out, void *user_data)
+{
+    (void)user_data;
+
+    // Frame fields are u32s with the high bit reserved for the raw flag.
+    if(num_bytes > 0x7FFFFFFFU) { return -TUNDRA_ERR_INVARG; }
+
+    const u64 MAX_BYTES = Tundra_Cmprs_max_compressed_size(num_bytes);
+    const u64 FRAME_START = Tundra_DynArrU8_size(out);
+
+    u8 *frame = Tundra_DynArrU8_add_mult_uninit(out, 8 + MAX_BYTES);
+
+    i64 stored = Tundra_Cmprs_compress_block(bytes, num_bytes, frame + 8,
+        MAX_BYTES);
+
+    if(stored < 0)
+    {
+        Tundra_DynArrU8_resize(out, FRAME_START);
+        return stored;
+    }
+
+    u32 stored_field = (u32)stored;
+
+    // The batch did not shrink, store it raw so the frame never costs more
+    // than the header.
+    if((u64)stored >= num_bytes)
+    {
+        Tundra_copy_mem_fwd(bytes, frame + 8, num_bytes);
+        stored = (i64)num_bytes;
+        stored_field = (u32)num_bytes | FRAME_RAW_FLAG;
+    }
+
+    *(u32*)frame = (u32)num_bytes;
+    *(u32*)(frame + 4) = stored_field;
+
+    // A shrink, so just a count store trimming the worst case reservation.
+    Tundra_DynArrU8_resize(out, FRAME_START + 8 + (u64)stored);
+
+    return 0;
+}
+
+i64 Tundra_Cmprs_decompress_frames(const u8 *src, u64 num_bytes,
+    Tundra_DynamicArrayU8 *out)
+{
+    const u64 OUT_START = Tundra_DynArrU8_size(out);
+
+    u64 in = 0;
+
+    while(in < num_bytes)
+    {
+        if(num_bytes - in < 8) { break; }
+
+        const u32 RAW_BYTES = *(const u32*)(src + in);
+        const u32 STORED_FIELD = *(const u32*)(src + in + 4);
+        const bool RAW_STORED = (STORED_FIELD & FRAME_RAW_FLAG) != 0;
+        const u32 STORED_BYTES = STORED_FIELD & ~FRAME_RAW_FLAG;
+
+        in += 8;
+
+        if(STORED_BYTES > num_bytes - in ||
+            (RAW_STORED && STORED_BYTES != RAW_BYTES))
+        {
+            break;
+        }
+
+        u8 *dst = Tundra_DynArrU8_add_mult_uninit(out, RAW_BYTES);
+
+        if(RAW_STORED)
+        {
+            Tundra_copy_mem_fwd(src + in, dst, RAW_BYTES);
+        }
+        else
+        {
+            i64 result = Tundra_Cmprs_decompress_block(src + in,
+                STORED_BYTES, dst, RAW_BYTES);
+
+            if(result != (i64)RAW_BYTES) { break; }
+        }
+
+        in += STORED_BYTES;
+    }
+
+    // A malformed or truncated frame broke out early.
+    if(in != num_bytes)
+    {
+        Tundra_DynArrU8_resize(out, OUT_START);
+        return -TUNDRA_ERR_INVARG;
+    }
+
+    return (i64)(Tundra_DynArrU8_size(out) - OUT_START);
+}
@@ -17,10 +17,229 @@
 #include "tundra/common/ErrorDef.h"
 #include "tundra/internal/IOBuffer.h"
 #include "tundra/common/TypeDef.h"
+#include "tundra/utils/MemAlloc.h"
 
 InTundra_InputBuffer stdin_buff;
 InTundra_OutputBuffer stdout_buff;
 
+// Tracks one-time initialization of the console buffers. 0 is uninitialized,
+// 1 is initialization in progress, 2 is ready.
+static u8 init_state;
+
+/**
+ * @brief Initializes the console buffers on their first use.
+ *
+ * The first caller claims initialization with a compare exchange; every other
+ * caller waits until it finishes. Once ready, the cost on every later call is
+ * a single predicted branch.
+ */
+static void ensure_init(void)
+{
+    if(__atomic_load_n(&init_state, __ATOMIC_ACQUIRE) == 2) { return; }
+
+    u8 expected = 0;
+
+    if(!__atomic_compare_exchange_n(&init_state, &expected, 1, false,
+        __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+    {
+        while(__atomic_load_n(&init_state, __ATOMIC_ACQUIRE) != 2)
+        {
+        }
+
+        return;
+    }
+
+    InTundra_OBuff_init(&stdout_buff, TUNDRA_IOHANDLE_STDOUT,
+        TUNDRA_IOBUFF_DEF_CAPACITY);
+    InTundra_IBuff_init(&stdin_buff, TUNDRA_IOHANDLE_STDIN,
+        TUNDRA_IOBUFF_DEF_CAPACITY);
+
+    __atomic_store_n(&init_state, 2, __ATOMIC_RELEASE);
+}
+
+// -- Async log pipeline --
+
+// Byte capacity of the staging ring; power of two so positions mask down to
+// indices.
+#define LOG_RING_BYTES (1U << 20)
+#define LOG_RING_MASK (LOG_RING_BYTES - 1U)
+
+// Set in a record's header once its payload is fully copied; the consumer
+// skips nothing and stops at the first unready record.
+#define LOG_READY_BIT 0x80000000U
+
+// Staging ring for async log mode. Producers reserve a record with one
+// atomic add on `log_head`, copy their payload, then publish the record's
+// header; the single consumer walks `log_tail` forward. Records are
+// [u32 header][payload] rounded up to 4 bytes so headers never straddle the
+// ring's physical end.
+static u8 *log_ring = NULL;
+static u64 log_head = 0;
+static u64 log_tail = 0;
+static bool log_async = false;
+
+/**
+ * @brief Rounds a record's byte size up to the 4 byte grain the ring
+ * reserves in.
+ *
+ * @param num_bytes Payload byte count.
+ *
+ * @return u64 Reserved record size including the header.
+ */
+static u64 log_record_bytes(u64 num_bytes)
+{
+    return (sizeof(u32) + num_bytes + 3U) & ~(u64)3U;
+}
+
+/**
+ * @brief Copies a payload into the ring at a reserved position, wrapping
+ * around the physical end when needed.
+ *
+ * @param pos Ring position of the payload's first byte.
+ * @param bytes Payload to copy.
+ * @param num_bytes Payload byte count.
+ */
+static void log_copy_in(u64 pos, const u8 *bytes, u64 num_bytes)
+{
+    const u64 INDEX = pos & LOG_RING_MASK;
+    const u64 TO_END = LOG_RING_BYTES - INDEX;
+
+    if(num_bytes <= TO_END)
+    {
+        Tundra_copy_mem_fwd(bytes, log_ring + INDEX, num_bytes);
+        return;
+    }
+
+    Tundra_copy_mem_fwd(bytes, log_ring + INDEX, TO_END);
+    Tundra_copy_mem_fwd(bytes + TO_END, log_ring, num_bytes - TO_END);
+}
+
+/**
+ * @brief Stages one finished message into the ring. Safe to call from many
+ * producers at once. If the return is negative, it's an error code;
+ * `-TUNDRA_ERR_AGAIN` means the ring is full and a consumer needs to drain.
+ *
+ * @param bytes Message bytes.
+ * @param num_bytes Message byte count.
+ *
+ * @return `i64` Number of bytes staged if the return is non negative,
+ * otherwise it is an error code.
+ */
+static i64 log_stage_bytes(const u8 *bytes, u64 num_bytes)
+{
+    if(bytes == NULL) return -TUNDRA_ERR_BADADDR;
+
+    const u64 REC_BYTES = log_record_bytes(num_bytes);
+
+    if(REC_BYTES > LOG_RING_BYTES) return -TUNDRA_ERR_NOMEM;
+
+    u64 head = __atomic_load_n(&log_head, __ATOMIC_RELAXED);
+
+    for(;;)
+    {
+        const u64 TAIL = __atomic_load_n(&log_tail, __ATOMIC_ACQUIRE);
+
+        if(head + REC_BYTES - TAIL > LOG_RING_BYTES)
+            return -TUNDRA_ERR_AGAIN;
+
+        // Claim the record; on a race `head` reloads and the space check
+        // reruns.
+        if(__atomic_compare_exchange_n(&log_head, &head, head + REC_BYTES,
+            false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) break;
+    }
+
+    log_copy_in(head + sizeof(u32), bytes, num_bytes);
+
+    // Publish last; the release order makes the payload visible before the
+    // ready bit.
+    __atomic_store_n((u32*)(log_ring + (head & LOG_RING_MASK)),
+        (u32)num_bytes | LOG_READY_BIT, __ATOMIC_RELEASE);
+
+    return (i64)num_bytes;
+}
+
+i64 Tundra_set_async_log(bool enable)
+{
+    if(log_async == enable) return 0;
+
+    if(enable)
+    {
+        log_ring = (u8*)Tundra_alloc_mem(LOG_RING_BYTES);
+        log_head = 0;
+        log_tail = 0;
+
+        // The ring must read as empty records before producers publish.
+        Tundra_fill_mem(log_ring, 0, LOG_RING_BYTES);
+
+        log_async = true;
+        return 0;
+    }
+
+    const i64 RESULT = Tundra_drain_log();
+
+    log_async = false;
+    Tundra_free_mem(log_ring);
+    log_ring = NULL;
+
+    return (RESULT < 0) ? RESULT : 0;
+}
+
+i64 Tundra_drain_log(void)
+{
+    if(!log_async) return 0;
+
+    // The drain below flushes through the stdout buffer.
+    ensure_init();
+
+    u64 tail = log_tail;
+    i64 num_drained = 0;
+
+    const u64 HEAD = __atomic_load_n(&log_head, __ATOMIC_ACQUIRE);
+
+    while(tail != HEAD)
+    {
+        u32 *header = (u32*)(log_ring + (tail & LOG_RING_MASK));
+
+        const u32 HEADER = __atomic_load_n(header, __ATOMIC_ACQUIRE);
+
+        // A producer is still copying this record; later records must wait
+        // behind it to keep messages in order.
+        if(!(HEADER & LOG_READY_BIT)) break;
+
+        const u64 NUM_BYTES = HEADER & ~LOG_READY_BIT;
+        const u64 INDEX = (tail + sizeof(u32)) & LOG_RING_MASK;
+        const u64 TO_END = LOG_RING_BYTES - INDEX;
+
+        if(NUM_BYTES <= TO_END)
+        {
+            InTundra_OBuff_write_bytes(&stdout_buff, log_ring + INDEX,
+                NUM_BYTES);
+        }
+        else
+        {
+            InTundra_OBuff_write_bytes(&stdout_buff, log_ring + INDEX,
+                TO_END);
+            InTundra_OBuff_write_bytes(&stdout_buff, log_ring,
+                NUM_BYTES - TO_END);
+        }
+
+        // Scrub the header before the slot is handed back so a wrapped
+        // producer's record is never mistaken as ready early.
+        __atomic_store_n(header, 0, __ATOMIC_RELAXED);
+
+        tail += log_record_bytes(NUM_BYTES);
+        num_drained += (i64)NUM_BYTES;
+    }
+
+    // The release order hands the freed space back to producers only after
+    // the scrub above lands.
+    __atomic_store_n(&log_tail, tail, __ATOMIC_RELEASE);
+
+    InTundra_OBuff_flush(&stdout_buff);
+
+    return num_drained;
+}
+
 i64 Tundra_print_cstr(const char *cstr)
 {
     // Don't need NULL check here, handled by get_cstr_len and following print
@@ -35,14 +254,36 @@ i64 Tundra_print_cstr_w_len(const char *cstr, u64 length)
 {
     if(cstr == NULL) return -TUNDRA_ERR_BADADDR;
 
+    if(log_async) return log_stage_bytes((const u8*)cstr, length);
+
+    ensure_init();
+
     return InTundra_OBuff_write_bytes(&stdout_buff, (const u8*)cstr, length);
 }
 
+i64 Tundra_print_CStr(Tundra_CStr cstr)
+{
+    return Tundra_print_cstr_w_len(cstr.str, cstr.length);
+}
+
+i64 Tundra_print_char(char c)
+{
+    if(log_async) return log_stage_bytes((const u8*)&c, 1);
+
+    ensure_init();
+
+    return InTundra_OBuff_write_char(&stdout_buff, c);
+}
+
 #define PRINT_NUM_IMPL(type) \
 i64 Tundra_print_##type(type num) { \
+    if(log_async) { \
+        char chars[64]; \
+        const u64 LEN = Tundra_##type##_to_cstr_buf(num, chars); \
+        return log_stage_bytes((const u8*)chars, LEN); } \
+    ensure_init(); \
     return InTundra_OBuff_write_##type(&stdout_buff, num); }
 
-PRINT_NUM_IMPL(char)
 PRINT_NUM_IMPL(u64)
 PRINT_NUM_IMPL(i64)
 PRINT_NUM_IMPL(u32)
@@ -86,9 +327,21 @@ i64 Tundra_vargs_printf(const char *format, Tundra_VaList args)
     Tundra_DynamicArrayChar chars = InTundra_vargs_convert_fmt_to_chars(
         format, args);
 
-    i64 result = InTundra_OBuff_write_bytes(&stdout_buff,
-        (const u8*)Tundra_DynArrChar_data(&chars), 
-        Tundra_DynArrChar_size(&chars));
+    i64 result;
+
+    if(log_async)
+    {
+        result = log_stage_bytes((const u8*)Tundra_DynArrChar_data(&chars),
+            Tundra_DynArrChar_size(&chars));
+    }
+    else
+    {
+        ensure_init();
+
+        result = InTundra_OBuff_write_bytes(&stdout_buff,
+            (const u8*)Tundra_DynArrChar_data(&chars),
+            Tundra_DynArrChar_size(&chars));
+    }
 
     Tundra_DynArrChar_free(&chars);
 
@@ -102,12 +355,15 @@ i64 Tundra_vargs_eprintf(const char *format, Tundra_VaList args)
 
 void Tundra_readin_bytes(u8 *output, u64 max_bytes, i64 *read_result_output)
 {
+    ensure_init();
+
     InTundra_IBuff_readin_bytes(&stdin_buff, output, max_bytes,
         read_result_output);
 }
 
 #define READIN_NUM_IMPL(type) \
 type Tundra_readin_##type(i64 *read_result_output) {\
+    ensure_init(); \
     return InTundra_IBuff_readin_##type(&stdin_buff, read_result_output); }
 
 READIN_NUM_IMPL(char)
@@ -123,24 +379,42 @@ READIN_NUM_IMPL(float)
 
 void Tundra_flush_stdout(void)
 {
+    if(log_async)
+    {
+        // Draining already flushes behind the batch.
+        Tundra_drain_log();
+        return;
+    }
+
+    ensure_init();
+
     InTundra_OBuff_flush(&stdout_buff);
 }
 
 void Tundra_clear_stdin(void)
 {
+    ensure_init();
+
     InTundra_IBuff_clear(&stdin_buff);
 }
 
 void InTundra_ConIO_init(void)
 {
-    InTundra_OBuff_init(&stdout_buff, TUNDRA_IOHANDLE_STDOUT);
-    InTundra_IBuff_init(&stdin_buff, TUNDRA_IOHANDLE_STDIN);
+    ensure_init();
 }
 
 void InTundra_ConIO_shutdown(void)
 {
+    // Nothing to flush or free if no console call ever initialized the
+    // buffers.
+    if(__atomic_load_n(&init_state, __ATOMIC_ACQUIRE) != 2) { return; }
+
+    Tundra_set_async_log(false);
+
     InTundra_OBuff_flush(&stdout_buff);
 
     InTundra_OBuff_free(&stdout_buff);
     InTundra_IBuff_free(&stdin_buff);
+
+    __atomic_store_n(&init_state, 0, __ATOMIC_RELEASE);
 }
@@ -0,0 +1,135 @@
+/**
+ * @file DirHandling.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Methods for enumerating the entries of a directory.
+ * @version 0.1
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "tundra/utils/DirHandling.h"
+#include "tundra/common/Core.h"
+#include "tundra/common/ErrorDef.h"
+#include "tundra/internal/Syscall.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/MemUtils.h"
+
+// Directories must be opened with this flag; opening anything else with it
+// fails.
+#define LINUX_FILEOPENFLAG_DIRECTORY 65536
+
+// Batch buffer size. Large enough that a getdents64 call returns over a
+// thousand typically-sized entries, keeping syscalls per directory low.
+#define DIR_BATCH_BYTES (64U * 1024U)
+
+// Fixed-size head of one packed kernel entry; field layout matches the
+// kernel's linux_dirent64. The null terminated name follows directly after
+// the `type` byte, and `reclen` spans head, name and padding together.
+typedef struct
+{
+    u64 inode;
+    i64 offset;
+    u16 reclen;
+    u8 type;
+} LinuxDirEntryHead;
+
+// The kernel packs the name right after the 19 head bytes; sizeof the head
+// struct would overshoot it by the compiler's tail padding.
+#define DIR_ENTRY_NAME_OFFSET 19U
+
+TUNDRA_CT_ASSERT(sizeof(LinuxDirEntryHead) >= DIR_ENTRY_NAME_OFFSET);
+
+/**
+ * @brief Refills a Dir's batch buffer from the kernel. If the return is
+ * negative, it's an error code. Otherwise it is the number of bytes
+ * buffered, 0 at the end of the directory.
+ *
+ * @param dir Dir to refill.
+ *
+ * @return `i64` Number of bytes buffered if the return is non negative,
+ * otherwise it is an error code.
+ */
+static i64 refill_batch(Tundra_Dir *dir)
+{
+    const i64 RESULT = InTundra_syscall(TUNDRA_LINUX_SYSCALL_GETDENTS64,
+        dir->handle, (i64)dir->data, DIR_BATCH_BYTES, 0, 0, 0);
+
+    if(RESULT < 0) return RESULT;
+
+    dir->read_pos = 0;
+    dir->end_pos = (u64)RESULT;
+
+    return RESULT;
+}
+
+i64 Tundra_Dir_open(Tundra_Dir *dir, const char *path)
+{
+    if(dir == NULL || path == NULL) return -TUNDRA_ERR_BADADDR;
+
+    const i64 OPEN_RESULT = InTundra_syscall(TUNDRA_LINUX_SYSCALL_OPENAT,
+        TUNDRA_LINUX_WORKING_DIRECTORY_FD, (i64)path,
+        TUNDRA_LINUX_FILEOPENFLAG_RDONLY | LINUX_FILEOPENFLAG_DIRECTORY,
+        0, 0, 0);
+
+    // If error
+    if(OPEN_RESULT < 0) return OPEN_RESULT;
+
+    dir->handle = OPEN_RESULT;
+    dir->data = (u8*)Tundra_alloc_mem(DIR_BATCH_BYTES);
+    dir->read_pos = 0;
+    dir->end_pos = 0;
+
+    return 0;
+}
+
+i64 Tundra_Dir_next(Tundra_Dir *dir, Tundra_DirEntry *entry_output)
+{
+    if(dir == NULL || entry_output == NULL) return -TUNDRA_ERR_BADADDR;
+
+    // Batch exhausted, fetch the next one.
+    if(dir->read_pos == dir->end_pos)
+    {
+        const i64 RESULT = refill_batch(dir);
+
+        if(RESULT < 0) return RESULT;
+
+        // End of the directory.
+        if(RESULT == 0) return 0;
+    }
+
+    const LinuxDirEntryHead *HEAD =
+        (const LinuxDirEntryHead*)(dir->data + dir->read_pos);
+
+    const char *NAME =
+        (const char*)(dir->data + dir->read_pos + DIR_ENTRY_NAME_OFFSET);
+
+    entry_output->name.view = NAME;
+    entry_output->name.num_char = Tundra_get_cstr_len(NAME);
+    entry_output->inode = HEAD->inode;
+    entry_output->type = HEAD->type;
+
+    dir->read_pos += HEAD->reclen;
+
+    return 1;
+}
+
+i64 Tundra_Dir_close(Tundra_Dir *dir)
+{
+    if(dir == NULL) return -TUNDRA_ERR_BADADDR;
+
+    const i64 CLOSE_RESULT = InTundra_syscall(TUNDRA_LINUX_SYSCALL_CLOSE,
+        dir->handle, 0, 0, 0, 0, 0);
+
+    if(CLOSE_RESULT < 0) return CLOSE_RESULT;
+
+    Tundra_free_mem(dir->data);
+
+    dir->handle = TUNDRA_IOHANDLE_INVALID;
+    dir->data = NULL;
+    dir->read_pos = 0;
+    dir->end_pos = 0;
+
+    return 0;
+}
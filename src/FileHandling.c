@@ -15,7 +15,221 @@
 #include "tundra/utils/StringConversion.h"
 #include "tundra/utils/MemUtils.h"
 #include "tundra/common/ErrorDef.h"
+#include "tundra/utils/MemAlloc.h"
 #include "tundra/internal/Syscall.h"
+#include "tundra/utils/Time.h"
+#include "tundra/utils/Trace.h"
+
+#ifndef PROT_READ
+#define PROT_READ 0x1
+#endif
+#ifndef MAP_PRIVATE
+#define MAP_PRIVATE 0x02
+#endif
+
+// Kernel struct stat layout for x86-64, named through the fields we read.
+typedef struct
+{
+    u64 st_dev;
+    u64 st_ino;
+    u64 st_nlink;
+    u32 st_mode;
+    u32 st_uid;
+    u32 st_gid;
+    u32 pad0;
+    u64 st_rdev;
+    i64 st_size;
+    i64 st_blksize;
+    i64 st_blocks;
+    i64 st_atime_sec;
+    i64 st_atime_nsec;
+    i64 st_mtime_sec;
+    i64 st_mtime_nsec;
+    i64 st_ctime_sec;
+    i64 st_ctime_nsec;
+    i64 unused[3];
+} LinuxStat;
+
+// -- IO Buffer Pool --
+
+/**
+ * @brief One pooled io buffer pair. A node sits on the free list with
+ * initialized buffers ready to lease, or on the spare list as an empty shell
+ * waiting to carry released buffers back.
+ */
+typedef struct BufferLease
+{
+    struct BufferLease *next;
+    InTundra_InputBuffer ibuff;
+    InTundra_OutputBuffer obuff;
+} BufferLease;
+
+// Nodes holding initialized buffers, ready to lease to an open.
+static BufferLease *pool_free_head = NULL;
+
+// Empty shell nodes; every lease leaves one here so releasing its buffers at
+// close needs no allocation.
+static BufferLease *pool_spare_head = NULL;
+
+// Byte capacity the pooled buffers were created with. Opens with a different
+// capacity bypass the pool.
+static u64 pool_capacity = 0;
+
+static u64 pool_num_free = 0;
+
+// Cap on the free list length; 0 means pooling is disabled.
+static u64 pool_max_free = 0;
+
+/**
+ * @brief Attempts to lease a pooled buffer pair into `file`. On a miss while
+ * pooling applies, a spare shell is set aside so the eventual close can
+ * still return freshly created buffers without allocating.
+ *
+ * @param file File to receive the buffers.
+ * @param handle Handle the buffers will serve.
+ *
+ * @return bool True if buffers were leased, false if the caller must create
+ * them.
+ */
+static bool pool_try_acquire(Tundra_File *file, InTundra_IOHandle handle)
+{
+    BufferLease *lease = pool_free_head;
+
+    if(lease == NULL)
+    {
+        BufferLease *spare =
+            (BufferLease*)Tundra_alloc_mem(sizeof(BufferLease));
+
+        spare->next = pool_spare_head;
+        pool_spare_head = spare;
+
+        return false;
+    }
+
+    pool_free_head = lease->next;
+    --pool_num_free;
+
+    file->ibuff = lease->ibuff;
+    file->obuff = lease->obuff;
+    file->ibuff.handle = handle;
+    file->obuff.handle = handle;
+
+    lease->next = pool_spare_head;
+    pool_spare_head = lease;
+
+    return true;
+}
+
+/**
+ * @brief Returns a closing file's buffers to the pool, or frees them when
+ * the pool is full, reconfigured, or disabled. The output buffer must
+ * already be flushed.
+ *
+ * @param file File whose buffers are released.
+ */
+static void pool_release(Tundra_File *file)
+{
+    // Async pending buffers don't carry across leases.
+    if(file->obuff.async_mode) InTundra_OBuff_set_async(&file->obuff, false);
+
+    if(pool_max_free == 0 || pool_num_free >= pool_max_free ||
+        file->ibuff.capacity != pool_capacity || pool_spare_head == NULL)
+    {
+        InTundra_IBuff_free(&file->ibuff);
+        InTundra_OBuff_free(&file->obuff);
+        return;
+    }
+
+    BufferLease *lease = pool_spare_head;
+    pool_spare_head = lease->next;
+
+    // Store the buffers clean so a lease is ready to use as-is.
+    file->ibuff.read_pos = 0;
+    file->ibuff.end_pos = 0;
+    Tundra_DynArrU8_clear(&file->obuff.data);
+
+    // A filter stage is per-file configuration and doesn't carry across
+    // leases either.
+    if(file->obuff.filter != NULL)
+    {
+        InTundra_OBuff_set_filter(&file->obuff, NULL, NULL);
+    }
+
+    lease->ibuff = file->ibuff;
+    lease->obuff = file->obuff;
+    lease->ibuff.handle = TUNDRA_IOHANDLE_INVALID;
+    lease->obuff.handle = TUNDRA_IOHANDLE_INVALID;
+
+    lease->next = pool_free_head;
+    pool_free_head = lease;
+    ++pool_num_free;
+}
+
+i64 Tundra_File_set_buffer_pool(u64 buff_capacity, u64 max_buffers)
+{
+    // Drain whatever the pool currently holds.
+    while(pool_free_head != NULL)
+    {
+        BufferLease *lease = pool_free_head;
+        pool_free_head = lease->next;
+
+        InTundra_IBuff_free(&lease->ibuff);
+        InTundra_OBuff_free(&lease->obuff);
+        Tundra_free_mem(lease);
+    }
+
+    while(pool_spare_head != NULL)
+    {
+        BufferLease *spare = pool_spare_head;
+        pool_spare_head = spare->next;
+        Tundra_free_mem(spare);
+    }
+
+    pool_num_free = 0;
+    pool_max_free = max_buffers;
+
+    if(max_buffers == 0)
+    {
+        pool_capacity = 0;
+        return 0;
+    }
+
+    pool_capacity =
+        (buff_capacity != 0) ? buff_capacity : TUNDRA_IOBUFF_FILE_CAPACITY;
+
+    // Prewarm so opens are allocation-free from the start.
+    for(u64 i = 0; i < max_buffers; ++i)
+    {
+        BufferLease *lease =
+            (BufferLease*)Tundra_alloc_mem(sizeof(BufferLease));
+
+        InTundra_IBuff_init(&lease->ibuff, TUNDRA_IOHANDLE_INVALID,
+            pool_capacity);
+        InTundra_OBuff_init(&lease->obuff, TUNDRA_IOHANDLE_INVALID,
+            pool_capacity);
+
+        lease->next = pool_free_head;
+        pool_free_head = lease;
+        ++pool_num_free;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Fills `stat_output` with the kernel's metadata for an open handle.
+ * One syscall, no cursor movement.
+ *
+ * @param handle Handle to inspect.
+ * @param stat_output Receives the metadata.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+static i64 fstat_helper(InTundra_IOHandle handle, LinuxStat *stat_output)
+{
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_FSTAT, handle,
+        (i64)stat_output, 0, 0, 0, 0);
+}
 
 /**
  * @brief Returns the cursor position inside an open file. 
@@ -61,26 +275,13 @@ static i64 get_cursor_pos_in_file(const Tundra_File *file)
  */
 static i64 find_file_size(Tundra_File *file)
 {
-    i64 current_cursor_pos = get_cursor_pos_in_file(file);
-
-    // If error
-    if(current_cursor_pos < 0) return current_cursor_pos;
-
-    i64 file_size = InTundra_syscall(TUNDRA_LINUX_SYSCALL_LSEEK, file->handle, 
-        0, TUNDRA_LINUX_SEEKBEHAVIOR_END, 0, 0, 0);
+    LinuxStat stat;
 
-    if(file_size < 0) return file_size;
-
-    // Restore cursor position to what it was.
-    // i64 move_result = move_cursor_in_file(file, current_cursor_pos);
-    i64 move_result = InTundra_syscall(TUNDRA_LINUX_SYSCALL_LSEEK, file->handle, 
-        current_cursor_pos, TUNDRA_LINUX_SEEKBEHAVIOR_SET, 0, 0, 0);
-
-    if(move_result < 0) return move_result;
+    i64 result = fstat_helper(file->handle, &stat);
 
-    // Cursor has been successfully restored.
+    if(result < 0) return result;
 
-    return file_size;
+    return stat.st_size;
 }
 
 /**
@@ -122,11 +323,87 @@ static i64 close_file_helper(InTundra_IOHandle file_handle)
         0, 0, 0);
 }
 
+// -- Adaptive Flush Policy --
+
+// Flushes the adaptive policy observes before each retune, keeping the
+// cycle-to-nanosecond conversion and the decision logic off the write path.
+#define ADAPTIVE_WINDOW_FLUSHES 8
+
+// Smallest threshold the tuner shrinks to; below a page the syscall itself
+// dominates and shrinking further cannot buy latency back.
+#define ADAPTIVE_MIN_BYTES 4096U
+
+/**
+ * @brief Retunes the adaptive policy's flush threshold from the window of
+ * flushes just observed, then resets the window.
+ *
+ * Mean flush latency over the target halves the threshold; latency
+ * comfortably under it doubles the threshold, but only when the window's
+ * flushes actually carried near-threshold batches, so trickle traffic with
+ * trivially cheap flushes does not inflate the batch size. Clamped to
+ * [ADAPTIVE_MIN_BYTES, buffer capacity].
+ *
+ * @param file File to retune.
+ */
+static void adaptive_retune(Tundra_File *file)
+{
+    const u64 MEAN_NS = Tundra_cycles_to_ns(
+        file->adaptive_window_cycles / ADAPTIVE_WINDOW_FLUSHES);
+
+    const u64 MEAN_BYTES =
+        file->adaptive_window_bytes / ADAPTIVE_WINDOW_FLUSHES;
+
+    // A buffer smaller than a page caps the shrink at its own capacity.
+    const u64 MIN_BYTES = file->obuff.capacity < ADAPTIVE_MIN_BYTES ?
+        file->obuff.capacity : ADAPTIVE_MIN_BYTES;
+
+    if(MEAN_NS > file->adaptive_target_ns)
+    {
+        file->flush_threshold_bytes /= 2;
+
+        if(file->flush_threshold_bytes < MIN_BYTES)
+            file->flush_threshold_bytes = MIN_BYTES;
+    }
+    else if(MEAN_NS * 2 < file->adaptive_target_ns &&
+        MEAN_BYTES * 4 >= file->flush_threshold_bytes * 3)
+    {
+        file->flush_threshold_bytes *= 2;
+
+        if(file->flush_threshold_bytes > file->obuff.capacity)
+            file->flush_threshold_bytes = file->obuff.capacity;
+    }
+
+    file->adaptive_window_flushes = 0;
+    file->adaptive_window_cycles = 0;
+    file->adaptive_window_bytes = 0;
+}
+
+/**
+ * @brief Drains the output buffer for the adaptive policy, timing the flush
+ * and accruing it into the retune window.
+ *
+ * @param file File to flush.
+ */
+static void adaptive_flush(Tundra_File *file)
+{
+    const u64 NUM_BYTES = InTundra_OBuff_size(&file->obuff);
+
+    const u64 START = Tundra_get_cycles_start();
+
+    InTundra_OBuff_flush(&file->obuff);
+
+    file->adaptive_window_cycles += Tundra_get_cycles_end() - START;
+    file->adaptive_window_bytes += NUM_BYTES;
+
+    if(++file->adaptive_window_flushes >= ADAPTIVE_WINDOW_FLUSHES)
+        adaptive_retune(file);
+}
+
 /**
- * @brief Helper for handling behavior after writing to a file. Checks for 
- * errors and increments the file's cursor position, also checking if the file 
+ * @brief Helper for handling behavior after writing to a file. Checks for
+ * errors and increments the file's cursor position, also checking if the file
  * has expanded in size from the write.
- * 
+ *
  * @param file File that was written.
  * @param write_result Return result of the write.
  */
@@ -154,10 +431,23 @@ static void write_helper(Tundra_File *file, i64 write_result)
     }
             
     // We've added bytes to the end of the file.
-    if(file->cursor_pos > file->file_byte_size) 
+    if(file->cursor_pos > file->file_byte_size)
         file->file_byte_size = file->cursor_pos;
 
     Tundra_eprintf("File size: %ld\n", file->file_byte_size);
+
+    // Apply the file's flush policy now that the write is buffered.
+    if(file->flush_policy == TUNDRA_FILE_FLUSH_POLICY_EVERY_WRITE ||
+        (file->flush_policy == TUNDRA_FILE_FLUSH_POLICY_BYTE_THRESHOLD &&
+        InTundra_OBuff_size(&file->obuff) >= file->flush_threshold_bytes))
+    {
+        InTundra_OBuff_flush(&file->obuff);
+    }
+    else if(file->flush_policy == TUNDRA_FILE_FLUSH_POLICY_ADAPTIVE &&
+        InTundra_OBuff_size(&file->obuff) >= file->flush_threshold_bytes)
+    {
+        adaptive_flush(file);
+    }
 }
 
 bool Tundra_File_at_eof(const Tundra_File *file)
@@ -189,12 +479,24 @@ void Tundra_File_check_readerr(i64 result)
         Tundra_err_to_rdbl(result));
 }
 
-i64 Tundra_File_open(Tundra_File *file, const char *path, 
+i64 Tundra_File_open(Tundra_File *file, const char *path,
     Tundra_FileOpenMode open_mode, Tundra_FileWriteBehavior write_behavior,
     bool create_if_noexist, bool clear_file)
 {
+    return Tundra_File_open_buffered(file, path, open_mode, write_behavior,
+        create_if_noexist, clear_file, TUNDRA_IOBUFF_FILE_CAPACITY);
+}
+
+i64 Tundra_File_open_buffered(Tundra_File *file, const char *path,
+    Tundra_FileOpenMode open_mode, Tundra_FileWriteBehavior write_behavior,
+    bool create_if_noexist, bool clear_file, u64 buff_capacity)
+{
+    TUNDRA_TRACE_SCOPE("file_open");
+
     if(file == NULL || path == NULL) return -TUNDRA_ERR_BADADDR;
 
+    if(buff_capacity == 0) buff_capacity = TUNDRA_IOBUFF_FILE_CAPACITY;
+
     enum
     {
         TRUNCATE_FLAG = 512
@@ -209,10 +511,39 @@ i64 Tundra_File_open(Tundra_File *file, const char *path,
     // If error
     if(open_result < 0) return open_result;
 
-    InTundra_IBuff_init(&file->ibuff, open_result);
-    InTundra_OBuff_init(&file->obuff, open_result);
+    // Lease pooled buffers when the pool is enabled and fits this open;
+    // direct-mode buffers are block aligned and never pooled.
+    file->buffs_pooled = pool_max_free != 0 &&
+        buff_capacity == pool_capacity &&
+        !(write_behavior & TUNDRA_FILE_WRITE_BEHAVIOR_DIRECT);
+
+    if(!file->buffs_pooled || !pool_try_acquire(file, open_result))
+    {
+        InTundra_IBuff_init(&file->ibuff, open_result, buff_capacity);
+
+        if(write_behavior & TUNDRA_FILE_WRITE_BEHAVIOR_DIRECT)
+        {
+            InTundra_OBuff_init_direct(&file->obuff, open_result,
+                buff_capacity);
+        }
+        else
+        {
+            InTundra_OBuff_init(&file->obuff, open_result, buff_capacity);
+        }
+    }
 
     file->handle = open_result;
+    file->flush_policy = TUNDRA_FILE_FLUSH_POLICY_MANUAL;
+    file->flush_threshold_bytes = 0;
+    file->adaptive_target_ns = 0;
+    file->adaptive_window_flushes = 0;
+    file->adaptive_window_cycles = 0;
+    file->adaptive_window_bytes = 0;
+
+    // Read-only opens are overwhelmingly sequential scans; tell the kernel
+    // so it widens its readahead window. Best effort, a refusal is harmless.
+    if(open_mode == TUNDRA_FILE_OPEN_MODE_READONLY)
+        InTundra_raw_fadvise(open_result, 0, 0, TUNDRA_FILE_ADVICE_SEQUENTIAL);
 
     i64 file_size = find_file_size(file);
 
@@ -244,7 +575,12 @@ i64 Tundra_File_open(Tundra_File *file, const char *path,
  */
 static i64 reset_input_buff(Tundra_File *file)
 {
-    i64 result = InTundra_syscall(TUNDRA_LINUX_SYSCALL_LSEEK, file->handle, 
+    // Stopping read-ahead puts the handle's cursor back at the consumer's
+    // position, so the relative seek below stays correct.
+    i64 result = InTundra_IBuff_stop_prefetch(&file->ibuff);
+    if(result < 0) return result;
+
+    result = InTundra_syscall(TUNDRA_LINUX_SYSCALL_LSEEK, file->handle,
         -(i64)InTundra_IBuff_size(&file->ibuff), 
         TUNDRA_LINUX_SEEKBEHAVIOR_CUR, 0, 0, 0);
 
@@ -301,6 +637,300 @@ i64 Tundra_File_write_cstr(Tundra_File *file, const char *cstr)
     return result;
 }
 
+i64 Tundra_File_copy_range(Tundra_File *src, u64 src_offset,
+    Tundra_File *dst, u64 dst_offset, u64 num_bytes)
+{
+    if(src == NULL || dst == NULL) return -TUNDRA_ERR_BADADDR;
+
+    // Both files' buffered output must reach the kernel first so the copy
+    // sees and orders against it.
+    i64 result = InTundra_OBuff_flush(&src->obuff);
+
+    if(result < 0) return result;
+
+    result = InTundra_OBuff_flush(&dst->obuff);
+
+    if(result < 0) return result;
+
+    i64 in_offset = (i64)src_offset;
+    i64 out_offset = (i64)dst_offset;
+    u64 remaining = num_bytes;
+
+    while(remaining != 0)
+    {
+        result = InTundra_raw_copy_file_range(src->handle, &in_offset,
+            dst->handle, &out_offset, remaining);
+
+        // copy_file_range cannot cross filesystems and old kernels lack it
+        // entirely; fall back to sendfile, which copies to the destination's
+        // cursor, by seeking it to the target offset for the remainder.
+        if(result == -TUNDRA_LINUX_ERR_CROSSDEV ||
+            result == -TUNDRA_LINUX_ERR_NOSYS ||
+            result == -TUNDRA_LINUX_ERR_INVARG)
+        {
+            result = InTundra_syscall(TUNDRA_LINUX_SYSCALL_LSEEK, dst->handle,
+                out_offset, TUNDRA_LINUX_SEEKBEHAVIOR_SET, 0, 0, 0);
+
+            if(result < 0) return result;
+
+            while(remaining != 0)
+            {
+                result = InTundra_raw_sendfile(dst->handle, src->handle,
+                    &in_offset, remaining);
+
+                if(result < 0) return result;
+                if(result == 0) break; // Source exhausted.
+
+                out_offset += result;
+                remaining -= (u64)result;
+            }
+
+            // Put the destination's kernel cursor back where its buffered io
+            // expects it.
+            result = InTundra_syscall(TUNDRA_LINUX_SYSCALL_LSEEK, dst->handle,
+                dst->cursor_pos, TUNDRA_LINUX_SEEKBEHAVIOR_SET, 0, 0, 0);
+
+            if(result < 0) return result;
+
+            break;
+        }
+
+        if(result < 0) return result;
+        if(result == 0) break; // Source exhausted.
+
+        remaining -= (u64)result;
+    }
+
+    // The copy can extend the destination past its tracked size.
+    if(out_offset > dst->file_byte_size) dst->file_byte_size = out_offset;
+
+    return (i64)(num_bytes - remaining);
+}
+
+i64 Tundra_copy_file(const char *src_path, const char *dst_path)
+{
+    if(src_path == NULL || dst_path == NULL) return -TUNDRA_ERR_BADADDR;
+
+    Tundra_File src;
+    i64 result = Tundra_File_open(&src, src_path,
+        TUNDRA_FILE_OPEN_MODE_READONLY, TUNDRA_FILE_WRITE_BEHAVIOR_NONE,
+        false, false);
+
+    if(result < 0) return result;
+
+    Tundra_File dst;
+    result = Tundra_File_open(&dst, dst_path,
+        TUNDRA_FILE_OPEN_MODE_WRITEONLY, TUNDRA_FILE_WRITE_BEHAVIOR_AT_CURSOR,
+        true, true);
+
+    if(result < 0)
+    {
+        Tundra_File_close(&src);
+        return result;
+    }
+
+    result = Tundra_File_copy_range(&src, 0, &dst, 0,
+        (u64)src.file_byte_size);
+
+    Tundra_File_close(&src);
+
+    i64 close_result = Tundra_File_close(&dst);
+
+    if(result < 0) return result;
+    if(close_result < 0) return close_result;
+
+    return result;
+}
+
+i64 Tundra_File_read_all(const char *path, Tundra_String *out)
+{
+    if(path == NULL || out == NULL) return -TUNDRA_ERR_BADADDR;
+
+    // Bare read-only open; no io buffers are created at all.
+    InTundra_IOHandle handle = open_file_helper(path, 0, 0);
+
+    if(handle < 0) return handle;
+
+    LinuxStat stat;
+
+    i64 result = fstat_helper(handle, &stat);
+
+    if(result < 0)
+    {
+        close_file_helper(handle);
+        return result;
+    }
+
+    const u64 NUM_BYTES = (u64)stat.st_size;
+
+    // Exactly the file plus its null terminator, handed to the String whole
+    // so the bytes land in their final place with no intermediate copies.
+    char *buffer = (char*)Tundra_alloc_mem(NUM_BYTES + 1);
+
+    u64 num_read = 0;
+
+    // One large read in practice; the loop only continues on a rare short
+    // read (or stops early if the file shrank under us).
+    while(num_read < NUM_BYTES)
+    {
+        result = InTundra_raw_read_bytes(handle, buffer + num_read,
+            (i64)(NUM_BYTES - num_read));
+
+        if(result < 0)
+        {
+            Tundra_free_mem((void*)buffer);
+            close_file_helper(handle);
+            return result;
+        }
+
+        if(result == 0) break;
+
+        num_read += (u64)result;
+    }
+
+    buffer[num_read] = '\0';
+
+    Tundra_Str_take_buffer(out, buffer, num_read + 1);
+
+    result = close_file_helper(handle);
+
+    if(result < 0) return result;
+
+    return (i64)num_read;
+}
+
+i64 Tundra_File_write_all(const char *path, const void *bytes, u64 num_bytes)
+{
+    if(path == NULL || (bytes == NULL && num_bytes != 0))
+        return -TUNDRA_ERR_BADADDR;
+
+    enum
+    {
+        TRUNCATE_FLAG = 512
+    };
+
+    // Write-only open, created if absent and cleared if present, so the
+    // buffer becomes the file's entire contents.
+    InTundra_IOHandle handle = open_file_helper(path,
+        TUNDRA_FILE_OPEN_MODE_WRITEONLY | TUNDRA_LINUX_FILEOPENFLAG_CREATE |
+        TRUNCATE_FLAG, 0644);
+
+    if(handle < 0) return handle;
+
+    u64 num_written = 0;
+
+    while(num_written < num_bytes)
+    {
+        i64 result = InTundra_raw_write_bytes(handle,
+            (const u8*)bytes + num_written, (i64)(num_bytes - num_written));
+
+        if(result < 0)
+        {
+            close_file_helper(handle);
+            return result;
+        }
+
+        num_written += (u64)result;
+    }
+
+    i64 close_result = close_file_helper(handle);
+
+    if(close_result < 0) return close_result;
+
+    return (i64)num_written;
+}
+
+i64 Tundra_File_map(Tundra_File *file, const void **view_output,
+    u64 *num_bytes_output)
+{
+    if(file == NULL || view_output == NULL || num_bytes_output == NULL)
+        return -TUNDRA_ERR_BADADDR;
+
+    // Buffered output must reach the kernel before mapping so the view
+    // reflects every write made through this file.
+    i64 result = InTundra_OBuff_flush(&file->obuff);
+
+    if(result < 0) return result;
+
+    result = InTundra_syscall(TUNDRA_LINUX_SYSCALL_MMAP, 0,
+        file->file_byte_size, PROT_READ, MAP_PRIVATE, file->handle, 0);
+
+    if(result < 0) return result;
+
+    *view_output = (const void*)result;
+    *num_bytes_output = (u64)file->file_byte_size;
+
+    return 0;
+}
+
+i64 Tundra_File_unmap(const void *view, u64 num_bytes)
+{
+    if(view == NULL) return -TUNDRA_ERR_BADADDR;
+
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_MUNMAP, (i64)view,
+        (i64)num_bytes, 0, 0, 0, 0);
+}
+
+i64 Tundra_File_read_at(Tundra_File *file, void *buffer, u64 num_bytes,
+    u64 offset)
+{
+    if(file == NULL || buffer == NULL) return -TUNDRA_ERR_BADADDR;
+
+    // Any buffered output must reach the kernel first so the read sees it.
+    // On read-only files the buffer is empty and this does no syscall.
+    i64 result = InTundra_OBuff_flush(&file->obuff);
+
+    if(result < 0) return result;
+
+    return InTundra_raw_pread_bytes(file->handle, buffer, (i64)num_bytes,
+        (i64)offset);
+}
+
+i64 Tundra_File_write_at(Tundra_File *file, const void *bytes, u64 num_bytes,
+    u64 offset)
+{
+    if(file == NULL || bytes == NULL) return -TUNDRA_ERR_BADADDR;
+
+    // Keep ordering against earlier buffered writes.
+    i64 result = InTundra_OBuff_flush(&file->obuff);
+
+    if(result < 0) return result;
+
+    result = InTundra_raw_pwrite_bytes(file->handle, bytes, (i64)num_bytes,
+        (i64)offset);
+
+    if(result < 0) return result;
+
+    // Positional writes never move the cursor but can still grow the file.
+    if((i64)offset + result > file->file_byte_size)
+        file->file_byte_size = (i64)offset + result;
+
+    return result;
+}
+
+i64 Tundra_File_writev(Tundra_File *file, const Tundra_IOVec *vecs,
+    u64 num_vecs)
+{
+    if(file == NULL || vecs == NULL) return -TUNDRA_ERR_BADADDR;
+
+    i64 result = check_write_after_read(file);
+
+    if(result < 0) return result;
+
+    file->last_op = INTUNDRA_FILE_OPERATION_WRITE;
+
+    // Push out any buffered text first so this write lands after earlier
+    // buffered ones, then hand every segment to the kernel in one syscall.
+    result = InTundra_OBuff_flush(&file->obuff);
+
+    if(result < 0) return result;
+
+    result = InTundra_raw_writev(file->handle, vecs, (i64)num_vecs);
+
+    write_helper(file, result);
+    return result;
+}
+
 #define WRITE_NUM_IMPL(type) \
 i64 Tundra_File_write_##type(Tundra_File *file, type num) {\
     if(file == NULL) return -TUNDRA_ERR_BADADDR; \
@@ -322,6 +952,57 @@ WRITE_NUM_IMPL(u8)
 WRITE_NUM_IMPL(i8)
 WRITE_NUM_IMPL(float)
 
+i64 Tundra_File_write_raw_array(Tundra_File *file, const void *elems,
+    u64 num_bytes)
+{
+    if(file == NULL || elems == NULL) return -TUNDRA_ERR_BADADDR;
+
+    i64 result = check_write_after_read(file);
+
+    if(result < 0) return result;
+
+    file->last_op = INTUNDRA_FILE_OPERATION_WRITE;
+
+    result = InTundra_OBuff_write_bytes(&file->obuff, (const u8*)elems,
+        num_bytes);
+
+    write_helper(file, result);
+    return result;
+}
+
+// Raw fixed-width writes skip decimal conversion entirely; the value's bytes
+// go into the buffer as-is (little endian on this platform).
+#define WRITE_RAW_IMPL(type) \
+i64 Tundra_File_write_raw_##type(Tundra_File *file, type num) {\
+    return Tundra_File_write_raw_array(file, &num, sizeof(type)); }
+
+WRITE_RAW_IMPL(u64)
+WRITE_RAW_IMPL(i64)
+WRITE_RAW_IMPL(u32)
+WRITE_RAW_IMPL(int)
+WRITE_RAW_IMPL(u16)
+WRITE_RAW_IMPL(i16)
+WRITE_RAW_IMPL(u8)
+WRITE_RAW_IMPL(i8)
+WRITE_RAW_IMPL(float)
+
+#define READIN_RAW_IMPL(type) \
+type Tundra_File_readin_raw_##type(Tundra_File *file, \
+    i64 *read_result_output) {\
+    type num = 0; \
+    Tundra_File_readin_bytes(file, &num, sizeof(type), read_result_output); \
+    return num; }
+
+READIN_RAW_IMPL(u64)
+READIN_RAW_IMPL(i64)
+READIN_RAW_IMPL(u32)
+READIN_RAW_IMPL(int)
+READIN_RAW_IMPL(u16)
+READIN_RAW_IMPL(i16)
+READIN_RAW_IMPL(u8)
+READIN_RAW_IMPL(i8)
+READIN_RAW_IMPL(float)
+
 i64 Tundra_File_writef(Tundra_File *file, const char *format, ...)
 {
     if(file == NULL || format == NULL) return -TUNDRA_ERR_BADADDR;
@@ -406,6 +1087,63 @@ void Tundra_File_readin_bytes(Tundra_File *file, void *buffer, u64 num_bytes,
     if(read_result_output != NULL) *read_result_output = IBuff_result;
 }
 
+i64 Tundra_File_readin_line(Tundra_File *file, Tundra_StringView *line_output)
+{
+    if(file == NULL || line_output == NULL) return -TUNDRA_ERR_BADADDR;
+
+    check_read_after_write(file);
+    file->last_op = INTUNDRA_FILE_OPERATION_READ;
+
+    i64 result = InTundra_IBuff_readin_line(&file->ibuff, line_output);
+
+    read_helper(file, result);
+
+    return result;
+}
+
+i64 Tundra_File_readin_u64_array(Tundra_File *file, u64 *output,
+    u64 max_elems)
+{
+    if(file == NULL || output == NULL) return -TUNDRA_ERR_BADADDR;
+
+    check_read_after_write(file);
+    file->last_op = INTUNDRA_FILE_OPERATION_READ;
+
+    u64 num_bytes = 0;
+
+    i64 result = InTundra_IBuff_readin_u64_array(&file->ibuff, output,
+        max_elems, &num_bytes);
+
+    read_helper(file, (i64)num_bytes);
+
+    return result;
+}
+
+i64 Tundra_File_write_u64_array(Tundra_File *file, const u64 *vals,
+    u64 num_vals, char sep)
+{
+    if(file == NULL || vals == NULL) return -TUNDRA_ERR_BADADDR;
+
+    i64 result = check_write_after_read(file);
+
+    if(result < 0) return result;
+
+    file->last_op = INTUNDRA_FILE_OPERATION_WRITE;
+
+    // One batch conversion, one buffered write for the whole column.
+    Tundra_String text;
+    Tundra_u64_array_to_cstr(vals, num_vals, sep, &text);
+
+    result = InTundra_OBuff_write_bytes(&file->obuff,
+        (const u8*)Tundra_Str_data(&text), Tundra_Str_size(&text));
+
+    Tundra_Str_free(&text);
+
+    write_helper(file, result);
+
+    return result;
+}
+
 #define READ_NUM_IMPL(type) \
 type Tundra_File_readin_##type(Tundra_File *file, i64 *read_result_output) { \
     check_read_after_write(file); \
@@ -432,6 +1170,17 @@ u64 Tundra_File_get_cursor(const Tundra_File *file)
 
 i64 Tundra_File_set_cursor(Tundra_File *file, u64 position)
 {
+    // Read-ahead is positional, so a seek restarts it at the target below.
+    u64 prefetch_slots = 0;
+
+    if(file->ibuff.prefetcher != NULL)
+    {
+        prefetch_slots = file->ibuff.prefetcher->num_slots;
+
+        i64 stop_result = InTundra_IBuff_stop_prefetch(&file->ibuff);
+        if(stop_result < 0) return stop_result;
+    }
+
     // Since we are setting the cursor position, we don't need to worry about
     // any cached input bytes causing a desync of file offset with user offset.
     InTundra_IBuff_clear(&file->ibuff);
@@ -450,12 +1199,25 @@ i64 Tundra_File_set_cursor(Tundra_File *file, u64 position)
 
     file->cursor_pos = result;
 
+    if(prefetch_slots != 0)
+    {
+        const i64 START_RESULT = InTundra_IBuff_start_prefetch(&file->ibuff,
+            prefetch_slots, (u64)result);
+
+        if(START_RESULT < 0) return START_RESULT;
+    }
+
     return result;
 }
 
 i64 Tundra_File_move_cursor(Tundra_File *file, i64 offset)
 {
-    // Unlike setting the cursor (above), we do need to worry about cached 
+    // Read-ahead is positional, so a seek restarts it at the target below;
+    // reset_input_buff stops the thread as part of its seek-back.
+    const u64 PREFETCH_SLOTS = (file->ibuff.prefetcher != NULL) ?
+        file->ibuff.prefetcher->num_slots : 0;
+
+    // Unlike setting the cursor (above), we do need to worry about cached
     // input bytes that would mistakenly put our file cursor ahead of where the
     // user thinks it is.
     i64 result = reset_input_buff(file);
@@ -463,7 +1225,7 @@ i64 Tundra_File_move_cursor(Tundra_File *file, i64 offset)
 
     result = reset_output_buff(file);
     if(result < 0) return result;
-    
+
     result = InTundra_syscall(
         TUNDRA_LINUX_SYSCALL_LSEEK,
         file->handle,
@@ -475,6 +1237,14 @@ i64 Tundra_File_move_cursor(Tundra_File *file, i64 offset)
 
     file->cursor_pos = result;
 
+    if(PREFETCH_SLOTS != 0)
+    {
+        const i64 START_RESULT = InTundra_IBuff_start_prefetch(&file->ibuff,
+            PREFETCH_SLOTS, (u64)result);
+
+        if(START_RESULT < 0) return START_RESULT;
+    }
+
     return result;
 }
 
@@ -482,8 +1252,19 @@ i64 Tundra_File_close(Tundra_File *file)
 {
     if(file == NULL) return -TUNDRA_ERR_BADADDR;
 
+    // The fill thread must be gone before its handle closes underneath it.
+    InTundra_IBuff_stop_prefetch(&file->ibuff);
+
     InTundra_OBuff_flush(&file->obuff);
 
+    // Direct-mode flushes write in whole blocks; trim the zero pad off the
+    // final partial block so the file ends at its true byte size.
+    if(file->obuff.direct_mode)
+    {
+        InTundra_syscall(TUNDRA_LINUX_SYSCALL_FTRUNCATE, file->handle,
+            (i64)file->obuff.direct_tot_bytes, 0, 0, 0, 0);
+    }
+
     i64 close_result = close_file_helper(file->handle);
 
     if(close_result < 0) return close_result;
@@ -492,8 +1273,15 @@ i64 Tundra_File_close(Tundra_File *file)
     file->file_byte_size = 0;
     file->cursor_pos = 0;
 
-    InTundra_IBuff_free(&file->ibuff);
-    InTundra_OBuff_free(&file->obuff);
+    if(file->buffs_pooled)
+    {
+        pool_release(file);
+    }
+    else
+    {
+        InTundra_IBuff_free(&file->ibuff);
+        InTundra_OBuff_free(&file->obuff);
+    }
 
     return 0;
 }
@@ -504,3 +1292,128 @@ u64 Tundra_File_get_size(const Tundra_File *file)
 
     return (u64)file->file_byte_size;
 }
+
+i64 Tundra_File_set_prefetch(Tundra_File *file, u64 num_buffers)
+{
+    if(file == NULL) return -TUNDRA_ERR_BADADDR;
+
+    if(num_buffers == 0) return InTundra_IBuff_stop_prefetch(&file->ibuff);
+
+    // Direct mode bypasses the buffered io paths read-ahead hooks into.
+    if(file->obuff.direct_mode) return -TUNDRA_ERR_INVARG;
+
+    // Reconfigure by restarting.
+    if(file->ibuff.prefetcher != NULL)
+    {
+        const i64 STOP_RESULT = InTundra_IBuff_stop_prefetch(&file->ibuff);
+
+        if(STOP_RESULT < 0) return STOP_RESULT;
+    }
+
+    // Flush so buffered writes land before read-ahead passes over them.
+    i64 result = InTundra_OBuff_flush(&file->obuff);
+    if(result < 0) return result;
+
+    // Bytes already buffered keep being consumed first; read-ahead starts
+    // at the handle's cursor, where the next synchronous refill would read.
+    result = get_cursor_pos_in_file(file);
+    if(result < 0) return result;
+
+    return InTundra_IBuff_start_prefetch(&file->ibuff, num_buffers,
+        (u64)result);
+}
+
+i64 Tundra_File_advise(Tundra_File *file, u64 offset, u64 num_bytes,
+    Tundra_FileAdvice advice)
+{
+    if(file == NULL) return -TUNDRA_ERR_BADADDR;
+
+    if(advice < TUNDRA_FILE_ADVICE_NORMAL ||
+        advice > TUNDRA_FILE_ADVICE_DONTNEED)
+    {
+        return -TUNDRA_ERR_INVARG;
+    }
+
+    return InTundra_raw_fadvise(file->handle, (i64)offset, (i64)num_bytes,
+        advice);
+}
+
+i64 Tundra_File_sync(Tundra_File *file)
+{
+    if(file == NULL) return -TUNDRA_ERR_BADADDR;
+
+    i64 result = InTundra_OBuff_flush(&file->obuff);
+
+    if(result < 0) return result;
+
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_FDATASYNC, file->handle,
+        0, 0, 0, 0, 0);
+}
+
+i64 Tundra_File_set_flush_policy(Tundra_File *file,
+    Tundra_FileFlushPolicy policy, u64 byte_threshold)
+{
+    if(file == NULL) return -TUNDRA_ERR_BADADDR;
+
+    if(policy != TUNDRA_FILE_FLUSH_POLICY_MANUAL &&
+        policy != TUNDRA_FILE_FLUSH_POLICY_EVERY_WRITE &&
+        policy != TUNDRA_FILE_FLUSH_POLICY_BYTE_THRESHOLD &&
+        policy != TUNDRA_FILE_FLUSH_POLICY_ADAPTIVE)
+    {
+        return -TUNDRA_ERR_INVARG;
+    }
+
+    if(policy == TUNDRA_FILE_FLUSH_POLICY_BYTE_THRESHOLD &&
+        byte_threshold == 0)
+    {
+        return -TUNDRA_ERR_INVARG;
+    }
+
+    if(policy == TUNDRA_FILE_FLUSH_POLICY_ADAPTIVE)
+    {
+        file->flush_policy = policy;
+
+        file->adaptive_target_ns = (byte_threshold == 0 ?
+            TUNDRA_FILE_ADAPTIVE_TARGET_DEF_US : byte_threshold) * 1000ULL;
+
+        // Start at full batches and let the measurements shrink them; a
+        // fast device never pays for a conservative guess.
+        file->flush_threshold_bytes = file->obuff.capacity;
+        file->adaptive_window_flushes = 0;
+        file->adaptive_window_cycles = 0;
+        file->adaptive_window_bytes = 0;
+
+        return 0;
+    }
+
+    file->flush_policy = policy;
+    file->flush_threshold_bytes = byte_threshold;
+
+    return 0;
+}
+
+i64 Tundra_File_get_info(Tundra_File *file, Tundra_FileInfo *info_output)
+{
+    if(file == NULL || info_output == NULL) return -TUNDRA_ERR_BADADDR;
+
+    // Flush so the reported size covers buffered output.
+    i64 result = InTundra_OBuff_flush(&file->obuff);
+
+    if(result < 0) return result;
+
+    LinuxStat stat;
+
+    result = fstat_helper(file->handle, &stat);
+
+    if(result < 0) return result;
+
+    info_output->byte_size = (u64)stat.st_size;
+    info_output->num_blocks = (u64)stat.st_blocks;
+    info_output->mod_time_sec = stat.st_mtime_sec;
+    info_output->mod_time_nsec = stat.st_mtime_nsec;
+
+    // Refresh the cached size, the kernel's answer is authoritative.
+    file->file_byte_size = stat.st_size;
+
+    return 0;
+}
@@ -10,6 +10,7 @@
  */
 
 #include "tundra/common/Hash.h"
+#include "tundra/utils/MemUtils.h"
 
 u64 Tundra_hash_u64(u64 i)
 {
@@ -32,3 +33,202 @@ HASH_IMPL(u16)
 HASH_IMPL(i16)
 HASH_IMPL(u8)
 HASH_IMPL(i8)
+
+// wyhash-class mixing constants; arbitrary odd 64 bit values with good bit
+// dispersion.
+#define HASH_SECRET_0 0xA0761D6478BD642FULL
+#define HASH_SECRET_1 0xE7037ED1A0B428DBULL
+#define HASH_SECRET_2 0x8EBC6AF09C88C6E3ULL
+#define HASH_SECRET_3 0x589965CC75374CC3ULL
+
+/**
+ * @brief Folds the 128 bit product of `a` and `b` into 64 bits.
+ *
+ * @param a First factor.
+ * @param b Second factor.
+ *
+ * @return u64 Low xor high half of the product.
+ */
+static u64 mix(u64 a, u64 b)
+{
+    const unsigned __int128 PRODUCT = (unsigned __int128)a * b;
+
+    return (u64)PRODUCT ^ (u64)(PRODUCT >> 64);
+}
+
+/**
+ * @brief Reads an unaligned u64 from `bytes`.
+ *
+ * @param bytes Bytes to read from.
+ *
+ * @return u64 Value read.
+ */
+static u64 read_u64(const u8 *bytes)
+{
+    return *(const u64*)bytes;
+}
+
+/**
+ * @brief Reads an unaligned u32 from `bytes`.
+ *
+ * @param bytes Bytes to read from.
+ *
+ * @return u64 Value read, zero extended.
+ */
+static u64 read_u32(const u8 *bytes)
+{
+    return (u64)*(const u32*)bytes;
+}
+
+u64 Tundra_hash_bytes_seeded(const void *mem, u64 num_bytes, u64 seed)
+{
+    const u8 *bytes = (const u8*)mem;
+
+    seed ^= mix(seed ^ HASH_SECRET_0, HASH_SECRET_1);
+
+    u64 a;
+    u64 b;
+
+    if(num_bytes <= 16)
+    {
+        if(num_bytes >= 4)
+        {
+            // Two possibly-overlapping u32 pairs cover the whole input with
+            // no per-byte loop.
+            a = (read_u32(bytes) << 32) |
+                read_u32(bytes + ((num_bytes >> 3) << 2));
+            b = (read_u32(bytes + num_bytes - 4) << 32) |
+                read_u32(bytes + num_bytes - 4 - ((num_bytes >> 3) << 2));
+        }
+
+        else if(num_bytes > 0)
+        {
+            a = ((u64)bytes[0] << 16) |
+                ((u64)bytes[num_bytes >> 1] << 8) | bytes[num_bytes - 1];
+            b = 0;
+        }
+
+        else
+        {
+            a = 0;
+            b = 0;
+        }
+    }
+
+    else
+    {
+        u64 remaining = num_bytes;
+
+        // Three independent 48 byte stripes keep the multiply lanes busy on
+        // long inputs.
+        if(remaining >= 48)
+        {
+            u64 see1 = seed;
+            u64 see2 = seed;
+
+            do
+            {
+                seed = mix(read_u64(bytes) ^ HASH_SECRET_1,
+                    read_u64(bytes + 8) ^ seed);
+                see1 = mix(read_u64(bytes + 16) ^ HASH_SECRET_2,
+                    read_u64(bytes + 24) ^ see1);
+                see2 = mix(read_u64(bytes + 32) ^ HASH_SECRET_3,
+                    read_u64(bytes + 40) ^ see2);
+
+                bytes += 48;
+                remaining -= 48;
+            }
+            while(remaining >= 48);
+
+            seed ^= see1 ^ see2;
+        }
+
+        while(remaining > 16)
+        {
+            seed = mix(read_u64(bytes) ^ HASH_SECRET_1,
+                read_u64(bytes + 8) ^ seed);
+
+            remaining -= 16;
+            bytes += 16;
+        }
+
+        // Final 16 bytes, overlapping the previous stripe when the input is
+        // not a multiple of 16.
+        a = read_u64(bytes + remaining - 16);
+        b = read_u64(bytes + remaining - 8);
+    }
+
+    a ^= HASH_SECRET_1;
+    b ^= seed;
+
+    const unsigned __int128 PRODUCT = (unsigned __int128)a * b;
+
+    a = (u64)PRODUCT;
+    b = (u64)(PRODUCT >> 64);
+
+    return mix(a ^ HASH_SECRET_0 ^ num_bytes, b ^ HASH_SECRET_1);
+}
+
+u64 Tundra_hash_bytes(const void *mem, u64 num_bytes)
+{
+    return Tundra_hash_bytes_seeded(mem, num_bytes, 0);
+}
+
+u64 Tundra_hash_cstr(const char *cstr)
+{
+    return Tundra_hash_bytes(cstr, Tundra_get_cstr_len(cstr));
+}
+
+void Tundra_hash_u64_batch(const u64 *keys, u64 *hashes_out, u64 num_keys)
+{
+    u64 pos = 0;
+
+    // Four independent mix chains per iteration; each chain is the same
+    // sequence as Tundra_hash_u64 but the chains have no dependencies on
+    // each other, so the multiplies pipeline.
+    while(pos + 4 <= num_keys)
+    {
+        u64 h0 = keys[pos];
+        u64 h1 = keys[pos + 1];
+        u64 h2 = keys[pos + 2];
+        u64 h3 = keys[pos + 3];
+
+        h0 ^= h0 >> 33;
+        h1 ^= h1 >> 33;
+        h2 ^= h2 >> 33;
+        h3 ^= h3 >> 33;
+
+        h0 *= 0xff51afd7ed558ccdULL;
+        h1 *= 0xff51afd7ed558ccdULL;
+        h2 *= 0xff51afd7ed558ccdULL;
+        h3 *= 0xff51afd7ed558ccdULL;
+
+        h0 ^= h0 >> 33;
+        h1 ^= h1 >> 33;
+        h2 ^= h2 >> 33;
+        h3 ^= h3 >> 33;
+
+        h0 *= 0xc4ceb9fe1a85ec53ULL;
+        h1 *= 0xc4ceb9fe1a85ec53ULL;
+        h2 *= 0xc4ceb9fe1a85ec53ULL;
+        h3 *= 0xc4ceb9fe1a85ec53ULL;
+
+        h0 ^= h0 >> 33;
+        h1 ^= h1 >> 33;
+        h2 ^= h2 >> 33;
+        h3 ^= h3 >> 33;
+
+        hashes_out[pos] = h0;
+        hashes_out[pos + 1] = h1;
+        hashes_out[pos + 2] = h2;
+        hashes_out[pos + 3] = h3;
+
+        pos += 4;
+    }
+
+    // Scalar tail.
+    for(; pos < num_keys; ++pos)
+    {
+        hashes_out[pos] = Tundra_hash_u64(keys[pos]);
+    }
+}
@@ -11,68 +11,552 @@
 
 #include "tundra/internal/IOBuffer.h"
 #include "tundra/common/Core.h"
+#include "tundra/common/Atomics.h"
+#include "tundra/common/BitUtils.h"
+#include "tundra/common/ErrorDef.h"
+#include "tundra/internal/Syscall.h"
 #include "tundra/utils/StringConversion.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/MemUtils.h"
+#include "tundra/utils/Stats.h"
+#include "tundra/utils/Trace.h"
 
 
-#define DEF_BUFF_SIZE 128U
+TUNDRA_CT_ASSERT(TUNDRA_IS_POW2(TUNDRA_IOBUFF_DEF_CAPACITY));
 
-TUNDRA_CT_ASSERT(TUNDRA_IS_POW2(DEF_BUFF_SIZE));
+/**
+ * @brief Returns the number of buffered bytes that have not been consumed.
+ *
+ * @param buff Buffer to query.
+ *
+ * @return u64 Number of unread buffered bytes.
+ */
+static u64 num_buffered(const InTundra_InputBuffer *buff)
+{
+    return buff->end_pos - buff->read_pos;
+}
 
-void InTundra_IBuff_init(InTundra_InputBuffer *buff, InTundra_IOHandle handle)
+void InTundra_IBuff_init(InTundra_InputBuffer *buff, InTundra_IOHandle handle,
+    u64 capacity)
 {
+    TUNDRA_RT_ASSERT(capacity != 0, "Input buffer capacity cannot be 0.\n");
+
     buff->handle = handle;
-    Tundra_DynStkU8_init(&buff->data);
+    buff->data = (u8*)Tundra_alloc_mem(capacity);
+    buff->capacity = capacity;
+    buff->read_pos = 0;
+    buff->end_pos = 0;
+    buff->prefetcher = NULL;
 }
 
-void InTundra_OBuff_init(InTundra_OutputBuffer *buff, 
-    InTundra_IOHandle handle)
+void InTundra_OBuff_init(InTundra_OutputBuffer *buff,
+    InTundra_IOHandle handle, u64 capacity)
 {
+    TUNDRA_RT_ASSERT(capacity != 0, "Output buffer capacity cannot be 0.\n");
+
     buff->handle = handle;
-    Tundra_DynArrU8_init(&buff->data);
+    buff->capacity = capacity;
+    buff->async_mode = false;
+    buff->direct_mode = false;
+    buff->filter = NULL;
+    buff->filter_user_data = NULL;
+    Tundra_DynArrU8_init_cap(&buff->data, capacity);
+}
+
+void InTundra_OBuff_init_direct(InTundra_OutputBuffer *buff,
+    InTundra_IOHandle handle, u64 capacity)
+{
+    TUNDRA_RT_ASSERT(capacity != 0, "Output buffer capacity cannot be 0.\n");
+
+    // Round the capacity up to whole blocks so a full flush is always an
+    // aligned length.
+    capacity = (capacity + TUNDRA_IOBUFF_DIRECT_BLOCK_BYTES - 1) &
+        ~((u64)TUNDRA_IOBUFF_DIRECT_BLOCK_BYTES - 1);
+
+    buff->handle = handle;
+    buff->capacity = capacity;
+    buff->async_mode = false;
+    buff->direct_mode = true;
+    buff->direct_data = (u8*)Tundra_alloc_mem_aligned(capacity,
+        TUNDRA_IOBUFF_DIRECT_BLOCK_BYTES);
+    buff->direct_size = 0;
+    buff->direct_carry = 0;
+    buff->direct_tot_bytes = 0;
+    buff->filter = NULL;
+    buff->filter_user_data = NULL;
 }
 
 void InTundra_IBuff_free(InTundra_InputBuffer *buff)
 {
+    InTundra_IBuff_stop_prefetch(buff);
+
     buff->handle = TUNDRA_IOHANDLE_INVALID;
-    Tundra_DynStkU8_free(&buff->data);
+    Tundra_free_mem(buff->data);
+    buff->data = NULL;
+    buff->capacity = 0;
+    buff->read_pos = 0;
+    buff->end_pos = 0;
 }
 
 void InTundra_OBuff_free(InTundra_OutputBuffer *buff)
 {
     buff->handle = TUNDRA_IOHANDLE_INVALID;
+
+    if(buff->direct_mode)
+    {
+        Tundra_free_mem(buff->direct_data);
+        buff->direct_data = NULL;
+        buff->direct_mode = false;
+        return;
+    }
+
     Tundra_DynArrU8_free(&buff->data);
+
+    if(buff->async_mode)
+    {
+        Tundra_DynArrU8_free(&buff->pending);
+        buff->async_mode = false;
+    }
+
+    if(buff->filter != NULL)
+    {
+        Tundra_DynArrU8_free(&buff->filter_out);
+        buff->filter = NULL;
+    }
+}
+
+#define FUTEX_WAIT_PRIVATE 128
+#define FUTEX_WAKE_PRIVATE 129
+
+// Wake count for "every waiter".
+#define WAKE_ALL 0x7FFFFFFF
+
+static void futex_wait(u32 *addr, u32 expected)
+{
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_FUTEX, (i64)addr,
+        FUTEX_WAIT_PRIVATE, (i64)expected, 0, 0, 0);
+}
+
+static void futex_wake(u32 *addr, i64 num_wake)
+{
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_FUTEX, (i64)addr,
+        FUTEX_WAKE_PRIVATE, num_wake, 0, 0, 0);
+}
+
+/**
+ * @brief Body of the prefetch fill thread: reads slots ahead of the
+ * consumer until the end of input, an error, or a stop.
+ *
+ * @param user_data The prefetcher.
+ */
+static void prefetch_fill(void *user_data)
+{
+    InTundra_IBuffPrefetcher *pf = (InTundra_IBuffPrefetcher*)user_data;
+
+    for(;;)
+    {
+        // Wait for a free slot, snapshotting the retire sequence before
+        // re-checking the counters so a wake between the check and the wait
+        // is not lost.
+        for(;;)
+        {
+            const u32 SEQ = Tundra_atm_load_u32(&pf->consumed_seq,
+                TUNDRA_ATM_ACQUIRE);
+
+            if(Tundra_atm_load_u32(&pf->stop, TUNDRA_ATM_ACQUIRE)) return;
+
+            if(pf->tail - Tundra_atm_load_u64(&pf->head,
+                TUNDRA_ATM_ACQUIRE) < pf->num_slots)
+            { break; }
+
+            futex_wait(&pf->consumed_seq, SEQ);
+        }
+
+        const u64 SLOT = pf->tail % pf->num_slots;
+
+        // Positional read, so the handle's cursor stays untouched for the
+        // consumer side.
+        const i64 RESULT = InTundra_raw_pread_bytes(pf->handle,
+            pf->slots + SLOT * pf->slot_capacity, (i64)pf->slot_capacity,
+            (i64)pf->fill_offset);
+
+        pf->slot_results[SLOT] = RESULT;
+
+        if(RESULT > 0) pf->fill_offset += (u64)RESULT;
+
+        Tundra_atm_store_u64(&pf->tail, pf->tail + 1, TUNDRA_ATM_RELEASE);
+        Tundra_atm_fetch_add_u32(&pf->filled_seq, 1, TUNDRA_ATM_RELEASE);
+        futex_wake(&pf->filled_seq, 1);
+
+        // End of input or an error: the slot stays at the ring head as a
+        // sticky result, there is nothing more to read ahead.
+        if(RESULT <= 0) return;
+    }
+}
+
+/**
+ * @brief Serves one refill from the prefetch ring, sleeping only when the
+ * fill thread has not completed a slot yet.
+ *
+ * @param pf Prefetcher to drain.
+ * @param dst Memory to copy into.
+ * @param num_bytes Maximum number of bytes to serve.
+ *
+ * @return i64 Bytes served, 0 at the end of input, negative error.
+ */
+static i64 prefetch_read(InTundra_IBuffPrefetcher *pf, u8 *dst, u64 num_bytes)
+{
+    // Wait for a completed slot.
+    for(;;)
+    {
+        const u32 SEQ = Tundra_atm_load_u32(&pf->filled_seq,
+            TUNDRA_ATM_ACQUIRE);
+
+        if(pf->head != Tundra_atm_load_u64(&pf->tail, TUNDRA_ATM_ACQUIRE))
+        { break; }
+
+        futex_wait(&pf->filled_seq, SEQ);
+    }
+
+    const u64 SLOT = pf->head % pf->num_slots;
+    const i64 RESULT = pf->slot_results[SLOT];
+
+    // Sticky end of input or error, matching a raw read at a file's end.
+    if(RESULT <= 0) return RESULT;
+
+    const u64 AVAIL = (u64)RESULT - pf->head_consumed;
+    const u64 NUM_SERVED = (num_bytes < AVAIL) ? num_bytes : AVAIL;
+
+    Tundra_copy_mem_fwd(
+        pf->slots + SLOT * pf->slot_capacity + pf->head_consumed, dst,
+        NUM_SERVED);
+
+    pf->head_consumed += NUM_SERVED;
+    pf->consume_offset += NUM_SERVED;
+
+    // Retire a drained slot back to the fill thread.
+    if(pf->head_consumed == (u64)RESULT)
+    {
+        pf->head_consumed = 0;
+        Tundra_atm_store_u64(&pf->head, pf->head + 1, TUNDRA_ATM_RELEASE);
+        Tundra_atm_fetch_add_u32(&pf->consumed_seq, 1, TUNDRA_ATM_RELEASE);
+        futex_wake(&pf->consumed_seq, 1);
+    }
+
+    return (i64)NUM_SERVED;
+}
+
+/**
+ * @brief One refill read for an input buffer: drained from the prefetch
+ * ring while prefetching, otherwise a raw read at the handle's cursor.
+ *
+ * @param buff Buffer being refilled.
+ * @param dst Memory to read into.
+ * @param num_bytes Maximum number of bytes to read.
+ *
+ * @return i64 Bytes read, 0 at the end of input, negative error.
+ */
+static i64 refill_read(InTundra_InputBuffer *buff, u8 *dst, u64 num_bytes)
+{
+    if(buff->prefetcher != NULL)
+    { return prefetch_read(buff->prefetcher, dst, num_bytes); }
+
+    return InTundra_raw_read_bytes(buff->handle, dst, (i64)num_bytes);
+}
+
+i64 InTundra_IBuff_start_prefetch(InTundra_InputBuffer *buff, u64 num_slots,
+    u64 fill_offset)
+{
+    if(buff->prefetcher != NULL) return -TUNDRA_ERR_INVARG;
+
+    if(num_slots == 0) num_slots = TUNDRA_IOBUFF_PREFETCH_DEF_BUFFERS;
+
+    // One slot would make every refill wait on the fill thread; two is the
+    // minimum that pipelines.
+    if(num_slots < 2) num_slots = 2;
+
+    InTundra_IBuffPrefetcher *pf = (InTundra_IBuffPrefetcher*)
+        Tundra_alloc_mem(sizeof(InTundra_IBuffPrefetcher));
+
+    pf->handle = buff->handle;
+    pf->slots = (u8*)Tundra_alloc_mem(num_slots * buff->capacity);
+    pf->slot_capacity = buff->capacity;
+    pf->num_slots = num_slots;
+    pf->slot_results = (i64*)Tundra_alloc_mem(num_slots * sizeof(i64));
+    pf->head = 0;
+    pf->tail = 0;
+    pf->head_consumed = 0;
+    pf->fill_offset = fill_offset;
+    pf->consume_offset = fill_offset;
+    pf->filled_seq = 0;
+    pf->consumed_seq = 0;
+    pf->stop = 0;
+
+    if(!Tundra_Thread_spawn(&pf->thread, prefetch_fill, pf))
+    {
+        Tundra_free_mem(pf->slot_results);
+        Tundra_free_mem(pf->slots);
+        Tundra_free_mem(pf);
+        return -TUNDRA_ERR_NOMEM;
+    }
+
+    buff->prefetcher = pf;
+
+    return 0;
+}
+
+i64 InTundra_IBuff_stop_prefetch(InTundra_InputBuffer *buff)
+{
+    InTundra_IBuffPrefetcher *pf = buff->prefetcher;
+
+    if(pf == NULL) return 0;
+
+    Tundra_atm_store_u32(&pf->stop, 1, TUNDRA_ATM_RELEASE);
+    Tundra_atm_fetch_add_u32(&pf->consumed_seq, 1, TUNDRA_ATM_RELEASE);
+    futex_wake(&pf->consumed_seq, WAKE_ALL);
+
+    Tundra_Thread_join(&pf->thread);
+
+    // Unconsumed read-ahead is discarded; put the handle's cursor at the
+    // consumer's position so synchronous refills continue where prefetched
+    // reads left off.
+    const i64 RESULT = InTundra_syscall(TUNDRA_LINUX_SYSCALL_LSEEK,
+        pf->handle, (i64)pf->consume_offset, TUNDRA_LINUX_SEEKBEHAVIOR_SET,
+        0, 0, 0);
+
+    Tundra_free_mem(pf->slot_results);
+    Tundra_free_mem(pf->slots);
+    Tundra_free_mem(pf);
+    buff->prefetcher = NULL;
+
+    return (RESULT < 0) ? RESULT : 0;
+}
+
+/**
+ * @brief Writes the contents of a direct-mode buffer as whole blocks.
+ *
+ * A partial final block is zero-padded to a full block, written, then the
+ * handle is seeked back to the block's start and the partial bytes are
+ * re-buffered at the front so the next flush rewrites the block with real
+ * data in place of the pad.
+ *
+ * @param buff Buffer to flush.
+ *
+ * @return i64 Newly flushed payload bytes if non negative, otherwise an
+ * error code.
+ */
+static i64 flush_direct(InTundra_OutputBuffer *buff)
+{
+    if(buff->direct_size == 0) return 0;
+
+    const u64 BLOCK = TUNDRA_IOBUFF_DIRECT_BLOCK_BYTES;
+    const u64 TAIL = buff->direct_size & (BLOCK - 1);
+    const u64 PADDED = (buff->direct_size + BLOCK - 1) & ~(BLOCK - 1);
+
+    if(TAIL != 0)
+    {
+        Tundra_zero_out_mem(buff->direct_data + buff->direct_size,
+            PADDED - buff->direct_size);
+    }
+
+    i64 result = InTundra_raw_write_bytes(buff->handle, buff->direct_data,
+        (i64)PADDED);
+
+    if(result < 0) return result;
+
+    TUNDRA_RT_ASSERT(result == (i64)PADDED,
+        "Failed to write entire OBuffer.\n");
+
+    const i64 NEW_BYTES = (i64)(buff->direct_size - buff->direct_carry);
+
+    if(TAIL != 0)
+    {
+        // Step the handle back over the padded block so the next flush
+        // rewrites it.
+        result = InTundra_syscall(TUNDRA_LINUX_SYSCALL_LSEEK, buff->handle,
+            -(i64)BLOCK, TUNDRA_LINUX_SEEKBEHAVIOR_CUR, 0, 0, 0);
+
+        if(result < 0) return result;
+
+        Tundra_copy_mem_fwd(buff->direct_data + PADDED - BLOCK,
+            buff->direct_data, TAIL);
+
+        buff->direct_size = TAIL;
+        buff->direct_carry = TAIL;
+
+        return NEW_BYTES;
+    }
+
+    buff->direct_size = 0;
+    buff->direct_carry = 0;
+
+    return NEW_BYTES;
+}
+
+/**
+ * @brief Appends bytes to a direct-mode buffer, flushing whole aligned
+ * blocks as it fills.
+ *
+ * The payload always passes through the aligned buffer; user memory cannot
+ * be handed to an O_DIRECT write.
+ *
+ * @param buff Buffer to write to.
+ * @param bytes Bytes to write.
+ * @param num_bytes Number of bytes to write.
+ *
+ * @return i64 `num_bytes` if non negative, otherwise an error code.
+ */
+static i64 write_bytes_direct(InTundra_OutputBuffer *buff, const u8 *bytes,
+    u64 num_bytes)
+{
+    u64 remaining = num_bytes;
+
+    while(remaining != 0)
+    {
+        const u64 SPACE = buff->capacity - buff->direct_size;
+        const u64 CHUNK = (remaining < SPACE) ? remaining : SPACE;
+
+        Tundra_copy_mem_fwd(bytes, buff->direct_data + buff->direct_size,
+            CHUNK);
+
+        buff->direct_size += CHUNK;
+        bytes += CHUNK;
+        remaining -= CHUNK;
+
+        if(buff->direct_size == buff->capacity)
+        {
+            i64 result = flush_direct(buff);
+
+            if(result < 0) return result;
+        }
+    }
+
+    buff->direct_tot_bytes += num_bytes;
+
+    return (i64)num_bytes;
+}
+
+/**
+ * @brief Writes a batch of payload bytes to the handle through the buffer's
+ * filter stage.
+ *
+ * The batch is transformed into the filter scratch and the transformed bytes
+ * are written in its place. Only call with a filter set.
+ *
+ * @param buff Buffer whose filter and handle to write through.
+ * @param bytes Payload bytes to write.
+ * @param num_bytes Number of payload bytes.
+ *
+ * @return i64 `num_bytes` on success, so callers keep accounting in payload
+ * bytes rather than transformed bytes, otherwise an error code.
+ */
+static i64 write_through_filter(InTundra_OutputBuffer *buff, const u8 *bytes,
+    u64 num_bytes)
+{
+    if(num_bytes == 0) return 0;
+
+    Tundra_DynArrU8_clear(&buff->filter_out);
+
+    i64 result = buff->filter(bytes, num_bytes, &buff->filter_out,
+        buff->filter_user_data);
+
+    if(result < 0) return result;
+
+    const u64 OUT_SIZE = Tundra_DynArrU8_size(&buff->filter_out);
+
+    result = InTundra_raw_write_bytes(buff->handle,
+        Tundra_DynArrU8_data(&buff->filter_out), (i64)OUT_SIZE);
+
+    if(result < 0) return result;
+
+    TUNDRA_RT_ASSERT(result == (i64)OUT_SIZE,
+        "Failed to write entire OBuffer.\n");
+
+    return (i64)num_bytes;
 }
 
 i64 InTundra_OBuff_write_bytes(InTundra_OutputBuffer *buff, const u8 *bytes,
     u64 num_bytes)
 {
+    if(buff->direct_mode) return write_bytes_direct(buff, bytes, num_bytes);
+
     const u64 buff_size = Tundra_DynArrU8_size(&buff->data);
 
     // Number of bytes to write is larger than the entire buffer, don't even
-    // bother with the buffer.
-    if(num_bytes > DEF_BUFF_SIZE)
+    // bother with the buffer. The buffered tail and the payload go out as one
+    // vectored write rather than a flush syscall followed by a raw write.
+    if(num_bytes > buff->capacity)
     {
-        // Flush whatever is in the buffer.
-        i64 flush_result = InTundra_OBuff_flush(buff);
+        // Retired bytes are older than everything here and must go out first.
+        i64 pending_result = InTundra_OBuff_drain_pending(buff);
+
+        if(pending_result < 0) return pending_result;
+
+        // A filter has to see every payload byte, so the writev bypass is
+        // replaced by flushing the buffered tail and filtering the payload
+        // as its own batch.
+        if(buff->filter != NULL)
+        {
+            i64 flush_result = InTundra_OBuff_flush(buff);
+
+            if(flush_result < 0) return flush_result;
 
-        if(flush_result < 0) return flush_result;
+            i64 filter_result = write_through_filter(buff, bytes, num_bytes);
 
-        i64 write_result = 
-            InTundra_raw_write_bytes(buff->handle, bytes, (i64)num_bytes);
+            if(filter_result < 0) return filter_result;
+
+            return flush_result + filter_result;
+        }
+
+        Tundra_IOVec vecs[2];
+        vecs[0].bytes = Tundra_DynArrU8_data(&buff->data);
+        vecs[0].num_bytes = buff_size;
+        vecs[1].bytes = bytes;
+        vecs[1].num_bytes = num_bytes;
+
+        // Skip the leading segment when nothing is buffered.
+        const u64 FIRST_VEC = (buff_size == 0);
+
+        i64 write_result = InTundra_raw_writev(buff->handle, vecs + FIRST_VEC,
+            (i64)(2 - FIRST_VEC));
 
         if(write_result < 0) return write_result;
 
-        return flush_result + write_result;
+        TUNDRA_RT_ASSERT(write_result == (i64)(buff_size + num_bytes),
+            "Failed to write entire OBuffer.\n");
+
+        Tundra_DynArrU8_clear(&buff->data);
+
+        return write_result;
     }
 
     i64 bytes_written = 0;
 
     // The buffer would overflow from this write.
-    if(DEF_BUFF_SIZE - buff_size < num_bytes)
+    if(buff->capacity - buff_size < num_bytes)
     {
-        i64 result = InTundra_OBuff_flush(buff);
+        i64 result;
 
-        if(result < 0) return result;
+        if(buff->async_mode)
+        {
+            // Retire the filled buffer into the pending slot and keep
+            // appending into a fresh one; the write syscall happens off this
+            // path in drain_pending. A still-undrained retirement has to go
+            // out now to make room.
+            result = InTundra_OBuff_drain_pending(buff);
+
+            if(result < 0) return result;
+
+            const Tundra_DynamicArrayU8 RETIRED = buff->data;
+            buff->data = buff->pending;
+            buff->pending = RETIRED;
+        }
+        else
+        {
+            result = InTundra_OBuff_flush(buff);
+
+            if(result < 0) return result;
+        }
 
         bytes_written += result;
     }
@@ -87,84 +571,93 @@ i64 InTundra_OBuff_write_char(InTundra_OutputBuffer *buff, char c)
     return InTundra_OBuff_write_bytes(buff, (const u8*)&c, 1);
 }
 
-#define WRITE_NUM_IMPL(type, arr_size) \
+// The hot path formats straight into the buffer tail after one headroom
+// check, skipping both the stack bounce and the capacity branching of
+// write_bytes. The over-reservation of `max_chars` + 1 covers the worst
+// case digits plus the terminator the conversion writes past them, and the
+// resize afterwards trims back to the digits actually produced (a shrink,
+// so just a count store). Direct-mode and nearly-full buffers fall back to
+// the general path.
+#define WRITE_NUM_IMPL(type, max_chars) \
 i64 InTundra_OBuff_write_##type(InTundra_OutputBuffer *buff, type num) { \
-    char in_buffer[arr_size]; \
+    if(!buff->direct_mode) \
+    { \
+        const u64 SIZE = Tundra_DynArrU8_size(&buff->data); \
+        if(buff->capacity - SIZE > (max_chars)) \
+        { \
+            char *tail = (char*)Tundra_DynArrU8_add_mult_uninit( \
+                &buff->data, (max_chars) + 1); \
+            const u64 LEN = Tundra_##type##_to_cstr_buf(num, tail); \
+            Tundra_DynArrU8_resize(&buff->data, SIZE + LEN); \
+            return (i64)LEN; \
+        } \
+    } \
+    char in_buffer[(max_chars) + 1]; \
     u64 converted_len = Tundra_##type##_to_cstr_buf(num, in_buffer); \
     return InTundra_OBuff_write_bytes(buff, (const u8*)in_buffer, \
     converted_len); }
 
-WRITE_NUM_IMPL(u64, TUNDRA_MAX_CHARS_TO_REPRESENT_U64 + 1)
-WRITE_NUM_IMPL(i64, TUNDRA_MAX_CHARS_TO_REPRESENT_I64 + 1)
-WRITE_NUM_IMPL(u32, TUNDRA_MAX_CHARS_TO_REPRESENT_U32 + 1)
-WRITE_NUM_IMPL(int, TUNDRA_MAX_CHARS_TO_REPRESENT_I32 + 1)
-WRITE_NUM_IMPL(u16, TUNDRA_MAX_CHARS_TO_REPRESENT_U16 + 1)
-WRITE_NUM_IMPL(i16, TUNDRA_MAX_CHARS_TO_REPRESENT_I16 + 1)
-WRITE_NUM_IMPL(u8, TUNDRA_MAX_CHARS_TO_REPRESENT_U8 + 1)
-WRITE_NUM_IMPL(i8, TUNDRA_MAX_CHARS_TO_REPRESENT_I8 + 1)
-WRITE_NUM_IMPL(float, TUNDRA_MAX_CHARS_TO_REPRESENT_FLOAT + 1)
-
-void InTundra_IBuff_readin_bytes(InTundra_InputBuffer *buff, u8 *bytes, 
+WRITE_NUM_IMPL(u64, TUNDRA_MAX_CHARS_TO_REPRESENT_U64)
+WRITE_NUM_IMPL(i64, TUNDRA_MAX_CHARS_TO_REPRESENT_I64)
+WRITE_NUM_IMPL(u32, TUNDRA_MAX_CHARS_TO_REPRESENT_U32)
+WRITE_NUM_IMPL(int, TUNDRA_MAX_CHARS_TO_REPRESENT_I32)
+WRITE_NUM_IMPL(u16, TUNDRA_MAX_CHARS_TO_REPRESENT_U16)
+WRITE_NUM_IMPL(i16, TUNDRA_MAX_CHARS_TO_REPRESENT_I16)
+WRITE_NUM_IMPL(u8, TUNDRA_MAX_CHARS_TO_REPRESENT_U8)
+WRITE_NUM_IMPL(i8, TUNDRA_MAX_CHARS_TO_REPRESENT_I8)
+WRITE_NUM_IMPL(float, TUNDRA_MAX_CHARS_TO_REPRESENT_FLOAT)
+
+void InTundra_IBuff_readin_bytes(InTundra_InputBuffer *buff, u8 *bytes,
     u64 num_bytes, i64 *read_result_output)
 {
     TUNDRA_RT_ASSERT(bytes != NULL, "Output buffer cannot be NULL.\n");
 
-    const u64 init_buff_size = Tundra_DynStkU8_size(&buff->data);
+    const u64 INIT_BUFFERED = num_buffered(buff);
 
-    u64 output_idx = 0;
-
-    // If we have enough buffered input to satisfy the request.
-    if(num_bytes <= init_buff_size)
+    // If we have enough buffered input to satisfy the request, draining is
+    // one copy and a cursor bump.
+    if(num_bytes <= INIT_BUFFERED)
     {
-        for(u64 i = 0; i < num_bytes; ++i)
-        {
-            bytes[output_idx++] = *Tundra_DynStkU8_top(&buff->data);
-            Tundra_DynStkU8_pop(&buff->data);
-        }
+        Tundra_copy_mem_fwd(buff->data + buff->read_pos, bytes, num_bytes);
+        buff->read_pos += num_bytes;
 
         if(read_result_output != NULL) *read_result_output = (i64)num_bytes;
 
         return;
     }
 
-    // We don't have enough input in the buffer. First read whatever is in 
-    // the buffer.
-    
-    for(u64 i = 0; i < init_buff_size; ++i)
-    {
-        bytes[output_idx++] = *Tundra_DynStkU8_top(&buff->data);
-        Tundra_DynStkU8_pop(&buff->data);
-    }
+    // We don't have enough input in the buffer. First drain whatever is
+    // buffered.
+    Tundra_copy_mem_fwd(buff->data + buff->read_pos, bytes, INIT_BUFFERED);
+    bytes += INIT_BUFFERED;
 
-    // Increment the pointer of bytes since we've added some data to the 
-    // output.
-    bytes += output_idx;
+    buff->read_pos = 0;
+    buff->end_pos = 0;
 
-    u64 remaining_bytes_needed = num_bytes - init_buff_size;
+    u64 remaining_bytes_needed = num_bytes - INIT_BUFFERED;
 
-    // Don't even bother going through the buffer. 
-    if(remaining_bytes_needed > DEF_BUFF_SIZE)
+    // Don't even bother going through the buffer.
+    if(remaining_bytes_needed > buff->capacity)
     {
-        i64 result = InTundra_raw_read_bytes(buff->handle, bytes, 
-            (i64)remaining_bytes_needed);
+        i64 result = refill_read(buff, bytes, remaining_bytes_needed);
 
         if(result < 0)
         {
             if(read_result_output != NULL) *read_result_output = result;
             return;
-        }   
+        }
 
         // Return the raw read in bytes plus the number of bytes we already
         // read from the initially filled buffer.
 
-        if(read_result_output != NULL) 
-            *read_result_output = result + (i64)init_buff_size;
+        if(read_result_output != NULL)
+            *read_result_output = result + (i64)INIT_BUFFERED;
         return;
     }
-    u8 raw_buff[DEF_BUFF_SIZE];
 
-    i64 result = InTundra_raw_read_bytes(buff->handle, raw_buff, 
-        DEF_BUFF_SIZE);
+    // Refill the buffer with one read, then serve the remainder straight
+    // from its front.
+    i64 result = refill_read(buff, buff->data, buff->capacity);
 
     if(result < 0)
     {
@@ -175,46 +668,159 @@ void InTundra_IBuff_readin_bytes(InTundra_InputBuffer *buff, u8 *bytes,
         return;
     }
 
-    // We read in more bytes than we needed.
-    if((u64)result > remaining_bytes_needed)
-    {  
-        // First get whatever bytes we need.
-        Tundra_copy_mem_fwd(raw_buff, bytes, remaining_bytes_needed);
+    const u64 NUM_SERVED = ((u64)result < remaining_bytes_needed) ?
+        (u64)result : remaining_bytes_needed;
+
+    Tundra_copy_mem_fwd(buff->data, bytes, NUM_SERVED);
+
+    // Whatever the raw read delivered past the request stays buffered.
+    buff->read_pos = NUM_SERVED;
+    buff->end_pos = (u64)result;
+
+    if(read_result_output != NULL)
+        *read_result_output = (i64)(INIT_BUFFERED + NUM_SERVED);
+}
+
+/**
+ * @brief Returns the index of the first '\n' in `data` over the range
+ * [start, end), or `end` if the range holds none.
+ *
+ * Scans 8 bytes per iteration: a xor against a broadcast '\n' zeroes exactly
+ * the matching byte, and the usual SWAR zero-byte test flags it.
+ *
+ * @param data Bytes to scan.
+ * @param start Index to begin scanning at.
+ * @param end One past the last index to scan.
+ *
+ * @return u64 Index of the first newline, or `end` if there is none.
+ */
+static u64 find_newline(const u8 *data, u64 start, u64 end)
+{
+    const u64 BROADCAST_NL = 0x0A0A0A0A0A0A0A0AULL;
+    const u64 LOW_BITS = 0x0101010101010101ULL;
+    const u64 HIGH_BITS = 0x8080808080808080ULL;
+
+    u64 pos = start;
+
+    while(pos + 8 <= end)
+    {
+        const u64 LANE = *(const u64*)(data + pos) ^ BROADCAST_NL;
+        const u64 FOUND = (LANE - LOW_BITS) & ~LANE & HIGH_BITS;
+
+        if(FOUND != 0)
+            return pos + (Tundra_get_num_trail_zeros(FOUND) >> 3);
+
+        pos += 8;
+    }
+
+    while(pos < end && data[pos] != '\n') ++pos;
+
+    return pos;
+}
+
+/**
+ * @brief Returns the index of the first ' ' or '\n' in `data` over the range
+ * [0, num_bytes), or `num_bytes` if the range holds none.
+ *
+ * Same 8 byte SWAR scan as `find_newline`, with a second lane xored against
+ * a broadcast space.
+ *
+ * @param data Bytes to scan.
+ * @param num_bytes Number of bytes to scan.
+ *
+ * @return u64 Index of the first delimiter, or `num_bytes` if there is none.
+ */
+static u64 find_delim(const u8 *data, u64 num_bytes)
+{
+    const u64 BROADCAST_NL = 0x0A0A0A0A0A0A0A0AULL;
+    const u64 BROADCAST_SP = 0x2020202020202020ULL;
+    const u64 LOW_BITS = 0x0101010101010101ULL;
+    const u64 HIGH_BITS = 0x8080808080808080ULL;
+
+    u64 pos = 0;
+
+    while(pos + 8 <= num_bytes)
+    {
+        const u64 NL_LANE = *(const u64*)(data + pos) ^ BROADCAST_NL;
+        const u64 SP_LANE = *(const u64*)(data + pos) ^ BROADCAST_SP;
+
+        const u64 FOUND = ((NL_LANE - LOW_BITS) & ~NL_LANE & HIGH_BITS) |
+            ((SP_LANE - LOW_BITS) & ~SP_LANE & HIGH_BITS);
+
+        if(FOUND != 0)
+            return pos + (Tundra_get_num_trail_zeros(FOUND) >> 3);
+
+        pos += 8;
+    }
+
+    while(pos < num_bytes && data[pos] != '\n' && data[pos] != ' ') ++pos;
 
-        // Add the rest to the buffer.
-        const u64 num_extra_bytes = (u64)result - remaining_bytes_needed;
+    return pos;
+}
 
-        u8 *extra_bytes = raw_buff + remaining_bytes_needed;
+i64 InTundra_IBuff_readin_line(InTundra_InputBuffer *buff,
+    Tundra_StringView *view_output)
+{
+    TUNDRA_RT_ASSERT(view_output != NULL, "Output view cannot be NULL.\n");
+
+    for(;;)
+    {
+        const u64 NL_POS = find_newline(buff->data, buff->read_pos,
+            buff->end_pos);
 
-        Tundra_DynStkU8_reserve(&buff->data, num_extra_bytes);
-        
-        u64 extra_bytes_idx = num_extra_bytes - 1;
-        
-        while(true)
+        if(NL_POS < buff->end_pos)
         {
-            Tundra_DynStkU8_push_val(&buff->data, extra_bytes[extra_bytes_idx]);
+            view_output->view = (const char*)(buff->data + buff->read_pos);
+            view_output->num_char = NL_POS - buff->read_pos;
 
-            if(extra_bytes_idx == 0) break;
+            const u64 CONSUMED = NL_POS + 1 - buff->read_pos;
+            buff->read_pos = NL_POS + 1;
 
-            --extra_bytes_idx;
+            return (i64)CONSUMED;
         }
 
-        if(read_result_output != NULL)
-            *read_result_output = (i64)num_bytes;
+        // No newline buffered yet.
+        const u64 PARTIAL = num_buffered(buff);
 
-        return;
-    }
+        // The line fills the whole buffer; a contiguous view into it is
+        // impossible.
+        if(PARTIAL == buff->capacity) return -TUNDRA_ERR_NOMEM;
+
+        // Compact the partial line to the front so the refill extends it
+        // contiguously. This copy only happens when a line straddles a
+        // refill boundary.
+        if(buff->read_pos != 0)
+        {
+            Tundra_copy_mem_fwd(buff->data + buff->read_pos, buff->data,
+                PARTIAL);
+
+            buff->read_pos = 0;
+            buff->end_pos = PARTIAL;
+        }
+
+        i64 result = refill_read(buff, buff->data + buff->end_pos,
+            buff->capacity - buff->end_pos);
+
+        if(result < 0) return result;
+
+        // End of input: the remaining partial bytes form the final line.
+        if(result == 0)
+        {
+            if(PARTIAL == 0) return -1;
 
-    // We did not read enough bytes. Simply just copy whatever we got.
-    else Tundra_copy_mem_fwd(raw_buff, bytes, (u64)result);
+            view_output->view = (const char*)(buff->data + buff->read_pos);
+            view_output->num_char = PARTIAL;
 
-    if(read_result_output != NULL) 
-        *read_result_output = result + (i64)init_buff_size;
+            buff->read_pos = buff->end_pos;
 
-    return;
+            return (i64)PARTIAL;
+        }
+
+        buff->end_pos += (u64)result;
+    }
 }
 
-char InTundra_IBuff_readin_char(InTundra_InputBuffer *buff, 
+char InTundra_IBuff_readin_char(InTundra_InputBuffer *buff,
     i64 *read_result_output)
 {
     char c = 0;
@@ -232,23 +838,37 @@ type InTundra_IBuff_readin_##type(InTundra_InputBuffer *buff, i64 *read_result_o
     u64 buff_idx = 0; \
     while(true) \
     { \
-        const i64 result = InTundra_IBuff_peek(buff); \
-        if(result < 0) \
+        if(num_buffered(buff) == 0) \
         { \
-            if(read_result_output != NULL) *read_result_output = result; \
-            return 0; \
+            const i64 result = refill_read(buff, buff->data, \
+                buff->capacity); \
+            if(result < 0 || (result == 0 && buff_idx == 0)) \
+            { \
+                if(read_result_output != NULL) \
+                    *read_result_output = (result < 0) ? result : -1; \
+                return 0; \
+            } \
+            /* End of input: the pending digits form the final number. */ \
+            if(result == 0) break; \
+            buff->read_pos = 0; \
+            buff->end_pos = (u64)result; \
         } \
-        const char c = (char)result; \
-        if(c == '\n' || c == ' ') break; \
-        if(buff_idx == (BUFF_SIZE)) \
+        /* Grab the whole contiguous digit span in one pass instead of */ \
+        /* peeking and discarding per character. */ \
+        const u8 *SPAN = buff->data + buff->read_pos; \
+        const u64 AVAIL = num_buffered(buff); \
+        const u64 SPAN_LEN = find_delim(SPAN, AVAIL); \
+        if(buff_idx + SPAN_LEN > (BUFF_SIZE)) \
         { \
             TUNDRA_FATAL("Attempted to convert a read in " #type \
                 " with too many digits.\n"); \
             return 0; \
         } \
-        InTundra_IBuff_discard(buff, 1); \
-        buffer[buff_idx] = c; \
-        ++buff_idx; \
+        Tundra_copy_mem_fwd(SPAN, buffer + buff_idx, SPAN_LEN); \
+        buff_idx += SPAN_LEN; \
+        buff->read_pos += SPAN_LEN; \
+        /* The delimiter is buffered; it stays unconsumed as before. */ \
+        if(SPAN_LEN < AVAIL) break; \
     } \
     TUNDRA_RT_ASSERT(buff_idx != 0, "Attempted to convert read in whitespace " \
         "to " #type); \
@@ -319,57 +939,249 @@ float InTundra_IBuff_readin_float(InTundra_InputBuffer *buff,
     return Tundra_str_to_float(buffer);
 }
 
+i64 InTundra_IBuff_readin_u64_array(InTundra_InputBuffer *buff, u64 *output,
+    u64 max_elems, u64 *num_bytes_output)
+{
+    u64 num_parsed = 0;
+    u64 num_bytes = 0;
+
+    u64 value = 0;
+    bool in_number = false;
+
+    while(num_parsed < max_elems)
+    {
+        if(num_buffered(buff) == 0)
+        {
+            const i64 RESULT = refill_read(buff, buff->data,
+                buff->capacity);
+
+            if(RESULT < 0)
+            {
+                if(num_bytes_output != NULL) *num_bytes_output = num_bytes;
+                return RESULT;
+            }
+
+            // End of input: a number pending without a trailing delimiter
+            // is the final element.
+            if(RESULT == 0)
+            {
+                if(in_number) output[num_parsed++] = value;
+                break;
+            }
+
+            buff->read_pos = 0;
+            buff->end_pos = (u64)RESULT;
+        }
+
+        // Accumulate straight out of the buffered span; values straddling
+        // a refill carry across iterations.
+        const u8 *SPAN = buff->data + buff->read_pos;
+        const u64 AVAIL = num_buffered(buff);
+
+        u64 pos = 0;
+
+        while(pos < AVAIL && num_parsed < max_elems)
+        {
+            const u8 C = SPAN[pos];
+
+            if(C >= '0' && C <= '9')
+            {
+                value = value * 10U + (C - '0');
+                in_number = true;
+            }
+            else if(in_number)
+            {
+                output[num_parsed++] = value;
+                value = 0;
+                in_number = false;
+            }
+
+            ++pos;
+        }
+
+        buff->read_pos += pos;
+        num_bytes += pos;
+    }
+
+    if(num_bytes_output != NULL) *num_bytes_output = num_bytes;
+
+    return (i64)num_parsed;
+}
+
 i64 InTundra_OBuff_flush(InTundra_OutputBuffer *buff)
 {
+    TUNDRA_STAT_INCR(OBUFF_FLUSH);
+    TUNDRA_TRACE_SCOPE("obuff_flush");
+
+    if(buff->direct_mode) return flush_direct(buff);
+
+    // Retired bytes are older than the active buffer and must go out first.
+    i64 pending_result = InTundra_OBuff_drain_pending(buff);
+
+    if(pending_result < 0) return pending_result;
+
     const u64 buff_size = Tundra_DynArrU8_size(&buff->data);
 
-    i64 result = InTundra_raw_write_bytes(buff->handle, 
-        Tundra_DynArrU8_data(&buff->data), 
-        (i64)Tundra_DynArrU8_size(&buff->data));
+    i64 result;
 
-    if(result < 0) return result;
+    if(buff->filter != NULL)
+    {
+        result = write_through_filter(buff,
+            Tundra_DynArrU8_data(&buff->data), buff_size);
 
-    TUNDRA_RT_ASSERT(result == (i64)buff_size, 
-        "Failed to write entire OBuffer.\n");
+        if(result < 0) return result;
+    }
+    else
+    {
+        result = InTundra_raw_write_bytes(buff->handle,
+            Tundra_DynArrU8_data(&buff->data),
+            (i64)buff_size);
+
+        if(result < 0) return result;
+
+        TUNDRA_RT_ASSERT(result == (i64)buff_size,
+            "Failed to write entire OBuffer.\n");
+    }
 
     Tundra_DynArrU8_clear(&buff->data);
 
+    return pending_result + result;
+}
+
+i64 InTundra_OBuff_set_async(InTundra_OutputBuffer *buff, bool enable)
+{
+    // Direct mode manages its own flat buffers; the two modes don't combine.
+    if(buff->direct_mode) return -TUNDRA_ERR_INVARG;
+
+    if(buff->async_mode == enable) return 0;
+
+    if(enable)
+    {
+        Tundra_DynArrU8_init_cap(&buff->pending, buff->capacity);
+        buff->async_mode = true;
+        return 0;
+    }
+
+    i64 result = InTundra_OBuff_drain_pending(buff);
+
+    if(result < 0) return result;
+
+    Tundra_DynArrU8_free(&buff->pending);
+    buff->async_mode = false;
+
     return result;
 }
 
-i64 InTundra_IBuff_peek(InTundra_InputBuffer *buff)
+i64 InTundra_OBuff_set_filter(InTundra_OutputBuffer *buff,
+    InTundra_OBuffFilterFn filter, void *user_data)
 {
-    if(Tundra_DynStkU8_is_empty(&buff->data))
+    // Direct mode rewrites partial blocks in place, which a transform cannot
+    // reproduce; the two modes don't combine.
+    if(buff->direct_mode) return -TUNDRA_ERR_INVARG;
+
+    if(buff->filter == filter && buff->filter_user_data == user_data)
     {
-        u8 in_buff[DEF_BUFF_SIZE];
+        return 0;
+    }
+
+    // Flush through the previous configuration so the filter boundary stays
+    // clean.
+    i64 result = InTundra_OBuff_flush(buff);
 
-        i64 result = 
-            InTundra_raw_read_bytes(buff->handle, in_buff, DEF_BUFF_SIZE);
+    if(result < 0) return result;
+
+    if(filter != NULL && buff->filter == NULL)
+    {
+        Tundra_DynArrU8_init_cap(&buff->filter_out, buff->capacity);
+    }
+    else if(filter == NULL && buff->filter != NULL)
+    {
+        Tundra_DynArrU8_free(&buff->filter_out);
+    }
+
+    buff->filter = filter;
+    buff->filter_user_data = user_data;
+
+    return result;
+}
+
+i64 InTundra_OBuff_drain_pending(InTundra_OutputBuffer *buff)
+{
+    if(!buff->async_mode) return 0;
+
+    const u64 PENDING_SIZE = Tundra_DynArrU8_size(&buff->pending);
+
+    if(PENDING_SIZE == 0) return 0;
+
+    i64 result;
+
+    if(buff->filter != NULL)
+    {
+        result = write_through_filter(buff,
+            Tundra_DynArrU8_data(&buff->pending), PENDING_SIZE);
+
+        if(result < 0) return result;
+    }
+    else
+    {
+        result = InTundra_raw_write_bytes(buff->handle,
+            Tundra_DynArrU8_data(&buff->pending), (i64)PENDING_SIZE);
+
+        if(result < 0) return result;
+
+        TUNDRA_RT_ASSERT(result == (i64)PENDING_SIZE,
+            "Failed to write entire OBuffer.\n");
+    }
+
+    Tundra_DynArrU8_clear(&buff->pending);
+
+    return result;
+}
+
+i64 InTundra_IBuff_peek(InTundra_InputBuffer *buff)
+{
+    if(num_buffered(buff) == 0)
+    {
+        i64 result = refill_read(buff, buff->data, buff->capacity);
 
         if(result < 0) return result;
 
-        Tundra_DynStkU8_push_mult_copy(&buff->data, in_buff, (u64)result);
+        // Nothing to peek at the end of input.
+        if(result == 0) return -1;
+
+        buff->read_pos = 0;
+        buff->end_pos = (u64)result;
     }
 
-    return *Tundra_DynStkU8_top(&buff->data);
+    return buff->data[buff->read_pos];
 }
 
 u64 InTundra_OBuff_size(InTundra_OutputBuffer *buff)
 {
-    return Tundra_DynArrU8_size(&buff->data);
+    if(buff->direct_mode) return buff->direct_size;
+
+    u64 size = Tundra_DynArrU8_size(&buff->data);
+
+    // Retired bytes are still unwritten output.
+    if(buff->async_mode) size += Tundra_DynArrU8_size(&buff->pending);
+
+    return size;
 }
 
 u64 InTundra_IBuff_size(InTundra_InputBuffer *buff)
 {
-    return Tundra_DynStkU8_size(&buff->data);
+    return num_buffered(buff);
 }
 
 void InTundra_IBuff_clear(InTundra_InputBuffer *buff)
 {
-    Tundra_DynStkU8_clear(&buff->data);
+    buff->read_pos = 0;
+    buff->end_pos = 0;
 }
 
 void InTundra_IBuff_discard(InTundra_InputBuffer *buff, u64 num_bytes)
 {
-    Tundra_DynStkU8_pop_mult(&buff->data, num_bytes);
+    const u64 BUFFERED = num_buffered(buff);
+
+    buff->read_pos += (num_bytes < BUFFERED) ? num_bytes : BUFFERED;
 }
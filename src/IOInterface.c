@@ -30,10 +30,20 @@ i64 InTundra_raw_write_bytes(InTundra_IOHandle handle, const void *bytes,
     if (bytes == NULL) return -TUNDRA_LINUX_ERR_BADADDR;
     if(num_bytes == 0) return 0;
 
-    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_WRITE, handle, (i64)bytes, 
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_WRITE, handle, (i64)bytes,
         (i64)num_bytes, 0, 0, 0);
 }
 
+i64 InTundra_raw_writev(InTundra_IOHandle handle, const Tundra_IOVec *vecs,
+    i64 num_vecs)
+{
+    if(vecs == NULL) return -TUNDRA_LINUX_ERR_BADADDR;
+    if(num_vecs == 0) return 0;
+
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_WRITEV, handle, (i64)vecs,
+        num_vecs, 0, 0, 0);
+}
+
 i64 InTundra_raw_write_u64(InTundra_IOHandle handle, u64 num)
 {
     char buffer[TUNDRA_MAX_CHARS_TO_REPRESENT_U64 + 1];
@@ -165,12 +175,11 @@ static void process_formatted_char(const char *format,
         {
             unsigned int varg = Tundra_varg_arg(args, unsigned int);
 
-            Tundra_CStr converted_int = Tundra_u32_to_cstr(varg);
+            char converted_int[TUNDRA_MAX_CHARS_TO_REPRESENT_U32 + 1];
 
-            Tundra_DynArrChar_add_mult_copy(chars, converted_int.str, 
-                converted_int.length);
+            const u64 LENGTH = Tundra_u32_to_cstr_buf(varg, converted_int);
 
-            Tundra_free_mem(converted_int.str);
+            Tundra_DynArrChar_add_mult_copy(chars, converted_int, LENGTH);
             break;
         }
 
@@ -178,18 +187,30 @@ static void process_formatted_char(const char *format,
         {
             int varg = Tundra_varg_arg(args, int);
 
-            Tundra_CStr converted_int = Tundra_int_to_cstr(varg);
+            char converted_int[TUNDRA_MAX_CHARS_TO_REPRESENT_I32 + 1];
 
-            Tundra_DynArrChar_add_mult_copy(chars, converted_int.str,
-                converted_int.length);
+            const u64 LENGTH = Tundra_int_to_cstr_buf(varg, converted_int);
 
-            Tundra_free_mem(converted_int.str);
+            Tundra_DynArrChar_add_mult_copy(chars, converted_int, LENGTH);
+            break;
+        }
+
+        case 'x':
+        {
+            unsigned int varg = Tundra_varg_arg(args, unsigned int);
+
+            char converted_hex[TUNDRA_MAX_CHARS_TO_REPRESENT_U64_HEX + 1];
+
+            const u64 LENGTH = Tundra_u64_to_hex_buf((u64)varg,
+                converted_hex, false);
+
+            Tundra_DynArrChar_add_mult_copy(chars, converted_hex, LENGTH);
             break;
         }
 
         case 'l':
         {
-            // Check if this is a long long 
+            // Check if this is a long long
 
             c = format[(*fmt_idx)++];
 
@@ -200,6 +221,19 @@ static void process_formatted_char(const char *format,
                 is_unsigned = true;
             }
 
+            else if(c == 'x')
+            {
+                u64 varg = Tundra_varg_arg(args, u64);
+
+                char converted_hex[TUNDRA_MAX_CHARS_TO_REPRESENT_U64_HEX + 1];
+
+                const u64 LENGTH = Tundra_u64_to_hex_buf(varg, converted_hex,
+                    false);
+
+                Tundra_DynArrChar_add_mult_copy(chars, converted_hex, LENGTH);
+                break;
+            }
+
             else if(c != 'd')
             {
                 TUNDRA_FATAL("Invalid formatted character in format string: "
@@ -207,26 +241,25 @@ static void process_formatted_char(const char *format,
                 Tundra_exit(1);
             }
 
-            Tundra_CStr converted_int;
+            char converted_int[TUNDRA_MAX_CHARS_TO_REPRESENT_I64 + 1];
+
+            u64 length;
 
             if(is_unsigned)
             {
                 u64 varg = Tundra_varg_arg(args, u64);
 
-                converted_int = Tundra_u64_to_cstr(varg);
+                length = Tundra_u64_to_cstr_buf(varg, converted_int);
             }
 
             else
             {
                 i64 varg = Tundra_varg_arg(args, i64);
 
-                converted_int = Tundra_i64_to_cstr(varg);
+                length = Tundra_i64_to_cstr_buf(varg, converted_int);
             }
 
-            Tundra_DynArrChar_add_mult_copy(chars, converted_int.str,  
-                converted_int.length);
-
-            Tundra_free_mem(converted_int.str);
+            Tundra_DynArrChar_add_mult_copy(chars, converted_int, length);
             break;
         }
 
@@ -234,13 +267,12 @@ static void process_formatted_char(const char *format,
         {
             float varg = (float)Tundra_varg_arg(args, double);
 
-            Tundra_CStr converted_float = Tundra_float_to_cstr(varg);
-
-            Tundra_DynArrChar_add_mult_copy(chars, converted_float.str,
-                converted_float.length);
+            char converted_float[TUNDRA_MAX_CHARS_TO_REPRESENT_FLOAT + 1];
 
-            Tundra_free_mem(converted_float.str);
+            const u64 LENGTH = Tundra_float_to_cstr_buf(varg,
+                converted_float);
 
+            Tundra_DynArrChar_add_mult_copy(chars, converted_float, LENGTH);
             break;
         }
 
@@ -267,26 +299,40 @@ Tundra_DynamicArrayChar InTundra_vargs_convert_fmt_to_chars(const char *format,
     Tundra_VaList args)
 {
     Tundra_DynamicArrayChar chars;
-    Tundra_DynArrChar_init(&chars);
 
-    if(format == NULL) return chars;
+    if(format == NULL)
+    {
+        Tundra_DynArrChar_init(&chars);
+        return chars;
+    }
+
+    // Most records are the format itself plus a few dozen converted digit
+    // characters; starting at that estimate means typical conversions never
+    // regrow mid-record.
+    Tundra_DynArrChar_init_cap(&chars, Tundra_get_cstr_len(format) + 64);
 
     u64 fmt_idx = 0;
 
     while(true)
     {
-        char c = format[fmt_idx++];
+        // Bulk-copy the literal run up to the next format marker, one
+        // capacity check per segment instead of one per character.
+        const u64 RUN_START = fmt_idx;
 
-        if(c == '\0') return chars;
+        while(format[fmt_idx] != '\0' && format[fmt_idx] != '%')
+        { ++fmt_idx; }
 
-        if(c != '%')
+        if(fmt_idx != RUN_START)
         {
-            Tundra_DynArrChar_add_val(&chars, c);
-            continue;
+            Tundra_DynArrChar_add_mult_copy(&chars, format + RUN_START,
+                fmt_idx - RUN_START);
         }
 
+        if(format[fmt_idx] == '\0') return chars;
+
         // Character is a '%', which is the special format character. Process it
-    
+
+        ++fmt_idx;
         process_formatted_char(format, &chars, &fmt_idx, args);
     }
 }
@@ -463,6 +509,51 @@ i64 InTundra_raw_read_bytes(InTundra_IOHandle handle, void *output, i64 num_byte
         (i64)num_bytes, 0, 0, 0);
 }
 
+i64 InTundra_raw_pread_bytes(InTundra_IOHandle handle, void *output,
+    i64 num_bytes, i64 offset)
+{
+    if(output == NULL) return -TUNDRA_LINUX_ERR_BADADDR;
+    if(num_bytes == 0) return 0;
+
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_PREAD64, handle, (i64)output,
+        num_bytes, offset, 0, 0);
+}
+
+i64 InTundra_raw_pwrite_bytes(InTundra_IOHandle handle, const void *bytes,
+    i64 num_bytes, i64 offset)
+{
+    if(bytes == NULL) return -TUNDRA_LINUX_ERR_BADADDR;
+    if(num_bytes == 0) return 0;
+
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_PWRITE64, handle, (i64)bytes,
+        num_bytes, offset, 0, 0);
+}
+
+i64 InTundra_raw_copy_file_range(InTundra_IOHandle in_handle, i64 *in_offset,
+    InTundra_IOHandle out_handle, i64 *out_offset, u64 num_bytes)
+{
+    if(num_bytes == 0) return 0;
+
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_COPY_FILE_RANGE, in_handle,
+        (i64)in_offset, out_handle, (i64)out_offset, (i64)num_bytes, 0);
+}
+
+i64 InTundra_raw_sendfile(InTundra_IOHandle out_handle,
+    InTundra_IOHandle in_handle, i64 *in_offset, u64 num_bytes)
+{
+    if(num_bytes == 0) return 0;
+
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_SENDFILE, out_handle,
+        in_handle, (i64)in_offset, (i64)num_bytes, 0, 0);
+}
+
+i64 InTundra_raw_fadvise(InTundra_IOHandle handle, i64 offset, i64 num_bytes,
+    i64 advice)
+{
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_FADVISE64, handle, offset,
+        num_bytes, advice, 0, 0);
+}
+
 #else // TUNDRA_SYS_x86_64
 #error Not Implemented
 #endif // TUNDRA_SYS_x86_64
@@ -0,0 +1,339 @@
+/**
+ * @file IORing.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief io_uring backed submission/completion queues for keeping many
+ * reads and writes in flight at once.
+ * @version 0.1
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "tundra/internal/IORing.h"
+#include "tundra/common/ErrorDef.h"
+#include "tundra/internal/Syscall.h"
+#include "tundra/utils/MemUtils.h"
+
+#ifndef PROT_READ
+#define PROT_READ 0x1
+#endif
+
+#ifndef PROT_WRITE
+#define PROT_WRITE 0x2
+#endif
+
+#ifndef MAP_SHARED
+#define MAP_SHARED 0x01
+#endif
+
+// Fixed mmap offsets the kernel reserves for each ring region.
+#define IORING_OFF_SQ_RING 0ULL
+#define IORING_OFF_CQ_RING 0x8000000ULL
+#define IORING_OFF_SQES 0x10000000ULL
+
+// Opcodes staged into submission entries.
+#define IORING_OP_READ 22
+#define IORING_OP_WRITE 23
+
+// io_uring_enter flag: block until the requested completions arrive.
+#define IORING_ENTER_GETEVENTS 1U
+
+// Submission ring offsets the kernel reports at setup; field layout matches
+// the kernel's io_sqring_offsets.
+typedef struct
+{
+    u32 head;
+    u32 tail;
+    u32 ring_mask;
+    u32 ring_entries;
+    u32 flags;
+    u32 dropped;
+    u32 array;
+    u32 resv1;
+    u64 user_addr;
+} LinuxSqRingOffsets;
+
+// Completion ring offsets the kernel reports at setup; field layout matches
+// the kernel's io_cqring_offsets.
+typedef struct
+{
+    u32 head;
+    u32 tail;
+    u32 ring_mask;
+    u32 ring_entries;
+    u32 overflow;
+    u32 cqes;
+    u32 flags;
+    u32 resv1;
+    u64 user_addr;
+} LinuxCqRingOffsets;
+
+// Setup parameters exchanged with the kernel; field layout matches the
+// kernel's io_uring_params.
+typedef struct
+{
+    u32 sq_entries;
+    u32 cq_entries;
+    u32 flags;
+    u32 sq_thread_cpu;
+    u32 sq_thread_idle;
+    u32 features;
+    u32 wq_fd;
+    u32 resv[3];
+    LinuxSqRingOffsets sq_off;
+    LinuxCqRingOffsets cq_off;
+} LinuxIORingParams;
+
+// One submission entry; field layout matches the kernel's io_uring_sqe.
+typedef struct
+{
+    u8 opcode;
+    u8 flags;
+    u16 ioprio;
+    i32 fd;
+    u64 off;
+    u64 addr;
+    u32 len;
+    u32 rw_flags;
+    u64 user_data;
+    u64 unused[3];
+} LinuxIORingSqe;
+
+// One completion entry; field layout matches the kernel's io_uring_cqe.
+typedef struct
+{
+    u64 user_data;
+    i32 res;
+    u32 flags;
+} LinuxIORingCqe;
+
+/**
+ * @brief Maps one ring region of an io_uring handle. If the return is
+ * negative, it's an error code. Otherwise it is the mapped address.
+ *
+ * @param handle Ring handle to map from.
+ * @param num_bytes Length of the region.
+ * @param offset Fixed region offset, one of the IORING_OFF defines.
+ *
+ * @return `i64` Mapped address if the return is non negative, otherwise it
+ * is an error code.
+ */
+static i64 map_ring_region(InTundra_IOHandle handle, u64 num_bytes,
+    u64 offset)
+{
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_MMAP, 0, (i64)num_bytes,
+        PROT_READ | PROT_WRITE, MAP_SHARED, handle, (i64)offset);
+}
+
+/**
+ * @brief Stages one operation into the next free submission slot. Shared
+ * staging path for queued reads and writes.
+ *
+ * @param ring Ring to stage on.
+ * @param opcode Kernel opcode for the operation.
+ * @param handle Handle the operation targets.
+ * @param addr Userspace memory the operation transfers through.
+ * @param num_bytes Number of bytes to transfer.
+ * @param offset Absolute byte offset, -1 for the handle's cursor.
+ * @param user_data Tag returned with this operation's completion.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+static i64 queue_op(InTundra_IORing *ring, u8 opcode,
+    InTundra_IOHandle handle, u64 addr, u64 num_bytes, i64 offset,
+    u64 user_data)
+{
+    if(ring == NULL) return -TUNDRA_ERR_BADADDR;
+
+    if(ring->num_staged == ring->sq_capacity) return -TUNDRA_ERR_AGAIN;
+
+    // Staged entries sit between the kernel's head and our private tail.
+    const u32 TAIL = *ring->sq_tail + ring->num_staged;
+    const u32 INDEX = TAIL & *ring->sq_mask;
+
+    LinuxIORingSqe *sqe = (LinuxIORingSqe*)ring->sqes + INDEX;
+
+    Tundra_fill_mem(sqe, 0, sizeof(LinuxIORingSqe));
+    sqe->opcode = opcode;
+    sqe->fd = (i32)handle;
+    sqe->off = (u64)offset;
+    sqe->addr = addr;
+    sqe->len = (u32)num_bytes;
+    sqe->user_data = user_data;
+
+    ring->sq_array[INDEX] = INDEX;
+    ++ring->num_staged;
+
+    return 0;
+}
+
+i64 InTundra_IORing_init(InTundra_IORing *ring, u32 num_entries)
+{
+    if(ring == NULL) return -TUNDRA_ERR_BADADDR;
+
+    if(num_entries == 0) return -TUNDRA_ERR_INVARG;
+
+    LinuxIORingParams params;
+    Tundra_fill_mem(&params, 0, sizeof(params));
+
+    const i64 HANDLE = InTundra_syscall(TUNDRA_LINUX_SYSCALL_IO_URING_SETUP,
+        num_entries, (i64)&params, 0, 0, 0, 0);
+
+    if(HANDLE < 0) return HANDLE;
+
+    ring->handle = HANDLE;
+    ring->sq_capacity = params.sq_entries;
+    ring->num_staged = 0;
+
+    ring->sq_ring_bytes =
+        params.sq_off.array + params.sq_entries * sizeof(u32);
+    ring->cq_ring_bytes =
+        params.cq_off.cqes + params.cq_entries * sizeof(LinuxIORingCqe);
+    ring->sqes_bytes = params.sq_entries * sizeof(LinuxIORingSqe);
+
+    const i64 SQ_RING = map_ring_region(HANDLE, ring->sq_ring_bytes,
+        IORING_OFF_SQ_RING);
+    const i64 CQ_RING = map_ring_region(HANDLE, ring->cq_ring_bytes,
+        IORING_OFF_CQ_RING);
+    const i64 SQES = map_ring_region(HANDLE, ring->sqes_bytes,
+        IORING_OFF_SQES);
+
+    if(SQ_RING < 0 || CQ_RING < 0 || SQES < 0)
+    {
+        if(SQ_RING >= 0)
+        {
+            InTundra_syscall(TUNDRA_LINUX_SYSCALL_MUNMAP, SQ_RING,
+                (i64)ring->sq_ring_bytes, 0, 0, 0, 0);
+        }
+
+        if(CQ_RING >= 0)
+        {
+            InTundra_syscall(TUNDRA_LINUX_SYSCALL_MUNMAP, CQ_RING,
+                (i64)ring->cq_ring_bytes, 0, 0, 0, 0);
+        }
+
+        if(SQES >= 0)
+        {
+            InTundra_syscall(TUNDRA_LINUX_SYSCALL_MUNMAP, SQES,
+                (i64)ring->sqes_bytes, 0, 0, 0, 0);
+        }
+
+        InTundra_syscall(TUNDRA_LINUX_SYSCALL_CLOSE, HANDLE, 0, 0, 0, 0, 0);
+
+        return (SQ_RING < 0) ? SQ_RING : (CQ_RING < 0) ? CQ_RING : SQES;
+    }
+
+    ring->sq_ring = (u8*)SQ_RING;
+    ring->cq_ring = (u8*)CQ_RING;
+    ring->sqes = (u8*)SQES;
+
+    ring->sq_head = (u32*)(ring->sq_ring + params.sq_off.head);
+    ring->sq_tail = (u32*)(ring->sq_ring + params.sq_off.tail);
+    ring->sq_mask = (u32*)(ring->sq_ring + params.sq_off.ring_mask);
+    ring->sq_array = (u32*)(ring->sq_ring + params.sq_off.array);
+    ring->cq_head = (u32*)(ring->cq_ring + params.cq_off.head);
+    ring->cq_tail = (u32*)(ring->cq_ring + params.cq_off.tail);
+    ring->cq_mask = (u32*)(ring->cq_ring + params.cq_off.ring_mask);
+    ring->cqes = ring->cq_ring + params.cq_off.cqes;
+
+    return 0;
+}
+
+void InTundra_IORing_free(InTundra_IORing *ring)
+{
+    if(ring == NULL) return;
+
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_MUNMAP, (i64)ring->sq_ring,
+        (i64)ring->sq_ring_bytes, 0, 0, 0, 0);
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_MUNMAP, (i64)ring->cq_ring,
+        (i64)ring->cq_ring_bytes, 0, 0, 0, 0);
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_MUNMAP, (i64)ring->sqes,
+        (i64)ring->sqes_bytes, 0, 0, 0, 0);
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_CLOSE, ring->handle, 0, 0, 0, 0, 0);
+
+    ring->handle = TUNDRA_IOHANDLE_INVALID;
+    ring->sq_capacity = 0;
+    ring->num_staged = 0;
+}
+
+i64 InTundra_IORing_queue_read(InTundra_IORing *ring, InTundra_IOHandle handle,
+    void *output, u64 num_bytes, i64 offset, u64 user_data)
+{
+    if(output == NULL) return -TUNDRA_ERR_BADADDR;
+
+    return queue_op(ring, IORING_OP_READ, handle, (u64)output, num_bytes,
+        offset, user_data);
+}
+
+i64 InTundra_IORing_queue_write(InTundra_IORing *ring,
+    InTundra_IOHandle handle, const void *bytes, u64 num_bytes, i64 offset,
+    u64 user_data)
+{
+    if(bytes == NULL) return -TUNDRA_ERR_BADADDR;
+
+    return queue_op(ring, IORING_OP_WRITE, handle, (u64)bytes, num_bytes,
+        offset, user_data);
+}
+
+i64 InTundra_IORing_submit(InTundra_IORing *ring)
+{
+    if(ring == NULL) return -TUNDRA_ERR_BADADDR;
+
+    if(ring->num_staged == 0) return 0;
+
+    // Publish the new tail; the release order makes the staged entries
+    // visible to the kernel before the tail moves.
+    __atomic_store_n(ring->sq_tail, *ring->sq_tail + ring->num_staged,
+        __ATOMIC_RELEASE);
+
+    const i64 RESULT = InTundra_syscall(TUNDRA_LINUX_SYSCALL_IO_URING_ENTER,
+        ring->handle, ring->num_staged, 0, 0, 0, 0);
+
+    if(RESULT < 0) return RESULT;
+
+    ring->num_staged -= (u32)RESULT;
+
+    return RESULT;
+}
+
+i64 InTundra_IORing_drain(InTundra_IORing *ring,
+    InTundra_IORingCompletion *completions_output, u64 max_completions,
+    u64 min_completions)
+{
+    if(ring == NULL || completions_output == NULL)
+        return -TUNDRA_ERR_BADADDR;
+
+    if(min_completions > max_completions) min_completions = max_completions;
+
+    if(min_completions != 0)
+    {
+        const i64 RESULT = InTundra_syscall(
+            TUNDRA_LINUX_SYSCALL_IO_URING_ENTER, ring->handle, 0,
+            (i64)min_completions, IORING_ENTER_GETEVENTS, 0, 0);
+
+        if(RESULT < 0) return RESULT;
+    }
+
+    u64 num_drained = 0;
+    u32 head = *ring->cq_head;
+
+    // The acquire order on the tail makes the entries behind it visible.
+    const u32 TAIL = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+    while(head != TAIL && num_drained < max_completions)
+    {
+        const LinuxIORingCqe *cqe =
+            (const LinuxIORingCqe*)ring->cqes + (head & *ring->cq_mask);
+
+        completions_output[num_drained].user_data = cqe->user_data;
+        completions_output[num_drained].result = cqe->res;
+
+        ++head;
+        ++num_drained;
+    }
+
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+
+    return (i64)num_drained;
+}
@@ -10,31 +10,59 @@
 
 #include "tundra/internal/LargeMemAlloc.h"
 #include "tundra/internal/MemAllocHandler.h"
+#include "tundra/utils/MemUtils.h"
 #include "tundra/common/NumLimits.h"
 #include "tundra/common/BitUtils.h"
 #include "tundra/utils/FatalHandler.h"
 #include "tundra/common/Core.h"
+#include "tundra/utils/Stats.h"
+#include "tundra/utils/Trace.h"
 
 
 // Defintions -----------------------------------------------------------------
 
-// The maximum size measured in increments of TUNDRA_OS_ALLOC_ALIGNMENT allowed
-// for caching. 
-#define MAX_ALIGN_INCR_FOR_CACHING 16
+// Hard upper bound, measured in increments of TUNDRA_OS_ALLOC_ALIGNMENT, on
+// block sizes the cache can ever hold. The runtime limit can be raised up to
+// this. 512 increments is 2 MiB.
+#define MAX_CACHEABLE_ALIGN_INCR 512
 
-// Maximum number of cached entries allowed for allocation size. 
-#define MAX_CACHE_PER_PAGE_SIZE 3
+// Default maximum block size allowed into the cache, in alignment increments.
+// 256 increments is 1 MiB.
+#define DEF_CACHE_ALIGN_INCR_LIMIT 256
 
-// Maximum number of bytes that can be requested to be allocated. 
+// Default maximum number of cached entries allowed per block size.
+#define DEF_CACHE_PER_SIZE_LIMIT 3
+
+// Maximum number of bytes that can be requested to be allocated.
 #define MAX_ALLOC_BYTE_SIZE ((TUNDRA_UINT64_MAX / TUNDRA_OS_ALLOC_ALIGNMENT) * \
     TUNDRA_OS_ALLOC_ALIGNMENT)
 
+#ifdef TUNDRA_USE_HUGE_PAGES
+
+// Number of os alloc alignment increments in one huge page. Blocks at or
+// above this many increments are requested with huge page backing to cut
+// down on TLB misses when walking very large allocations.
+#define HUGE_PAGE_ALIGN_INCR \
+    (u32)(TUNDRA_HUGE_PAGE_BYTE_SIZE / TUNDRA_OS_ALLOC_ALIGNMENT)
+
+#endif // TUNDRA_USE_HUGE_PAGES
+
 // Containers ------------------------------------------------------------------
 
 typedef struct TUNDRA_CMPDIR_ALIGN(TUNDRA_MEM_ALIGNMENT) BlockHeader
 {
     // Size of the block this header tracks in alignment increments.
     u32 block_align_incr;
+
+    // Byte offset from the start of the os memory to the payload. This is
+    // BLOCK_HEADER_SIZE for regular blocks, but larger for aligned
+    // allocations whose payload was pushed forward to satisfy the alignment.
+    u32 payload_offset;
+
+    // Bytes of the block taken by a trailing PROT_NONE guard page, 0 for
+    // unguarded blocks. The header's 16 byte alignment padding already held
+    // this space, so the field costs no extra size.
+    u32 guard_bytes;
 } BlockHeader;
 
 #define BLOCK_HEADER_SIZE sizeof(BlockHeader)
@@ -42,31 +70,100 @@ typedef struct TUNDRA_CMPDIR_ALIGN(TUNDRA_MEM_ALIGNMENT) BlockHeader
 typedef struct TUNDRA_CMPDIR_ALIGN(TUNDRA_MEM_ALIGNMENT) FreedBlock
 {
     struct FreedBlock *next; // Next FreedBlock in the chain, NULL if none.
-    struct FreedBlock *prev; // Previous FreedBlock in the chain, NULL if none.
 } FreedBlock;
 
 // Global Variables ------------------------------------------------------------
 
 /**
- * Array of linked lists that contain cached blocks that have been freed. Each 
- * index corresponds to a block with an increment of the os alignment. For 
- * instance, index 0 are blocks of 1 alignment, index 1 are blocks with 
- * 2 alignment increments, and so on. The head array contains the head node of 
- * each list, whereas the tail list stores the tail node.
+ * Array of lock-free stacks that contain cached blocks that have been freed.
+ * Each index corresponds to a block with an increment of the os alignment. For
+ * instance, index 0 are blocks of 1 alignment, index 1 are blocks with
+ * 2 alignment increments, and so on.
+ *
+ * Pushes CAS a node onto the head. Pops never CAS individual nodes off (that
+ * would be vulnerable to the ABA problem); instead the whole stack is taken
+ * with an atomic exchange to NULL, giving the popping thread exclusive
+ * ownership of the nodes, and any remainder is pushed back on.
  */
-static FreedBlock* cached_blocks_head[MAX_ALIGN_INCR_FOR_CACHING];
-static FreedBlock* cached_blocks_tail[MAX_ALIGN_INCR_FOR_CACHING];
+static FreedBlock* cached_blocks_head[MAX_CACHEABLE_ALIGN_INCR];
 
 /**
- * Tracks the number of cached freed blocks per alignment increment. Each index 
+ * Tracks the number of cached freed blocks per alignment increment. Each index
  * represents the count cached of the index into the `cached_blocks` array.
+ * Updated with relaxed atomics; counts may transiently disagree with the
+ * stacks while another thread holds a taken stack, which only ever causes a
+ * benign extra cache miss or early release.
  */
-static u8 num_cached_per_align_incr[MAX_ALIGN_INCR_FOR_CACHING];
+static u8 num_cached_per_align_incr[MAX_CACHEABLE_ALIGN_INCR];
+
+/**
+ * Runtime cache limits, adjustable per process through
+ * `InTundra_LgMemAlc_set_cache_limits`. Blocks larger than the increment
+ * limit, or freed once a size already holds the per-size count, skip the
+ * cache and are released to the os immediately.
+ */
+static u32 cache_align_incr_limit = DEF_CACHE_ALIGN_INCR_LIMIT;
+static u8 cache_per_size_limit = DEF_CACHE_PER_SIZE_LIMIT;
+
+/**
+ * Stats counters, updated with relaxed atomic adds so polling them from a
+ * monitoring thread costs the allocation path next to nothing.
+ */
+static u64 live_block_count;
+static u64 live_block_bytes;
+static u64 peak_live_bytes;
+static u64 cache_hit_count;
+static u64 cache_miss_count;
+
+/**
+ * Guarded allocation sampling: when the rate is nonzero, one in every
+ * `guard_sample_rate` large allocations is laid out against a PROT_NONE
+ * guard page so an overrun traps at the faulting instruction. The counter
+ * is bumped with relaxed atomics; exact 1-in-N spacing across threads is
+ * not needed, only the aggregate rate.
+ */
+static u64 guard_sample_rate;
+static u64 guard_sample_counter;
 
 // Methods ---------------------------------------------------------------------
 
 // -- Local Helper Methods --
 
+/**
+ * @brief Counts a block of `align_incr` increments as handed out to the user,
+ * updating the live byte high-water mark.
+ *
+ * @param align_incr Size of the block in alignment increments.
+ */
+static void track_live_block(u32 align_incr)
+{
+    __atomic_fetch_add(&live_block_count, 1, __ATOMIC_RELAXED);
+
+    const u64 NEW_LIVE = __atomic_add_fetch(&live_block_bytes,
+        (u64)align_incr * TUNDRA_OS_ALLOC_ALIGNMENT, __ATOMIC_RELAXED);
+
+    u64 peak = __atomic_load_n(&peak_live_bytes, __ATOMIC_RELAXED);
+
+    while(NEW_LIVE > peak &&
+        !__atomic_compare_exchange_n(&peak_live_bytes, &peak, NEW_LIVE,
+        false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+}
+
+/**
+ * @brief Removes a freed block of `align_incr` increments from the live
+ * counters.
+ *
+ * @param align_incr Size of the block in alignment increments.
+ */
+static void untrack_live_block(u32 align_incr)
+{
+    __atomic_fetch_sub(&live_block_count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_sub(&live_block_bytes,
+        (u64)align_incr * TUNDRA_OS_ALLOC_ALIGNMENT, __ATOMIC_RELAXED);
+}
+
 /**
  * @brief Returns the number of cached blocks for a given alignment increment.
  * 
@@ -77,7 +174,8 @@ static u8 num_cached_per_align_incr[MAX_ALIGN_INCR_FOR_CACHING];
 static u8 get_num_cached(u32 align_incr)
 {
     // Index 0 corresponds to an alignment increment of 1.
-    return num_cached_per_align_incr[align_incr - 1];
+    return __atomic_load_n(&num_cached_per_align_incr[align_incr - 1],
+        __ATOMIC_RELAXED);
 }
 
 // #define TRAIL_ZEROS_OF_OS_ALLC_ALGN __builtin_ctzll(TUNDRA_OS_ALLOC_ALIGNMENT)
@@ -117,39 +215,49 @@ static u32 calc_min_align_incr(u64 num_bytes)
 // #undef TRAIL_ZEROS_OF_OS_ALLC_ALGN
 
 /**
- * @brief Returns the head Node of the linked list corresponding to the passed
- * alignment increment size.
- * 
- * Does not check if there exists a head Node, simply returns the pointer, which
- * may be NULL.
- * 
- * @param align_incr Alignment increment to get the head Node of the list.
- * 
- * @return FreedBlock* Freed block  
+ * @brief Takes the entire cached stack of an alignment increment, leaving it
+ * empty.
+ *
+ * The atomic exchange hands the calling thread exclusive ownership of every
+ * node in the returned chain, which is what makes later pops and walks safe
+ * without any ABA hazard.
+ *
+ * @param align_incr Alignment increment of the stack to take.
+ *
+ * @return FreedBlock* Head of the taken chain, NULL if the stack was empty.
  */
-static FreedBlock* get_freed_head_node(u32 align_incr) 
+static FreedBlock* take_cached_stack(u32 align_incr)
 {
     // Subtract 1 from the increment since an increment of 1 points to the 0th
     // index.
-    return cached_blocks_head[align_incr - 1];
+    return __atomic_exchange_n(&cached_blocks_head[align_incr - 1], NULL,
+        __ATOMIC_ACQUIRE);
 }
 
 /**
- * @brief Returns the tail Node of the linked list corresponding to the passed
- * alignment increment size.
- * 
- * Does not check if there exists a tail Node, simply returns the pointer, which
- * may be NULL.
- * 
- * @param align_incr Alignment increment to get the tail Node of the list.
- * 
- * @return FreedBlock* Freed block  
+ * @brief Pushes a chain of nodes owned by the calling thread onto the cached
+ * stack of an alignment increment.
+ *
+ * Only the chain's own next pointers and the stack head are written, so the
+ * compare exchange loop is safe against concurrent pushes and takes.
+ *
+ * @param align_incr Alignment increment of the stack to push onto.
+ * @param chain_head First node of the owned chain.
+ * @param chain_tail Last node of the owned chain.
  */
-static FreedBlock* get_freed_tail_node(u32 align_incr) 
+static void push_cached_chain(u32 align_incr, FreedBlock *chain_head,
+    FreedBlock *chain_tail)
 {
-    // Subtract 1 from the increment since an increment of 1 points to the 0th
-    // index.
-    return cached_blocks_tail[align_incr - 1];
+    FreedBlock **stack_head = &cached_blocks_head[align_incr - 1];
+
+    FreedBlock *head = __atomic_load_n(stack_head, __ATOMIC_RELAXED);
+
+    do
+    {
+        chain_tail->next = head;
+    }
+    while(!__atomic_compare_exchange_n(stack_head, &head, chain_head, false,
+        __ATOMIC_RELEASE, __ATOMIC_RELAXED));
 }
 
 /**
@@ -167,130 +275,230 @@ static BlockHeader* get_header(void *ptr)
 }
 
 /**
- * @brief Get's the first available block that has the alignment increment of
- * `align_incr`.
+ * @brief Pops one cached block of the given alignment increment, returning
+ * NULL if none is available.
  *
- * Assumes the number of cached blocks for the given page size is non zero.
+ * The whole stack is taken with an exchange, the first node is kept and the
+ * remainder is pushed back, so no node is ever popped with a bare CAS.
  *
- * @param align_incr Alignment increment to find cached block of.
+ * @param align_incr Alignment increment to pop a block of.
  *
- * @return void* Pointer to the available block.
+ * @return void* Pointer to the block's usable memory, NULL if the stack was
+ * empty.
  */
-static void* get_available_block(u32 align_incr)
+static void* pop_cached_block(u32 align_incr)
 {
-    FreedBlock *free_block = get_freed_head_node(align_incr);
+    FreedBlock *chain = take_cached_stack(align_incr);
 
-    u32 ALIGN_INCR_IDX = align_incr - 1;
+    if(chain == NULL) { return NULL; }
 
-    // If there is only a single Node in the list.
-    if(get_num_cached(align_incr) == 1)
+    if(chain->next != NULL)
     {
-        cached_blocks_head[ALIGN_INCR_IDX] = NULL;
-        cached_blocks_tail[ALIGN_INCR_IDX] = NULL;
-        --num_cached_per_align_incr[align_incr - 1];
-        return (void*)free_block;
-    }
+        // Hand back everything after the node we are keeping. The chain is
+        // exclusively owned, so walking it to find the tail is safe.
+        FreedBlock *rest_tail = chain->next;
 
-    // Set the new head node of the list to be whatever the snatched block was
-    // pointing to next.
-    cached_blocks_head[ALIGN_INCR_IDX] = free_block->next;
-    cached_blocks_head[ALIGN_INCR_IDX]->prev = NULL;
+        while(rest_tail->next != NULL) { rest_tail = rest_tail->next; }
 
-    --num_cached_per_align_incr[align_incr - 1];
+        push_cached_chain(align_incr, chain->next, rest_tail);
+    }
+
+    __atomic_fetch_sub(&num_cached_per_align_incr[align_incr - 1], 1,
+        __ATOMIC_RELAXED);
 
-    return (void*)free_block;
-};
+    return (void*)chain;
+}
 
 /**
- * @brief Pops the stalest block off the linked list of FreedBlocks associated
- * with `align_incr`.
+ * @brief Releases every cached block of a given alignment increment back to
+ * the os and empties its stack.
  *
- * Assumes that the number of cached blocks for the page size is greater than 0.
- *
- * @note The return pointer pointer to the start of the usable memory of the 
- *    block, which is just after the header of the block.
- * 
- * @param align_incr Alignment increment to pop block from.
+ * @param align_incr Alignment increment to release the cached blocks of.
  */
-static void pop_stale_block(u32 align_incr)
+static void release_cached_blocks(u32 align_incr)
 {
-    FreedBlock *tail_node = get_freed_tail_node(align_incr);
+    FreedBlock *current_node = take_cached_stack(align_incr);
 
-    // Subtract one from the increment since we account for an increment of 1
-    // being represented as the 0th index into the cached array.
-    const u32 ALIGN_INCR_IDX = align_incr - 1;
+    u8 num_released = 0;
 
-    // The begin of the block of memory the tail Node sits at.
-    void *begin_mem_of_freed_block = 
-        (void*)((u8*)(tail_node) - BLOCK_HEADER_SIZE);
-
-    // There is only 1 Node in the list.
-    if(get_num_cached(align_incr) == 1)
+    while(current_node != NULL)
     {
-        // Release the only Node back to the OS.
-        InTundra_Mem_release_mem_to_os(begin_mem_of_freed_block, 
-            align_incr * TUNDRA_OS_ALLOC_ALIGNMENT);
+        // The start of the block's memory is just before the header. Grab the
+        // next node before releasing, the node lives inside the block.
+        FreedBlock *next_node = current_node->next;
 
-        // There are now now Nodes in the list, so no head or tail.
-        cached_blocks_head[ALIGN_INCR_IDX] = 
-            cached_blocks_tail[ALIGN_INCR_IDX] = NULL;
+        InTundra_Mem_release_mem_to_os(
+            (void*)((u8*)(current_node) - BLOCK_HEADER_SIZE),
+            (u64)align_incr * TUNDRA_OS_ALLOC_ALIGNMENT);
 
-        --num_cached_per_align_incr[ALIGN_INCR_IDX];
-        return;
+        current_node = next_node;
+        ++num_released;
     }
 
-    // -- There is more than 1 Node in the list --
+    __atomic_fetch_sub(&num_cached_per_align_incr[align_incr - 1],
+        num_released, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Gets block memory from the os, requesting huge page backing when the
+ * block is large enough and huge pages are enabled.
+ *
+ * With huge pages the block is rounded up to a whole number of huge pages, so
+ * `align_incr` is passed by pointer and updated to the true block size.
+ *
+ * @param align_incr Pointer to the block size in alignment increments, may be
+ * rounded up.
+ *
+ * @return void* Pointer to the os memory.
+ */
+static void* get_block_mem_from_os(u32 *align_incr)
+{
+    // The cache-miss path every large allocation funnels through.
+    TUNDRA_TRACE_SCOPE("lg_mem_from_os");
 
-    // Update the Node before the tail Node to point to NULL;
-    tail_node->prev->next = NULL;
+    #ifdef TUNDRA_USE_HUGE_PAGES
 
-    // Set the previous Node to be the tail Node.
-    cached_blocks_tail[align_incr] = tail_node->prev;
+    if(*align_incr >= HUGE_PAGE_ALIGN_INCR)
+    {
+        // Round the block up to a whole number of huge pages.
+        *align_incr = (*align_incr + HUGE_PAGE_ALIGN_INCR - 1) /
+            HUGE_PAGE_ALIGN_INCR * HUGE_PAGE_ALIGN_INCR;
 
-    // Release the popped Node back to the OS.
-    InTundra_Mem_release_mem_to_os(begin_mem_of_freed_block, 
-        align_incr * TUNDRA_OS_ALLOC_ALIGNMENT);
+        return InTundra_Mem_get_huge_mem_from_os((u64)*align_incr *
+            TUNDRA_OS_ALLOC_ALIGNMENT);
+    }
 
-    --num_cached_per_align_incr[ALIGN_INCR_IDX];
+    #endif // TUNDRA_USE_HUGE_PAGES
+
+    return InTundra_Mem_get_mem_from_os((u64)*align_incr *
+        TUNDRA_OS_ALLOC_ALIGNMENT);
 }
 
 /**
- * @brief Creates a new block, allocating memory from the os and setting the 
+ * @brief Creates a new block, allocating memory from the os and setting the
  * information in the header of the new block. Returns a pointer to the usable
  * memory.
- * 
- * Uses `align_incr` to calculate the byte size to allocate. 
- * 
- * @param align_incr Byte size in increments of the os alignment to allocate 
+ *
+ * Uses `align_incr` to calculate the byte size to allocate.
+ *
+ * @param align_incr Byte size in increments of the os alignment to allocate
  * for.
- *  
- * @return void* Pointer to the usable memory. 
+ *
+ * @return void* Pointer to the usable memory.
  */
 static void* create_new_block(u32 align_incr)
 {
-    void *mem = InTundra_Mem_get_mem_from_os(align_incr * 
-        TUNDRA_OS_ALLOC_ALIGNMENT);
+    void *mem = get_block_mem_from_os(&align_incr);
+
+    track_live_block(align_incr);
 
     // Set the header at the beginning of the new memory.
     ((BlockHeader*)mem)->block_align_incr = align_incr;
+    ((BlockHeader*)mem)->payload_offset = BLOCK_HEADER_SIZE;
+    ((BlockHeader*)mem)->guard_bytes = 0;
 
     // Return a pointer to the usable memory after the memory the header takes
     // up.
     return (void*)((u8*)(mem) + BLOCK_HEADER_SIZE);
 }
 
+/**
+ * @brief Creates a block whose payload sits directly against a trailing
+ * PROT_NONE guard page, so writing past the usable size traps at the
+ * faulting instruction.
+ *
+ * The payload is pushed as close to the guard page as its alignment allows,
+ * leaving at most TUNDRA_MEM_ALIGNMENT - 1 slack bytes an overrun must
+ * cross before trapping. The aligned payload offset keeps the freed block
+ * out of the shared cache, so the guard page is unmapped with the rest of
+ * the block. Huge pages are skipped, they cannot be protected at page
+ * granularity.
+ *
+ * @param num_bytes Number of bytes to allocate.
+ *
+ * @return void* Pointer to the usable memory.
+ */
+static void* create_guarded_block(u64 num_bytes)
+{
+    // Data pages sized so the header and the payload's alignment rounding
+    // always fit in front of the payload, plus the trailing guard page.
+    const u32 DATA_INCR = calc_min_align_incr(num_bytes + BLOCK_HEADER_SIZE +
+        TUNDRA_MEM_ALIGNMENT);
+    const u32 ALIGN_INCR = DATA_INCR + 1;
+
+    void *mem = InTundra_Mem_get_mem_from_os(
+        (u64)ALIGN_INCR * TUNDRA_OS_ALLOC_ALIGNMENT);
+
+    track_live_block(ALIGN_INCR);
+
+    u8 *guard_page = (u8*)mem + (u64)DATA_INCR * TUNDRA_OS_ALLOC_ALIGNMENT;
+
+    // Best effort: without the protection the block is still a valid
+    // allocation, just an unguarded one.
+    InTundra_Mem_protect_mem_none((void*)guard_page,
+        TUNDRA_OS_ALLOC_ALIGNMENT);
+
+    u8 *payload = (u8*)((u64)(guard_page - num_bytes) &
+        ~((u64)TUNDRA_MEM_ALIGNMENT - 1));
+
+    BlockHeader *hdr = get_header((void*)payload);
+
+    hdr->block_align_incr = ALIGN_INCR;
+    hdr->payload_offset = (u32)(payload - (u8*)mem);
+    hdr->guard_bytes = TUNDRA_OS_ALLOC_ALIGNMENT;
+
+    return (void*)payload;
+}
+
+/**
+ * @brief Returns a guarded block when this allocation is sampled, NULL when
+ * the caller should take its normal path.
+ *
+ * @param num_bytes Number of bytes being allocated.
+ *
+ * @return void* Pointer to the guarded usable memory, NULL if not sampled.
+ */
+static void* try_guarded_block(u64 num_bytes)
+{
+    const u64 RATE = __atomic_load_n(&guard_sample_rate, __ATOMIC_RELAXED);
+
+    if(RATE == 0) { return NULL; }
+
+    if(__atomic_fetch_add(&guard_sample_counter, 1, __ATOMIC_RELAXED) %
+        RATE != 0)
+    { return NULL; }
+
+    // The guard layout needs room for its extra page; oversized requests
+    // just go unguarded.
+    if(num_bytes > MAX_ALLOC_BYTE_SIZE - 2 * TUNDRA_OS_ALLOC_ALIGNMENT)
+    { return NULL; }
+
+    return create_guarded_block(num_bytes);
+}
+
 
 // Public Methods --------------------------------------------------------------
 
 void InTundra_LgMemAlc_init(void)
 {
-    for(int i = 0; i < MAX_ALIGN_INCR_FOR_CACHING; ++i)
+    for(int i = 0; i < MAX_CACHEABLE_ALIGN_INCR; ++i)
     {
         cached_blocks_head[i] = NULL;
-        cached_blocks_tail[i] = NULL;
         num_cached_per_align_incr[i] = 0;
     }
 
+    cache_align_incr_limit = DEF_CACHE_ALIGN_INCR_LIMIT;
+    cache_per_size_limit = DEF_CACHE_PER_SIZE_LIMIT;
+
+    live_block_count = 0;
+    live_block_bytes = 0;
+    peak_live_bytes = 0;
+    cache_hit_count = 0;
+    cache_miss_count = 0;
+
+    guard_sample_rate = 0;
+    guard_sample_counter = 0;
+
     // max_allocation_byte_amount = TUNDRA_UINT32_MAX *
     //     InTundra_Mem_data_instance.page_size_bytes;
 }
@@ -298,30 +506,13 @@ void InTundra_LgMemAlc_init(void)
 void InTundra_LgMemAlc_shutdown(void)
 {
     // Iterate through each page size
-    for(int i = 1; i < MAX_ALIGN_INCR_FOR_CACHING; ++i)
+    for(u32 i = 1; i <= MAX_CACHEABLE_ALIGN_INCR; ++i)
     {
-        FreedBlock *current_node = get_freed_head_node((u32)i);
-
-        // Release all cached blocks for this page size.
-        while(current_node != NULL)
-        {
-            // The start of the block's memory is just before the header.
-            void *begin_mem_of_freed_block = 
-                (void*)((u8*)(current_node) - BLOCK_HEADER_SIZE);
-
-            InTundra_Mem_release_mem_to_os(begin_mem_of_freed_block, 
-                (u64)i * TUNDRA_OS_ALLOC_ALIGNMENT);
-
-            current_node = current_node->next;
-        }
-
-        cached_blocks_head[i] = NULL;
-        cached_blocks_tail[i] = NULL;
-        num_cached_per_align_incr[i] = 0;
+        release_cached_blocks(i);
     }
 }
 
-void InTundra_LgMemAlc_free(void *ptr) 
+void InTundra_LgMemAlc_free(void *ptr)
 {
     BlockHeader *hdr = get_header(ptr);
     u32 num_align_incr = hdr->block_align_incr;
@@ -332,62 +523,213 @@ void InTundra_LgMemAlc_free(void *ptr)
             increment of 0.");
     }
 
+    untrack_live_block(num_align_incr);
+
     // The size of this Block is larger than what we allow caching for, so just
-    // release it immediately.
-    if(num_align_incr > MAX_ALIGN_INCR_FOR_CACHING)
+    // release it immediately. Aligned blocks (payload pushed past the default
+    // offset) are also released immediately, since the cache assumes the
+    // header sits at the start of the os memory.
+    if(num_align_incr > cache_align_incr_limit || cache_per_size_limit == 0 ||
+        hdr->payload_offset != BLOCK_HEADER_SIZE)
     {
-        InTundra_Mem_release_mem_to_os((void*)(hdr),
+        InTundra_Mem_release_mem_to_os((void*)((u8*)ptr - hdr->payload_offset),
             num_align_incr * TUNDRA_OS_ALLOC_ALIGNMENT);
         return;
     }
 
-    // If we've reached our limit for total cached blocks for this alignment 
-    // increment.
-    if(get_num_cached(num_align_incr) >= MAX_CACHE_PER_PAGE_SIZE)
+    // If we've reached our limit for total cached blocks for this alignment
+    // increment, release the incoming block instead. The lock-free stack has
+    // no cheap way to evict its stalest entry, so the newest block is the one
+    // dropped. Racing frees can overshoot the limit by a block or two, which
+    // is benign.
+    if(get_num_cached(num_align_incr) >= cache_per_size_limit)
     {
-        // Pop off the most stale cached block which is at the end of the list
-        // of freed blocks of this alignment increment.
-        pop_stale_block(num_align_incr);
+        InTundra_Mem_release_mem_to_os((void*)((u8*)ptr - BLOCK_HEADER_SIZE),
+            (u64)num_align_incr * TUNDRA_OS_ALLOC_ALIGNMENT);
+        return;
     }
 
-    // u32 page_index = num_align_incr - 1;
-
-    // Subtract one from the increment since we account for an increment of 1
-    // being represented as the 0th index into the cached array.
-    const u32 ALIGN_INCR_IDX = num_align_incr - 1;
+    __atomic_fetch_add(&num_cached_per_align_incr[num_align_incr - 1], 1,
+        __ATOMIC_RELAXED);
 
-    // Interpret the memory in front of the header as a FreedBlock, and use that
-    // to store the information of a Node in our linked list.
+    // Interpret the memory in front of the header as a FreedBlock, and use
+    // that to store the stack node.
     FreedBlock *new_free_block = (FreedBlock*)(
         (u8*)(hdr) + BLOCK_HEADER_SIZE);
 
-    FreedBlock *existing_head_node = get_freed_head_node(num_align_incr);
+    push_cached_chain(num_align_incr, new_free_block, new_free_block);
+}
 
-    // We're adding a node to the chain
-    ++num_cached_per_align_incr[ALIGN_INCR_IDX];
+void InTundra_LgMemAlc_set_cache_limits(u64 max_block_bytes,
+    u8 max_blocks_per_size)
+{
+    u32 new_incr_limit = calc_min_align_incr(max_block_bytes);
 
-    // Have the new Node point to what is the head Node.
-    new_free_block->next = existing_head_node;
-    new_free_block->prev = NULL;
+    if(new_incr_limit > MAX_CACHEABLE_ALIGN_INCR)
+    {
+        new_incr_limit = MAX_CACHEABLE_ALIGN_INCR;
+    }
 
-    // Update the head Node to now be the new Node.
-    cached_blocks_head[ALIGN_INCR_IDX] = new_free_block;
+    // Release cached blocks of sizes the tightened size limit no longer
+    // allows.
+    for(u32 incr = new_incr_limit + 1; incr <= cache_align_incr_limit; ++incr)
+    {
+        release_cached_blocks(incr);
+    }
 
-    if(existing_head_node != NULL)
+    // Pop entries from sizes holding more than the new per-size count.
+    for(u32 incr = 1; incr <= new_incr_limit; ++incr)
     {
-        // Have the head Node point back to the new block.
-        existing_head_node->prev = new_free_block;
-        return;
+        while(get_num_cached(incr) > max_blocks_per_size)
+        {
+            void *block = pop_cached_block(incr);
+
+            if(block == NULL) { break; }
+
+            InTundra_Mem_release_mem_to_os(
+                (void*)((u8*)block - BLOCK_HEADER_SIZE),
+                (u64)incr * TUNDRA_OS_ALLOC_ALIGNMENT);
+        }
+    }
+
+    cache_align_incr_limit = new_incr_limit;
+    cache_per_size_limit = max_blocks_per_size;
+}
+
+void InTundra_LgMemAlc_set_guard_rate(u64 rate)
+{
+    __atomic_store_n(&guard_sample_rate, rate, __ATOMIC_RELAXED);
+}
+
+void InTundra_LgMemAlc_trim_cache(void)
+{
+    // Cached blocks stay reusable, but the kernel is told their payload pages
+    // past the first are unneeded so they stop counting toward resident
+    // memory. The first page is kept since the block's header and stack node
+    // live there. Single-increment blocks have nothing to trim. Each stack is
+    // taken for exclusive ownership during its walk and pushed back after.
+    for(u32 incr = 2; incr <= cache_align_incr_limit; ++incr)
+    {
+        FreedBlock *chain = take_cached_stack(incr);
+
+        if(chain == NULL) { continue; }
+
+        FreedBlock *tail = chain;
+
+        for(FreedBlock *node = chain; node != NULL; node = node->next)
+        {
+            u8 *block_begin = (u8*)node - BLOCK_HEADER_SIZE;
+
+            InTundra_Mem_advise_mem_unneeded(
+                (void*)(block_begin + TUNDRA_OS_ALLOC_ALIGNMENT),
+                (u64)(incr - 1) * TUNDRA_OS_ALLOC_ALIGNMENT);
+
+            tail = node;
+        }
+
+        push_cached_chain(incr, chain, tail);
+    }
+}
+
+void InTundra_LgMemAlc_gather_stats(Tundra_MemStats *stats_out)
+{
+    stats_out->large_live_blocks =
+        __atomic_load_n(&live_block_count, __ATOMIC_RELAXED);
+    stats_out->large_live_bytes =
+        __atomic_load_n(&live_block_bytes, __ATOMIC_RELAXED);
+    stats_out->large_peak_live_bytes =
+        __atomic_load_n(&peak_live_bytes, __ATOMIC_RELAXED);
+    stats_out->large_cache_hits =
+        __atomic_load_n(&cache_hit_count, __ATOMIC_RELAXED);
+    stats_out->large_cache_misses =
+        __atomic_load_n(&cache_miss_count, __ATOMIC_RELAXED);
+
+    stats_out->large_cached_blocks = 0;
+    stats_out->large_cached_bytes = 0;
+
+    for(u32 i = 0; i < MAX_CACHEABLE_ALIGN_INCR; ++i)
+    {
+        stats_out->large_cached_blocks += num_cached_per_align_incr[i];
+        stats_out->large_cached_bytes += (u64)num_cached_per_align_incr[i] *
+            (i + 1) * TUNDRA_OS_ALLOC_ALIGNMENT;
+    }
+}
+
+u64 InTundra_LgMemAlc_usable_size(void *ptr)
+{
+    const BlockHeader *HDR = get_header(ptr);
+
+    // Guard pages are part of the block but never usable; realloc relies on
+    // this count stopping short of them.
+    return (u64)HDR->block_align_incr * TUNDRA_OS_ALLOC_ALIGNMENT -
+        HDR->payload_offset - HDR->guard_bytes;
+}
+
+void* InTundra_LgMemAlc_malloc_aligned(u64 num_bytes, u64 alignment)
+{
+    if(num_bytes > MAX_ALLOC_BYTE_SIZE - alignment - BLOCK_HEADER_SIZE)
+    {
+        TUNDRA_FATAL("Allocation amount is too large, limit is: %u",
+            MAX_ALLOC_BYTE_SIZE);
     }
 
-    // -- Head node was a NULL, which means the tail node is also a NULL
-    // and should be set to the only node in the list, which is our new 
-    // freed block. --
+    // Over-allocate by the alignment so the payload can be pushed forward to
+    // the first aligned address that still leaves room for the header in
+    // front of it. Aligned blocks never come from the cache since cached
+    // blocks have a fixed payload address.
+    u32 align_incr = calc_min_align_incr(num_bytes + alignment +
+        BLOCK_HEADER_SIZE);
+
+    void *mem = get_block_mem_from_os(&align_incr);
+
+    track_live_block(align_incr);
 
-    cached_blocks_tail[ALIGN_INCR_IDX] = new_free_block;
+    u8 *payload = (u8*)(((u64)mem + BLOCK_HEADER_SIZE + alignment - 1) &
+        ~(alignment - 1));
+
+    BlockHeader *hdr = get_header((void*)payload);
+
+    hdr->block_align_incr = align_incr;
+    hdr->payload_offset = (u32)(payload - (u8*)mem);
+    hdr->guard_bytes = 0;
+
+    return (void*)payload;
 }
 
-void* InTundra_LgMemAlc_malloc(u64 num_bytes) 
+void* InTundra_LgMemAlc_malloc_on_node(u64 num_bytes, u32 node)
+{
+    if(num_bytes > MAX_ALLOC_BYTE_SIZE - TUNDRA_OS_ALLOC_ALIGNMENT)
+    {
+        TUNDRA_FATAL("Allocation amount is too large, limit is: %u",
+            MAX_ALLOC_BYTE_SIZE);
+    }
+
+    // One extra page in front holds the header and page aligns the payload.
+    // The aligned payload offset keeps the freed block out of the shared
+    // cache, where a thread on another socket could recycle its bound pages.
+    u32 align_incr = calc_min_align_incr(num_bytes) + 1;
+
+    void *mem = get_block_mem_from_os(&align_incr);
+
+    // Bind before the header write below faults the first page, so every
+    // page of the block faults in on the requested node.
+    InTundra_Mem_bind_mem_to_node(mem, (u64)align_incr *
+        TUNDRA_OS_ALLOC_ALIGNMENT, node);
+
+    track_live_block(align_incr);
+
+    u8 *payload = (u8*)mem + TUNDRA_OS_ALLOC_ALIGNMENT;
+
+    BlockHeader *hdr = get_header((void*)payload);
+
+    hdr->block_align_incr = align_incr;
+    hdr->payload_offset = TUNDRA_OS_ALLOC_ALIGNMENT;
+    hdr->guard_bytes = 0;
+
+    return (void*)payload;
+}
+
+void* InTundra_LgMemAlc_malloc_zeroed(u64 num_bytes)
 {
     if(num_bytes > MAX_ALLOC_BYTE_SIZE)
     {
@@ -395,19 +737,79 @@ void* InTundra_LgMemAlc_malloc(u64 num_bytes)
             MAX_ALLOC_BYTE_SIZE);
     }
 
-    u32 align_incr = calc_min_align_incr(num_bytes + 
+    // Sampled allocations trade this block's cache eligibility for a guard
+    // page. Fresh os pages arrive zeroed, so the guarded path satisfies the
+    // zeroing for free.
+    void *guarded = try_guarded_block(num_bytes);
+
+    if(guarded != NULL) { return guarded; }
+
+    u32 align_incr = calc_min_align_incr(num_bytes + BLOCK_HEADER_SIZE);
+
+    // Only recycled cache blocks hold stale bytes and need clearing.
+    if(align_incr <= cache_align_incr_limit)
+    {
+        void *cached = pop_cached_block(align_incr);
+
+        if(cached != NULL)
+        {
+            TUNDRA_STAT_INCR(LG_CACHE_HIT);
+            __atomic_fetch_add(&cache_hit_count, 1, __ATOMIC_RELAXED);
+            track_live_block(align_incr);
+
+            Tundra_zero_out_mem(cached,
+                (u64)align_incr * TUNDRA_OS_ALLOC_ALIGNMENT -
+                BLOCK_HEADER_SIZE);
+
+            return cached;
+        }
+    }
+
+    TUNDRA_STAT_INCR(LG_CACHE_MISS);
+    __atomic_fetch_add(&cache_miss_count, 1, __ATOMIC_RELAXED);
+
+    // Fresh anonymous os pages arrive already zeroed, so the payload needs no
+    // touch at all.
+    return create_new_block(align_incr);
+}
+
+void* InTundra_LgMemAlc_malloc(u64 num_bytes)
+{
+    if(num_bytes > MAX_ALLOC_BYTE_SIZE)
+    {
+        TUNDRA_FATAL("Allocation amount is too large, limit is: %u",
+            MAX_ALLOC_BYTE_SIZE);
+    }
+
+    // Sampled allocations are laid out against a guard page instead of
+    // taking the cached path.
+    void *guarded = try_guarded_block(num_bytes);
+
+    if(guarded != NULL) { return guarded; }
+
+    u32 align_incr = calc_min_align_incr(num_bytes +
         BLOCK_HEADER_SIZE);
 
-    // If the number of pages that make up this memory if more than what we can
-    // cache, it's not possible to have a cached block for this size. If this 
-    // first check failed, then we check if there aren't any cached blocks for
-    // this page size. If either are true, simply create a new block without 
-    // looking for an available one.
-    if(align_incr > MAX_ALIGN_INCR_FOR_CACHING || 
-        get_num_cached(align_incr) == 0)
+    // If the number of pages that make up this memory is more than what we
+    // can cache, it's not possible to have a cached block for this size.
+    // Otherwise try popping one; a NULL means the stack was empty (or another
+    // thread raced us to its blocks) and a new block is created instead.
+    if(align_incr <= cache_align_incr_limit)
     {
-        return create_new_block(align_incr);
+        void *cached = pop_cached_block(align_incr);
+
+        if(cached != NULL)
+        {
+            TUNDRA_STAT_INCR(LG_CACHE_HIT);
+            __atomic_fetch_add(&cache_hit_count, 1, __ATOMIC_RELAXED);
+            track_live_block(align_incr);
+
+            return cached;
+        }
     }
 
-    return get_available_block(align_incr);
+    TUNDRA_STAT_INCR(LG_CACHE_MISS);
+    __atomic_fetch_add(&cache_miss_count, 1, __ATOMIC_RELAXED);
+
+    return create_new_block(align_incr);
 }
@@ -40,6 +40,131 @@ CLAMP_MAX_IMPL(u64, u64)
 CLAMP_MIN_IMPL(i64, i64)
 CLAMP_MAX_IMPL(i64, i64)
 
+// Buffer Clamp Implementations
+//
+// The branchless min/max pair in a plain counted loop maps straight onto the
+// hardware's packed min/max instructions, clamping a full vector of elements
+// per iteration instead of paying two branches per element.
+#define CLAMP_ARR_IMPL(name, type) \
+void Tundra_clamp_arr_##name(type *data, u64 num_elem, type min, type max) \
+{ \
+    for(u64 i = 0; i < num_elem; ++i) \
+    { \
+        type val = data[i]; \
+        val = (val < min) ? min : val; \
+        val = (val > max) ? max : val; \
+        data[i] = val; \
+    } \
+}
+
+CLAMP_ARR_IMPL(u8, u8)
+CLAMP_ARR_IMPL(i8, i8)
+CLAMP_ARR_IMPL(u16, u16)
+CLAMP_ARR_IMPL(i16, i16)
+CLAMP_ARR_IMPL(u32, u32)
+CLAMP_ARR_IMPL(i32, i32)
+CLAMP_ARR_IMPL(u64, u64)
+CLAMP_ARR_IMPL(i64, i64)
+CLAMP_ARR_IMPL(float, float)
+CLAMP_ARR_IMPL(double, double)
+
+// Array Reduction Implementations
+//
+// Four independent accumulators break the loop-carried dependency so the
+// compiler can vectorize and the hardware can overlap iterations.
+#define MIN_ARR_IMPL(name, type) \
+type Tundra_min_##name##_arr(const type *elems, u64 num_elem) \
+{ \
+    type acc0 = elems[0]; \
+    type acc1 = elems[0]; \
+    type acc2 = elems[0]; \
+    type acc3 = elems[0]; \
+\
+    u64 i = 0; \
+\
+    for(; i + 4 <= num_elem; i += 4) \
+    { \
+        acc0 = (elems[i] < acc0) ? elems[i] : acc0; \
+        acc1 = (elems[i + 1] < acc1) ? elems[i + 1] : acc1; \
+        acc2 = (elems[i + 2] < acc2) ? elems[i + 2] : acc2; \
+        acc3 = (elems[i + 3] < acc3) ? elems[i + 3] : acc3; \
+    } \
+\
+    for(; i < num_elem; ++i) \
+    { \
+        acc0 = (elems[i] < acc0) ? elems[i] : acc0; \
+    } \
+\
+    acc0 = (acc1 < acc0) ? acc1 : acc0; \
+    acc2 = (acc3 < acc2) ? acc3 : acc2; \
+    return (acc2 < acc0) ? acc2 : acc0; \
+}
+#define MAX_ARR_IMPL(name, type) \
+type Tundra_max_##name##_arr(const type *elems, u64 num_elem) \
+{ \
+    type acc0 = elems[0]; \
+    type acc1 = elems[0]; \
+    type acc2 = elems[0]; \
+    type acc3 = elems[0]; \
+\
+    u64 i = 0; \
+\
+    for(; i + 4 <= num_elem; i += 4) \
+    { \
+        acc0 = (elems[i] > acc0) ? elems[i] : acc0; \
+        acc1 = (elems[i + 1] > acc1) ? elems[i + 1] : acc1; \
+        acc2 = (elems[i + 2] > acc2) ? elems[i + 2] : acc2; \
+        acc3 = (elems[i + 3] > acc3) ? elems[i + 3] : acc3; \
+    } \
+\
+    for(; i < num_elem; ++i) \
+    { \
+        acc0 = (elems[i] > acc0) ? elems[i] : acc0; \
+    } \
+\
+    acc0 = (acc1 > acc0) ? acc1 : acc0; \
+    acc2 = (acc3 > acc2) ? acc3 : acc2; \
+    return (acc2 > acc0) ? acc2 : acc0; \
+}
+#define SUM_ARR_IMPL(name, type) \
+type Tundra_sum_##name##_arr(const type *elems, u64 num_elem) \
+{ \
+    type acc0 = 0; \
+    type acc1 = 0; \
+    type acc2 = 0; \
+    type acc3 = 0; \
+\
+    u64 i = 0; \
+\
+    for(; i + 4 <= num_elem; i += 4) \
+    { \
+        acc0 += elems[i]; \
+        acc1 += elems[i + 1]; \
+        acc2 += elems[i + 2]; \
+        acc3 += elems[i + 3]; \
+    } \
+\
+    for(; i < num_elem; ++i) \
+    { \
+        acc0 += elems[i]; \
+    } \
+\
+    return (acc0 + acc1) + (acc2 + acc3); \
+}
+
+MIN_ARR_IMPL(u64, u64)
+MAX_ARR_IMPL(u64, u64)
+SUM_ARR_IMPL(u64, u64)
+MIN_ARR_IMPL(i64, i64)
+MAX_ARR_IMPL(i64, i64)
+SUM_ARR_IMPL(i64, i64)
+MIN_ARR_IMPL(float, float)
+MAX_ARR_IMPL(float, float)
+SUM_ARR_IMPL(float, float)
+MIN_ARR_IMPL(double, double)
+MAX_ARR_IMPL(double, double)
+SUM_ARR_IMPL(double, double)
+
 u64 Tundra_ceil_pow2(u64 num)
 {
     if(Tundra_is_pow2(num))
@@ -11,6 +11,8 @@
 #include "tundra/common/BitUtils.h"
 #include "tundra/utils/MemUtils.h"
 #include "tundra/internal/MemAllocHandler.h"
+#include "tundra/internal/SmallMemAlloc.h"
+#include "tundra/internal/LargeMemAlloc.h"
 
 
 // Internal Methods ------------------------------------------------------------
@@ -45,11 +47,31 @@ void* Tundra_alloc_mem(u64 num_bytes)
     return InTundra_Mem_malloc(num_bytes);
 }
 
+void* Tundra_alloc_mem_aligned(u64 num_bytes, u64 alignment)
+{
+    return InTundra_Mem_malloc_aligned(num_bytes, alignment);
+}
+
+void* Tundra_alloc_mem_on_node(u64 num_bytes, u32 node)
+{
+    return InTundra_Mem_malloc_on_node(num_bytes, node);
+}
+
+void* Tundra_alloc_mem_zeroed(u64 num_bytes)
+{
+    return InTundra_Mem_malloc_zeroed(num_bytes);
+}
+
 void Tundra_free_mem(void *mem_ptr)
 {
     InTundra_Mem_free(mem_ptr);
 }
 
+void* Tundra_realloc_mem(void *mem_ptr, u64 num_bytes)
+{
+    return InTundra_Mem_realloc(mem_ptr, num_bytes);
+}
+
 void Tundra_alloc_reserve_mem(void **mem_out, u64 *capacity_out,
     u64 num_bytes)
 {
@@ -78,7 +100,33 @@ void* Tundra_alloc_copy_mem(const void *src, u64 num_alloc_bytes,
     return new_mem;
 }
 
-void Tundra_reserve_mem(void **mem_out, u64* capacity_out, 
+void Tundra_set_mem_cache_limits(u64 max_block_bytes, u8 max_blocks_per_size)
+{
+    InTundra_LgMemAlc_set_cache_limits(max_block_bytes, max_blocks_per_size);
+}
+
+void Tundra_trim_mem_cache(void)
+{
+    InTundra_LgMemAlc_trim_cache();
+}
+
+void Tundra_set_mem_guard_rate(u64 rate)
+{
+    InTundra_LgMemAlc_set_guard_rate(rate);
+}
+
+void Tundra_dump_mem_stats(i64 out_handle)
+{
+    InTundra_Mem_dump_alloc_stats(out_handle);
+}
+
+void Tundra_get_mem_stats(Tundra_MemStats *stats_out)
+{
+    InTundra_SmlMemAlc_gather_stats(stats_out);
+    InTundra_LgMemAlc_gather_stats(stats_out);
+}
+
+void Tundra_reserve_mem(void **mem_out, u64* capacity_out,
     u64 num_used_bytes, u64 num_reserve_bytes)
 {
     u64 tot_req_bytes = num_used_bytes + num_reserve_bytes;
@@ -86,14 +134,11 @@ void Tundra_reserve_mem(void **mem_out, u64* capacity_out,
     // If the capacity is already sufficient.
     if(tot_req_bytes <= *capacity_out) { return; }
 
-    u64 new_cap = 
+    u64 new_cap =
         InTundra_calc_new_capacity_by_doubling(tot_req_bytes, *capacity_out);
 
-    // Create a new block with our calculated sufficient capacity, then copy 
-    // over the old bytes from the original block passed in.
-    void *new_mem = Tundra_alloc_copy_mem(*mem_out, new_cap, num_used_bytes);
-    
-    Tundra_free_mem(*mem_out);
-    *mem_out = new_mem;
+    // Realloc grows the block in place when size-class slack allows it,
+    // otherwise it moves the old bytes to a sufficient new block itself.
+    *mem_out = Tundra_realloc_mem(*mem_out, new_cap);
     *capacity_out = new_cap;
 }
\ No newline at end of file
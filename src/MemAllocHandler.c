@@ -13,6 +13,11 @@
 #include "tundra/utils/FatalHandler.h"
 #include "tundra/internal/SmallMemAlloc.h"
 #include "tundra/internal/LargeMemAlloc.h"
+#include "tundra/utils/ScratchArena.h"
+#include "tundra/internal/Syscall.h"
+#include "tundra/internal/IOInterface.h"
+#include "tundra/common/BitUtils.h"
+#include "tundra/utils/MemUtils.h"
 #include "tundra/common/Core.h"
 
 
@@ -33,6 +38,18 @@
 #define MAP_PRIVATE   0x02
 #define MAP_ANONYMOUS 0x20
 #endif
+#ifndef MAP_HUGETLB
+#define MAP_HUGETLB 0x40000
+#endif
+#ifndef MADV_DONTNEED
+#define MADV_DONTNEED 4
+#endif
+#ifndef MADV_HUGEPAGE
+#define MADV_HUGEPAGE 14
+#endif
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
 
 // Linux x86-64 syscall numbers
 #define SYS_MMAP 9;
@@ -92,16 +109,294 @@ static long munmap_syscall(void *addr, long long num_bytes)
 // Global instance
 // InTundra_SystemMemData InTundra_Mem_data_instance = {0};
 
+// Allocation Tracking ---------------------------------------------------------
+
+#ifdef TUNDRA_TRACK_ALLOCS
+
+/**
+ * Live allocation counts and byte totals per small size class. Updated with
+ * relaxed atomic adds so tracking stays cheap enough to leave enabled in
+ * production.
+ */
+static u64 small_live_count[TUNDRA_NUM_SIZE_CLASSES];
+static u64 small_live_bytes[TUNDRA_NUM_SIZE_CLASSES];
+
+// Number of large alignment increments tracked individually. Larger blocks
+// all share the final overflow bucket.
+#define TRACKED_LARGE_INCRS 512
+
+static u64 large_live_count[TRACKED_LARGE_INCRS + 1];
+static u64 large_live_bytes[TRACKED_LARGE_INCRS + 1];
+
+#ifdef TUNDRA_TRACK_ALLOC_SITES
+
+// Every TUNDRA_TRACK_SITE_INTERVAL-th allocation records its call site, so
+// site capture costs one counter increment on the untaken path.
+#ifndef TUNDRA_TRACK_SITE_INTERVAL
+#define TUNDRA_TRACK_SITE_INTERVAL 64
+#endif
+
+// Capacity of the call site table, must be a power of 2.
+#define NUM_TRACKED_SITES 64
+
+static void *site_addrs[NUM_TRACKED_SITES];
+static u64 site_counts[NUM_TRACKED_SITES];
+static u64 site_bytes[NUM_TRACKED_SITES];
+static u64 site_sample_tick;
+
+/**
+ * @brief Records a sampled allocation call site into the fixed site table,
+ * claiming a slot with a compare exchange on first sight. Samples are dropped
+ * if the table is full.
+ *
+ * @param site Return address of the sampled allocation.
+ * @param num_bytes Byte size of the sampled allocation.
+ */
+static void record_site(void *site, u64 num_bytes)
+{
+    u64 idx = ((u64)site >> 4) & (NUM_TRACKED_SITES - 1);
+
+    for(u32 probes = 0; probes < NUM_TRACKED_SITES; ++probes)
+    {
+        void *existing = __atomic_load_n(&site_addrs[idx], __ATOMIC_RELAXED);
+
+        if(existing == NULL)
+        {
+            void *expected = NULL;
+
+            // Claim the empty slot. Losing the race to a different site
+            // means probing onward, losing it to the same site is fine.
+            if(!__atomic_compare_exchange_n(&site_addrs[idx], &expected, site,
+                false, __ATOMIC_RELAXED, __ATOMIC_RELAXED) && expected != site)
+            {
+                idx = (idx + 1) & (NUM_TRACKED_SITES - 1);
+                continue;
+            }
+        }
+        else if(existing != site)
+        {
+            idx = (idx + 1) & (NUM_TRACKED_SITES - 1);
+            continue;
+        }
+
+        __atomic_fetch_add(&site_counts[idx], 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&site_bytes[idx], num_bytes, __ATOMIC_RELAXED);
+        return;
+    }
+}
+
+#endif // TUNDRA_TRACK_ALLOC_SITES
+
+/**
+ * @brief Adjusts the live allocation counters for `ptr` by one allocation.
+ *
+ * Buckets are derived from the block's usable size, which is identical at
+ * allocation and free time, so counts always balance.
+ *
+ * @param ptr Pointer to the allocated block.
+ * @param is_alloc True to count an allocation, false to count a free.
+ */
+static void track_live_delta(void *ptr, bool is_alloc)
+{
+    u64 *count_slot;
+    u64 *bytes_slot;
+    u64 usable_bytes;
+
+    if(InTundra_SmlMemAlc_is_ptr_in_arena(ptr))
+    {
+        usable_bytes = InTundra_SmlMemAlc_usable_size(ptr);
+
+        // Floor log2 of the usable size maps to the size class index.
+        u64 idx = (u64)(63 - Tundra_get_num_lead_zeros(usable_bytes)) -
+            TUNDRA_MIN_SIZE_CLASS_MSB_POS;
+
+        if(idx >= TUNDRA_NUM_SIZE_CLASSES)
+        {
+            idx = TUNDRA_NUM_SIZE_CLASSES - 1;
+        }
+
+        count_slot = &small_live_count[idx];
+        bytes_slot = &small_live_bytes[idx];
+    }
+    else
+    {
+        usable_bytes = InTundra_LgMemAlc_usable_size(ptr);
+
+        u64 incr = (usable_bytes + TUNDRA_OS_ALLOC_ALIGNMENT - 1) /
+            TUNDRA_OS_ALLOC_ALIGNMENT;
+
+        // Increment 1 lives at index 0, oversized blocks share the overflow
+        // bucket at the end.
+        u64 idx = (incr <= TRACKED_LARGE_INCRS) ?
+            incr - 1 : TRACKED_LARGE_INCRS;
+
+        count_slot = &large_live_count[idx];
+        bytes_slot = &large_live_bytes[idx];
+    }
+
+    if(is_alloc)
+    {
+        __atomic_fetch_add(count_slot, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(bytes_slot, usable_bytes, __ATOMIC_RELAXED);
+        return;
+    }
+
+    __atomic_fetch_sub(count_slot, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_sub(bytes_slot, usable_bytes, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Writes a string literal to the handle, for dump formatting.
+ */
+static void write_lit(i64 handle, const char *str)
+{
+    i64 len = 0;
+    while(str[len] != '\0') { ++len; }
+
+    InTundra_raw_write_bytes(handle, (const void*)str, len);
+}
+
+#endif // TUNDRA_TRACK_ALLOCS
+
+void InTundra_Mem_dump_alloc_stats(i64 handle)
+{
+    #ifndef TUNDRA_TRACK_ALLOCS
+
+    InTundra_raw_write_bytes(handle,
+        "Alloc tracking is disabled, build with TUNDRA_TRACK_ALLOCS.\n", 60);
+
+    #else
+
+    write_lit(handle, "== Tundra live allocations ==\n");
+
+    u64 total_count = 0;
+    u64 total_bytes = 0;
+
+    for(u64 i = 0; i < TUNDRA_NUM_SIZE_CLASSES; ++i)
+    {
+        const u64 COUNT = __atomic_load_n(&small_live_count[i],
+            __ATOMIC_RELAXED);
+
+        if(COUNT == 0) { continue; }
+
+        const u64 BYTES = __atomic_load_n(&small_live_bytes[i],
+            __ATOMIC_RELAXED);
+
+        write_lit(handle, "small class ");
+        InTundra_raw_write_u64(handle,
+            1ULL << (TUNDRA_MIN_SIZE_CLASS_MSB_POS + i));
+        write_lit(handle, " B: ");
+        InTundra_raw_write_u64(handle, COUNT);
+        write_lit(handle, " live, ");
+        InTundra_raw_write_u64(handle, BYTES);
+        write_lit(handle, " B\n");
+
+        total_count += COUNT;
+        total_bytes += BYTES;
+    }
+
+    for(u64 i = 0; i <= TRACKED_LARGE_INCRS; ++i)
+    {
+        const u64 COUNT = __atomic_load_n(&large_live_count[i],
+            __ATOMIC_RELAXED);
+
+        if(COUNT == 0) { continue; }
+
+        const u64 BYTES = __atomic_load_n(&large_live_bytes[i],
+            __ATOMIC_RELAXED);
+
+        write_lit(handle, (i < TRACKED_LARGE_INCRS) ?
+            "large " : "large >");
+        InTundra_raw_write_u64(handle, (i < TRACKED_LARGE_INCRS) ?
+            (i + 1) * TUNDRA_OS_ALLOC_ALIGNMENT :
+            (u64)TRACKED_LARGE_INCRS * TUNDRA_OS_ALLOC_ALIGNMENT);
+        write_lit(handle, " B: ");
+        InTundra_raw_write_u64(handle, COUNT);
+        write_lit(handle, " live, ");
+        InTundra_raw_write_u64(handle, BYTES);
+        write_lit(handle, " B\n");
+
+        total_count += COUNT;
+        total_bytes += BYTES;
+    }
+
+    write_lit(handle, "total: ");
+    InTundra_raw_write_u64(handle, total_count);
+    write_lit(handle, " live, ");
+    InTundra_raw_write_u64(handle, total_bytes);
+    write_lit(handle, " B\n");
+
+    #ifdef TUNDRA_TRACK_ALLOC_SITES
+
+    write_lit(handle, "== Sampled call sites (every ");
+    InTundra_raw_write_u64(handle, TUNDRA_TRACK_SITE_INTERVAL);
+    write_lit(handle, "th alloc) ==\n");
+
+    for(u64 i = 0; i < NUM_TRACKED_SITES; ++i)
+    {
+        void *site = __atomic_load_n(&site_addrs[i], __ATOMIC_RELAXED);
+
+        if(site == NULL) { continue; }
+
+        // Write the site address as hex so it can be fed to a symbolizer.
+        char hex_buff[18] = "0x";
+        u64 addr = (u64)site;
+
+        for(int nibble = 15; nibble >= 0; --nibble)
+        {
+            const u8 DIGIT = (addr >> (nibble * 4)) & 0xF;
+            hex_buff[2 + (15 - nibble)] = (char)((DIGIT < 10) ?
+                '0' + DIGIT : 'a' + (DIGIT - 10));
+        }
+
+        InTundra_raw_write_bytes(handle, hex_buff, 18);
+        write_lit(handle, ": ");
+        InTundra_raw_write_u64(handle,
+            __atomic_load_n(&site_counts[i], __ATOMIC_RELAXED));
+        write_lit(handle, " samples, ");
+        InTundra_raw_write_u64(handle,
+            __atomic_load_n(&site_bytes[i], __ATOMIC_RELAXED));
+        write_lit(handle, " B\n");
+    }
+
+    #endif // TUNDRA_TRACK_ALLOC_SITES
+
+    #endif // TUNDRA_TRACK_ALLOCS
+}
+
+// Tracks one-time initialization of the allocator stack. 0 is uninitialized,
+// 1 is initialization in progress, 2 is ready.
+static u8 init_state;
+
 void InTundra_Mem_init(void)
 {
+    u8 expected = 0;
+
+    // The first caller claims initialization with a compare exchange; every
+    // other caller waits until it finishes, so racing inits are idempotent
+    // and no thread allocates from a half-built allocator.
+    if(!__atomic_compare_exchange_n(&init_state, &expected, 1, false,
+        __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+    {
+        while(__atomic_load_n(&init_state, __ATOMIC_ACQUIRE) != 2)
+        {
+        }
+
+        return;
+    }
+
     InTundra_SmlMemAlc_init();
     InTundra_LgMemAlc_init();
+
+    __atomic_store_n(&init_state, 2, __ATOMIC_RELEASE);
 }
 
 void InTundra_Mem_shutdown(void)
 {
     InTundra_SmlMemAlc_shutdown();
     InTundra_LgMemAlc_shutdown();
+
+    __atomic_store_n(&init_state, 0, __ATOMIC_RELEASE);
 }
 
 void InTundra_Mem_free(void *ptr) 
@@ -112,6 +407,14 @@ void InTundra_Mem_free(void *ptr)
 
     if(ptr == NULL) { return; }
 
+    // Scratch-owned memory is reclaimed by resetting its arena, so individual
+    // frees of it are absorbed here.
+    if(InTundra_ScrArena_try_free(ptr)) { return; }
+
+    #ifdef TUNDRA_TRACK_ALLOCS
+    track_live_delta(ptr, false);
+    #endif
+
     if(InTundra_SmlMemAlc_is_ptr_in_arena(ptr))
     {
         InTundra_SmlMemAlc_free(ptr);
@@ -131,11 +434,168 @@ void* InTundra_Mem_malloc(u64 num_bytes)
 
     TUNDRA_RT_ASSERT(num_bytes != 0, "Requested allocation of 0 bytes.");
 
-    // If num_bytes is larger than the maximum size class of the small 
+    // If the calling thread has a scratch arena scope active, bump the
+    // allocation from it instead. A NULL means no scope is active (or the
+    // arena lacks room) and the request falls through to the allocators.
+    void *scratch_mem = InTundra_ScrArena_scope_alloc(num_bytes);
+
+    if(scratch_mem != NULL) { return scratch_mem; }
+
+    // If num_bytes is larger than the maximum size class of the small
     // allocator, use the large allocator. Otherwise, use the small one.
-    return (num_bytes > TUNDRA_MAX_SIZE_CLASS_BYTE_SIZE) ? 
-        InTundra_LgMemAlc_malloc(num_bytes) : 
+    void *mem = (num_bytes > TUNDRA_MAX_SIZE_CLASS_BYTE_SIZE) ?
+        InTundra_LgMemAlc_malloc(num_bytes) :
         InTundra_SmlMemAlc_malloc(num_bytes);
+
+    #ifdef TUNDRA_TRACK_ALLOCS
+    track_live_delta(mem, true);
+
+    #ifdef TUNDRA_TRACK_ALLOC_SITES
+    if(__atomic_fetch_add(&site_sample_tick, 1, __ATOMIC_RELAXED) %
+        TUNDRA_TRACK_SITE_INTERVAL == 0)
+    {
+        record_site(__builtin_return_address(0), num_bytes);
+    }
+    #endif
+    #endif
+
+    return mem;
+    #endif
+}
+
+void* InTundra_Mem_malloc_zeroed(u64 num_bytes)
+{
+    #ifdef TUNDRA_USE_C_MALLOC
+    return calloc(1, num_bytes);
+    #else
+
+    TUNDRA_RT_ASSERT(num_bytes != 0, "Requested allocation of 0 bytes.");
+
+    // Scratch arena memory is recycled bump space, so it always needs
+    // clearing.
+    void *scratch_mem = InTundra_ScrArena_scope_alloc(num_bytes);
+
+    if(scratch_mem != NULL)
+    {
+        Tundra_zero_out_mem(scratch_mem, num_bytes);
+        return scratch_mem;
+    }
+
+    void *mem;
+
+    if(num_bytes > TUNDRA_MAX_SIZE_CLASS_BYTE_SIZE)
+    {
+        // The large allocator skips the clear entirely for blocks that come
+        // straight from the os.
+        mem = InTundra_LgMemAlc_malloc_zeroed(num_bytes);
+    }
+    else
+    {
+        // Small blocks are carved from recycled arena space; clearing them is
+        // a handful of cachelines at most.
+        mem = InTundra_SmlMemAlc_malloc(num_bytes);
+        Tundra_zero_out_mem(mem, num_bytes);
+    }
+
+    #ifdef TUNDRA_TRACK_ALLOCS
+    track_live_delta(mem, true);
+    #endif
+
+    return mem;
+    #endif
+}
+
+void* InTundra_Mem_malloc_aligned(u64 num_bytes, u64 alignment)
+{
+    #ifdef TUNDRA_USE_C_MALLOC
+    // aligned_alloc requires the size to be a multiple of the alignment.
+    return aligned_alloc(alignment, (num_bytes + alignment - 1) &
+        ~(alignment - 1));
+    #else
+
+    TUNDRA_RT_ASSERT(num_bytes != 0, "Requested allocation of 0 bytes.");
+    TUNDRA_RT_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0,
+        "Requested alignment is not a power of two.");
+
+    // Every allocation already satisfies the base alignment.
+    if(alignment <= TUNDRA_MEM_ALIGNMENT)
+    {
+        return InTundra_Mem_malloc(num_bytes);
+    }
+
+    // The small allocator over-allocates by the alignment plus room for a
+    // re-carved header and a bin-able front pad, so route to the large
+    // allocator if that worst case overflows the maximum size class.
+    void *mem = (num_bytes + alignment + 2 * TUNDRA_MEM_ALIGNMENT >
+        TUNDRA_MAX_SIZE_CLASS_BYTE_SIZE) ?
+        InTundra_LgMemAlc_malloc_aligned(num_bytes, alignment) :
+        InTundra_SmlMemAlc_malloc_aligned(num_bytes, alignment);
+
+    #ifdef TUNDRA_TRACK_ALLOCS
+    track_live_delta(mem, true);
+    #endif
+
+    return mem;
+    #endif
+}
+
+void* InTundra_Mem_malloc_on_node(u64 num_bytes, u32 node)
+{
+    #ifdef TUNDRA_USE_C_MALLOC
+    // No placement control through malloc; the block still works, just with
+    // default placement.
+    (void)node;
+    return malloc(num_bytes);
+    #else
+
+    TUNDRA_RT_ASSERT(num_bytes != 0, "Requested allocation of 0 bytes.");
+
+    // Placement is page granular, so node bound blocks always come from the
+    // large allocator; the small allocator carves shared pages whose node is
+    // whoever faulted them first.
+    void *mem = InTundra_LgMemAlc_malloc_on_node(num_bytes, node);
+
+    #ifdef TUNDRA_TRACK_ALLOCS
+    track_live_delta(mem, true);
+    #endif
+
+    return mem;
+    #endif
+}
+
+void* InTundra_Mem_realloc(void *ptr, u64 num_bytes)
+{
+    #ifdef TUNDRA_USE_C_MALLOC
+    return realloc(ptr, num_bytes);
+    #else
+
+    TUNDRA_RT_ASSERT(num_bytes != 0, "Requested reallocation of 0 bytes.");
+
+    if(ptr == NULL) { return InTundra_Mem_malloc(num_bytes); }
+
+    // Scratch-owned memory is resized within its owning arena.
+    void *scratch_mem = InTundra_ScrArena_realloc(ptr, num_bytes);
+
+    if(scratch_mem != NULL) { return scratch_mem; }
+
+    // The block's usable size may exceed what was originally requested since
+    // both allocators round requests up (size classes for small, os alloc
+    // alignment increments for large). If the new size fits in that slack,
+    // the block grows in place with no copy at all.
+    const u64 USABLE_BYTES = InTundra_SmlMemAlc_is_ptr_in_arena(ptr) ?
+        InTundra_SmlMemAlc_usable_size(ptr) :
+        InTundra_LgMemAlc_usable_size(ptr);
+
+    if(num_bytes <= USABLE_BYTES) { return ptr; }
+
+    // No slack left, fall back to alloc-copy-free.
+    void *new_mem = InTundra_Mem_malloc(num_bytes);
+
+    Tundra_copy_mem_fwd(ptr, new_mem, USABLE_BYTES);
+
+    InTundra_Mem_free(ptr);
+
+    return new_mem;
     #endif
 }
 
@@ -184,3 +644,90 @@ void *InTundra_Mem_get_mem_from_os(u64 num_bytes)
     return mem;
 }
 
+void InTundra_Mem_advise_mem_unneeded(void *ptr, u64 num_bytes)
+{
+    TUNDRA_RT_ASSERT(num_bytes % TUNDRA_OS_ALLOC_ALIGNMENT == 0,
+        "Byte size to advise is not an increment of the required os \
+        alloc alignment.")
+
+    #ifdef TUNDRA_PLATFORM_LINUX
+
+    // Best effort, the memory stays valid (and zero-filled on next touch)
+    // whether or not the kernel honors the advise.
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_MADVISE, (i64)ptr, (i64)num_bytes,
+        MADV_DONTNEED, 0, 0, 0);
+
+    #else // Windows / Apple
+    #error Not implemented.
+    #endif
+}
+
+void InTundra_Mem_protect_mem_none(void *ptr, u64 num_bytes)
+{
+    TUNDRA_RT_ASSERT(num_bytes % TUNDRA_OS_ALLOC_ALIGNMENT == 0,
+        "Byte size to protect is not an increment of the required os \
+        alloc alignment.")
+
+    #ifdef TUNDRA_PLATFORM_LINUX
+
+    // PROT_NONE is 0: no read, write or execute access. Best effort, a
+    // refusal just leaves the range unguarded.
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_MPROTECT, (i64)ptr, (i64)num_bytes,
+        0, 0, 0, 0);
+
+    #else // Windows / Apple
+    #error Not implemented.
+    #endif
+}
+
+void InTundra_Mem_bind_mem_to_node(void *ptr, u64 num_bytes, u32 node)
+{
+    TUNDRA_RT_ASSERT(num_bytes % TUNDRA_OS_ALLOC_ALIGNMENT == 0,
+        "Byte size to bind is not an increment of the required os \
+        alloc alignment.")
+
+    #ifdef TUNDRA_PLATFORM_LINUX
+
+    const u64 NODE_MASK = 1ULL << node;
+
+    // Preferred rather than strict binding: under pressure on the target
+    // node the kernel falls back to another node instead of failing the
+    // later faults. Best effort, like the advises; untouched pages placed
+    // after this land on `node`.
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_MBIND, (i64)ptr, (i64)num_bytes,
+        MPOL_PREFERRED, (i64)&NODE_MASK, 64 + 1, 0);
+
+    #else // Windows / Apple
+    #error Not implemented.
+    #endif
+}
+
+void *InTundra_Mem_get_huge_mem_from_os(u64 num_bytes)
+{
+    TUNDRA_RT_ASSERT(num_bytes % TUNDRA_HUGE_PAGE_BYTE_SIZE == 0,
+        "Byte size to allocate is not an increment of the huge page size.")
+
+    #ifdef TUNDRA_PLATFORM_LINUX
+
+    // Try an explicit huge page mapping first.
+    i64 mem = InTundra_syscall(TUNDRA_LINUX_SYSCALL_MMAP, 0, (i64)num_bytes,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+    if(mem >= 0) { return (void*)mem; }
+
+    // No huge pages available (pool unconfigured or exhausted). Fall back to
+    // a regular mapping and advise the kernel to back it with transparent
+    // huge pages. The advise is best effort, the mapping works without it.
+    void *fallback_mem = InTundra_Mem_get_mem_from_os(num_bytes);
+
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_MADVISE, (i64)fallback_mem,
+        (i64)num_bytes, MADV_HUGEPAGE, 0, 0, 0);
+
+    return fallback_mem;
+
+    #else // Windows / Apple
+    #error Not implemented.
+    #endif
+}
+
@@ -9,12 +9,125 @@
 
 #include "tundra/utils/MemUtils.h"
 #include "tundra/common/SystemInfo.h"
+#include "tundra/common/BitUtils.h"
 
-void Tundra_copy_mem_fwd(const void *src, void *dst, u64 num_bytes)
+// Copies at or below this size use wide overlapping loads/stores; rep movsb
+// only wins once its setup latency is amortized, around 128-256 bytes.
+#define SMALL_COPY_LIMIT_BYTES 256
+
+// Copies at or above this size use non-temporal streaming stores, since a
+// copy this large would otherwise evict the whole cache on its way through.
+#define STREAM_COPY_THRESHOLD_BYTES (8 * TUNDRA_MEBIBYTE)
+
+/**
+ * @brief Copies up to 16 bytes with overlapping wide loads and stores.
+ *
+ * Both lanes are loaded before either store, so the result matches a forward
+ * byte copy for any regions a forward copy supports.
+ *
+ * @param src Source memory block.
+ * @param dst Destination memory block.
+ * @param num_bytes Number of bytes to copy, at most 16.
+ */
+static void copy_fwd_tiny(const u8 *src, u8 *dst, u64 num_bytes)
 {
+    if(num_bytes >= 8)
+    {
+        const u64 LO = *(const u64*)src;
+        const u64 HI = *(const u64*)(src + num_bytes - 8);
+
+        *(u64*)dst = LO;
+        *(u64*)(dst + num_bytes - 8) = HI;
+        return;
+    }
+
+    if(num_bytes >= 4)
+    {
+        const u32 LO = *(const u32*)src;
+        const u32 HI = *(const u32*)(src + num_bytes - 4);
+
+        *(u32*)dst = LO;
+        *(u32*)(dst + num_bytes - 4) = HI;
+        return;
+    }
+
+    if(num_bytes >= 2)
+    {
+        const u16 LO = *(const u16*)src;
+        const u16 HI = *(const u16*)(src + num_bytes - 2);
+
+        *(u16*)dst = LO;
+        *(u16*)(dst + num_bytes - 2) = HI;
+        return;
+    }
+
+    if(num_bytes == 1) { *dst = *src; }
+}
 
 #ifdef TUNDRA_SYS_x86_64
 
+/**
+ * @brief Copies very large ranges with non-temporal 8 byte stores so the
+ * destination does not sweep through the cache.
+ *
+ * @param src Source memory block.
+ * @param dst Destination memory block.
+ * @param num_bytes Number of bytes to copy.
+ */
+static void copy_fwd_streaming(const u8 *src, u8 *dst, u64 num_bytes)
+{
+    // Align the destination to 8 bytes with a forward byte head, streaming
+    // stores require it.
+    while(((u64)dst & 7) != 0 && num_bytes != 0)
+    {
+        *dst++ = *src++;
+        --num_bytes;
+    }
+
+    u64 num_chunks = num_bytes >> 3;
+
+    if(num_chunks != 0)
+    {
+        const u8 *chunk_src = src;
+        u8 *chunk_dst = dst;
+
+        asm volatile
+        (
+            "1:\n\t"
+            "mov (%[s]), %%rax\n\t"
+            "movnti %%rax, (%[d])\n\t" // Store bypassing the cache.
+            "add $8, %[s]\n\t"
+            "add $8, %[d]\n\t"
+            "dec %[n]\n\t"
+            "jnz 1b\n\t"
+            "sfence" // Order the streaming stores with later accesses.
+            : [s]"+r"(chunk_src), [d]"+r"(chunk_dst), [n]"+r"(num_chunks)
+            :
+            : "rax", "memory", "cc"
+        );
+
+        src += (num_bytes & ~(u64)7);
+        dst += (num_bytes & ~(u64)7);
+        num_bytes &= 7;
+    }
+
+    // Forward byte tail.
+    while(num_bytes != 0)
+    {
+        *dst++ = *src++;
+        --num_bytes;
+    }
+}
+
+/**
+ * @brief Mid-size copy kernel, rep movsb variant.
+ *
+ * @param src Source memory block.
+ * @param dst Destination memory block.
+ * @param num_bytes Number of bytes to copy.
+ */
+static void copy_fwd_mid_movsb(const u8 *src, u8 *dst, u64 num_bytes)
+{
     asm volatile
     (
         "rep movsb" // Copy bytes forward.
@@ -22,8 +135,157 @@ void Tundra_copy_mem_fwd(const void *src, void *dst, u64 num_bytes)
         : "D"(dst), "S"(src), "c"(num_bytes)
         : "memory", "cc"
     );
+}
+
+/**
+ * @brief Mid-size copy kernel, avx2 variant. 64 bytes per iteration with
+ * unaligned ymm moves, which beat rep movsb's startup latency across the
+ * sub-streaming range on most parts.
+ *
+ * The instructions are hand-encoded in inline asm, so the build's baseline
+ * ISA flags don't matter; this variant is only ever reached after the
+ * runtime feature probe confirms avx2.
+ *
+ * @param src Source memory block.
+ * @param dst Destination memory block.
+ * @param num_bytes Number of bytes to copy.
+ */
+static void copy_fwd_mid_avx2(const u8 *src, u8 *dst, u64 num_bytes)
+{
+    u64 num_chunks = num_bytes >> 6;
+
+    if(num_chunks != 0)
+    {
+        const u8 *chunk_src = src;
+        u8 *chunk_dst = dst;
+
+        asm volatile
+        (
+            "1:\n\t"
+            "vmovdqu (%[s]), %%ymm0\n\t"
+            "vmovdqu 32(%[s]), %%ymm1\n\t"
+            "vmovdqu %%ymm0, (%[d])\n\t"
+            "vmovdqu %%ymm1, 32(%[d])\n\t"
+            "add $64, %[s]\n\t"
+            "add $64, %[d]\n\t"
+            "dec %[n]\n\t"
+            "jnz 1b\n\t"
+            "vzeroupper" // Avoid the sse/avx transition penalty afterward.
+            : [s]"+r"(chunk_src), [d]"+r"(chunk_dst), [n]"+r"(num_chunks)
+            :
+            : "xmm0", "xmm1", "memory", "cc"
+        );
+
+        src += (num_bytes & ~(u64)63);
+        dst += (num_bytes & ~(u64)63);
+        num_bytes &= 63;
+    }
+
+    // Forward byte tail.
+    while(num_bytes != 0)
+    {
+        *dst++ = *src++;
+        --num_bytes;
+    }
+}
+
+static void copy_fwd_mid_select(const u8 *src, u8 *dst, u64 num_bytes);
+
+// Mid-size copy kernel, lazily bound. The first call probes the cpu's
+// features and rebinds the pointer to the widest safe variant; every later
+// call jumps straight to it.
+static void (*copy_fwd_mid)(const u8 *src, u8 *dst, u64 num_bytes) =
+    copy_fwd_mid_select;
+
+/**
+ * @brief First-call resolver for the mid-size copy kernel.
+ *
+ * @param src Source memory block.
+ * @param dst Destination memory block.
+ * @param num_bytes Number of bytes to copy.
+ */
+static void copy_fwd_mid_select(const u8 *src, u8 *dst, u64 num_bytes)
+{
+    copy_fwd_mid = Tundra_cpu_has_features(TUNDRA_CPU_FEAT_AVX2) ?
+        copy_fwd_mid_avx2 : copy_fwd_mid_movsb;
+
+    copy_fwd_mid(src, dst, num_bytes);
+}
+
+#endif // TUNDRA_SYS_x86_64
+
+void Tundra_copy_mem_fwd(const void *src, void *dst, u64 num_bytes)
+{
+    const u8 *src_cast = (const u8*)src;
+    u8 *dst_cast = (u8*)dst;
+
+    if(num_bytes <= 16)
+    {
+        copy_fwd_tiny(src_cast, dst_cast, num_bytes);
+        return;
+    }
+
+    if(num_bytes <= SMALL_COPY_LIMIT_BYTES)
+    {
+        // Preload the final 16 bytes before the chunk loop. With that done,
+        // every load in this tier reads original source bytes even when the
+        // regions overlap with dst below src, matching a forward byte copy.
+        const u64 TAIL_LO = *(const u64*)(src_cast + num_bytes - 16);
+        const u64 TAIL_HI = *(const u64*)(src_cast + num_bytes - 8);
+
+        for(u64 offset = 0; offset + 16 <= num_bytes; offset += 16)
+        {
+            const u64 LO = *(const u64*)(src_cast + offset);
+            const u64 HI = *(const u64*)(src_cast + offset + 8);
+
+            *(u64*)(dst_cast + offset) = LO;
+            *(u64*)(dst_cast + offset + 8) = HI;
+        }
+
+        *(u64*)(dst_cast + num_bytes - 16) = TAIL_LO;
+        *(u64*)(dst_cast + num_bytes - 8) = TAIL_HI;
+        return;
+    }
+
+#ifdef TUNDRA_SYS_x86_64
+
+    if(num_bytes >= STREAM_COPY_THRESHOLD_BYTES)
+    {
+        copy_fwd_streaming(src_cast, dst_cast, num_bytes);
+        return;
+    }
+
+    copy_fwd_mid(src_cast, dst_cast, num_bytes);
+
+#elif defined(TUNDRA_SYS_ARM)
+
+    // NEON pair copy, 32 bytes per iteration. Forward chunking reads ahead
+    // of every store, so dst-below-src overlap behaves like a forward byte
+    // copy, same as the rep movsb path.
+    u64 num_chunks = num_bytes >> 5;
+
+    asm volatile
+    (
+        "1:\n\t"
+        "ldp q0, q1, [%[s]], #32\n\t"
+        "stp q0, q1, [%[d]], #32\n\t"
+        "subs %[n], %[n], #1\n\t"
+        "b.ne 1b"
+        : [s]"+r"(src_cast), [d]"+r"(dst_cast), [n]"+r"(num_chunks)
+        :
+        : "v0", "v1", "memory", "cc"
+    );
 
-#else // ARM
+    num_bytes &= 31;
+
+    // Forward byte tail.
+    while(num_bytes != 0)
+    {
+        *dst_cast++ = *src_cast++;
+        --num_bytes;
+    }
+
+#else
 #error Not implemented.
 #endif
 
@@ -51,11 +313,46 @@ void Tundra_copy_mem_bwd(const void *src, void *dst, u64 num_bytes)
         "rep movsb\n\t"    // Copy bytes backward
         "cld\n\t"          // Clear direction flag.
         :     
-        : "D"(dst_cast), "S"(src_cast), "c"(num_bytes)           
+        : "D"(dst_cast), "S"(src_cast), "c"(num_bytes)
         : "memory", "cc"
     );
 
-#else // ARM
+#elif defined(TUNDRA_SYS_ARM)
+
+    // Descending 16 byte NEON chunks. Every load sits below all earlier
+    // stores, matching a backward byte copy for dst-above-src overlap.
+    u64 num_chunks = num_bytes >> 4;
+
+    if(num_chunks != 0)
+    {
+        const u8 *chunk_src = src_cast - 15;
+        u8 *chunk_dst = dst_cast - 15;
+
+        asm volatile
+        (
+            "1:\n\t"
+            "ldr q0, [%[s]], #-16\n\t"
+            "str q0, [%[d]], #-16\n\t"
+            "subs %[n], %[n], #1\n\t"
+            "b.ne 1b"
+            : [s]"+r"(chunk_src), [d]"+r"(chunk_dst), [n]"+r"(num_chunks)
+            :
+            : "v0", "memory", "cc"
+        );
+
+        src_cast -= (num_bytes & ~(u64)15);
+        dst_cast -= (num_bytes & ~(u64)15);
+        num_bytes &= 15;
+    }
+
+    // Backward byte head.
+    while(num_bytes != 0)
+    {
+        *dst_cast-- = *src_cast--;
+        --num_bytes;
+    }
+
+#else
 #error Not implemented.
 #endif
 
@@ -75,31 +372,429 @@ void Tundra_copy_mem_safe(const void *src, void *dst,
 
 void Tundra_zero_out_mem(void *mem, u64 num_bytes)
 {
-    u8 *mem_cast = (u8*)(mem);
 
+#ifdef TUNDRA_SYS_x86_64
+
+    asm volatile
+    (
+        "rep stosb" // Store the zeroed al across the range.
+        :
+        : "D"(mem), "a"(0), "c"(num_bytes)
+        : "memory", "cc"
+    );
+
+#elif defined(TUNDRA_SYS_ARM)
+
+    u8 *mem_cast = (u8*)mem;
+
+    u64 num_chunks = num_bytes >> 5;
+
+    if(num_chunks != 0)
+    {
+        u8 *chunk = mem_cast;
+
+        asm volatile
+        (
+            "movi v0.16b, #0\n\t"
+            "1:\n\t"
+            "stp q0, q0, [%[d]], #32\n\t"
+            "subs %[n], %[n], #1\n\t"
+            "b.ne 1b"
+            : [d]"+r"(chunk), [n]"+r"(num_chunks)
+            :
+            : "v0", "memory", "cc"
+        );
+
+        mem_cast += (num_bytes & ~(u64)31);
+        num_bytes &= 31;
+    }
+
+    while(num_bytes != 0)
+    {
+        *mem_cast++ = 0;
+        --num_bytes;
+    }
+
+#else
+#error Not implemented.
+#endif
+
+}
+
+void Tundra_fill_mem(void *mem, u8 value, u64 num_bytes)
+{
+
+#ifdef TUNDRA_SYS_x86_64
+
+    asm volatile
+    (
+        "rep stosb" // Store the byte in al across the range.
+        :
+        : "D"(mem), "a"(value), "c"(num_bytes)
+        : "memory", "cc"
+    );
+
+#elif defined(TUNDRA_SYS_ARM)
+
+    u8 *mem_cast = (u8*)mem;
+
+    u64 num_chunks = num_bytes >> 5;
+
+    if(num_chunks != 0)
+    {
+        u8 *chunk = mem_cast;
+
+        asm volatile
+        (
+            "dup v0.16b, %w[v]\n\t" // Broadcast the byte across a q lane.
+            "1:\n\t"
+            "stp q0, q0, [%[d]], #32\n\t"
+            "subs %[n], %[n], #1\n\t"
+            "b.ne 1b"
+            : [d]"+r"(chunk), [n]"+r"(num_chunks)
+            : [v]"r"((u32)value)
+            : "v0", "memory", "cc"
+        );
+
+        mem_cast += (num_bytes & ~(u64)31);
+        num_bytes &= 31;
+    }
+
+    while(num_bytes != 0)
+    {
+        *mem_cast++ = value;
+        --num_bytes;
+    }
+
+#else
+#error Not implemented.
+#endif
+
+}
+
+void Tundra_fill_mem_u32(void *mem, u32 value, u64 num_elems)
+{
+
+#ifdef TUNDRA_SYS_x86_64
+
+    asm volatile
+    (
+        "rep stosl" // Store the 4 byte pattern in eax across the range.
+        :
+        : "D"(mem), "a"(value), "c"(num_elems)
+        : "memory", "cc"
+    );
+
+#elif defined(TUNDRA_SYS_ARM)
+
+    u32 *mem_cast = (u32*)mem;
+
+    u64 num_chunks = num_elems >> 3; // 8 elements per 32 byte store pair.
+
+    if(num_chunks != 0)
+    {
+        u32 *chunk = mem_cast;
+
+        asm volatile
+        (
+            "dup v0.4s, %w[v]\n\t" // Broadcast the element across a q lane.
+            "1:\n\t"
+            "stp q0, q0, [%[d]], #32\n\t"
+            "subs %[n], %[n], #1\n\t"
+            "b.ne 1b"
+            : [d]"+r"(chunk), [n]"+r"(num_chunks)
+            : [v]"r"(value)
+            : "v0", "memory", "cc"
+        );
+
+        mem_cast += (num_elems & ~(u64)7);
+        num_elems &= 7;
+    }
+
+    while(num_elems != 0)
+    {
+        *mem_cast++ = value;
+        --num_elems;
+    }
+
+#else
+#error Not implemented.
+#endif
+
+}
+
+void Tundra_fill_mem_u64(void *mem, u64 value, u64 num_elems)
+{
+
+#ifdef TUNDRA_SYS_x86_64
+
+    asm volatile
+    (
+        "rep stosq" // Store the 8 byte pattern in rax across the range.
+        :
+        : "D"(mem), "a"(value), "c"(num_elems)
+        : "memory", "cc"
+    );
+
+#elif defined(TUNDRA_SYS_ARM)
+
+    u64 *mem_cast = (u64*)mem;
+
+    u64 num_chunks = num_elems >> 2; // 4 elements per 32 byte store pair.
+
+    if(num_chunks != 0)
+    {
+        u64 *chunk = mem_cast;
+
+        asm volatile
+        (
+            "dup v0.2d, %x[v]\n\t" // Broadcast the element across a q lane.
+            "1:\n\t"
+            "stp q0, q0, [%[d]], #32\n\t"
+            "subs %[n], %[n], #1\n\t"
+            "b.ne 1b"
+            : [d]"+r"(chunk), [n]"+r"(num_chunks)
+            : [v]"r"(value)
+            : "v0", "memory", "cc"
+        );
+
+        mem_cast += (num_elems & ~(u64)3);
+        num_elems &= 3;
+    }
+
+    while(num_elems != 0)
+    {
+        *mem_cast++ = value;
+        --num_elems;
+    }
+
+#else
+#error Not implemented.
+#endif
+
+}
+
+bool Tundra_cmp_mem(const void *first, const void *second,
+    u64 num_bytes)
+{
+    return Tundra_compare_mem_eq(first, second, num_bytes);
+}
+
+i32 Tundra_compare_mem(const void *first, const void *second, u64 num_bytes)
+{
+    const u8 *first_cast = (const u8*)first;
+    const u8 *second_cast = (const u8*)second;
+
+    // Compare two unaligned 8 byte lanes per iteration. A xor of the lanes is
+    // nonzero exactly at the differing bits, and on a little-endian machine
+    // the trailing-zero count of that xor lands in the first differing byte.
+    while(num_bytes >= 16)
+    {
+        const u64 FIRST_LO = *(const u64*)first_cast;
+        const u64 SECOND_LO = *(const u64*)second_cast;
+
+        if(FIRST_LO != SECOND_LO)
+        {
+            const u8 BYTE_IDX =
+                Tundra_get_num_trail_zeros(FIRST_LO ^ SECOND_LO) >> 3;
+
+            return (i32)first_cast[BYTE_IDX] - (i32)second_cast[BYTE_IDX];
+        }
+
+        const u64 FIRST_HI = *(const u64*)(first_cast + 8);
+        const u64 SECOND_HI = *(const u64*)(second_cast + 8);
+
+        if(FIRST_HI != SECOND_HI)
+        {
+            const u8 BYTE_IDX =
+                Tundra_get_num_trail_zeros(FIRST_HI ^ SECOND_HI) >> 3;
+
+            return (i32)first_cast[8 + BYTE_IDX] -
+                (i32)second_cast[8 + BYTE_IDX];
+        }
+
+        first_cast += 16;
+        second_cast += 16;
+        num_bytes -= 16;
+    }
+
+    // Scalar tail.
     for(u64 i = 0; i < num_bytes; ++i)
     {
-        mem_cast[i] = 0;
+        if(first_cast[i] != second_cast[i])
+        {
+            return (i32)first_cast[i] - (i32)second_cast[i];
+        }
     }
+
+    return 0;
 }
 
-bool Tundra_cmp_mem(const void *first, const void *second, 
+bool Tundra_compare_mem_eq(const void *first, const void *second,
     u64 num_bytes)
 {
-    const u8 *first_u8_ptr = (u8 *)first;
-    const u8 *second_u8_ptr = (u8 *)second;
+    const u8 *first_cast = (const u8*)first;
+    const u8 *second_cast = (const u8*)second;
+
+    // Equality only needs a wide xor check per 16 byte chunk, early-outing on
+    // the first difference.
+    while(num_bytes >= 16)
+    {
+        const u64 DIFF = (*(const u64*)first_cast ^
+            *(const u64*)second_cast) |
+            (*(const u64*)(first_cast + 8) ^
+            *(const u64*)(second_cast + 8));
+
+        if(DIFF != 0) { return false; }
 
+        first_cast += 16;
+        second_cast += 16;
+        num_bytes -= 16;
+    }
+
+    // Scalar tail.
     for(u64 i = 0; i < num_bytes; ++i)
-    {   
-        if(*first_u8_ptr != *second_u8_ptr) { return false; }
-        ++first_u8_ptr;
-        ++second_u8_ptr;
+    {
+        if(first_cast[i] != second_cast[i]) { return false; }
     }
 
     return true;
 }
 
-void Tundra_erase_shift_left(void *mem, u64 index, 
+i64 Tundra_find_byte(const void *mem, u64 num_bytes, u8 value)
+{
+    const u8 *mem_cast = (const u8*)mem;
+
+    const u64 BROADCAST = (u64)value * 0x0101010101010101ULL;
+    const u64 LOW_BITS = 0x0101010101010101ULL;
+    const u64 HIGH_BITS = 0x8080808080808080ULL;
+
+    u64 pos = 0;
+
+    // Two unaligned 8 byte lanes per iteration. A xor against the broadcast
+    // byte zeroes exactly the matching bytes, the SWAR zero-byte test flags
+    // them, and the trailing-zero count of the flags lands in the first match.
+    while(pos + 16 <= num_bytes)
+    {
+        const u64 LO = *(const u64*)(mem_cast + pos) ^ BROADCAST;
+        const u64 FOUND_LO = (LO - LOW_BITS) & ~LO & HIGH_BITS;
+
+        if(FOUND_LO != 0)
+        {
+            return (i64)(pos + (Tundra_get_num_trail_zeros(FOUND_LO) >> 3));
+        }
+
+        const u64 HI = *(const u64*)(mem_cast + pos + 8) ^ BROADCAST;
+        const u64 FOUND_HI = (HI - LOW_BITS) & ~HI & HIGH_BITS;
+
+        if(FOUND_HI != 0)
+        {
+            return (i64)(pos + 8 +
+                (Tundra_get_num_trail_zeros(FOUND_HI) >> 3));
+        }
+
+        pos += 16;
+    }
+
+    // Scalar tail.
+    for(; pos < num_bytes; ++pos)
+    {
+        if(mem_cast[pos] == value) { return (i64)pos; }
+    }
+
+    return -1;
+}
+
+i64 Tundra_rfind_byte(const void *mem, u64 num_bytes, u8 value)
+{
+    const u8 *mem_cast = (const u8*)mem;
+
+    const u64 BROADCAST = (u64)value * 0x0101010101010101ULL;
+    const u64 LOW_7BITS = 0x7F7F7F7F7F7F7F7FULL;
+    const u64 HIGH_BITS = 0x8080808080808080ULL;
+
+    u64 pos = num_bytes;
+
+    // Same lanes as the forward scan, walked from the end. The subtraction
+    // form of the zero-byte test can falsely flag bytes above the lowest
+    // zero, which is harmless for a trailing-zero count but not a leading
+    // one, so this uses the exact carry-out form instead: only a zero byte
+    // leaves its high bit clear after `(lane & 0x7F..) + 0x7F.. | lane`. The
+    // flag of the last match is then the highest set bit; byte i flags bit
+    // 8i + 7, giving i = 7 - (lead zeros >> 3).
+    while(pos >= 16)
+    {
+        const u64 HI = *(const u64*)(mem_cast + pos - 8) ^ BROADCAST;
+        const u64 FOUND_HI = ~(((HI & LOW_7BITS) + LOW_7BITS) | HI) &
+            HIGH_BITS;
+
+        if(FOUND_HI != 0)
+        {
+            return (i64)(pos - 8 + 7 -
+                (Tundra_get_num_lead_zeros(FOUND_HI) >> 3));
+        }
+
+        const u64 LO = *(const u64*)(mem_cast + pos - 16) ^ BROADCAST;
+        const u64 FOUND_LO = ~(((LO & LOW_7BITS) + LOW_7BITS) | LO) &
+            HIGH_BITS;
+
+        if(FOUND_LO != 0)
+        {
+            return (i64)(pos - 16 + 7 -
+                (Tundra_get_num_lead_zeros(FOUND_LO) >> 3));
+        }
+
+        pos -= 16;
+    }
+
+    // Scalar head.
+    while(pos != 0)
+    {
+        --pos;
+        if(mem_cast[pos] == value) { return (i64)pos; }
+    }
+
+    return -1;
+}
+
+i64 Tundra_find_bytes(const void *mem, u64 num_bytes, const void *pattern,
+    u64 num_pattern_bytes)
+{
+    if(num_pattern_bytes == 0) { return 0; }
+    if(num_pattern_bytes > num_bytes) { return -1; }
+
+    const u8 *mem_cast = (const u8*)mem;
+    const u8 *pattern_cast = (const u8*)pattern;
+
+    const u8 FIRST = pattern_cast[0];
+
+    // Last index the pattern could start at and still fit.
+    const u64 LAST_START = num_bytes - num_pattern_bytes;
+
+    u64 pos = 0;
+
+    while(pos <= LAST_START)
+    {
+        const i64 HIT = Tundra_find_byte(mem_cast + pos,
+            LAST_START - pos + 1, FIRST);
+
+        if(HIT < 0) { return -1; }
+
+        pos += (u64)HIT;
+
+        if(Tundra_compare_mem_eq(mem_cast + pos + 1, pattern_cast + 1,
+            num_pattern_bytes - 1))
+        {
+            return (i64)pos;
+        }
+
+        ++pos;
+    }
+
+    return -1;
+}
+
+void Tundra_erase_shift_left(void *mem, u64 index,
     u64 num_erase_bytes, u64 tot_bytes)
 {
     if(mem == NULL || tot_bytes == 0 || num_erase_bytes == 0) 
@@ -117,11 +812,84 @@ u64 Tundra_get_cstr_len(const char *cstr)
 {
     if(cstr == NULL) return 0;
 
-    u64 length = 0;
+#ifdef TUNDRA_SYS_x86_64
+
+    // Scan aligned 16 byte blocks, comparing each against zero bytewise and
+    // movemasking the compare into one terminator bitmask per block. Aligned
+    // loads never cross a page, so reading past the terminator (or before
+    // the string in the first block) touches only memory the string's page
+    // already owns.
+    const char *block = (const char*)((uintptr)cstr & ~(uintptr)15);
+
+    // Bits of the first block that fall before the string's start are
+    // stripped so stray zero bytes there don't terminate the scan early.
+    const u32 FIRST_MASK = 0xFFFFU << ((uintptr)cstr & 15);
+
+    u32 mask;
+
+    asm
+    (
+        "pxor %%xmm0, %%xmm0\n\t"
+        "movdqa (%[p]), %%xmm1\n\t"
+        "pcmpeqb %%xmm0, %%xmm1\n\t"
+        "pmovmskb %%xmm1, %[m]\n\t"
+        "and %[first], %[m]\n\t"
+        "jnz 2f\n"
+        "1:\n\t"
+        "add $16, %[p]\n\t"
+        "movdqa (%[p]), %%xmm1\n\t"
+        "pcmpeqb %%xmm0, %%xmm1\n\t"
+        "pmovmskb %%xmm1, %[m]\n\t"
+        "test %[m], %[m]\n\t"
+        "jz 1b\n"
+        "2:"
+        : [p]"+r"(block), [m]"=&r"(mask)
+        : [first]"r"(FIRST_MASK)
+        : "xmm0", "xmm1", "cc"
+    );
+
+    return (u64)(block - cstr) + Tundra_get_num_trail_zeros((u64)mask);
 
-    char c = cstr[length];
+#elif defined(TUNDRA_SYS_ARM)
 
-    while(c != '\0') c = cstr[++length];
+    // Same aligned block scan with NEON. There is no movemask, so each
+    // block's zero compare is narrowed with a shift-right-by-4 into a 64 bit
+    // mask of 4 bits per matching byte, scannable with a trailing-zero
+    // count like the movemask form.
+    const char *block = (const char*)((uintptr)cstr & ~(uintptr)15);
+
+    // Nibbles of the first block that fall before the string's start are
+    // stripped so stray zero bytes there don't terminate the scan early.
+    const u64 FIRST_MASK = ~(u64)0 << (((uintptr)cstr & 15) * 4);
+
+    u64 mask;
+
+    asm
+    (
+        "movi v0.16b, #0\n\t"
+        "ld1 {v1.16b}, [%[p]]\n\t"
+        "cmeq v1.16b, v1.16b, v0.16b\n\t"
+        "shrn v1.8b, v1.8h, #4\n\t"
+        "fmov %[m], d1\n\t"
+        "and %[m], %[m], %[first]\n\t"
+        "cbnz %[m], 2f\n"
+        "1:\n\t"
+        "add %[p], %[p], #16\n\t"
+        "ld1 {v1.16b}, [%[p]]\n\t"
+        "cmeq v1.16b, v1.16b, v0.16b\n\t"
+        "shrn v1.8b, v1.8h, #4\n\t"
+        "fmov %[m], d1\n\t"
+        "cbz %[m], 1b\n"
+        "2:"
+        : [p]"+r"(block), [m]"=&r"(mask)
+        : [first]"r"(FIRST_MASK)
+        : "v0", "v1"
+    );
+
+    return (u64)(block - cstr) + (Tundra_get_num_trail_zeros(mask) >> 2);
+
+#else
+#error Not implemented.
+#endif
 
-    return length;
 }
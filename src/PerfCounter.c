@@ -0,0 +1,149 @@
+/**
+ * @file PerfCounter.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Hardware performance counters around code regions via
+ * perf_event_open.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/PerfCounter.h"
+#include "tundra/internal/Syscall.h"
+
+#ifdef TUNDRA_PLATFORM_LINUX
+
+// Minimal perf_event_attr definitions; only the first attr revision is
+// needed, later fields stay zero and the kernel treats them as absent.
+#define PERF_TYPE_HARDWARE 0
+
+#define PERF_COUNT_HW_CPU_CYCLES 0
+#define PERF_COUNT_HW_CACHE_MISSES 3
+#define PERF_COUNT_HW_BRANCH_MISSES 5
+
+// Bits of the attr flags word.
+#define PERF_FLAG_EXCLUDE_KERNEL (1ULL << 5)
+#define PERF_FLAG_EXCLUDE_HV (1ULL << 6)
+
+typedef struct
+{
+    u32 type;
+    u32 size;
+    u64 config;
+    u64 sample_period;
+    u64 sample_type;
+    u64 read_format;
+    u64 flags;
+    u32 wakeup_events;
+    u32 bp_type;
+    u64 config1;
+} PerfEventAttr;
+
+/**
+ * @brief Opens one hardware counter for the calling thread on any cpu.
+ *
+ * @param config `PERF_COUNT_HW_` event to count.
+ *
+ * @return i64 File descriptor of the counter, negative on failure.
+ */
+static i64 open_counter(u64 config)
+{
+    PerfEventAttr attr = {0};
+
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(PerfEventAttr);
+    attr.config = config;
+    attr.flags = PERF_FLAG_EXCLUDE_KERNEL | PERF_FLAG_EXCLUDE_HV;
+
+    // pid 0, any cpu, no group, no flags: a plain per-thread counter that
+    // starts counting immediately.
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_PERF_EVENT_OPEN,
+        (i64)&attr, 0, -1, -1, 0, 0);
+}
+
+/**
+ * @brief Reads a counter's current value, or 0 for a failed descriptor.
+ *
+ * @param fd Counter descriptor from `open_counter`.
+ *
+ * @return u64 Current counter value.
+ */
+static u64 read_counter(i64 fd)
+{
+    if(fd < 0) { return 0; }
+
+    u64 value = 0;
+
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_READ, fd, (i64)&value,
+        sizeof(value), 0, 0, 0);
+
+    return value;
+}
+
+bool Tundra_PerfCtr_open(Tundra_PerfCounter *ctr)
+{
+    ctr->cycles_fd = open_counter(PERF_COUNT_HW_CPU_CYCLES);
+    ctr->cache_miss_fd = open_counter(PERF_COUNT_HW_CACHE_MISSES);
+    ctr->branch_miss_fd = open_counter(PERF_COUNT_HW_BRANCH_MISSES);
+
+    ctr->begin_cycles = 0;
+    ctr->begin_cache_misses = 0;
+    ctr->begin_branch_misses = 0;
+
+    if(ctr->cycles_fd < 0 || ctr->cache_miss_fd < 0 ||
+        ctr->branch_miss_fd < 0)
+    {
+        // All or nothing; partial counter sets would report misleading
+        // zeroes next to real values.
+        Tundra_PerfCtr_close(ctr);
+        return false;
+    }
+
+    return true;
+}
+
+void Tundra_PerfCtr_begin(Tundra_PerfCounter *ctr)
+{
+    ctr->begin_cycles = read_counter(ctr->cycles_fd);
+    ctr->begin_cache_misses = read_counter(ctr->cache_miss_fd);
+    ctr->begin_branch_misses = read_counter(ctr->branch_miss_fd);
+}
+
+void Tundra_PerfCtr_end(Tundra_PerfCounter *ctr,
+    Tundra_PerfResult *result_out)
+{
+    result_out->cycles = read_counter(ctr->cycles_fd) - ctr->begin_cycles;
+    result_out->cache_misses =
+        read_counter(ctr->cache_miss_fd) - ctr->begin_cache_misses;
+    result_out->branch_misses =
+        read_counter(ctr->branch_miss_fd) - ctr->begin_branch_misses;
+}
+
+void Tundra_PerfCtr_close(Tundra_PerfCounter *ctr)
+{
+    if(ctr->cycles_fd >= 0)
+    {
+        InTundra_syscall(TUNDRA_LINUX_SYSCALL_CLOSE, ctr->cycles_fd,
+            0, 0, 0, 0, 0);
+    }
+
+    if(ctr->cache_miss_fd >= 0)
+    {
+        InTundra_syscall(TUNDRA_LINUX_SYSCALL_CLOSE, ctr->cache_miss_fd,
+            0, 0, 0, 0, 0);
+    }
+
+    if(ctr->branch_miss_fd >= 0)
+    {
+        InTundra_syscall(TUNDRA_LINUX_SYSCALL_CLOSE, ctr->branch_miss_fd,
+            0, 0, 0, 0, 0);
+    }
+
+    ctr->cycles_fd = -1;
+    ctr->cache_miss_fd = -1;
+    ctr->branch_miss_fd = -1;
+}
+
+#else // TUNDRA_PLATFORM_LINUX
+#error Not Implemented
+#endif // TUNDRA_PLATFORM_LINUX
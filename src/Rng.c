@@ -0,0 +1,96 @@
+/**
+ * @file Rng.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Fast non-cryptographic random number generation (xoshiro256++).
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/Rng.h"
+#include "tundra/utils/MemUtils.h"
+
+static inline u64 rotl_u64(u64 bits, u8 amount)
+{
+    return (bits << amount) | (bits >> (64 - amount));
+}
+
+// splitmix64 step, used only to expand the seed into the initial state so
+// even seeds like 0 and 1 start from well-mixed, non-zero state.
+static inline u64 splitmix64_next(u64 *seed_state)
+{
+    u64 mixed = (*seed_state += 0x9E3779B97F4A7C15ULL);
+    mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+    return mixed ^ (mixed >> 31);
+}
+
+void Tundra_Rng_init(Tundra_Rng *rng, u64 seed)
+{
+    rng->state[0] = splitmix64_next(&seed);
+    rng->state[1] = splitmix64_next(&seed);
+    rng->state[2] = splitmix64_next(&seed);
+    rng->state[3] = splitmix64_next(&seed);
+}
+
+u64 Tundra_Rng_next_u64(Tundra_Rng *rng)
+{
+    const u64 RESULT = rotl_u64(rng->state[0] + rng->state[3], 23) +
+        rng->state[0];
+
+    const u64 SHIFTED = rng->state[1] << 17;
+
+    rng->state[2] ^= rng->state[0];
+    rng->state[3] ^= rng->state[1];
+    rng->state[1] ^= rng->state[2];
+    rng->state[0] ^= rng->state[3];
+
+    rng->state[2] ^= SHIFTED;
+    rng->state[3] = rotl_u64(rng->state[3], 45);
+
+    return RESULT;
+}
+
+u64 Tundra_Rng_range_u64(Tundra_Rng *rng, u64 bound)
+{
+    unsigned __int128 product =
+        (unsigned __int128)Tundra_Rng_next_u64(rng) * bound;
+
+    u64 low_bits = (u64)product;
+
+    if(low_bits < bound)
+    {
+        // Reject the low sliver of values that would over-represent small
+        // results; hit at most bound / 2^64 of the time.
+        const u64 THRESHOLD = (0 - bound) % bound;
+
+        while(low_bits < THRESHOLD)
+        {
+            product = (unsigned __int128)Tundra_Rng_next_u64(rng) * bound;
+            low_bits = (u64)product;
+        }
+    }
+
+    return (u64)(product >> 64);
+}
+
+void Tundra_Rng_fill(Tundra_Rng *rng, void *data, u64 num_bytes)
+{
+    u8 *write_pos = (u8*)data;
+
+    while(num_bytes >= 8)
+    {
+        const u64 BITS = Tundra_Rng_next_u64(rng);
+
+        Tundra_copy_mem_fwd((const void*)&BITS, (void*)write_pos, 8);
+        write_pos += 8;
+        num_bytes -= 8;
+    }
+
+    if(num_bytes > 0)
+    {
+        const u64 BITS = Tundra_Rng_next_u64(rng);
+
+        Tundra_copy_mem_fwd((const void*)&BITS, (void*)write_pos, num_bytes);
+    }
+}
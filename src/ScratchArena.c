@@ -0,0 +1,258 @@
+/**
+ * @file ScratchArena.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Bump allocated scratch arena with O(1) whole-arena reset.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/ScratchArena.h"
+#include "tundra/internal/MemAllocHandler.h"
+#include "tundra/utils/FatalHandler.h"
+#include "tundra/utils/MemUtils.h"
+#include "tundra/common/Core.h"
+
+
+// Global Variables ------------------------------------------------------------
+
+// Head of the calling thread's list of live scratch arenas, used to recognize
+// scratch-owned pointers so their frees can be absorbed.
+static __thread Tundra_ScratchArena *live_arenas_head;
+
+// The calling thread's currently scoped arena, NULL if no scope is active.
+static __thread Tundra_ScratchArena *scoped_arena;
+
+
+// Methods ---------------------------------------------------------------------
+
+// -- Local Helper Methods --
+
+/**
+ * @brief Rounds a byte count up to an increment of TUNDRA_MEM_ALIGNMENT so
+ * consecutive bumps stay aligned.
+ *
+ * @param num_bytes Byte count to round.
+ *
+ * @return u64 Rounded byte count.
+ */
+static u64 align_up_bytes(u64 num_bytes)
+{
+    return (num_bytes + TUNDRA_MEM_ALIGNMENT - 1) &
+        ~((u64)TUNDRA_MEM_ALIGNMENT - 1);
+}
+
+/**
+ * @brief Returns true if `ptr` lies inside the arena's memory.
+ *
+ * @param arena Arena to check against.
+ * @param ptr Pointer to check.
+ *
+ * @return bool True if the arena owns the pointer.
+ */
+static bool arena_owns_ptr(const Tundra_ScratchArena *arena, void *ptr)
+{
+    return (u8*)ptr >= arena->base_ptr &&
+        (u8*)ptr < arena->base_ptr + arena->total_size_bytes;
+}
+
+/**
+ * @brief Returns the live arena owning `ptr`, NULL if no live scratch arena
+ * of the calling thread holds it.
+ *
+ * @param ptr Pointer to find the owning arena of.
+ *
+ * @return Tundra_ScratchArena* Owning arena, NULL if none.
+ */
+static Tundra_ScratchArena* find_owning_arena(void *ptr)
+{
+    for(Tundra_ScratchArena *curr = live_arenas_head; curr != NULL;
+        curr = curr->next_live)
+    {
+        if(arena_owns_ptr(curr, ptr)) { return curr; }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Bumps `num_bytes` off an arena if it has room.
+ *
+ * @param arena Arena to bump from.
+ * @param num_bytes Number of bytes to allocate.
+ *
+ * @return void* Pointer to the bumped memory, NULL if the arena lacks room.
+ */
+static void* try_bump(Tundra_ScratchArena *arena, u64 num_bytes)
+{
+    const u64 ALIGNED_BYTES = align_up_bytes(num_bytes);
+
+    if(ALIGNED_BYTES > arena->total_size_bytes - arena->used_bytes)
+    {
+        return NULL;
+    }
+
+    arena->last_alloc_offset = arena->used_bytes;
+
+    void *mem = (void*)(arena->base_ptr + arena->used_bytes);
+
+    arena->used_bytes += ALIGNED_BYTES;
+
+    return mem;
+}
+
+
+// -- Internal Methods --
+
+void* InTundra_ScrArena_scope_alloc(u64 num_bytes)
+{
+    if(scoped_arena == NULL) { return NULL; }
+
+    return try_bump(scoped_arena, num_bytes);
+}
+
+bool InTundra_ScrArena_try_free(void *ptr)
+{
+    return find_owning_arena(ptr) != NULL;
+}
+
+void* InTundra_ScrArena_realloc(void *ptr, u64 num_bytes)
+{
+    Tundra_ScratchArena *arena = find_owning_arena(ptr);
+
+    if(arena == NULL) { return NULL; }
+
+    const u64 PTR_OFFSET = (u64)((u8*)ptr - arena->base_ptr);
+
+    // The most recent allocation can be grown in place by bumping the offset
+    // further, nothing sits past it.
+    if(PTR_OFFSET == arena->last_alloc_offset)
+    {
+        const u64 ALIGNED_BYTES = align_up_bytes(num_bytes);
+
+        if(ALIGNED_BYTES <= arena->total_size_bytes - PTR_OFFSET)
+        {
+            arena->used_bytes = PTR_OFFSET + ALIGNED_BYTES;
+            return ptr;
+        }
+    }
+
+    // Older blocks have no headers, so the exact old size is unknown. Bytes
+    // bumped after the block bound it from above, giving a safe copy size
+    // that never overlaps the new allocation.
+    const u64 COPY_BYTES = (num_bytes < arena->used_bytes - PTR_OFFSET) ?
+        num_bytes : arena->used_bytes - PTR_OFFSET;
+
+    void *new_mem = try_bump(arena, num_bytes);
+
+    // The arena is out of room, move the block to the regular allocator. The
+    // old bytes stay behind until the arena is reset.
+    if(new_mem == NULL) { new_mem = InTundra_Mem_malloc(num_bytes); }
+
+    Tundra_copy_mem_fwd(ptr, new_mem, COPY_BYTES);
+
+    return new_mem;
+}
+
+
+// -- Public Methods --
+
+void Tundra_ScrArena_init(Tundra_ScratchArena *arena, u64 num_bytes)
+{
+    TUNDRA_RT_ASSERT(num_bytes != 0,
+        "Requested scratch arena of 0 bytes.");
+
+    // Round the capacity up to an increment of the os alloc alignment.
+    const u64 TOTAL_BYTES = (num_bytes + TUNDRA_OS_ALLOC_ALIGNMENT - 1) &
+        ~((u64)TUNDRA_OS_ALLOC_ALIGNMENT - 1);
+
+    arena->base_ptr = (u8*)InTundra_Mem_get_mem_from_os(TOTAL_BYTES);
+    arena->used_bytes = 0;
+    arena->total_size_bytes = TOTAL_BYTES;
+    arena->last_alloc_offset = 0;
+    arena->prev_scope = NULL;
+
+    // Register the arena in the calling thread's live list.
+    arena->next_live = live_arenas_head;
+    live_arenas_head = arena;
+}
+
+void* Tundra_ScrArena_alloc(Tundra_ScratchArena *arena, u64 num_bytes)
+{
+    TUNDRA_RT_ASSERT(num_bytes != 0, "Requested allocation of 0 bytes.");
+
+    void *mem = try_bump(arena, num_bytes);
+
+    // The arena is out of room, fall back to the regular allocator so the
+    // request still succeeds.
+    return (mem != NULL) ? mem : InTundra_Mem_malloc(num_bytes);
+}
+
+void Tundra_ScrArena_reset(Tundra_ScratchArena *arena)
+{
+    arena->used_bytes = 0;
+    arena->last_alloc_offset = 0;
+}
+
+Tundra_ScrArenaSnapshot Tundra_ScrArena_snapshot(
+    const Tundra_ScratchArena *arena)
+{
+    Tundra_ScrArenaSnapshot snapshot;
+    snapshot.used_bytes = arena->used_bytes;
+    snapshot.last_alloc_offset = arena->last_alloc_offset;
+    return snapshot;
+}
+
+void Tundra_ScrArena_restore(Tundra_ScratchArena *arena,
+    Tundra_ScrArenaSnapshot snapshot)
+{
+    TUNDRA_RT_ASSERT(snapshot.used_bytes <= arena->used_bytes,
+        "Attempted to restore a scratch arena snapshot taken after the "
+        "arena's current state.");
+
+    arena->used_bytes = snapshot.used_bytes;
+    arena->last_alloc_offset = snapshot.last_alloc_offset;
+}
+
+void Tundra_ScrArena_free(Tundra_ScratchArena *arena)
+{
+    // Unlink the arena from the calling thread's live list.
+    Tundra_ScratchArena **link = &live_arenas_head;
+
+    while(*link != NULL && *link != arena)
+    {
+        link = &(*link)->next_live;
+    }
+
+    if(*link == NULL)
+    {
+        TUNDRA_FATAL("Attempted to free a scratch arena that is not live on "
+            "this thread: %p", (void*)arena);
+    }
+
+    *link = arena->next_live;
+
+    InTundra_Mem_release_mem_to_os((void*)arena->base_ptr,
+        arena->total_size_bytes);
+
+    arena->base_ptr = NULL;
+    arena->used_bytes = 0;
+    arena->total_size_bytes = 0;
+}
+
+void Tundra_ScrArena_push_scope(Tundra_ScratchArena *arena)
+{
+    arena->prev_scope = scoped_arena;
+    scoped_arena = arena;
+}
+
+void Tundra_ScrArena_pop_scope(void)
+{
+    if(scoped_arena == NULL)
+    {
+        TUNDRA_FATAL("Attempted to pop a scratch arena scope with none "
+            "active.");
+    }
+
+    scoped_arena = scoped_arena->prev_scope;
+}
@@ -15,6 +15,9 @@
 #include "tundra/common/TypeDef.h"
 #include "tundra/common/BitUtils.h"
 #include "tundra/utils/FatalHandler.h"
+#include "tundra/utils/Stats.h"
+#include "tundra/utils/Trace.h"
+#include "tundra/common/Core.h"
 
 
 // Definitions -----------------------------------------------------------------
@@ -24,9 +27,23 @@ typedef struct SizeClassLookup
     u16 data[TUNDRA_NUM_SIZE_CLASSES];
 } SizeClassLookup;
 
-// Constant lookup for size classes. The 0th index corresponds to the smallest 
-// size class, which is 2^TUNDRA_MIN_SIZE_CLASS_MSB_POS.
-static SizeClassLookup size_class_l_instance;
+// Constant lookup for size classes. The 0th index corresponds to the smallest
+// size class, which is 2^TUNDRA_MIN_SIZE_CLASS_MSB_POS. Built at compile time
+// so the allocator is usable with no init call.
+static const SizeClassLookup size_class_l_instance =
+{
+    {
+        (u16)(1U << (TUNDRA_MIN_SIZE_CLASS_MSB_POS + 0)),
+        (u16)(1U << (TUNDRA_MIN_SIZE_CLASS_MSB_POS + 1)),
+        (u16)(1U << (TUNDRA_MIN_SIZE_CLASS_MSB_POS + 2)),
+        (u16)(1U << (TUNDRA_MIN_SIZE_CLASS_MSB_POS + 3)),
+        (u16)(1U << (TUNDRA_MIN_SIZE_CLASS_MSB_POS + 4)),
+        (u16)(1U << (TUNDRA_MIN_SIZE_CLASS_MSB_POS + 5)),
+        (u16)(1U << (TUNDRA_MIN_SIZE_CLASS_MSB_POS + 6)),
+        (u16)(1U << (TUNDRA_MIN_SIZE_CLASS_MSB_POS + 7)),
+        (u16)(1U << (TUNDRA_MIN_SIZE_CLASS_MSB_POS + 8)),
+    }
+};
 
 // typedef struct FreedBlock
 // {
@@ -55,61 +72,89 @@ static SizeClassLookup size_class_l_instance;
 //     FreedBlock *freed_bins[TUNDRA_EXPAND(TUNDRA_NUM_SIZE_CLASSES)];
 // } MemArena;
 
-// Global arena instance
-static MemArena arena;
+// Byte size of the first arena in the chain.
+#define DEF_ARENA_SIZE_BYTE 8192
+TUNDRA_CT_ASSERT(DEF_ARENA_SIZE_BYTE % TUNDRA_OS_ALLOC_ALIGNMENT == 0);
+
+// Maximum byte size a single linked arena is allowed to grow to. Arena sizes
+// double with each new link until this cap is reached.
+#define MAX_ARENA_SIZE_BYTE TUNDRA_MEBIBYTE
+
+// Head of the global registry of every arena across all threads. Only pushed
+// to when a new arena is created, and only walked for cross-thread ownership
+// lookups.
+static MemArena *registry_head;
+
+// Head of the calling thread's arena chain, created lazily on the thread's
+// first small allocation. All arenas are OS-backed with their bookkeeping
+// embedded at the start of their own memory.
+static __thread MemArena *thread_arena;
+
+// Total bytes of os memory backing every arena, with its high-water mark.
+// Only touched on arena creation, so the hot path never sees these.
+static u64 total_arena_bytes;
+static u64 peak_arena_bytes;
 
 
 // Methods ---------------------------------------------------------------------
 
 // -- Local Helper Methods --
 
-static void init_size_class_lookup(void)
-{
-    for(int i = 0; i < TUNDRA_EXPAND(TUNDRA_NUM_SIZE_CLASSES); ++i)
-    {
-        size_class_l_instance.data[i] = 
-            (u16)(1ULL << (TUNDRA_EXPAND(TUNDRA_MIN_SIZE_CLASS_MSB_POS) + i));
-    }
-}
-
 /**
  * @brief Returns the index into the size class lookup of the smallest size
  * class that can hold `num_bytes`.
- * 
+ *
  * @param num_bytes Number of bytes to find suitable size class.
  *
- * @return u8 Index into the size class lookup. 
+ * @return u8 Index into the size class lookup.
  */
 static u8 get_size_class_index(u64 num_bytes)
 {
-    if(num_bytes <= size_class_l_instance.data[0])
-    {
-        return 0;
-    }
-
-    bool is_pow_two = (num_bytes & (num_bytes - 1)) == 0;
+    // The wanted index is ceil(log2(num_bytes)) - MIN_CLASS_MSB, clamped to
+    // index 0 for requests at or below the minimum size class. Both fall out
+    // of one leading-zero count: ceil(log2(n)) is 64 - clz(n - 1) for n > 1,
+    // and or-ing in the minimum class's low bits floors the result at index 0
+    // without testing for small or power-of-two requests. For example, 16
+    // bytes gives clz(15 | 15) = 60, so 64 - 60 - 4 = index 0, while 17 bytes
+    // gives clz(31) = 59, so index 1.
+    u8 size_class_index = (u8)(64 - Tundra_get_num_lead_zeros(
+        (num_bytes - 1) | (TUNDRA_MIN_SIZE_CLASS_BYTE_SIZE - 1)) -
+        TUNDRA_MIN_SIZE_CLASS_MSB_POS);
+
+    // Clamp the lookup index to the bounds of the array, which the compiler
+    // lowers to a conditional move.
+    return (size_class_index < TUNDRA_NUM_SIZE_CLASSES) ?
+        size_class_index : TUNDRA_NUM_SIZE_CLASSES - 1;
+}
 
-    // Get the position of the most significant bit.
-    u8 msb = 63ULL - Tundra_get_num_lead_zeros(num_bytes);
+/**
+ * @brief Returns the index of the largest size class whose byte size is less
+ * than or equal to `payload_bytes`.
+ *
+ * Used to bin freed blocks: coalescing can produce payload sizes that are not
+ * exact powers of two, so blocks are binned under the largest class they can
+ * fully satisfy, with their actual size kept in the header.
+ *
+ * @param payload_bytes Payload byte size, must be at least the minimum size
+ * class.
+ *
+ * @return u8 Index into the size class lookup.
+ */
+static u8 get_floor_size_class_index(u64 payload_bytes)
+{
+    u8 msb = 63U - Tundra_get_num_lead_zeros(payload_bytes);
 
-    // If num_bytes is a power of 2, it matches a size class exactly.
-    // Otherwise, find the next power of 2 greater than num_bytes.
-    // The msb index gives the size class bit. Add 1 if not a power of 2.
-    // To map msb to free_bins index, subtract MIN_CLASS_MSB (4).
-    // For example, 16 bytes (2^4) yields msb=4, so index 0.
-    // This ensures the correct index for the smallest aligned size class.
-    u8 size_class_index = 
-        (is_pow_two ? msb : msb + 1) - TUNDRA_MIN_SIZE_CLASS_MSB_POS;
+    u8 size_class_index = msb - TUNDRA_MIN_SIZE_CLASS_MSB_POS;
 
     // Clamp the lookup index to the bounds of the array.
-    return (size_class_index < TUNDRA_NUM_SIZE_CLASSES) ? 
+    return (size_class_index < TUNDRA_NUM_SIZE_CLASSES) ?
         size_class_index : TUNDRA_NUM_SIZE_CLASSES - 1;
 }
 
 /**
  * @brief Given a pointer to a payload inside the arena, returns a pointer to
  * Header that tracks it.
- * 
+ *
  * @param ptr Pointer to the payload
  * @return BlockHeader* Pointer to the Header of the given payload.
  */
@@ -119,30 +164,170 @@ static BlockHeader* get_header_from_payload_ptr(void * ptr)
 }
 
 /**
- * @brief Carves a new block from the arena and returns a pointer to its 
+ * @brief Pushes a not-in-use block onto the freed bin matching its actual
+ * payload size, updating the header's stored size class index.
+ *
+ * @param a Arena that owns the block.
+ * @param header Header of the block to bin.
+ */
+static void push_freed_block(MemArena *a, BlockHeader *header)
+{
+    const u8 BIN_IDX = get_floor_size_class_index(header->block_byte_size);
+
+    header->size_class_index = BIN_IDX;
+
+    FreedBlock *blk = (FreedBlock*)((u8*)header + BLOCK_HEADER_SIZE);
+
+    blk->next = a->freed_bins[BIN_IDX];
+    a->freed_bins[BIN_IDX] = blk;
+    ++a->freed_bin_counts[BIN_IDX];
+}
+
+/**
+ * @brief Unlinks a specific block from one of an arena's freed bins.
+ *
+ * @param a Arena that owns the bin.
+ * @param bin_idx Index of the bin the block is expected to be in.
+ * @param blk Block to unlink.
+ *
+ * @return bool True if the block was found and unlinked, false if it was not
+ * in the bin (e.g. it is sitting on the remote free list instead).
+ */
+static bool remove_from_bin(MemArena *a, u8 bin_idx, FreedBlock *blk)
+{
+    FreedBlock **link = &a->freed_bins[bin_idx];
+
+    while(*link != NULL)
+    {
+        if(*link == blk)
+        {
+            *link = blk->next;
+            --a->freed_bin_counts[bin_idx];
+            return true;
+        }
+
+        link = &(*link)->next;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Absorbs any directly adjacent freed blocks to the right of `header`
+ * into it, growing its payload size.
+ *
+ * Blocks are carved contiguously, so the next header sits right after this
+ * block's payload. Absorption stops at the arena's carve frontier, at an
+ * in-use block, or at a freed block that is not currently binned (it may be
+ * waiting on the remote free list and cannot safely be unlinked).
+ *
+ * @param a Arena that owns the block.
+ * @param header Header of the block to grow.
+ */
+static void coalesce_right(MemArena *a, BlockHeader *header)
+{
+    u8 * const carve_end = a->base_ptr + a->used_bytes;
+
+    while(true)
+    {
+        u8 *next_addr =
+            (u8*)header + BLOCK_HEADER_SIZE + header->block_byte_size;
+
+        if(next_addr >= carve_end) { return; }
+
+        BlockHeader *next_header = (BlockHeader*)next_addr;
+
+        if(next_header->in_use) { return; }
+
+        if(!remove_from_bin(a, next_header->size_class_index,
+            (FreedBlock*)(next_addr + BLOCK_HEADER_SIZE)))
+        {
+            return;
+        }
+
+        // Merge the neighbor's header and payload into this block.
+        header->block_byte_size +=
+            BLOCK_HEADER_SIZE + next_header->block_byte_size;
+    }
+}
+
+/**
+ * @brief Trims a block down to a target size class, binning the cut-off
+ * remainder as a new freed block.
+ *
+ * If the remainder is too small to hold its own header plus the minimum size
+ * class, the slack is left attached to the block instead.
+ *
+ * @param a Arena that owns the block.
+ * @param header Header of the block to split.
+ * @param target_class_index Size class the block is being trimmed to.
+ */
+static void split_block(MemArena *a, BlockHeader *header,
+    u8 target_class_index)
+{
+    const u64 TARGET_BYTES = size_class_l_instance.data[target_class_index];
+
+    const u64 REMAINDER = header->block_byte_size - TARGET_BYTES;
+
+    if(REMAINDER < BLOCK_HEADER_SIZE + TUNDRA_MIN_SIZE_CLASS_BYTE_SIZE)
+    {
+        return;
+    }
+
+    header->block_byte_size = TARGET_BYTES;
+    header->size_class_index = target_class_index;
+
+    // Stamp a header for the remainder right after the trimmed payload and
+    // bin it for reuse.
+    BlockHeader *rem_header = (BlockHeader*)(
+        (u8*)header + BLOCK_HEADER_SIZE + TARGET_BYTES);
+
+    rem_header->block_byte_size = REMAINDER - BLOCK_HEADER_SIZE;
+    rem_header->in_use = false;
+
+    push_freed_block(a, rem_header);
+}
+
+/**
+ * @brief Returns true if an arena has room to carve a block of
+ * `size_class_index` from its unused space.
+ *
+ * @param a Arena to check.
+ * @param size_class_index Index into the size class lookup of the block size.
+ *
+ * @return bool True if a block of the size class fits in the arena.
+ */
+static bool arena_has_room(const MemArena *a, u8 size_class_index)
+{
+    const u64 SIZE_CLASS_BYTES = size_class_l_instance.data[size_class_index];
+
+    return SIZE_CLASS_BYTES + BLOCK_HEADER_SIZE <=
+        a->total_size_bytes - a->used_bytes;
+}
+
+/**
+ * @brief Carves a new block from an arena and returns a pointer to its
  * payload.
- * 
+ *
+ * Assumes the arena has enough unused space for the block, check with
+ * `arena_has_room` first.
+ *
+ * @param a Arena to carve from.
  * @param size_class_index Index into the size class lookup that represents
  * the size class of the block to create.
  *
- * @return void* Pointer to the new block payload. 
+ * @return void* Pointer to the new block payload.
  */
-static void* create_block(u8 size_class_index)
+static void* create_block(MemArena *a, u8 size_class_index)
 {
-    const u64 SIZE_CLASS_BYTES = 
-        size_class_l_instance.data[size_class_index];
+    TUNDRA_STAT_INCR(SML_BLOCK_CREATE);
 
-    // If we don't have enough room left to allocate. 
-    if(SIZE_CLASS_BYTES + BLOCK_HEADER_SIZE > 
-        arena.total_size_bytes - arena.used_bytes)
-    {
-        TUNDRA_FATAL("Out of memory in arena when trying "
-            "to allocate %lu bytes.\n", SIZE_CLASS_BYTES);
-    }
+    const u64 SIZE_CLASS_BYTES =
+        size_class_l_instance.data[size_class_index];
 
     // Get the Header of the new carved block
     BlockHeader *header = (BlockHeader*)(
-        arena.base_ptr + arena.used_bytes);
+        a->base_ptr + a->used_bytes);
 
     header->block_byte_size = SIZE_CLASS_BYTES;
     header->size_class_index = size_class_index;
@@ -150,79 +335,252 @@ static void* create_block(u8 size_class_index)
 
     // Update the arena to reflect the new bytes we carved. We include the size
     // of the payload and the header.
-    arena.used_bytes += SIZE_CLASS_BYTES + BLOCK_HEADER_SIZE;
+    a->used_bytes += SIZE_CLASS_BYTES + BLOCK_HEADER_SIZE;
 
     // Return the pointer to the payload of the new Block.
     return (void*)((u8*)header + BLOCK_HEADER_SIZE);
 }
 
+/**
+ * @brief Pushes an arena onto the global cross-thread registry.
+ *
+ * Lock free, the registry head is claimed with an atomic compare exchange.
+ * Arenas are never removed from the registry until shutdown.
+ *
+ * @param a Arena to register.
+ */
+static void register_arena(MemArena *a)
+{
+    MemArena *head = __atomic_load_n(&registry_head, __ATOMIC_ACQUIRE);
 
-// Public Methods --------------------------------------------------------------
+    do
+    {
+        a->next_registered = head;
+    }
+    while(!__atomic_compare_exchange_n(&registry_head, &head, a, false,
+        __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+}
 
-void InTundra_SmlMemAlc_init(void) 
+/**
+ * @brief Allocates a new arena from the OS and registers it globally.
+ *
+ * The arena's bookkeeping struct is embedded at the start of its own OS
+ * memory, so carving begins just past it.
+ *
+ * @param size_bytes Total byte size of the arena, must be an increment of
+ * TUNDRA_OS_ALLOC_ALIGNMENT.
+ * @param owner_head Head of the owning thread's chain. Pass NULL if the new
+ * arena is itself a chain head.
+ *
+ * @return MemArena* Pointer to the new arena.
+ */
+static MemArena* create_arena(u64 size_bytes, MemArena *owner_head)
 {
-    init_size_class_lookup();
+    TUNDRA_TRACE_SCOPE("sml_arena_create");
+
+    void *mem_from_os = InTundra_Mem_get_mem_from_os(size_bytes);
+
+    MemArena *new_arena = (MemArena*)mem_from_os;
 
-    // enum { DEF_ARENA_SIZE_BYTE = TUNDRA_MEBIBYTE };
-    enum { DEF_ARENA_SIZE_BYTE = 8192 };
+    new_arena->base_ptr = (u8*)mem_from_os;
 
-    if(DEF_ARENA_SIZE_BYTE % TUNDRA_OS_ALLOC_ALIGNMENT != 0)
+    // The arena's own bookkeeping lives at the start of its memory. Round its
+    // size up to the block alignment so carved headers stay aligned.
+    new_arena->used_bytes = (sizeof(MemArena) + TUNDRA_MEM_ALIGNMENT - 1) &
+        ~((u64)TUNDRA_MEM_ALIGNMENT - 1);
+
+    new_arena->total_size_bytes = size_bytes;
+    new_arena->next_arena = NULL;
+    new_arena->owner_head = (owner_head == NULL) ? new_arena : owner_head;
+    new_arena->remote_freed = NULL;
+
+    for(int i = 0; i < TUNDRA_NUM_SIZE_CLASSES; ++i)
     {
-        TUNDRA_FATAL("Arena size must be an increment of the required os "
-            "alloc alignment.");
+        new_arena->freed_bins[i] = NULL;
+        new_arena->freed_bin_counts[i] = 0;
     }
 
-    void *mem_from_os = InTundra_Mem_get_mem_from_os(DEF_ARENA_SIZE_BYTE);
+    // Arena creation is rare, so the total and its high-water mark are
+    // tracked here rather than on the allocation hot path.
+    const u64 NEW_TOTAL =
+        __atomic_add_fetch(&total_arena_bytes, size_bytes, __ATOMIC_RELAXED);
 
-    arena.base_ptr = (u8*)mem_from_os;
-    arena.used_bytes = 0;
-    arena.total_size_bytes = DEF_ARENA_SIZE_BYTE;;
+    u64 peak = __atomic_load_n(&peak_arena_bytes, __ATOMIC_RELAXED);
 
-    // Initialize freed block linked lists for each size class.
-    for(int i = 0; i < TUNDRA_NUM_SIZE_CLASSES; ++i)
+    while(NEW_TOTAL > peak &&
+        !__atomic_compare_exchange_n(&peak_arena_bytes, &peak, NEW_TOTAL,
+        false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+
+    register_arena(new_arena);
+
+    return new_arena;
+}
+
+/**
+ * @brief Allocates a new arena and links it onto the end of the calling
+ * thread's arena chain.
+ *
+ * Arena sizes double with each link (capped at MAX_ARENA_SIZE_BYTE) so heavy
+ * workloads converge to few links.
+ *
+ * @param last_arena Current final arena in the chain to link onto.
+ *
+ * @return MemArena* Pointer to the newly linked arena.
+ */
+static MemArena* link_new_arena(MemArena *last_arena)
+{
+    u64 new_size = last_arena->total_size_bytes * 2;
+
+    if(new_size > MAX_ARENA_SIZE_BYTE) { new_size = MAX_ARENA_SIZE_BYTE; }
+
+    MemArena *new_arena = create_arena(new_size, last_arena->owner_head);
+
+    last_arena->next_arena = new_arena;
+
+    return new_arena;
+}
+
+/**
+ * @brief Returns the calling thread's arena chain head, creating it if this
+ * is the thread's first small allocation.
+ *
+ * @return MemArena* The calling thread's head arena.
+ */
+static MemArena* get_thread_arena(void)
+{
+    if(thread_arena == NULL)
+    {
+        thread_arena = create_arena(DEF_ARENA_SIZE_BYTE, NULL);
+    }
+
+    return thread_arena;
+}
+
+/**
+ * @brief Drains an arena's remote free list (blocks freed by foreign threads)
+ * back into its owner-local freed bins.
+ *
+ * Only the owning thread may call this.
+ *
+ * @param a Arena to drain.
+ */
+static void drain_remote_frees(MemArena *a)
+{
+    // Cheap check first, the list is empty in the common case.
+    if(__atomic_load_n(&a->remote_freed, __ATOMIC_RELAXED) == NULL)
+    {
+        return;
+    }
+
+    FreedBlock *blk =
+        __atomic_exchange_n(&a->remote_freed, NULL, __ATOMIC_ACQUIRE);
+
+    while(blk != NULL)
     {
-        arena.freed_bins[i] = NULL;
+        FreedBlock *next = blk->next;
+
+        push_freed_block(a, get_header_from_payload_ptr((void*)blk));
+
+        blk = next;
     }
 }
 
+
+// Public Methods --------------------------------------------------------------
+
+void InTundra_SmlMemAlc_init(void)
+{
+    // Purely a pre-warm: every thread (the main one included) gets its arena
+    // lazily on its first allocation, this just maps the caller's up front.
+    get_thread_arena();
+}
+
 void InTundra_SmlMemAlc_shutdown(void)
 {
-    InTundra_Mem_release_mem_to_os((void*)arena.base_ptr, 
-        arena.total_size_bytes);
-    arena.base_ptr = NULL;
-    
-    // NULL out free bins.
-    for(int i = 0; i < TUNDRA_NUM_SIZE_CLASSES; ++i)
+    // Shutdown must only be called once all worker threads have finished
+    // allocating. Every arena across all threads lives in the registry, so
+    // walk it and release each one. Arena bookkeeping lives inside its own
+    // memory, so grab the next pointer before releasing.
+    MemArena *curr = __atomic_load_n(&registry_head, __ATOMIC_ACQUIRE);
+
+    while(curr != NULL)
     {
-        arena.freed_bins[i] = NULL;
+        MemArena *next = curr->next_registered;
+
+        InTundra_Mem_release_mem_to_os((void*)curr->base_ptr,
+            curr->total_size_bytes);
+
+        curr = next;
     }
 
-    arena.total_size_bytes = 0;
-    arena.used_bytes = 0;
+    __atomic_store_n(&registry_head, NULL, __ATOMIC_RELEASE);
+    thread_arena = NULL;
+    __atomic_store_n(&total_arena_bytes, 0, __ATOMIC_RELAXED);
 }
 
 bool InTundra_SmlMemAlc_is_ptr_in_arena(void *ptr)
 {
     u8 *cast_ptr = (u8*)ptr;
 
-    return cast_ptr >= arena.base_ptr && 
-        cast_ptr < (arena.base_ptr + arena.total_size_bytes);
+    // Walk the global registry so pointers owned by any thread's arenas are
+    // recognized, not just the calling thread's.
+    for(const MemArena *curr =
+        __atomic_load_n(&registry_head, __ATOMIC_ACQUIRE);
+        curr != NULL; curr = curr->next_registered)
+    {
+        if(cast_ptr >= curr->base_ptr &&
+            cast_ptr < (curr->base_ptr + curr->total_size_bytes))
+        {
+            return true;
+        }
+    }
+
+    return false;
 }
 
-void InTundra_SmlMemAlc_free(void *ptr) 
+/**
+ * @brief Returns the arena whose address range contains `ptr`, searching
+ * every registered arena across all threads. NULL if no arena holds it.
+ *
+ * @param ptr Pointer to find the owning arena of.
+ *
+ * @return MemArena* Owning arena, NULL if none.
+ */
+static MemArena* find_owning_arena(void *ptr)
 {
-    // If the ptr is outside the memory arena, it wasn't allocated by Tundra.
-    if(!InTundra_SmlMemAlc_is_ptr_in_arena(ptr))
+    u8 *cast_ptr = (u8*)ptr;
+
+    for(MemArena *curr = __atomic_load_n(&registry_head, __ATOMIC_ACQUIRE);
+        curr != NULL; curr = curr->next_registered)
+    {
+        if(cast_ptr >= curr->base_ptr &&
+            cast_ptr < (curr->base_ptr + curr->total_size_bytes))
+        {
+            return curr;
+        }
+    }
+
+    return NULL;
+}
+
+void InTundra_SmlMemAlc_free(void *ptr)
+{
+    MemArena *owner = find_owning_arena(ptr);
+
+    // If the ptr is outside every memory arena, it wasn't allocated by Tundra.
+    if(owner == NULL)
     {
         TUNDRA_FATAL("Attempted to free pointer that was not malloced by "
             "Tundra: %p", ptr);
     }
 
     BlockHeader *header = get_header_from_payload_ptr(ptr);
-    
+
     if(!header->in_use)
     {
-        TUNDRA_FATAL("Attempted to free already freed memory: %p", ptr); 
+        TUNDRA_FATAL("Attempted to free already freed memory: %p", ptr);
     }
 
     header->in_use = false;
@@ -230,52 +588,164 @@ void InTundra_SmlMemAlc_free(void *ptr)
     // Interpret the payload as a freed block.
     FreedBlock *new_freed_block = (FreedBlock*)ptr;
 
-    // Get a pointer to the head node pointer of the list belonging to the size
-    // class of the freed payload.
-    FreedBlock **ptr_head_node = &arena.freed_bins[header->size_class_index];
-
-    if(*ptr_head_node == NULL)
+    // The block belongs to another thread's arena. Push it onto the owning
+    // arena's remote free list with an atomic exchange; the owning thread
+    // drains it back into its bins on a later allocation.
+    if(owner->owner_head != thread_arena)
     {
-        new_freed_block->next = NULL;
-        *ptr_head_node = new_freed_block;
+        FreedBlock *remote_head =
+            __atomic_load_n(&owner->remote_freed, __ATOMIC_ACQUIRE);
+
+        do
+        {
+            new_freed_block->next = remote_head;
+        }
+        while(!__atomic_compare_exchange_n(&owner->remote_freed, &remote_head,
+            new_freed_block, false, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+
         return;
     }
 
-    // Since there are already node(s) existing in the size class linked list,
-    // place the new freed block at the head node and have it point to what was
-    // the head node.
+    // Owner-local free: merge with any adjacent freed blocks to the right so
+    // arena space is recycled as larger chunks, then bin the result.
+    coalesce_right(owner, header);
 
-    new_freed_block->next = *ptr_head_node;
-    *ptr_head_node = new_freed_block;
+    push_freed_block(owner, header);
 }
 
-void* InTundra_SmlMemAlc_malloc(u64 num_bytes) 
+void* InTundra_SmlMemAlc_malloc(u64 num_bytes)
 {
     const u8 SIZE_CLASS_INDEX = get_size_class_index(num_bytes);
 
-    // If there are no available blocks for this size class
-    if(arena.freed_bins[SIZE_CLASS_INDEX] == NULL)
+    MemArena *head = get_thread_arena();
+    MemArena *last_arena = head;
+
+    // Walk this thread's chain looking for a freed block of this size class
+    // to reuse, falling back to carving from an arena with unused room.
+    for(MemArena *curr = head; curr != NULL; curr = curr->next_arena)
     {
-        return create_block(SIZE_CLASS_INDEX);
+        // Recover any blocks foreign threads have freed back to this arena.
+        drain_remote_frees(curr);
+
+        // Look for a freed block to reuse, starting at the requested size
+        // class and climbing into larger bins. A larger block is split, with
+        // the remainder binned back for reuse.
+        for(u8 bin_idx = SIZE_CLASS_INDEX; bin_idx < TUNDRA_NUM_SIZE_CLASSES;
+            ++bin_idx)
+        {
+            if(curr->freed_bins[bin_idx] == NULL) { continue; }
+
+            // Take the first block in the list.
+            FreedBlock *available_block = curr->freed_bins[bin_idx];
+            curr->freed_bins[bin_idx] = available_block->next;
+            --curr->freed_bin_counts[bin_idx];
+
+            BlockHeader *header =
+                get_header_from_payload_ptr((void*)available_block);
+
+            // Trim oversized blocks down to the requested class so the
+            // excess stays recyclable.
+            if(bin_idx > SIZE_CLASS_INDEX)
+            {
+                split_block(curr, header, SIZE_CLASS_INDEX);
+            }
+
+            header->in_use = true;
+
+            return (void*)available_block;
+        }
+
+        if(arena_has_room(curr, SIZE_CLASS_INDEX))
+        {
+            return create_block(curr, SIZE_CLASS_INDEX);
+        }
+
+        last_arena = curr;
     }
 
-    // -- There is an available block for this size class. --
+    // -- Every arena is exhausted, grow the chain. --
+
+    return create_block(link_new_arena(last_arena), SIZE_CLASS_INDEX);
+}
 
-    // Get the first block in the list.
-    void *available_block = (void*)arena.freed_bins[SIZE_CLASS_INDEX];
+void* InTundra_SmlMemAlc_malloc_aligned(u64 num_bytes, u64 alignment)
+{
+    // Over-allocate so that an aligned payload with its own header, plus a
+    // front pad large enough to be binned as its own freed block, are both
+    // guaranteed to fit.
+    void *payload = InTundra_SmlMemAlc_malloc(num_bytes + alignment +
+        BLOCK_HEADER_SIZE + TUNDRA_MIN_SIZE_CLASS_BYTE_SIZE);
+
+    // The block may already land on the alignment, in which case the extra
+    // bytes simply stay attached as slack.
+    if(((u64)payload & (alignment - 1)) == 0) { return payload; }
+
+    BlockHeader *header = get_header_from_payload_ptr(payload);
+
+    // End of the block's payload, unchanged by the re-carve below.
+    u8 * const BLOCK_END = (u8*)payload + header->block_byte_size;
+
+    // First aligned address that leaves enough room in front of it for the
+    // aligned block's header and a pad of at least the minimum size class.
+    u8 *aligned_payload = (u8*)(((u64)((u8*)payload + BLOCK_HEADER_SIZE +
+        TUNDRA_MIN_SIZE_CLASS_BYTE_SIZE) + alignment - 1) &
+        ~(alignment - 1));
+
+    // Stamp a header right before the aligned payload so the block is freed
+    // like any other small allocation.
+    BlockHeader *aligned_header =
+        (BlockHeader*)(aligned_payload - BLOCK_HEADER_SIZE);
+
+    aligned_header->block_byte_size = (u64)(BLOCK_END - aligned_payload);
+    aligned_header->size_class_index =
+        get_floor_size_class_index(aligned_header->block_byte_size);
+    aligned_header->in_use = true;
+
+    // Shrink the original block down to the front pad and bin it for reuse,
+    // keeping the arena's block walk contiguous.
+    header->block_byte_size =
+        (u64)(aligned_payload - BLOCK_HEADER_SIZE - (u8*)payload);
+    header->in_use = false;
 
-    // Update the head node of this list to point to the next element, since 
-    // we're taking the head node.
-    arena.freed_bins[SIZE_CLASS_INDEX] = 
-        arena.freed_bins[SIZE_CLASS_INDEX]->next;
+    push_freed_block(find_owning_arena(payload), header);
 
-    // Update the Header of the grabbed block to flag it as in use.
-    get_header_from_payload_ptr(available_block)->in_use = true;
+    return (void*)aligned_payload;
+}
 
-    return available_block;
+u64 InTundra_SmlMemAlc_usable_size(void *ptr)
+{
+    return get_header_from_payload_ptr(ptr)->block_byte_size;
 }
 
-const MemArena * get_mem_arena_instance()
+void InTundra_SmlMemAlc_gather_stats(Tundra_MemStats *stats_out)
 {
-    return &arena;
+    stats_out->small_num_arenas = 0;
+    stats_out->small_arena_bytes = 0;
+    stats_out->small_used_bytes = 0;
+
+    for(int i = 0; i < TUNDRA_NUM_SIZE_CLASSES; ++i)
+    {
+        stats_out->small_freed_bin_counts[i] = 0;
+    }
+
+    // Walk the global registry so every thread's arenas are aggregated. Bin
+    // counts and used bytes of foreign arenas are read racily, stats are a
+    // snapshot, not a synchronization point.
+    for(const MemArena *curr =
+        __atomic_load_n(&registry_head, __ATOMIC_ACQUIRE);
+        curr != NULL; curr = curr->next_registered)
+    {
+        ++stats_out->small_num_arenas;
+        stats_out->small_arena_bytes += curr->total_size_bytes;
+        stats_out->small_used_bytes += curr->used_bytes;
+
+        for(int i = 0; i < TUNDRA_NUM_SIZE_CLASSES; ++i)
+        {
+            stats_out->small_freed_bin_counts[i] +=
+                curr->freed_bin_counts[i];
+        }
+    }
+
+    stats_out->small_peak_arena_bytes =
+        __atomic_load_n(&peak_arena_bytes, __ATOMIC_RELAXED);
 }
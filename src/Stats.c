@@ -0,0 +1,136 @@
+/**
+ * @file Stats.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Compile-time-gated hot-path event counters.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/Stats.h"
+#include "tundra/utils/ConsoleIO.h"
+#include "tundra/utils/Time.h"
+#include "tundra/internal/Syscall.h"
+
+#ifdef TUNDRA_STATS
+
+u64 InTundra_stat_counts[TUNDRA_STAT_NUM_COUNTERS];
+
+// Display names, indexed by `Tundra_StatCounter`.
+static const char *const STAT_NAMES[TUNDRA_STAT_NUM_COUNTERS] =
+{
+    "syscalls",
+    "obuff flushes",
+    "sml arena block carves",
+    "lg cache hits",
+    "lg cache misses"
+};
+
+void Tundra_dump_stats(void)
+{
+    Tundra_printf("hot-path counters:\n");
+
+    for(u64 i = 0; i < TUNDRA_STAT_NUM_COUNTERS; ++i)
+    {
+        Tundra_printf("  %s: %lu\n",
+            STAT_NAMES[i],
+            __atomic_load_n(&InTundra_stat_counts[i], __ATOMIC_RELAXED));
+    }
+
+    Tundra_flush_stdout();
+}
+
+#else // TUNDRA_STATS
+
+void Tundra_dump_stats(void)
+{
+    Tundra_printf(
+        "hot-path counters unavailable, built without TUNDRA_STATS.\n");
+    Tundra_flush_stdout();
+}
+
+#endif // TUNDRA_STATS
+
+#ifdef TUNDRA_SYSCALL_TRACE
+
+/**
+ * @brief Returns a display name for syscall numbers the library issues
+ * itself, or NULL for any other number.
+ *
+ * @param number Syscall number.
+ *
+ * @return const char* Display name or NULL.
+ */
+static const char* syscall_name(u64 number)
+{
+    switch(number)
+    {
+        case TUNDRA_LINUX_SYSCALL_READ: return "read";
+        case TUNDRA_LINUX_SYSCALL_WRITE: return "write";
+        case TUNDRA_LINUX_SYSCALL_CLOSE: return "close";
+        case TUNDRA_LINUX_SYSCALL_FSTAT: return "fstat";
+        case TUNDRA_LINUX_SYSCALL_LSEEK: return "lseek";
+        case TUNDRA_LINUX_SYSCALL_MMAP: return "mmap";
+        case TUNDRA_LINUX_SYSCALL_MUNMAP: return "munmap";
+        case TUNDRA_LINUX_SYSCALL_PREAD64: return "pread64";
+        case TUNDRA_LINUX_SYSCALL_PWRITE64: return "pwrite64";
+        case TUNDRA_LINUX_SYSCALL_WRITEV: return "writev";
+        case TUNDRA_LINUX_SYSCALL_MADVISE: return "madvise";
+        case TUNDRA_LINUX_SYSCALL_SENDFILE: return "sendfile";
+        case TUNDRA_LINUX_SYSCALL_EXIT: return "exit";
+        case TUNDRA_LINUX_SYSCALL_FDATASYNC: return "fdatasync";
+        case TUNDRA_LINUX_SYSCALL_FTRUNCATE: return "ftruncate";
+        case TUNDRA_LINUX_SYSCALL_GETDENTS64: return "getdents64";
+        case TUNDRA_LINUX_SYSCALL_FADVISE64: return "fadvise64";
+        case TUNDRA_LINUX_SYSCALL_CLOCK_GETTIME: return "clock_gettime";
+        case TUNDRA_LINUX_SYSCALL_OPENAT: return "openat";
+        case TUNDRA_LINUX_SYSCALL_PERF_EVENT_OPEN: return "perf_event_open";
+        case TUNDRA_LINUX_SYSCALL_COPY_FILE_RANGE: return "copy_file_range";
+        case TUNDRA_LINUX_SYSCALL_IO_URING_SETUP: return "io_uring_setup";
+        case TUNDRA_LINUX_SYSCALL_IO_URING_ENTER: return "io_uring_enter";
+        default: return NULL;
+    }
+}
+
+void Tundra_dump_syscall_trace(void)
+{
+    // Latencies are accumulated in cycles; calibrate so they print in
+    // nanoseconds.
+    Tundra_calibrate_cycle_rate();
+
+    Tundra_printf("syscall accounting:\n");
+
+    for(u64 i = 0; i < TUNDRA_SYSCALL_TRACE_SLOTS; ++i)
+    {
+        const u64 COUNT =
+            __atomic_load_n(&InTundra_syscall_trace_counts[i],
+                __ATOMIC_RELAXED);
+
+        if(COUNT == 0) { continue; }
+
+        const u64 TOTAL_NS = Tundra_cycles_to_ns(
+            __atomic_load_n(&InTundra_syscall_trace_cycles[i],
+                __ATOMIC_RELAXED));
+
+        const char *NAME = syscall_name(i);
+
+        if(NAME != NULL) { Tundra_printf("  %s", NAME); }
+        else { Tundra_printf("  syscall %lu", i); }
+
+        Tundra_printf(": count=%lu total=%luns avg=%luns\n", COUNT,
+            TOTAL_NS, TOTAL_NS / COUNT);
+    }
+
+    Tundra_flush_stdout();
+}
+
+#else // TUNDRA_SYSCALL_TRACE
+
+void Tundra_dump_syscall_trace(void)
+{
+    Tundra_printf("syscall accounting unavailable, built without "
+        "TUNDRA_SYSCALL_TRACE.\n");
+    Tundra_flush_stdout();
+}
+
+#endif // TUNDRA_SYSCALL_TRACE
@@ -12,19 +12,46 @@
 #include "tundra/utils/MemAlloc.h"
 #include "tundra/utils/MemUtils.h"
 #include "tundra/utils/FatalHandler.h"
+#include "tundra/common/CharUtils.h"
+#include "tundra/common/Core.h"
+#include "tundra/common/VariadicArgs.h"
+#include "tundra/utils/StringConversion.h"
 
 
 #define NULL_TERMINATOR 1
 
 
+/**
+ * @brief Returns true if the String's characters live in its inline small
+ * buffer rather than on the heap.
+ *
+ * @param str String to query.
+ *
+ * @return bool True if the String is stored inline.
+ */
+static bool is_small(const Tundra_String *str)
+{
+    return str->chars == str->small;
+}
+
+
 // Internal Methods ------------------------------------------------------------
 
 void InTundra_Str_init(Tundra_String *str, u64 init_cap)
 {
-    str->chars = (char*)Tundra_alloc_mem(init_cap);
+    // Small requests live in the struct itself; no allocation.
+    if(init_cap <= TUNDRA_STR_SMALL_CAP)
+    {
+        str->chars = str->small;
+        str->cap = TUNDRA_STR_SMALL_CAP;
+    }
+    else
+    {
+        str->chars = (char*)Tundra_alloc_mem(init_cap);
+        str->cap = init_cap;
+    }
 
     str->num_char = 0;
-    str->cap = init_cap;
 
     InTundra_Str_place_null_t(str);
 }
@@ -45,7 +72,9 @@ void InTundra_Str_check_handle_exp(Tundra_String *str)
     char *new_mem = (char*)Tundra_alloc_mem(NEW_CAP);
 
     Tundra_copy_mem_fwd((const void*)str->chars, (void*)new_mem, str->num_char);
-    Tundra_free_mem((void*)str->chars);
+
+    // Inline storage is part of the struct; only heap chars are freed.
+    if(!is_small(str)) Tundra_free_mem((void*)str->chars);
 
     str->chars = new_mem;
     str->cap = NEW_CAP;
@@ -67,13 +96,31 @@ void InTundra_Str_reserve_additional(Tundra_String *str, u64 extra_chars)
         str->num_char);
 
     // Free old memory.
-    Tundra_free_mem((void*)str->chars);
+    if(!is_small(str)) Tundra_free_mem((void*)str->chars);
     str->chars = new_mem;
     str->cap = NEW_CAP_BYTE;
 }
 
 void InTundra_Str_shrink(Tundra_String *str, u64 cap)
 {
+    // Inline storage is already as small as a String gets.
+    if(is_small(str)) return;
+
+    // Shrinking under the inline threshold moves the chars back into the
+    // struct and drops the heap block entirely.
+    if(cap <= TUNDRA_STR_SMALL_CAP)
+    {
+        Tundra_copy_mem_fwd((const void*)str->chars, (void*)str->small,
+            cap - 1); // -1 since we're replacing it with a null terminator.
+        str->small[cap - 1] = '\0'; // Place null terminator.
+
+        Tundra_free_mem((void*)str->chars);
+        str->chars = str->small;
+        str->num_char = cap;
+        str->cap = TUNDRA_STR_SMALL_CAP;
+        return;
+    }
+
     char *new_mem = (char*)Tundra_alloc_copy_mem(
         (const void*)str->chars,
         cap,
@@ -106,13 +153,24 @@ void Tundra_Str_init_w_chars(Tundra_String *str, const char *chars,
 {
     const u64 CAP = num_chars + NULL_TERMINATOR;
 
+    // Chars that fit inline skip the allocator no matter the alloc policy.
+    if(CAP <= TUNDRA_STR_SMALL_CAP)
+    {
+        str->chars = str->small;
+        Tundra_copy_mem_fwd((const void*)chars, (void*)str->chars, num_chars);
+        str->num_char = num_chars;
+        str->cap = TUNDRA_STR_SMALL_CAP;
+        InTundra_Str_place_null_t(str);
+        return;
+    }
+
     // Allocate exactly enough bytes for the memory to copy in.
     if(strict_alloc)
     {
         str->chars = (char*)Tundra_alloc_mem(CAP);
         Tundra_copy_mem_fwd((const void*)chars, (void*)str->chars, num_chars);
         str->num_char = num_chars;
-        str->cap = CAP; 
+        str->cap = CAP;
         InTundra_Str_place_null_t(str);
         return;
     }
@@ -133,7 +191,7 @@ void Tundra_Str_init_w_chars(Tundra_String *str, const char *chars,
 
 void Tundra_Str_free(Tundra_String *str)
 {
-    Tundra_free_mem((void*)str->chars);
+    if(!is_small(str)) Tundra_free_mem((void*)str->chars);
     str->chars = NULL;
 }
 
@@ -143,9 +201,18 @@ void Tundra_Str_copy(const Tundra_String *src, Tundra_String *dst)
 
     if(dst->cap != src->cap)
     {
-        Tundra_free_mem((void*)dst->chars);
-        dst->chars = (char*)(Tundra_alloc_mem(src->cap));
-        dst->cap = src->cap;
+        if(!is_small(dst)) Tundra_free_mem((void*)dst->chars);
+
+        if(src->cap <= TUNDRA_STR_SMALL_CAP)
+        {
+            dst->chars = dst->small;
+            dst->cap = TUNDRA_STR_SMALL_CAP;
+        }
+        else
+        {
+            dst->chars = (char*)(Tundra_alloc_mem(src->cap));
+            dst->cap = src->cap;
+        }
     }
 
     Tundra_copy_mem_fwd(
@@ -159,8 +226,12 @@ void Tundra_Str_move(Tundra_String *src, Tundra_String *dst)
 {
     if(src == dst) { return; }
 
-    Tundra_free_mem((void*)dst->chars);
+    if(!is_small(dst)) Tundra_free_mem((void*)dst->chars);
     *dst = *src;
+
+    // Inline chars moved with the struct; repoint at dst's own buffer.
+    if(is_small(src)) dst->chars = dst->small;
+
     src->chars = NULL;
 }
 
@@ -172,7 +243,7 @@ void Tundra_Str_clear(Tundra_String *str)
 
 void Tundra_Str_take_buffer(Tundra_String *str, char *buffer, u64 num_char)
 {
-    Tundra_free_mem((void*)str->chars);
+    if(!is_small(str)) Tundra_free_mem((void*)str->chars);
 
     str->chars = buffer;
     str->num_char = num_char;
@@ -250,7 +321,7 @@ void Tundra_Str_resize(Tundra_String *str, u64 num_char)
         NEW_CAP,
         str->num_char);
 
-    Tundra_free_mem((void*)str->chars);
+    if(!is_small(str)) Tundra_free_mem((void*)str->chars);
     str->chars = new_mem;
     str->cap = NEW_CAP;
 
@@ -400,3 +471,334 @@ Tundra_StringView Tundra_Str_make_view(const Tundra_String *str, u64 index,
 
     return view;
 }
+
+void Tundra_Str_to_lower(Tundra_String *str)
+{
+    Tundra_to_lower_mem(str->chars, str->num_char - 1);
+}
+
+void Tundra_Str_to_upper(Tundra_String *str)
+{
+    Tundra_to_upper_mem(str->chars, str->num_char - 1);
+}
+
+bool Tundra_Str_eq(const Tundra_String *first, const Tundra_String *second)
+{
+    if(first->num_char != second->num_char) { return false; }
+
+    return Tundra_compare_mem_eq(first->chars, second->chars,
+        first->num_char - 1);
+}
+
+i32 Tundra_Str_compare(const Tundra_String *first,
+    const Tundra_String *second)
+{
+    const u64 FIRST_LEN = first->num_char - 1;
+    const u64 SECOND_LEN = second->num_char - 1;
+
+    const u64 SHARED_LEN = FIRST_LEN < SECOND_LEN ? FIRST_LEN : SECOND_LEN;
+
+    const i32 ORDER = Tundra_compare_mem(first->chars, second->chars,
+        SHARED_LEN);
+
+    if(ORDER != 0) { return ORDER; }
+
+    // Shared prefixes are equal, the shorter String orders first.
+    if(FIRST_LEN < SECOND_LEN) { return -1; }
+
+    return FIRST_LEN > SECOND_LEN;
+}
+
+bool Tundra_StrView_eq(const Tundra_StringView *first,
+    const Tundra_StringView *second)
+{
+    if(first->num_char != second->num_char) { return false; }
+
+    return Tundra_compare_mem_eq(first->view, second->view,
+        first->num_char);
+}
+
+i64 Tundra_Str_find_char(const Tundra_String *str, char c)
+{
+    return Tundra_find_byte(str->chars, str->num_char - 1, (u8)c);
+}
+
+i64 Tundra_Str_rfind_char(const Tundra_String *str, char c)
+{
+    return Tundra_rfind_byte(str->chars, str->num_char - 1, (u8)c);
+}
+
+i64 Tundra_Str_find_cstr(const Tundra_String *str, const char *cstr)
+{
+    return Tundra_find_bytes(str->chars, str->num_char - 1, cstr,
+        Tundra_get_cstr_len(cstr));
+}
+
+i64 Tundra_StrView_find_char(const Tundra_StringView *view, char c)
+{
+    return Tundra_find_byte(view->view, view->num_char, (u8)c);
+}
+
+i64 Tundra_StrView_rfind_char(const Tundra_StringView *view, char c)
+{
+    return Tundra_rfind_byte(view->view, view->num_char, (u8)c);
+}
+
+i64 Tundra_StrView_find_cstr(const Tundra_StringView *view, const char *cstr)
+{
+    return Tundra_find_bytes(view->view, view->num_char, cstr,
+        Tundra_get_cstr_len(cstr));
+}
+
+void Tundra_StrView_split_init(Tundra_StrViewSplitter *splitter,
+    const Tundra_StringView *view, char delim)
+{
+    splitter->view = view->view;
+    splitter->num_char = view->num_char;
+    splitter->pos = 0;
+    splitter->delim = delim;
+    splitter->done = false;
+}
+
+bool Tundra_StrView_split_next(Tundra_StrViewSplitter *splitter,
+    Tundra_StringView *token_output)
+{
+    if(splitter->done) { return false; }
+
+    const u64 REMAINING = splitter->num_char - splitter->pos;
+
+    const i64 HIT = Tundra_find_byte(splitter->view + splitter->pos,
+        REMAINING, (u8)splitter->delim);
+
+    token_output->view = splitter->view + splitter->pos;
+
+    if(HIT < 0)
+    {
+        // Final token, runs to the end of the view.
+        token_output->num_char = REMAINING;
+        splitter->done = true;
+        return true;
+    }
+
+    token_output->num_char = (u64)HIT;
+    splitter->pos += (u64)HIT + 1;
+    return true;
+}
+
+/**
+ * @brief Returns an upper bound on the number of characters `format` expands
+ * to, consuming one pass over `args`.
+ *
+ * String arguments are measured exactly; numeric arguments use their maximum
+ * printed width so the bound never under-reserves.
+ *
+ * @param format Format string.
+ * @param args Argument list, consumed by this pass.
+ *
+ * @return u64 Upper bound on the expanded character count.
+ */
+static u64 appendf_upper_bound(const char *format, Tundra_VaList args)
+{
+    u64 bound = 0;
+    u64 fmt_idx = 0;
+
+    while(true)
+    {
+        char c = format[fmt_idx++];
+
+        if(c == '\0') { return bound; }
+
+        if(c != '%')
+        {
+            ++bound;
+            continue;
+        }
+
+        c = format[fmt_idx++];
+
+        switch(c)
+        {
+            case '%':
+
+                ++bound;
+                break;
+
+            case 'c':
+
+                (void)Tundra_varg_arg(args, int);
+                ++bound;
+                break;
+
+            case 's':
+
+                bound += Tundra_get_cstr_len(
+                    Tundra_varg_arg(args, const char *));
+                break;
+
+            case 'u':
+
+                (void)Tundra_varg_arg(args, unsigned int);
+                bound += TUNDRA_MAX_CHARS_TO_REPRESENT_U32;
+                break;
+
+            case 'd':
+
+                (void)Tundra_varg_arg(args, int);
+                bound += TUNDRA_MAX_CHARS_TO_REPRESENT_I32;
+                break;
+
+            case 'x':
+
+                (void)Tundra_varg_arg(args, unsigned int);
+                bound += TUNDRA_MAX_CHARS_TO_REPRESENT_U64_HEX;
+                break;
+
+            case 'f':
+
+                (void)Tundra_varg_arg(args, double);
+                bound += TUNDRA_MAX_CHARS_TO_REPRESENT_FLOAT;
+                break;
+
+            case 'l':
+
+                c = format[fmt_idx++];
+
+                if(c != 'u' && c != 'd' && c != 'x')
+                {
+                    TUNDRA_FATAL("Invalid formatted character in format "
+                        "string: %s\n", format);
+                    Tundra_exit(1);
+                }
+
+                (void)Tundra_varg_arg(args, u64);
+
+                bound += c == 'x' ? TUNDRA_MAX_CHARS_TO_REPRESENT_U64_HEX :
+                    TUNDRA_MAX_CHARS_TO_REPRESENT_I64;
+                break;
+
+            default:
+
+                TUNDRA_FATAL("Invalid formatted character in format string: "
+                    "%s\n", format);
+                Tundra_exit(1);
+        }
+    }
+}
+
+void Tundra_Str_appendf(Tundra_String *str, const char *format, ...)
+{
+    TUNDRA_RT_ASSERT(format != NULL, "\"format\" cannot be NULL.\n");
+
+    Tundra_VaList args;
+    Tundra_varg_start(args, format);
+
+    Tundra_VaList sizing_args;
+    Tundra_varg_copy(sizing_args, args);
+
+    // One reservation up front; the conversions below write straight into the
+    // tail with no per-character growth checks.
+    Tundra_Str_reserve_additional(str,
+        appendf_upper_bound(format, sizing_args));
+
+    Tundra_varg_end(sizing_args);
+
+    // Overwrite the null terminator; it is rewritten after the last
+    // conversion.
+    char *tail = str->chars + str->num_char - 1;
+
+    u64 fmt_idx = 0;
+
+    while(true)
+    {
+        char c = format[fmt_idx++];
+
+        if(c == '\0') { break; }
+
+        if(c != '%')
+        {
+            *tail++ = c;
+            continue;
+        }
+
+        c = format[fmt_idx++];
+
+        switch(c)
+        {
+            case '%':
+
+                *tail++ = '%';
+                break;
+
+            case 'c':
+
+                *tail++ = (char)Tundra_varg_arg(args, int);
+                break;
+
+            case 's':
+            {
+                const char *varg = Tundra_varg_arg(args, const char *);
+
+                const u64 LENGTH = Tundra_get_cstr_len(varg);
+
+                Tundra_copy_mem_fwd((const void*)varg, (void*)tail, LENGTH);
+                tail += LENGTH;
+                break;
+            }
+
+            case 'u':
+
+                tail += Tundra_u32_to_cstr_buf(
+                    Tundra_varg_arg(args, unsigned int), tail);
+                break;
+
+            case 'd':
+
+                tail += Tundra_int_to_cstr_buf(Tundra_varg_arg(args, int),
+                    tail);
+                break;
+
+            case 'x':
+
+                tail += Tundra_u64_to_hex_buf(
+                    (u64)Tundra_varg_arg(args, unsigned int), tail, false);
+                break;
+
+            case 'f':
+
+                tail += Tundra_float_to_cstr_buf(
+                    (float)Tundra_varg_arg(args, double), tail);
+                break;
+
+            case 'l':
+
+                c = format[fmt_idx++];
+
+                if(c == 'u')
+                {
+                    tail += Tundra_u64_to_cstr_buf(
+                        Tundra_varg_arg(args, u64), tail);
+                }
+
+                else if(c == 'x')
+                {
+                    tail += Tundra_u64_to_hex_buf(
+                        Tundra_varg_arg(args, u64), tail, false);
+                }
+
+                else
+                {
+                    tail += Tundra_i64_to_cstr_buf(
+                        Tundra_varg_arg(args, i64), tail);
+                }
+
+                break;
+
+            // The sizing pass has already rejected any other specifier.
+        }
+    }
+
+    *tail = '\0';
+    str->num_char = (u64)(tail - str->chars) + 1;
+
+    Tundra_varg_end(args);
+}
@@ -10,245 +10,184 @@
  */
 
 #include "tundra/utils/StringConversion.h"
+#include "tundra/common/BitUtils.h"
 #include "tundra/common/Core.h"
 #include "tundra/common/NumLimits.h"
 #include "tundra/utils/Math.h"
 #include "tundra/utils/MemUtils.h"
 
-float InTundra_float_rounding_constant = 0.0f;
+// Every two-digit pair packed into one table, so each formatting step peels
+// two digits with a single divide and copies both characters from the table.
+static const char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+u8 Tundra_u64_digit_count(u64 num)
+{
+    if(num == 0) { return 1; }
+
+    static const u64 POW10[20] =
+    {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+        10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+        100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+        100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+        100000000000000000ULL, 1000000000000000000ULL,
+        10000000000000000000ULL
+    };
+
+    // bits * log10(2) approximated as bits * 1233 >> 12, then corrected by
+    // one against the exact power-of-ten boundary.
+    const u8 APPROX = (u8)(((u64)Tundra_get_msb_pos(num) + 1) * 1233 >> 12);
+
+    return (u8)(APPROX + (num >= POW10[APPROX]));
+}
 
-// Returns number of characters in buffer not including null terminator.
-static u64 InTundra_int_to_cstr_helper(u64 num, char *buffer, char *output, 
+// Returns number of characters written, not including the null terminator.
+// Writes right-to-left into the output's final positions, known up front
+// from the digit count, so there is no reverse pass.
+static u64 InTundra_int_to_cstr_helper(u64 num, char *output,
     bool negative_num)
 {
     if(num == 0)
     {
         output[0] = '0';
-        output[1] = '\0'; 
+        output[1] = '\0';
         return 1;
     }
 
-    u64 buff_idx = 0;
+    const u64 LENGTH = (u64)Tundra_u64_digit_count(num) + negative_num;
 
-    while(num > 0)
-    {
-        u8 digit = (u8)(num % 10);
-        
-        buffer[buff_idx++] = (char)('0' + digit);
-        
-        num /= 10;
-    }
-
-    // Walk back the buffer idx by one since it is pointing one past the end
-    // of the read in characters.
-    buff_idx--;
+    if(negative_num) { output[0] = '-'; }
 
-    u64 output_idx = 0;
+    u64 write_pos = LENGTH;
 
-    if(negative_num)
+    while(num >= 100)
     {
-        output[output_idx++] = '-';
+        const u64 PAIR = (num % 100) * 2;
+        num /= 100;
+
+        write_pos -= 2;
+        output[write_pos] = DIGIT_PAIRS[PAIR];
+        output[write_pos + 1] = DIGIT_PAIRS[PAIR + 1];
     }
 
-    while(true)
+    if(num >= 10)
     {
-        output[output_idx++] = buffer[buff_idx];
-
-        if(buff_idx == 0) break;
+        const u64 PAIR = num * 2;
 
-        --buff_idx;
+        output[write_pos - 2] = DIGIT_PAIRS[PAIR];
+        output[write_pos - 1] = DIGIT_PAIRS[PAIR + 1];
     }
 
-    output[output_idx] = '\0';
+    else { output[write_pos - 1] = (char)('0' + num); }
+
+    output[LENGTH] = '\0';
 
-    return output_idx;
+    return LENGTH;
 }
 
-Tundra_CStr Tundra_u64_to_cstr(u64 num)
+// Allocates exactly the characters `num` formats to plus the null
+// terminator, sized up front with Tundra_u64_digit_count instead of the
+// worst case for the type.
+static Tundra_CStr InTundra_uint_to_exact_cstr(u64 num)
 {
     Tundra_CStr result;
 
-    if(num == 0)
-    {
-        result.str = (char*)Tundra_alloc_mem(2);
-        result.str[0] = '0';
-        result.str[1] = '\0';
-        result.length = 1;
-        return result;
-    }
-
     // +1 for null terminator.
-    result.str = (char*)Tundra_alloc_mem(TUNDRA_MAX_CHARS_TO_REPRESENT_U64 + 1);
+    result.str = (char*)Tundra_alloc_mem((u64)Tundra_u64_digit_count(num) + 1);
     result.length = Tundra_u64_to_cstr_buf(num, result.str);
 
     return result;
 }
 
-Tundra_CStr Tundra_i64_to_cstr(i64 num)
+// Signed counterpart of `InTundra_uint_to_exact_cstr`; one extra character
+// is allocated for the sign when `num` is negative.
+static Tundra_CStr InTundra_int_to_exact_cstr(i64 num)
 {
     Tundra_CStr result;
-    
-    if(num == 0)
-    {
-        result.str = (char*)Tundra_alloc_mem(2);
-        result.str[0] = '0';
-        result.str[1] = '\0';
-        result.length = 1;
-        return result;
-    }
+
+    // Funky negation here due to i64 minimum not fitting inside i64 when
+    // negated.
+    const u64 NEGATIVE = num < 0;
+    const u64 MAGNITUDE = NEGATIVE ? (u64)(-(num + 1)) + 1 : (u64)num;
 
     // +1 for null terminator.
-    result.str = (char*)Tundra_alloc_mem(TUNDRA_MAX_CHARS_TO_REPRESENT_I64 + 1);
+    result.str = (char*)Tundra_alloc_mem(
+        (u64)Tundra_u64_digit_count(MAGNITUDE) + NEGATIVE + 1);
     result.length = Tundra_i64_to_cstr_buf(num, result.str);
 
     return result;
 }
 
-Tundra_CStr Tundra_u32_to_cstr(u32 num)
+Tundra_CStr Tundra_u64_to_cstr(u64 num)
 {
-    Tundra_CStr result;
-
-    if(num == 0)
-    {
-        result.str = (char*)Tundra_alloc_mem(2);
-        result.str[0] = '0';
-        result.str[1] = '\0';
-        result.length = 1;
-        return result;
-    }
+    return InTundra_uint_to_exact_cstr(num);
+}
 
-    // +1 for null terminator.
-    result.str = (char*)Tundra_alloc_mem(TUNDRA_MAX_CHARS_TO_REPRESENT_U32 + 1);
-    result.length = Tundra_u32_to_cstr_buf(num, result.str);
+Tundra_CStr Tundra_i64_to_cstr(i64 num)
+{
+    return InTundra_int_to_exact_cstr(num);
+}
 
-    return result;
+Tundra_CStr Tundra_u32_to_cstr(u32 num)
+{
+    return InTundra_uint_to_exact_cstr((u64)num);
 }
 
 Tundra_CStr Tundra_int_to_cstr(int num)
 {
-    Tundra_CStr result;
-    
-    if(num == 0)
-    {
-        result.str = (char*)Tundra_alloc_mem(2);
-        result.str[0] = '0';
-        result.str[1] = '\0';
-        result.length = 1;
-        return result;
-    }
-
-    // +1 for null terminator.
-    result.str = (char*)Tundra_alloc_mem(TUNDRA_MAX_CHARS_TO_REPRESENT_I32 + 1);
-    result.length = Tundra_int_to_cstr_buf(num, result.str);
-
-    return result;
+    return InTundra_int_to_exact_cstr((i64)num);
 }
 
 Tundra_CStr Tundra_u16_to_cstr(u16 num)
 {
-    Tundra_CStr result;
-
-    if(num == 0)
-    {
-        result.str = (char*)Tundra_alloc_mem(2);
-        result.str[0] = '0';
-        result.str[1] = '\0';
-        result.length = 1;
-        return result;
-    }
-
-    // +1 for null terminator.
-    result.str = (char*)Tundra_alloc_mem(TUNDRA_MAX_CHARS_TO_REPRESENT_U16 + 1);
-    result.length = Tundra_u16_to_cstr_buf(num, result.str);
-
-    return result;
+    return InTundra_uint_to_exact_cstr((u64)num);
 }
 
 Tundra_CStr Tundra_i16_to_cstr(i16 num)
 {
-    Tundra_CStr result;
-    
-    if(num == 0)
-    {
-        result.str = (char*)Tundra_alloc_mem(2);
-        result.str[0] = '0';
-        result.str[1] = '\0';
-        result.length = 1;
-        return result;
-    }
-
-    // +1 for null terminator.
-    result.str = (char*)Tundra_alloc_mem(TUNDRA_MAX_CHARS_TO_REPRESENT_I16 + 1);
-    result.length = Tundra_i16_to_cstr_buf(num, result.str);
-
-    return result;
+    return InTundra_int_to_exact_cstr((i64)num);
 }
 
 Tundra_CStr Tundra_u8_to_cstr(u8 num)
 {
-    Tundra_CStr result;
-
-    if(num == 0)
-    {
-        result.str = (char*)Tundra_alloc_mem(2);
-        result.str[0] = '0';
-        result.str[1] = '\0';
-        result.length = 1;
-        return result;
-    }
-
-    // +1 for null terminator.
-    result.str = (char*)Tundra_alloc_mem(TUNDRA_MAX_CHARS_TO_REPRESENT_U8 + 1);
-    result.length = Tundra_u8_to_cstr_buf(num, result.str);
-
-    return result;
+    return InTundra_uint_to_exact_cstr((u64)num);
 }
 
 Tundra_CStr Tundra_i8_to_cstr(i8 num)
 {
-    Tundra_CStr result;
-    
-    if(num == 0)
-    {
-        result.str = (char*)Tundra_alloc_mem(2);
-        result.str[0] = '0';
-        result.str[1] = '\0';
-        result.length = 1;
-        return result;
-    }
-
-    // +1 for null terminator.
-    result.str = (char*)Tundra_alloc_mem(TUNDRA_MAX_CHARS_TO_REPRESENT_I8 + 1);
-    result.length = Tundra_i8_to_cstr_buf(num, result.str);
-
-    return result;
+    return InTundra_int_to_exact_cstr((i64)num);
 }
 
 Tundra_CStr Tundra_float_to_cstr(float num)
 {
     Tundra_CStr result;
 
-    if(num == 0)
-    {
-        // 2 is for the "0." then the precision counts the number of zeros after
-        // that.
-        result.length = 2 + TUNDRA_FLOAT_PRECISION;
+    // +1 for null terminator 
+    result.str = (char*)Tundra_alloc_mem(
+        TUNDRA_MAX_CHARS_TO_REPRESENT_FLOAT + 1);    
+    result.length = Tundra_float_to_cstr_buf(num, result.str);
 
-        result.str = (char*)Tundra_alloc_mem(result.length + 1);
+    return result;
+}
 
-        u64 result_idx = 0;
-        result.str[result_idx++] = '0';
-        result.str[result_idx++] = '.';
-        for(u8 i = 0; i < TUNDRA_FLOAT_PRECISION; ++i)
-            result.str[result_idx++] = '0';
-        result.str[result_idx] = '\0';
-        return result;
-    }
+Tundra_CStr Tundra_double_to_cstr(double num)
+{
+    Tundra_CStr result;
 
     // +1 for null terminator 
     result.str = (char*)Tundra_alloc_mem(
-        TUNDRA_MAX_CHARS_TO_REPRESENT_FLOAT + 1);    
-    result.length = Tundra_float_to_cstr_buf(num, result.str);
+        TUNDRA_MAX_CHARS_TO_REPRESENT_DOUBLE + 1);
+    result.length = Tundra_double_to_cstr_buf(num, result.str);
 
     return result;
 }
@@ -264,9 +203,7 @@ u64 Tundra_u64_to_cstr_buf(u64 num, char *output)
         return 1;
     }
 
-    char buffer[TUNDRA_MAX_CHARS_TO_REPRESENT_U64];
-    
-    return InTundra_int_to_cstr_helper(num, buffer, output, false);
+    return InTundra_int_to_cstr_helper(num, output, false);
 }
 
 u64 Tundra_i64_to_cstr_buf(i64 num, char *output)
@@ -280,13 +217,11 @@ u64 Tundra_i64_to_cstr_buf(i64 num, char *output)
         return 1;
     }
 
-    char buffer[TUNDRA_MAX_CHARS_TO_REPRESENT_I64];
-    
     // Funky negation here due to i64 minimum not fitting inside i64 when 
     // negated. 
-    if(num < 0) return InTundra_int_to_cstr_helper((u64)(-(num + 1)) + 1, buffer, 
-        output, true);
-    return InTundra_int_to_cstr_helper((u64)num, buffer, output, false);
+    if(num < 0) return InTundra_int_to_cstr_helper((u64)(-(num + 1)) + 1, output,
+        true);
+    return InTundra_int_to_cstr_helper((u64)num, output, false);
 }
 
 u64 Tundra_u32_to_cstr_buf(u32 num, char *output)
@@ -300,9 +235,7 @@ u64 Tundra_u32_to_cstr_buf(u32 num, char *output)
         return 1;
     }
 
-    char buffer[TUNDRA_MAX_CHARS_TO_REPRESENT_U32];
-    
-    return InTundra_int_to_cstr_helper((u64)num, buffer, output, false);
+    return InTundra_int_to_cstr_helper((u64)num, output, false);
 }
 
 u64 Tundra_int_to_cstr_buf(int num, char *output)
@@ -316,13 +249,11 @@ u64 Tundra_int_to_cstr_buf(int num, char *output)
         return 1;
     }
 
-    char buffer[TUNDRA_MAX_CHARS_TO_REPRESENT_I32];
-    
     // Funky negation here due to i64 minimum not fitting inside i64 when 
     // negated. 
-    if(num < 0) return InTundra_int_to_cstr_helper((u64)(-(num + 1)) + 1, buffer, 
-        output, true);
-    return InTundra_int_to_cstr_helper((u64)num, buffer, output, false);
+    if(num < 0) return InTundra_int_to_cstr_helper((u64)(-(num + 1)) + 1, output,
+        true);
+    return InTundra_int_to_cstr_helper((u64)num, output, false);
 }
 
 u64 Tundra_u16_to_cstr_buf(u16 num, char *output)
@@ -336,9 +267,7 @@ u64 Tundra_u16_to_cstr_buf(u16 num, char *output)
         return 1;
     }
 
-    char buffer[TUNDRA_MAX_CHARS_TO_REPRESENT_U16];
-    
-    return InTundra_int_to_cstr_helper((u64)num, buffer, output, false);
+    return InTundra_int_to_cstr_helper((u64)num, output, false);
 }
 
 u64 Tundra_i16_to_cstr_buf(i16 num, char *output)
@@ -352,13 +281,11 @@ u64 Tundra_i16_to_cstr_buf(i16 num, char *output)
         return 1;
     }
 
-    char buffer[TUNDRA_MAX_CHARS_TO_REPRESENT_I16];
-    
     // Funky negation here due to i64 minimum not fitting inside i64 when 
     // negated. 
-    if(num < 0) return InTundra_int_to_cstr_helper((u64)(-(num + 1)) + 1, buffer, 
-        output, true);
-    return InTundra_int_to_cstr_helper((u64)num, buffer, output, false);
+    if(num < 0) return InTundra_int_to_cstr_helper((u64)(-(num + 1)) + 1, output,
+        true);
+    return InTundra_int_to_cstr_helper((u64)num, output, false);
 }
 
 u64 Tundra_u8_to_cstr_buf(u8 num, char *output)
@@ -372,9 +299,7 @@ u64 Tundra_u8_to_cstr_buf(u8 num, char *output)
         return 1;
     }
 
-    char buffer[TUNDRA_MAX_CHARS_TO_REPRESENT_U8];
-    
-    return InTundra_int_to_cstr_helper((u64)num, buffer, output, false);
+    return InTundra_int_to_cstr_helper((u64)num, output, false);
 }
 
 u64 Tundra_i8_to_cstr_buf(i8 num, char *output)
@@ -388,64 +313,1441 @@ u64 Tundra_i8_to_cstr_buf(i8 num, char *output)
         return 1;
     }
 
-    char buffer[TUNDRA_MAX_CHARS_TO_REPRESENT_I8];
-    
     // Funky negation here due to i64 minimum not fitting inside i64 when 
     // negated. 
-    if(num < 0) return InTundra_int_to_cstr_helper((u64)(-(num + 1)) + 1, buffer, 
-        output, true);
-    return InTundra_int_to_cstr_helper((u64)num, buffer, output, false);
+    if(num < 0) return InTundra_int_to_cstr_helper((u64)(-(num + 1)) + 1, output,
+        true);
+    return InTundra_int_to_cstr_helper((u64)num, output, false);
+}
+
+// Shortest round-trip float formatting --------------------------------------
+//
+// Ryu-style algorithm: the halfway interval [vm, vp] around the exact binary
+// value is scaled into decimal with precomputed 5^q / 2^k factors, then
+// digits are removed while the interval still brackets a unique shortest
+// representation. Output parses back to exactly the input bits.
+
+// Number of bits in 5^e, valid for e up to 3528.
+static inline u32 pow5_bits(i32 e)
+{
+    return (u32)(((e * 1217359) >> 19) + 1);
+}
+
+// floor(log10(2^e)), valid for e up to 1650.
+static inline u32 log10_pow2(i32 e)
+{
+    return (u32)((e * 78913) >> 18);
+}
+
+// floor(log10(5^e)), valid for e up to 2620.
+static inline u32 log10_pow5(i32 e)
+{
+    return (u32)((e * 732923) >> 20);
+}
+
+static const u64 FLOAT_POW5_INV_SPLIT[31] =
+{
+    576460752303423489ULL, 461168601842738791ULL,
+    368934881474191033ULL, 295147905179352826ULL,
+    472236648286964522ULL, 377789318629571618ULL,
+    302231454903657294ULL, 483570327845851670ULL,
+    386856262276681336ULL, 309485009821345069ULL,
+    495176015714152110ULL, 396140812571321688ULL,
+    316912650057057351ULL, 507060240091291761ULL,
+    405648192073033409ULL, 324518553658426727ULL,
+    519229685853482763ULL, 415383748682786211ULL,
+    332306998946228969ULL, 531691198313966350ULL,
+    425352958651173080ULL, 340282366920938464ULL,
+    544451787073501542ULL, 435561429658801234ULL,
+    348449143727040987ULL, 557518629963265579ULL,
+    446014903970612463ULL, 356811923176489971ULL,
+    570899077082383953ULL, 456719261665907162ULL,
+    365375409332725730ULL,
+};
+
+static const u64 FLOAT_POW5_SPLIT[47] =
+{
+    1152921504606846976ULL, 1441151880758558720ULL,
+    1801439850948198400ULL, 2251799813685248000ULL,
+    1407374883553280000ULL, 1759218604441600000ULL,
+    2199023255552000000ULL, 1374389534720000000ULL,
+    1717986918400000000ULL, 2147483648000000000ULL,
+    1342177280000000000ULL, 1677721600000000000ULL,
+    2097152000000000000ULL, 1310720000000000000ULL,
+    1638400000000000000ULL, 2048000000000000000ULL,
+    1280000000000000000ULL, 1600000000000000000ULL,
+    2000000000000000000ULL, 1250000000000000000ULL,
+    1562500000000000000ULL, 1953125000000000000ULL,
+    1220703125000000000ULL, 1525878906250000000ULL,
+    1907348632812500000ULL, 1192092895507812500ULL,
+    1490116119384765625ULL, 1862645149230957031ULL,
+    1164153218269348144ULL, 1455191522836685180ULL,
+    1818989403545856475ULL, 2273736754432320594ULL,
+    1421085471520200371ULL, 1776356839400250464ULL,
+    2220446049250313080ULL, 1387778780781445675ULL,
+    1734723475976807094ULL, 2168404344971008868ULL,
+    1355252715606880542ULL, 1694065894508600678ULL,
+    2117582368135750847ULL, 1323488980084844279ULL,
+    1654361225106055349ULL, 2067951531382569187ULL,
+    1292469707114105741ULL, 1615587133892632177ULL,
+    2019483917365790221ULL,
+};
+
+static const u64 DOUBLE_POW5_INV_SPLIT[292][2] =
+{
+    { 1ULL, 2305843009213693952ULL },
+    { 11068046444225730970ULL, 1844674407370955161ULL },
+    { 5165088340638674453ULL, 1475739525896764129ULL },
+    { 7821419487252849886ULL, 1180591620717411303ULL },
+    { 8824922364862649494ULL, 1888946593147858085ULL },
+    { 7059937891890119595ULL, 1511157274518286468ULL },
+    { 13026647942995916322ULL, 1208925819614629174ULL },
+    { 9774590264567735146ULL, 1934281311383406679ULL },
+    { 11509021026396098440ULL, 1547425049106725343ULL },
+    { 16585914450600699399ULL, 1237940039285380274ULL },
+    { 15469416676735388068ULL, 1980704062856608439ULL },
+    { 16064882156130220778ULL, 1584563250285286751ULL },
+    { 9162556910162266299ULL, 1267650600228229401ULL },
+    { 7281393426775805432ULL, 2028240960365167042ULL },
+    { 16893161185646375315ULL, 1622592768292133633ULL },
+    { 2446482504291369283ULL, 1298074214633706907ULL },
+    { 7603720821608101175ULL, 2076918743413931051ULL },
+    { 2393627842544570617ULL, 1661534994731144841ULL },
+    { 16672297533003297786ULL, 1329227995784915872ULL },
+    { 11918280793837635165ULL, 2126764793255865396ULL },
+    { 5845275820328197809ULL, 1701411834604692317ULL },
+    { 15744267100488289217ULL, 1361129467683753853ULL },
+    { 3054734472329800808ULL, 2177807148294006166ULL },
+    { 17201182836831481939ULL, 1742245718635204932ULL },
+    { 6382248639981364905ULL, 1393796574908163946ULL },
+    { 2832900194486363201ULL, 2230074519853062314ULL },
+    { 5955668970331000884ULL, 1784059615882449851ULL },
+    { 1075186361522890384ULL, 1427247692705959881ULL },
+    { 12788344622662355584ULL, 2283596308329535809ULL },
+    { 13920024512871794791ULL, 1826877046663628647ULL },
+    { 3757321980813615186ULL, 1461501637330902918ULL },
+    { 10384555214134712795ULL, 1169201309864722334ULL },
+    { 5547241898389809503ULL, 1870722095783555735ULL },
+    { 4437793518711847602ULL, 1496577676626844588ULL },
+    { 10928932444453298728ULL, 1197262141301475670ULL },
+    { 17486291911125277965ULL, 1915619426082361072ULL },
+    { 6610335899416401726ULL, 1532495540865888858ULL },
+    { 12666966349016942027ULL, 1225996432692711086ULL },
+    { 12888448528943286597ULL, 1961594292308337738ULL },
+    { 17689456452638449924ULL, 1569275433846670190ULL },
+    { 14151565162110759939ULL, 1255420347077336152ULL },
+    { 7885109000409574610ULL, 2008672555323737844ULL },
+    { 9997436015069570011ULL, 1606938044258990275ULL },
+    { 7997948812055656009ULL, 1285550435407192220ULL },
+    { 12796718099289049614ULL, 2056880696651507552ULL },
+    { 2858676849947419045ULL, 1645504557321206042ULL },
+    { 13354987924183666206ULL, 1316403645856964833ULL },
+    { 17678631863951955605ULL, 2106245833371143733ULL },
+    { 3074859046935833515ULL, 1684996666696914987ULL },
+    { 13527933681774397782ULL, 1347997333357531989ULL },
+    { 10576647446613305481ULL, 2156795733372051183ULL },
+    { 15840015586774465031ULL, 1725436586697640946ULL },
+    { 8982663654677661702ULL, 1380349269358112757ULL },
+    { 18061610662226169046ULL, 2208558830972980411ULL },
+    { 10759939715039024913ULL, 1766847064778384329ULL },
+    { 12297300586773130254ULL, 1413477651822707463ULL },
+    { 15986332124095098083ULL, 2261564242916331941ULL },
+    { 9099716884534168143ULL, 1809251394333065553ULL },
+    { 14658471137111155161ULL, 1447401115466452442ULL },
+    { 4348079280205103483ULL, 1157920892373161954ULL },
+    { 14335624477811986218ULL, 1852673427797059126ULL },
+    { 7779150767507678651ULL, 1482138742237647301ULL },
+    { 2533971799264232598ULL, 1185710993790117841ULL },
+    { 15122401323048503126ULL, 1897137590064188545ULL },
+    { 12097921058438802501ULL, 1517710072051350836ULL },
+    { 5988988032009131678ULL, 1214168057641080669ULL },
+    { 16961078480698431330ULL, 1942668892225729070ULL },
+    { 13568862784558745064ULL, 1554135113780583256ULL },
+    { 7165741412905085728ULL, 1243308091024466605ULL },
+    { 11465186260648137165ULL, 1989292945639146568ULL },
+    { 16550846638002330379ULL, 1591434356511317254ULL },
+    { 16930026125143774626ULL, 1273147485209053803ULL },
+    { 4951948911778577463ULL, 2037035976334486086ULL },
+    { 272210314680951647ULL, 1629628781067588869ULL },
+    { 3907117066486671641ULL, 1303703024854071095ULL },
+    { 6251387306378674625ULL, 2085924839766513752ULL },
+    { 16069156289328670670ULL, 1668739871813211001ULL },
+    { 9165976216721026213ULL, 1334991897450568801ULL },
+    { 7286864317269821294ULL, 2135987035920910082ULL },
+    { 16897537898041588005ULL, 1708789628736728065ULL },
+    { 13518030318433270404ULL, 1367031702989382452ULL },
+    { 6871453250525591353ULL, 2187250724783011924ULL },
+    { 9186511415162383406ULL, 1749800579826409539ULL },
+    { 11038557946871817048ULL, 1399840463861127631ULL },
+    { 10282995085511086630ULL, 2239744742177804210ULL },
+    { 8226396068408869304ULL, 1791795793742243368ULL },
+    { 13959814484210916090ULL, 1433436634993794694ULL },
+    { 11267656730511734774ULL, 2293498615990071511ULL },
+    { 5324776569667477496ULL, 1834798892792057209ULL },
+    { 7949170070475892320ULL, 1467839114233645767ULL },
+    { 17427382500606444826ULL, 1174271291386916613ULL },
+    { 5747719112518849781ULL, 1878834066219066582ULL },
+    { 15666221734240810795ULL, 1503067252975253265ULL },
+    { 12532977387392648636ULL, 1202453802380202612ULL },
+    { 5295368560860596524ULL, 1923926083808324180ULL },
+    { 4236294848688477220ULL, 1539140867046659344ULL },
+    { 7078384693692692099ULL, 1231312693637327475ULL },
+    { 11325415509908307358ULL, 1970100309819723960ULL },
+    { 9060332407926645887ULL, 1576080247855779168ULL },
+    { 14626963555825137356ULL, 1260864198284623334ULL },
+    { 12335095245094488799ULL, 2017382717255397335ULL },
+    { 9868076196075591040ULL, 1613906173804317868ULL },
+    { 15273158586344293478ULL, 1291124939043454294ULL },
+    { 13369007293925138595ULL, 2065799902469526871ULL },
+    { 7005857020398200553ULL, 1652639921975621497ULL },
+    { 16672732060544291412ULL, 1322111937580497197ULL },
+    { 11918976037903224966ULL, 2115379100128795516ULL },
+    { 5845832015580669650ULL, 1692303280103036413ULL },
+    { 12055363241948356366ULL, 1353842624082429130ULL },
+    { 841837113407818570ULL, 2166148198531886609ULL },
+    { 4362818505468165179ULL, 1732918558825509287ULL },
+    { 14558301248600263113ULL, 1386334847060407429ULL },
+    { 12225235553534690011ULL, 2218135755296651887ULL },
+    { 2401490813343931363ULL, 1774508604237321510ULL },
+    { 1921192650675145090ULL, 1419606883389857208ULL },
+    { 17831303500047873437ULL, 2271371013423771532ULL },
+    { 6886345170554478103ULL, 1817096810739017226ULL },
+    { 1819727321701672159ULL, 1453677448591213781ULL },
+    { 16213177116328979020ULL, 1162941958872971024ULL },
+    { 14873036941900635463ULL, 1860707134196753639ULL },
+    { 15587778368262418694ULL, 1488565707357402911ULL },
+    { 8780873879868024632ULL, 1190852565885922329ULL },
+    { 2981351763563108441ULL, 1905364105417475727ULL },
+    { 13453127855076217722ULL, 1524291284333980581ULL },
+    { 7073153469319063855ULL, 1219433027467184465ULL },
+    { 11317045550910502167ULL, 1951092843947495144ULL },
+    { 12742985255470312057ULL, 1560874275157996115ULL },
+    { 10194388204376249646ULL, 1248699420126396892ULL },
+    { 1553625868034358140ULL, 1997919072202235028ULL },
+    { 8621598323911307159ULL, 1598335257761788022ULL },
+    { 17965325103354776697ULL, 1278668206209430417ULL },
+    { 13987124906400001422ULL, 2045869129935088668ULL },
+    { 121653480894270168ULL, 1636695303948070935ULL },
+    { 97322784715416134ULL, 1309356243158456748ULL },
+    { 14913111714512307107ULL, 2094969989053530796ULL },
+    { 8241140556867935363ULL, 1675975991242824637ULL },
+    { 17660958889720079260ULL, 1340780792994259709ULL },
+    { 17189487779326395846ULL, 2145249268790815535ULL },
+    { 13751590223461116677ULL, 1716199415032652428ULL },
+    { 18379969808252713988ULL, 1372959532026121942ULL },
+    { 14650556434236701088ULL, 2196735251241795108ULL },
+    { 652398703163629901ULL, 1757388200993436087ULL },
+    { 11589965406756634890ULL, 1405910560794748869ULL },
+    { 7475898206584884855ULL, 2249456897271598191ULL },
+    { 2291369750525997561ULL, 1799565517817278553ULL },
+    { 9211793429904618695ULL, 1439652414253822842ULL },
+    { 18428218302589300235ULL, 2303443862806116547ULL },
+    { 7363877012587619542ULL, 1842755090244893238ULL },
+    { 13269799239553916280ULL, 1474204072195914590ULL },
+    { 10615839391643133024ULL, 1179363257756731672ULL },
+    { 2227947767661371545ULL, 1886981212410770676ULL },
+    { 16539753473096738529ULL, 1509584969928616540ULL },
+    { 13231802778477390823ULL, 1207667975942893232ULL },
+    { 6413489186596184024ULL, 1932268761508629172ULL },
+    { 16198837793502678189ULL, 1545815009206903337ULL },
+    { 5580372605318321905ULL, 1236652007365522670ULL },
+    { 8928596168509315048ULL, 1978643211784836272ULL },
+    { 18210923379033183008ULL, 1582914569427869017ULL },
+    { 7190041073742725760ULL, 1266331655542295214ULL },
+    { 436019273762630246ULL, 2026130648867672343ULL },
+    { 7727513048493924843ULL, 1620904519094137874ULL },
+    { 9871359253537050198ULL, 1296723615275310299ULL },
+    { 4726128361433549347ULL, 2074757784440496479ULL },
+    { 7470251503888749801ULL, 1659806227552397183ULL },
+    { 13354898832594820487ULL, 1327844982041917746ULL },
+    { 13989140502667892133ULL, 2124551971267068394ULL },
+    { 14880661216876224029ULL, 1699641577013654715ULL },
+    { 11904528973500979224ULL, 1359713261610923772ULL },
+    { 4289851098633925465ULL, 2175541218577478036ULL },
+    { 18189276137874781665ULL, 1740432974861982428ULL },
+    { 3483374466074094362ULL, 1392346379889585943ULL },
+    { 1884050330976640656ULL, 2227754207823337509ULL },
+    { 5196589079523222848ULL, 1782203366258670007ULL },
+    { 15225317707844309248ULL, 1425762693006936005ULL },
+    { 5913764258841343181ULL, 2281220308811097609ULL },
+    { 8420360221814984868ULL, 1824976247048878087ULL },
+    { 17804334621677718864ULL, 1459980997639102469ULL },
+    { 17932816512084085415ULL, 1167984798111281975ULL },
+    { 10245762345624985047ULL, 1868775676978051161ULL },
+    { 4507261061758077715ULL, 1495020541582440929ULL },
+    { 7295157664148372495ULL, 1196016433265952743ULL },
+    { 7982903447895485668ULL, 1913626293225524389ULL },
+    { 10075671573058298858ULL, 1530901034580419511ULL },
+    { 4371188443704728763ULL, 1224720827664335609ULL },
+    { 14372599139411386667ULL, 1959553324262936974ULL },
+    { 15187428126271019657ULL, 1567642659410349579ULL },
+    { 15839291315758726049ULL, 1254114127528279663ULL },
+    { 3206773216762499739ULL, 2006582604045247462ULL },
+    { 13633465017635730761ULL, 1605266083236197969ULL },
+    { 14596120828850494932ULL, 1284212866588958375ULL },
+    { 4907049252451240275ULL, 2054740586542333401ULL },
+    { 236290587219081897ULL, 1643792469233866721ULL },
+    { 14946427728742906810ULL, 1315033975387093376ULL },
+    { 16535586736504830250ULL, 2104054360619349402ULL },
+    { 5849771759720043554ULL, 1683243488495479522ULL },
+    { 15747863852001765813ULL, 1346594790796383617ULL },
+    { 10439186904235184007ULL, 2154551665274213788ULL },
+    { 15730047152871967852ULL, 1723641332219371030ULL },
+    { 12584037722297574282ULL, 1378913065775496824ULL },
+    { 9066413911450387881ULL, 2206260905240794919ULL },
+    { 10942479943902220628ULL, 1765008724192635935ULL },
+    { 8753983955121776503ULL, 1412006979354108748ULL },
+    { 10317025513452932081ULL, 2259211166966573997ULL },
+    { 874922781278525018ULL, 1807368933573259198ULL },
+    { 8078635854506640661ULL, 1445895146858607358ULL },
+    { 13841606313089133175ULL, 1156716117486885886ULL },
+    { 14767872471458792434ULL, 1850745787979017418ULL },
+    { 746251532941302978ULL, 1480596630383213935ULL },
+    { 597001226353042382ULL, 1184477304306571148ULL },
+    { 15712597221132509104ULL, 1895163686890513836ULL },
+    { 8880728962164096960ULL, 1516130949512411069ULL },
+    { 10793931984473187891ULL, 1212904759609928855ULL },
+    { 17270291175157100626ULL, 1940647615375886168ULL },
+    { 2748186495899949531ULL, 1552518092300708935ULL },
+    { 2198549196719959625ULL, 1242014473840567148ULL },
+    { 18275073973719576693ULL, 1987223158144907436ULL },
+    { 10930710364233751031ULL, 1589778526515925949ULL },
+    { 12433917106128911148ULL, 1271822821212740759ULL },
+    { 8826220925580526867ULL, 2034916513940385215ULL },
+    { 7060976740464421494ULL, 1627933211152308172ULL },
+    { 16716827836597268165ULL, 1302346568921846537ULL },
+    { 11989529279587987770ULL, 2083754510274954460ULL },
+    { 9591623423670390216ULL, 1667003608219963568ULL },
+    { 15051996368420132820ULL, 1333602886575970854ULL },
+    { 13015147745246481542ULL, 2133764618521553367ULL },
+    { 3033420566713364587ULL, 1707011694817242694ULL },
+    { 6116085268112601993ULL, 1365609355853794155ULL },
+    { 9785736428980163188ULL, 2184974969366070648ULL },
+    { 15207286772667951197ULL, 1747979975492856518ULL },
+    { 1097782973908629988ULL, 1398383980394285215ULL },
+    { 1756452758253807981ULL, 2237414368630856344ULL },
+    { 5094511021344956708ULL, 1789931494904685075ULL },
+    { 4075608817075965366ULL, 1431945195923748060ULL },
+    { 6520974107321544586ULL, 2291112313477996896ULL },
+    { 1527430471115325346ULL, 1832889850782397517ULL },
+    { 12289990821117991246ULL, 1466311880625918013ULL },
+    { 17210690286378213644ULL, 1173049504500734410ULL },
+    { 9090360384495590213ULL, 1876879207201175057ULL },
+    { 18340334751822203140ULL, 1501503365760940045ULL },
+    { 14672267801457762512ULL, 1201202692608752036ULL },
+    { 16096930852848599373ULL, 1921924308174003258ULL },
+    { 1809498238053148529ULL, 1537539446539202607ULL },
+    { 12515645034668249793ULL, 1230031557231362085ULL },
+    { 1578287981759648052ULL, 1968050491570179337ULL },
+    { 12330676829633449412ULL, 1574440393256143469ULL },
+    { 13553890278448669853ULL, 1259552314604914775ULL },
+    { 3239480371808320148ULL, 2015283703367863641ULL },
+    { 17348979556414297411ULL, 1612226962694290912ULL },
+    { 6500486015647617283ULL, 1289781570155432730ULL },
+    { 10400777625036187652ULL, 2063650512248692368ULL },
+    { 15699319729512770768ULL, 1650920409798953894ULL },
+    { 16248804598352126938ULL, 1320736327839163115ULL },
+    { 7551343283653851484ULL, 2113178124542660985ULL },
+    { 6041074626923081187ULL, 1690542499634128788ULL },
+    { 12211557331022285596ULL, 1352433999707303030ULL },
+    { 1091747655926105338ULL, 2163894399531684849ULL },
+    { 4562746939482794594ULL, 1731115519625347879ULL },
+    { 7339546366328145998ULL, 1384892415700278303ULL },
+    { 8053925371383123274ULL, 2215827865120445285ULL },
+    { 6443140297106498619ULL, 1772662292096356228ULL },
+    { 12533209867169019542ULL, 1418129833677084982ULL },
+    { 5295740528502789974ULL, 2269007733883335972ULL },
+    { 15304638867027962949ULL, 1815206187106668777ULL },
+    { 4865013464138549713ULL, 1452164949685335022ULL },
+    { 14960057215536570740ULL, 1161731959748268017ULL },
+    { 9178696285890871890ULL, 1858771135597228828ULL },
+    { 14721654658196518159ULL, 1487016908477783062ULL },
+    { 4398626097073393881ULL, 1189613526782226450ULL },
+    { 7037801755317430209ULL, 1903381642851562320ULL },
+    { 5630241404253944167ULL, 1522705314281249856ULL },
+    { 814844308661245011ULL, 1218164251424999885ULL },
+    { 1303750893857992017ULL, 1949062802279999816ULL },
+    { 15800395974054034906ULL, 1559250241823999852ULL },
+    { 5261619149759407279ULL, 1247400193459199882ULL },
+    { 12107939454356961969ULL, 1995840309534719811ULL },
+    { 5997002748743659252ULL, 1596672247627775849ULL },
+    { 8486951013736837725ULL, 1277337798102220679ULL },
+    { 2511075177753209390ULL, 2043740476963553087ULL },
+    { 13076906586428298482ULL, 1634992381570842469ULL },
+    { 14150874083884549109ULL, 1307993905256673975ULL },
+    { 4194654460505726958ULL, 2092790248410678361ULL },
+    { 18113118827372222859ULL, 1674232198728542688ULL },
+    { 3422448617672047318ULL, 1339385758982834151ULL },
+    { 16543964232501006678ULL, 2143017214372534641ULL },
+    { 9545822571258895019ULL, 1714413771498027713ULL },
+    { 15015355686490936662ULL, 1371531017198422170ULL },
+    { 5577825024675947042ULL, 2194449627517475473ULL },
+    { 11840957649224578280ULL, 1755559702013980378ULL },
+    { 16851463748863483271ULL, 1404447761611184302ULL },
+    { 12204946739213931940ULL, 2247116418577894884ULL },
+    { 13453306206113055875ULL, 1797693134862315907ULL },
+    { 3383947335406624054ULL, 1438154507889852726ULL },
+};
+
+static const u64 DOUBLE_POW5_SPLIT[326][2] =
+{
+    { 0ULL, 1152921504606846976ULL },
+    { 0ULL, 1441151880758558720ULL },
+    { 0ULL, 1801439850948198400ULL },
+    { 0ULL, 2251799813685248000ULL },
+    { 0ULL, 1407374883553280000ULL },
+    { 0ULL, 1759218604441600000ULL },
+    { 0ULL, 2199023255552000000ULL },
+    { 0ULL, 1374389534720000000ULL },
+    { 0ULL, 1717986918400000000ULL },
+    { 0ULL, 2147483648000000000ULL },
+    { 0ULL, 1342177280000000000ULL },
+    { 0ULL, 1677721600000000000ULL },
+    { 0ULL, 2097152000000000000ULL },
+    { 0ULL, 1310720000000000000ULL },
+    { 0ULL, 1638400000000000000ULL },
+    { 0ULL, 2048000000000000000ULL },
+    { 0ULL, 1280000000000000000ULL },
+    { 0ULL, 1600000000000000000ULL },
+    { 0ULL, 2000000000000000000ULL },
+    { 0ULL, 1250000000000000000ULL },
+    { 0ULL, 1562500000000000000ULL },
+    { 0ULL, 1953125000000000000ULL },
+    { 0ULL, 1220703125000000000ULL },
+    { 0ULL, 1525878906250000000ULL },
+    { 0ULL, 1907348632812500000ULL },
+    { 0ULL, 1192092895507812500ULL },
+    { 0ULL, 1490116119384765625ULL },
+    { 4611686018427387904ULL, 1862645149230957031ULL },
+    { 9799832789158199296ULL, 1164153218269348144ULL },
+    { 12249790986447749120ULL, 1455191522836685180ULL },
+    { 15312238733059686400ULL, 1818989403545856475ULL },
+    { 14528612397897220096ULL, 2273736754432320594ULL },
+    { 13692068767113150464ULL, 1421085471520200371ULL },
+    { 12503399940464050176ULL, 1776356839400250464ULL },
+    { 15629249925580062720ULL, 2220446049250313080ULL },
+    { 9768281203487539200ULL, 1387778780781445675ULL },
+    { 7598665485932036096ULL, 1734723475976807094ULL },
+    { 274959820560269312ULL, 2168404344971008868ULL },
+    { 9395221924704944128ULL, 1355252715606880542ULL },
+    { 2520655369026404352ULL, 1694065894508600678ULL },
+    { 12374191248137781248ULL, 2117582368135750847ULL },
+    { 14651398557727195136ULL, 1323488980084844279ULL },
+    { 13702562178731606016ULL, 1654361225106055349ULL },
+    { 3293144668132343808ULL, 2067951531382569187ULL },
+    { 18199116482078572544ULL, 1292469707114105741ULL },
+    { 8913837547316051968ULL, 1615587133892632177ULL },
+    { 15753982952572452864ULL, 2019483917365790221ULL },
+    { 12152082354571476992ULL, 1262177448353618888ULL },
+    { 15190102943214346240ULL, 1577721810442023610ULL },
+    { 9764256642163156992ULL, 1972152263052529513ULL },
+    { 17631875447420442880ULL, 1232595164407830945ULL },
+    { 8204786253993389888ULL, 1540743955509788682ULL },
+    { 1032610780636961552ULL, 1925929944387235853ULL },
+    { 2951224747111794922ULL, 1203706215242022408ULL },
+    { 3689030933889743652ULL, 1504632769052528010ULL },
+    { 13834660704216955373ULL, 1880790961315660012ULL },
+    { 17870034976990372916ULL, 1175494350822287507ULL },
+    { 17725857702810578241ULL, 1469367938527859384ULL },
+    { 3710578054803671186ULL, 1836709923159824231ULL },
+    { 26536550077201078ULL, 2295887403949780289ULL },
+    { 11545800389866720434ULL, 1434929627468612680ULL },
+    { 14432250487333400542ULL, 1793662034335765850ULL },
+    { 8816941072311974870ULL, 2242077542919707313ULL },
+    { 17039803216263454053ULL, 1401298464324817070ULL },
+    { 12076381983474541759ULL, 1751623080406021338ULL },
+    { 5872105442488401391ULL, 2189528850507526673ULL },
+    { 15199280947623720629ULL, 1368455531567204170ULL },
+    { 9775729147674874978ULL, 1710569414459005213ULL },
+    { 16831347453020981627ULL, 2138211768073756516ULL },
+    { 1296220121283337709ULL, 1336382355046097823ULL },
+    { 15455333206886335848ULL, 1670477943807622278ULL },
+    { 10095794471753144002ULL, 2088097429759527848ULL },
+    { 6309871544845715001ULL, 1305060893599704905ULL },
+    { 12499025449484531656ULL, 1631326116999631131ULL },
+    { 11012095793428276666ULL, 2039157646249538914ULL },
+    { 11494245889320060820ULL, 1274473528905961821ULL },
+    { 532749306367912313ULL, 1593091911132452277ULL },
+    { 5277622651387278295ULL, 1991364888915565346ULL },
+    { 7910200175544436838ULL, 1244603055572228341ULL },
+    { 14499436237857933952ULL, 1555753819465285426ULL },
+    { 8900923260467641632ULL, 1944692274331606783ULL },
+    { 12480606065433357876ULL, 1215432671457254239ULL },
+    { 10989071563364309441ULL, 1519290839321567799ULL },
+    { 9124653435777998898ULL, 1899113549151959749ULL },
+    { 8008751406574943263ULL, 1186945968219974843ULL },
+    { 5399253239791291175ULL, 1483682460274968554ULL },
+    { 15972438586593889776ULL, 1854603075343710692ULL },
+    { 759402079766405302ULL, 1159126922089819183ULL },
+    { 14784310654990170340ULL, 1448908652612273978ULL },
+    { 9257016281882937117ULL, 1811135815765342473ULL },
+    { 16182956370781059300ULL, 2263919769706678091ULL },
+    { 7808504722524468110ULL, 1414949856066673807ULL },
+    { 5148944884728197234ULL, 1768687320083342259ULL },
+    { 1824495087482858639ULL, 2210859150104177824ULL },
+    { 1140309429676786649ULL, 1381786968815111140ULL },
+    { 1425386787095983311ULL, 1727233711018888925ULL },
+    { 6393419502297367043ULL, 2159042138773611156ULL },
+    { 13219259225790630210ULL, 1349401336733506972ULL },
+    { 16524074032238287762ULL, 1686751670916883715ULL },
+    { 16043406521870471799ULL, 2108439588646104644ULL },
+    { 803757039314269066ULL, 1317774742903815403ULL },
+    { 14839754354425000045ULL, 1647218428629769253ULL },
+    { 4714634887749086344ULL, 2059023035787211567ULL },
+    { 9864175832484260821ULL, 1286889397367007229ULL },
+    { 16941905809032713930ULL, 1608611746708759036ULL },
+    { 2730638187581340797ULL, 2010764683385948796ULL },
+    { 10930020904093113806ULL, 1256727927116217997ULL },
+    { 18274212148543780162ULL, 1570909908895272496ULL },
+    { 4396021111970173586ULL, 1963637386119090621ULL },
+    { 5053356204195052443ULL, 1227273366324431638ULL },
+    { 15540067292098591362ULL, 1534091707905539547ULL },
+    { 14813398096695851299ULL, 1917614634881924434ULL },
+    { 13870059828862294966ULL, 1198509146801202771ULL },
+    { 12725888767650480803ULL, 1498136433501503464ULL },
+    { 15907360959563101004ULL, 1872670541876879330ULL },
+    { 14553786618154326031ULL, 1170419088673049581ULL },
+    { 4357175217410743827ULL, 1463023860841311977ULL },
+    { 10058155040190817688ULL, 1828779826051639971ULL },
+    { 7961007781811134206ULL, 2285974782564549964ULL },
+    { 14199001900486734687ULL, 1428734239102843727ULL },
+    { 13137066357181030455ULL, 1785917798878554659ULL },
+    { 11809646928048900164ULL, 2232397248598193324ULL },
+    { 16604401366885338411ULL, 1395248280373870827ULL },
+    { 16143815690179285109ULL, 1744060350467338534ULL },
+    { 10956397575869330579ULL, 2180075438084173168ULL },
+    { 6847748484918331612ULL, 1362547148802608230ULL },
+    { 17783057643002690323ULL, 1703183936003260287ULL },
+    { 17617136035325974999ULL, 2128979920004075359ULL },
+    { 17928239049719816230ULL, 1330612450002547099ULL },
+    { 17798612793722382384ULL, 1663265562503183874ULL },
+    { 13024893955298202172ULL, 2079081953128979843ULL },
+    { 5834715712847682405ULL, 1299426220705612402ULL },
+    { 16516766677914378815ULL, 1624282775882015502ULL },
+    { 11422586310538197711ULL, 2030353469852519378ULL },
+    { 11750802462513761473ULL, 1268970918657824611ULL },
+    { 10076817059714813937ULL, 1586213648322280764ULL },
+    { 12596021324643517422ULL, 1982767060402850955ULL },
+    { 5566670318688504437ULL, 1239229412751781847ULL },
+    { 2346651879933242642ULL, 1549036765939727309ULL },
+    { 7545000868343941206ULL, 1936295957424659136ULL },
+    { 4715625542714963254ULL, 1210184973390411960ULL },
+    { 5894531928393704067ULL, 1512731216738014950ULL },
+    { 16591536947346905892ULL, 1890914020922518687ULL },
+    { 17287239619732898039ULL, 1181821263076574179ULL },
+    { 16997363506238734644ULL, 1477276578845717724ULL },
+    { 2799960309088866689ULL, 1846595723557147156ULL },
+    { 10973347230035317489ULL, 1154122327223216972ULL },
+    { 13716684037544146861ULL, 1442652909029021215ULL },
+    { 12534169028502795672ULL, 1803316136286276519ULL },
+    { 11056025267201106687ULL, 2254145170357845649ULL },
+    { 18439230838069161439ULL, 1408840731473653530ULL },
+    { 13825666510731675991ULL, 1761050914342066913ULL },
+    { 3447025083132431277ULL, 2201313642927583642ULL },
+    { 6766076695385157452ULL, 1375821026829739776ULL },
+    { 8457595869231446815ULL, 1719776283537174720ULL },
+    { 10571994836539308519ULL, 2149720354421468400ULL },
+    { 6607496772837067824ULL, 1343575221513417750ULL },
+    { 17482743002901110588ULL, 1679469026891772187ULL },
+    { 17241742735199000331ULL, 2099336283614715234ULL },
+    { 15387775227926763111ULL, 1312085177259197021ULL },
+    { 5399660979626290177ULL, 1640106471573996277ULL },
+    { 11361262242960250625ULL, 2050133089467495346ULL },
+    { 11712474920277544544ULL, 1281333180917184591ULL },
+    { 10028907631919542777ULL, 1601666476146480739ULL },
+    { 7924448521472040567ULL, 2002083095183100924ULL },
+    { 14176152362774801162ULL, 1251301934489438077ULL },
+    { 3885132398186337741ULL, 1564127418111797597ULL },
+    { 9468101516160310080ULL, 1955159272639746996ULL },
+    { 15140935484454969608ULL, 1221974545399841872ULL },
+    { 479425281859160394ULL, 1527468181749802341ULL },
+    { 5210967620751338397ULL, 1909335227187252926ULL },
+    { 17091912818251750210ULL, 1193334516992033078ULL },
+    { 12141518985959911954ULL, 1491668146240041348ULL },
+    { 15176898732449889943ULL, 1864585182800051685ULL },
+    { 11791404716994875166ULL, 1165365739250032303ULL },
+    { 10127569877816206054ULL, 1456707174062540379ULL },
+    { 8047776328842869663ULL, 1820883967578175474ULL },
+    { 836348374198811271ULL, 2276104959472719343ULL },
+    { 7440246761515338900ULL, 1422565599670449589ULL },
+    { 13911994470321561530ULL, 1778206999588061986ULL },
+    { 8166621051047176104ULL, 2222758749485077483ULL },
+    { 2798295147690791113ULL, 1389224218428173427ULL },
+    { 17332926989895652603ULL, 1736530273035216783ULL },
+    { 17054472718942177850ULL, 2170662841294020979ULL },
+    { 8353202440125167204ULL, 1356664275808763112ULL },
+    { 10441503050156459005ULL, 1695830344760953890ULL },
+    { 3828506775840797949ULL, 2119787930951192363ULL },
+    { 86973725686804766ULL, 1324867456844495227ULL },
+    { 13943775212390669669ULL, 1656084321055619033ULL },
+    { 3594660960206173375ULL, 2070105401319523792ULL },
+    { 2246663100128858359ULL, 1293815875824702370ULL },
+    { 12031700912015848757ULL, 1617269844780877962ULL },
+    { 5816254103165035138ULL, 2021587305976097453ULL },
+    { 5941001823691840913ULL, 1263492066235060908ULL },
+    { 7426252279614801142ULL, 1579365082793826135ULL },
+    { 4671129331091113523ULL, 1974206353492282669ULL },
+    { 5225298841145639904ULL, 1233878970932676668ULL },
+    { 6531623551432049880ULL, 1542348713665845835ULL },
+    { 3552843420862674446ULL, 1927935892082307294ULL },
+    { 16055585193321335241ULL, 1204959932551442058ULL },
+    { 10846109454796893243ULL, 1506199915689302573ULL },
+    { 18169322836923504458ULL, 1882749894611628216ULL },
+    { 11355826773077190286ULL, 1176718684132267635ULL },
+    { 9583097447919099954ULL, 1470898355165334544ULL },
+    { 11978871809898874942ULL, 1838622943956668180ULL },
+    { 14973589762373593678ULL, 2298278679945835225ULL },
+    { 2440964573842414192ULL, 1436424174966147016ULL },
+    { 3051205717303017741ULL, 1795530218707683770ULL },
+    { 13037379183483547984ULL, 2244412773384604712ULL },
+    { 8148361989677217490ULL, 1402757983365377945ULL },
+    { 14797138505523909766ULL, 1753447479206722431ULL },
+    { 13884737113477499304ULL, 2191809349008403039ULL },
+    { 15595489723564518921ULL, 1369880843130251899ULL },
+    { 14882676136028260747ULL, 1712351053912814874ULL },
+    { 9379973133180550126ULL, 2140438817391018593ULL },
+    { 17391698254306313589ULL, 1337774260869386620ULL },
+    { 3292878744173340370ULL, 1672217826086733276ULL },
+    { 4116098430216675462ULL, 2090272282608416595ULL },
+    { 266718509671728212ULL, 1306420176630260372ULL },
+    { 333398137089660265ULL, 1633025220787825465ULL },
+    { 5028433689789463235ULL, 2041281525984781831ULL },
+    { 10060300083759496378ULL, 1275800953740488644ULL },
+    { 12575375104699370472ULL, 1594751192175610805ULL },
+    { 1884160825592049379ULL, 1993438990219513507ULL },
+    { 17318501580490888525ULL, 1245899368887195941ULL },
+    { 7813068920331446945ULL, 1557374211108994927ULL },
+    { 5154650131986920777ULL, 1946717763886243659ULL },
+    { 915813323278131534ULL, 1216698602428902287ULL },
+    { 14979824709379828129ULL, 1520873253036127858ULL },
+    { 9501408849870009354ULL, 1901091566295159823ULL },
+    { 12855909558809837702ULL, 1188182228934474889ULL },
+    { 2234828893230133415ULL, 1485227786168093612ULL },
+    { 2793536116537666769ULL, 1856534732710117015ULL },
+    { 8663489100477123587ULL, 1160334207943823134ULL },
+    { 1605989338741628675ULL, 1450417759929778918ULL },
+    { 11230858710281811652ULL, 1813022199912223647ULL },
+    { 9426887369424876662ULL, 2266277749890279559ULL },
+    { 12809333633531629769ULL, 1416423593681424724ULL },
+    { 16011667041914537212ULL, 1770529492101780905ULL },
+    { 6179525747111007803ULL, 2213161865127226132ULL },
+    { 13085575628799155685ULL, 1383226165704516332ULL },
+    { 16356969535998944606ULL, 1729032707130645415ULL },
+    { 15834525901571292854ULL, 2161290883913306769ULL },
+    { 2979049660840976177ULL, 1350806802445816731ULL },
+    { 17558870131333383934ULL, 1688508503057270913ULL },
+    { 8113529608884566205ULL, 2110635628821588642ULL },
+    { 9682642023980241782ULL, 1319147268013492901ULL },
+    { 16714988548402690132ULL, 1648934085016866126ULL },
+    { 11670363648648586857ULL, 2061167606271082658ULL },
+    { 11905663298832754689ULL, 1288229753919426661ULL },
+    { 1047021068258779650ULL, 1610287192399283327ULL },
+    { 15143834390605638274ULL, 2012858990499104158ULL },
+    { 4853210475701136017ULL, 1258036869061940099ULL },
+    { 1454827076199032118ULL, 1572546086327425124ULL },
+    { 1818533845248790147ULL, 1965682607909281405ULL },
+    { 3442426662494187794ULL, 1228551629943300878ULL },
+    { 13526405364972510550ULL, 1535689537429126097ULL },
+    { 3072948650933474476ULL, 1919611921786407622ULL },
+    { 15755650962115585259ULL, 1199757451116504763ULL },
+    { 15082877684217093670ULL, 1499696813895630954ULL },
+    { 9630225068416591280ULL, 1874621017369538693ULL },
+    { 8324733676974063502ULL, 1171638135855961683ULL },
+    { 5794231077790191473ULL, 1464547669819952104ULL },
+    { 7242788847237739342ULL, 1830684587274940130ULL },
+    { 18276858095901949986ULL, 2288355734093675162ULL },
+    { 16034722328366106645ULL, 1430222333808546976ULL },
+    { 1596658836748081690ULL, 1787777917260683721ULL },
+    { 6607509564362490017ULL, 2234722396575854651ULL },
+    { 1823850468512862308ULL, 1396701497859909157ULL },
+    { 6891499104068465790ULL, 1745876872324886446ULL },
+    { 17837745916940358045ULL, 2182346090406108057ULL },
+    { 4231062170446641922ULL, 1363966306503817536ULL },
+    { 5288827713058302403ULL, 1704957883129771920ULL },
+    { 6611034641322878003ULL, 2131197353912214900ULL },
+    { 13355268687681574560ULL, 1331998346195134312ULL },
+    { 16694085859601968200ULL, 1664997932743917890ULL },
+    { 11644235287647684442ULL, 2081247415929897363ULL },
+    { 4971804045566108824ULL, 1300779634956185852ULL },
+    { 6214755056957636030ULL, 1625974543695232315ULL },
+    { 3156757802769657134ULL, 2032468179619040394ULL },
+    { 6584659645158423613ULL, 1270292612261900246ULL },
+    { 17454196593302805324ULL, 1587865765327375307ULL },
+    { 17206059723201118751ULL, 1984832206659219134ULL },
+    { 6142101308573311315ULL, 1240520129162011959ULL },
+    { 3065940617289251240ULL, 1550650161452514949ULL },
+    { 8444111790038951954ULL, 1938312701815643686ULL },
+    { 665883850346957067ULL, 1211445438634777304ULL },
+    { 832354812933696334ULL, 1514306798293471630ULL },
+    { 10263815553021896226ULL, 1892883497866839537ULL },
+    { 17944099766707154901ULL, 1183052186166774710ULL },
+    { 13206752671529167818ULL, 1478815232708468388ULL },
+    { 16508440839411459773ULL, 1848519040885585485ULL },
+    { 12623618533845856310ULL, 1155324400553490928ULL },
+    { 15779523167307320387ULL, 1444155500691863660ULL },
+    { 1277659885424598868ULL, 1805194375864829576ULL },
+    { 1597074856780748586ULL, 2256492969831036970ULL },
+    { 5609857803915355770ULL, 1410308106144398106ULL },
+    { 16235694291748970521ULL, 1762885132680497632ULL },
+    { 1847873790976661535ULL, 2203606415850622041ULL },
+    { 12684136165428883219ULL, 1377254009906638775ULL },
+    { 11243484188358716120ULL, 1721567512383298469ULL },
+    { 219297180166231438ULL, 2151959390479123087ULL },
+    { 7054589765244976505ULL, 1344974619049451929ULL },
+    { 13429923224983608535ULL, 1681218273811814911ULL },
+    { 12175718012802122765ULL, 2101522842264768639ULL },
+    { 14527352785642408584ULL, 1313451776415480399ULL },
+    { 13547504963625622826ULL, 1641814720519350499ULL },
+    { 12322695186104640628ULL, 2052268400649188124ULL },
+    { 16925056528170176201ULL, 1282667750405742577ULL },
+    { 7321262604930556539ULL, 1603334688007178222ULL },
+    { 18374950293017971482ULL, 2004168360008972777ULL },
+    { 4566814905495150320ULL, 1252605225005607986ULL },
+    { 14931890668723713708ULL, 1565756531257009982ULL },
+    { 9441491299049866327ULL, 1957195664071262478ULL },
+    { 1289246043478778550ULL, 1223247290044539049ULL },
+    { 6223243572775861092ULL, 1529059112555673811ULL },
+    { 3167368447542438461ULL, 1911323890694592264ULL },
+    { 1979605279714024038ULL, 1194577431684120165ULL },
+    { 7086192618069917952ULL, 1493221789605150206ULL },
+    { 18081112809442173248ULL, 1866527237006437757ULL },
+    { 13606538515115052232ULL, 1166579523129023598ULL },
+    { 7784801107039039482ULL, 1458224403911279498ULL },
+    { 507629346944023544ULL, 1822780504889099373ULL },
+    { 5246222702107417334ULL, 2278475631111374216ULL },
+    { 3278889188817135834ULL, 1424047269444608885ULL },
+    { 8710297504448807696ULL, 1780059086805761106ULL },
+};
+
+// Returns true if `value` divides evenly by 5^p.
+static bool multiple_of_pow5(u64 value, u32 p)
+{
+    u32 count = 0;
+
+    while(value % 5 == 0)
+    {
+        value /= 5;
+        ++count;
+    }
+
+    return count >= p;
+}
+
+// Returns true if `value` divides evenly by 2^p.
+static inline bool multiple_of_pow2(u64 value, u32 p)
+{
+    return (value & ((1ULL << p) - 1)) == 0;
+}
+
+// ((m * factor) >> shift) without losing the high product bits.
+static inline u32 mul_shift_32(u32 m, u64 factor, i32 shift)
+{
+    return (u32)(((unsigned __int128)m * factor) >> shift);
+}
+
+// Same as `mul_shift_32` with a 128 bit factor stored as { low, high }.
+static inline u64 mul_shift_64(u64 m, const u64 *mul, i32 shift)
+{
+    const unsigned __int128 LO = (unsigned __int128)m * mul[0];
+    const unsigned __int128 HI = (unsigned __int128)m * mul[1];
+
+    return (u64)(((LO >> 64) + HI) >> (shift - 64));
+}
+
+/**
+ * @brief Converts a finite nonzero float's raw mantissa and exponent into
+ * the shortest decimal digits that round-trip.
+ *
+ * @param ieee_mantissa Raw 23 bit mantissa field.
+ * @param ieee_exponent Raw 8 bit exponent field.
+ * @param exp_output Receives the power of ten of the last digit.
+ *
+ * @return u32 The decimal digits; the value is digits * 10^exponent.
+ */
+static u32 float_to_shortest_digits(u32 ieee_mantissa, u32 ieee_exponent,
+    i32 *exp_output)
+{
+    i32 e2;
+    u32 m2;
+
+    // Two extra mantissa bits so the halfway points below are integers.
+    if(ieee_exponent == 0)
+    {
+        e2 = 1 - 127 - 23 - 2;
+        m2 = ieee_mantissa;
+    }
+    else
+    {
+        e2 = (i32)ieee_exponent - 127 - 23 - 2;
+        m2 = (1U << 23) | ieee_mantissa;
+    }
+
+    const bool ACCEPT_BOUNDS = (m2 & 1) == 0;
+
+    // The value and its halfway points to the neighboring floats.
+    const u32 MV = 4 * m2;
+    const u32 MP = 4 * m2 + 2;
+    const u32 MM_SHIFT = ieee_mantissa != 0 || ieee_exponent <= 1;
+    const u32 MM = 4 * m2 - 1 - MM_SHIFT;
+
+    u32 vr, vp, vm;
+    i32 e10;
+    bool vm_trailing_zeros = false;
+    bool vr_trailing_zeros = false;
+    u8 last_removed_digit = 0;
+
+    if(e2 >= 0)
+    {
+        const u32 Q = log10_pow2(e2);
+        e10 = (i32)Q;
+
+        const i32 K = 59 + (i32)pow5_bits((i32)Q) - 1;
+        const i32 I = -e2 + (i32)Q + K;
+
+        vr = mul_shift_32(MV, FLOAT_POW5_INV_SPLIT[Q], I);
+        vp = mul_shift_32(MP, FLOAT_POW5_INV_SPLIT[Q], I);
+        vm = mul_shift_32(MM, FLOAT_POW5_INV_SPLIT[Q], I);
+
+        if(Q != 0 && (vp - 1) / 10 <= vm / 10)
+        {
+            // The loop below won't remove any digit, so the rounding digit
+            // has to come from one digit further out.
+            const i32 L = 59 + (i32)pow5_bits((i32)Q - 1) - 1;
+
+            last_removed_digit = (u8)(mul_shift_32(MV,
+                FLOAT_POW5_INV_SPLIT[Q - 1], -e2 + (i32)Q - 1 + L) % 10);
+        }
+
+        if(Q <= 9)
+        {
+            // Only one of mv, mm and mp can be a multiple of 5^q, if any.
+            if(MV % 5 == 0)
+            {
+                vr_trailing_zeros = multiple_of_pow5(MV, Q);
+            }
+            else if(ACCEPT_BOUNDS)
+            {
+                vm_trailing_zeros = multiple_of_pow5(MM, Q);
+            }
+            else { vp -= multiple_of_pow5(MP, Q); }
+        }
+    }
+    else
+    {
+        const u32 Q = log10_pow5(-e2);
+        e10 = (i32)Q + e2;
+
+        const i32 I = -e2 - (i32)Q;
+        const i32 K = (i32)pow5_bits(I) - 61;
+        i32 j = (i32)Q - K;
+
+        vr = mul_shift_32(MV, FLOAT_POW5_SPLIT[I], j);
+        vp = mul_shift_32(MP, FLOAT_POW5_SPLIT[I], j);
+        vm = mul_shift_32(MM, FLOAT_POW5_SPLIT[I], j);
+
+        if(Q != 0 && (vp - 1) / 10 <= vm / 10)
+        {
+            j = (i32)Q - 1 - ((i32)pow5_bits(I + 1) - 61);
+
+            last_removed_digit = (u8)(mul_shift_32(MV,
+                FLOAT_POW5_SPLIT[I + 1], j) % 10);
+        }
+
+        if(Q <= 1)
+        {
+            // Every digit of mv is trailing; mm only if the gap below is the
+            // full ulp.
+            vr_trailing_zeros = true;
+
+            if(ACCEPT_BOUNDS) { vm_trailing_zeros = MM_SHIFT == 1; }
+            else { --vp; }
+        }
+        else if(Q < 31)
+        {
+            vr_trailing_zeros = multiple_of_pow2(MV, Q - 1);
+        }
+    }
+
+    i32 removed = 0;
+    u32 digits;
+
+    if(vm_trailing_zeros || vr_trailing_zeros)
+    {
+        // General case: track trailing zeros so the result can be shortened
+        // across them and break halfway ties to even.
+        while(vp / 10 > vm / 10)
+        {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed_digit == 0;
+
+            last_removed_digit = (u8)(vr % 10);
+
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+
+        if(vm_trailing_zeros)
+        {
+            while(vm % 10 == 0)
+            {
+                vr_trailing_zeros &= last_removed_digit == 0;
+
+                last_removed_digit = (u8)(vr % 10);
+
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                ++removed;
+            }
+        }
+
+        if(vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+        {
+            // Exactly halfway, round even.
+            last_removed_digit = 4;
+        }
+
+        digits = vr + ((vr == vm && (!ACCEPT_BOUNDS || !vm_trailing_zeros))
+            || last_removed_digit >= 5);
+    }
+    else
+    {
+        // Common case, no trailing zero bookkeeping needed.
+        while(vp / 10 > vm / 10)
+        {
+            last_removed_digit = (u8)(vr % 10);
+
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+
+        digits = vr + (vr == vm || last_removed_digit >= 5);
+    }
+
+    *exp_output = e10 + removed;
+
+    return digits;
+}
+
+/**
+ * @brief Converts a finite nonzero double's raw mantissa and exponent into
+ * the shortest decimal digits that round-trip.
+ *
+ * Same structure as `float_to_shortest_digits` with 128 bit factors.
+ *
+ * @param ieee_mantissa Raw 52 bit mantissa field.
+ * @param ieee_exponent Raw 11 bit exponent field.
+ * @param exp_output Receives the power of ten of the last digit.
+ *
+ * @return u64 The decimal digits; the value is digits * 10^exponent.
+ */
+static u64 double_to_shortest_digits(u64 ieee_mantissa, u32 ieee_exponent,
+    i32 *exp_output)
+{
+    i32 e2;
+    u64 m2;
+
+    if(ieee_exponent == 0)
+    {
+        e2 = 1 - 1023 - 52 - 2;
+        m2 = ieee_mantissa;
+    }
+    else
+    {
+        e2 = (i32)ieee_exponent - 1023 - 52 - 2;
+        m2 = (1ULL << 52) | ieee_mantissa;
+    }
+
+    const bool ACCEPT_BOUNDS = (m2 & 1) == 0;
+
+    const u64 MV = 4 * m2;
+    const u32 MM_SHIFT = ieee_mantissa != 0 || ieee_exponent <= 1;
+
+    u64 vr, vp, vm;
+    i32 e10;
+    bool vm_trailing_zeros = false;
+    bool vr_trailing_zeros = false;
+
+    if(e2 >= 0)
+    {
+        // The adjustment guarantees the removal loop below runs at least
+        // once, so no early rounding digit is needed in the double path.
+        const u32 Q = log10_pow2(e2) - (e2 > 3);
+        e10 = (i32)Q;
+
+        const i32 K = 125 + (i32)pow5_bits((i32)Q) - 1;
+        const i32 I = -e2 + (i32)Q + K;
+
+        vr = mul_shift_64(MV, DOUBLE_POW5_INV_SPLIT[Q], I);
+        vp = mul_shift_64(MV + 2, DOUBLE_POW5_INV_SPLIT[Q], I);
+        vm = mul_shift_64(MV - 1 - MM_SHIFT, DOUBLE_POW5_INV_SPLIT[Q], I);
+
+        if(Q <= 21)
+        {
+            if(MV % 5 == 0)
+            {
+                vr_trailing_zeros = multiple_of_pow5(MV, Q);
+            }
+            else if(ACCEPT_BOUNDS)
+            {
+                vm_trailing_zeros = multiple_of_pow5(MV - 1 - MM_SHIFT, Q);
+            }
+            else { vp -= multiple_of_pow5(MV + 2, Q); }
+        }
+    }
+    else
+    {
+        const u32 Q = log10_pow5(-e2) - (-e2 > 1);
+        e10 = (i32)Q + e2;
+
+        const i32 I = -e2 - (i32)Q;
+        const i32 K = (i32)pow5_bits(I) - 125;
+        const i32 J = (i32)Q - K;
+
+        vr = mul_shift_64(MV, DOUBLE_POW5_SPLIT[I], J);
+        vp = mul_shift_64(MV + 2, DOUBLE_POW5_SPLIT[I], J);
+        vm = mul_shift_64(MV - 1 - MM_SHIFT, DOUBLE_POW5_SPLIT[I], J);
+
+        if(Q <= 1)
+        {
+            vr_trailing_zeros = true;
+
+            if(ACCEPT_BOUNDS) { vm_trailing_zeros = MM_SHIFT == 1; }
+            else { --vp; }
+        }
+        else if(Q < 63)
+        {
+            vr_trailing_zeros = multiple_of_pow2(MV, Q);
+        }
+    }
+
+    i32 removed = 0;
+    u8 last_removed_digit = 0;
+    u64 digits;
+
+    if(vm_trailing_zeros || vr_trailing_zeros)
+    {
+        while(vp / 10 > vm / 10)
+        {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed_digit == 0;
+
+            last_removed_digit = (u8)(vr % 10);
+
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+
+        if(vm_trailing_zeros)
+        {
+            while(vm % 10 == 0)
+            {
+                vr_trailing_zeros &= last_removed_digit == 0;
+
+                last_removed_digit = (u8)(vr % 10);
+
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                ++removed;
+            }
+        }
+
+        if(vr_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+        {
+            last_removed_digit = 4;
+        }
+
+        digits = vr + ((vr == vm && (!ACCEPT_BOUNDS || !vm_trailing_zeros))
+            || last_removed_digit >= 5);
+    }
+    else
+    {
+        while(vp / 10 > vm / 10)
+        {
+            last_removed_digit = (u8)(vr % 10);
+
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+
+        digits = vr + (vr == vm || last_removed_digit >= 5);
+    }
+
+    *exp_output = e10 + removed;
+
+    return digits;
+}
+
+/**
+ * @brief Assembles shortest-representation digits into the output buffer.
+ *
+ * Plain decimal notation when the leading digit's power of ten is in
+ * [-4, 15], `d.ddde±x` notation otherwise.
+ *
+ * @param digits Decimal digits of the value.
+ * @param exp Power of ten of the last digit.
+ * @param negative True to prefix a minus sign.
+ * @param output Buffer to place converted characters into.
+ *
+ * @return u64 Number of characters written, not including the null
+ * terminator.
+ */
+static u64 format_shortest(u64 digits, i32 exp, bool negative, char *output)
+{
+    char digit_buf[TUNDRA_MAX_CHARS_TO_REPRESENT_U64 + 1];
+
+    const u64 NUM_DIGITS = Tundra_u64_to_cstr_buf(digits, digit_buf);
+
+    // Power of ten of the leading digit.
+    const i32 SCI_EXP = exp + (i32)NUM_DIGITS - 1;
+
+    u64 out_idx = 0;
+
+    if(negative) { output[out_idx++] = '-'; }
+
+    if(SCI_EXP >= -4 && SCI_EXP < 16)
+    {
+        if(exp >= 0)
+        {
+            // All digits are integral: digits, zero padding, ".0".
+            Tundra_copy_mem_fwd(digit_buf, output + out_idx, NUM_DIGITS);
+            out_idx += NUM_DIGITS;
+
+            for(i32 i = 0; i < exp; ++i) { output[out_idx++] = '0'; }
+
+            output[out_idx++] = '.';
+            output[out_idx++] = '0';
+        }
+        else if(SCI_EXP >= 0)
+        {
+            // The decimal point lands inside the digits.
+            const u64 NUM_INT_DIGITS = (u64)(SCI_EXP + 1);
+
+            Tundra_copy_mem_fwd(digit_buf, output + out_idx, NUM_INT_DIGITS);
+            out_idx += NUM_INT_DIGITS;
+
+            output[out_idx++] = '.';
+
+            Tundra_copy_mem_fwd(digit_buf + NUM_INT_DIGITS,
+                output + out_idx, NUM_DIGITS - NUM_INT_DIGITS);
+            out_idx += NUM_DIGITS - NUM_INT_DIGITS;
+        }
+        else
+        {
+            // Value below one: "0.", leading zeros, digits.
+            output[out_idx++] = '0';
+            output[out_idx++] = '.';
+
+            for(i32 i = 0; i < -SCI_EXP - 1; ++i)
+            {
+                output[out_idx++] = '0';
+            }
+
+            Tundra_copy_mem_fwd(digit_buf, output + out_idx, NUM_DIGITS);
+            out_idx += NUM_DIGITS;
+        }
+    }
+    else
+    {
+        output[out_idx++] = digit_buf[0];
+
+        if(NUM_DIGITS > 1)
+        {
+            output[out_idx++] = '.';
+
+            Tundra_copy_mem_fwd(digit_buf + 1, output + out_idx,
+                NUM_DIGITS - 1);
+            out_idx += NUM_DIGITS - 1;
+        }
+
+        output[out_idx++] = 'e';
+        out_idx += Tundra_i64_to_cstr_buf(SCI_EXP, output + out_idx);
+    }
+
+    output[out_idx] = '\0';
+
+    return out_idx;
+}
+
+/**
+ * @brief Writes the non-finite and zero special cases, returning 0 if `bits`
+ * is an ordinary nonzero value.
+ *
+ * @param negative True if the sign bit is set.
+ * @param exponent_all_ones True if the raw exponent field is saturated.
+ * @param mantissa_zero True if the raw mantissa field is zero.
+ * @param output Buffer to place converted characters into.
+ *
+ * @return u64 Number of characters written, or 0 for ordinary values.
+ */
+static u64 write_float_special(bool negative, bool exponent_all_ones,
+    bool mantissa_zero, char *output)
+{
+    if(exponent_all_ones)
+    {
+        if(!mantissa_zero)
+        {
+            Tundra_copy_mem_fwd("nan", output, 4);
+            return 3;
+        }
+
+        u64 out_idx = 0;
+
+        if(negative) { output[out_idx++] = '-'; }
+
+        Tundra_copy_mem_fwd("inf", output + out_idx, 4);
+        return out_idx + 3;
+    }
+
+    // Zero mantissa and zero exponent: positive or negative zero.
+    u64 out_idx = 0;
+
+    if(negative) { output[out_idx++] = '-'; }
+
+    Tundra_copy_mem_fwd("0.0", output + out_idx, 4);
+    return out_idx + 3;
 }
 
 u64 Tundra_float_to_cstr_buf(float num, char *output)
 {
     if(output == NULL) return 0;
 
-    if(num == 0)
+    u32 bits;
+    Tundra_copy_mem_fwd(&num, &bits, sizeof(bits));
+
+    const bool NEGATIVE = (bits >> 31) != 0;
+    const u32 IEEE_MANTISSA = bits & ((1U << 23) - 1);
+    const u32 IEEE_EXPONENT = (bits >> 23) & 0xFF;
+
+    if(IEEE_EXPONENT == 0xFF || (IEEE_EXPONENT == 0 && IEEE_MANTISSA == 0))
     {
-        u64 output_idx = 0;
-        output[output_idx++] = '0';
-        output[output_idx++] = '.';
-        for(u8 i = 0; i < TUNDRA_FLOAT_PRECISION; ++i)
-            output[output_idx++] = '0';
-        output[output_idx] = '\0';
-        return output_idx;
+        return write_float_special(NEGATIVE, IEEE_EXPONENT == 0xFF,
+            IEEE_MANTISSA == 0, output);
     }
 
-    bool is_negative = num < 0.0f;
+    i32 exp;
+    const u32 DIGITS = float_to_shortest_digits(IEEE_MANTISSA, IEEE_EXPONENT,
+        &exp);
 
-    if(is_negative) num = -num;
+    return format_shortest(DIGITS, exp, NEGATIVE, output);
+}
 
-    // The float has a fractional part to it. Round it.
-    if((u64)num != num) num += InTundra_float_rounding_constant;
+u64 Tundra_double_to_cstr_buf(double num, char *output)
+{
+    if(output == NULL) return 0;
 
-    // Integer part is guaranteed to be non negative.
-    u64 integer_part = (u64)num;
-    float fraction_part = num - (float)integer_part;
-    
-    // +1 for null terminator
-    char buffer[TUNDRA_MAX_CHARS_TO_REPRESENT_FLOAT + TUNDRA_FLOAT_PRECISION + 
-        1];
+    u64 bits;
+    Tundra_copy_mem_fwd(&num, &bits, sizeof(bits));
+
+    const bool NEGATIVE = (bits >> 63) != 0;
+    const u64 IEEE_MANTISSA = bits & ((1ULL << 52) - 1);
+    const u32 IEEE_EXPONENT = (u32)((bits >> 52) & 0x7FF);
+
+    if(IEEE_EXPONENT == 0x7FF || (IEEE_EXPONENT == 0 && IEEE_MANTISSA == 0))
+    {
+        return write_float_special(NEGATIVE, IEEE_EXPONENT == 0x7FF,
+            IEEE_MANTISSA == 0, output);
+    }
+
+    i32 exp;
+    const u64 DIGITS = double_to_shortest_digits(IEEE_MANTISSA,
+        IEEE_EXPONENT, &exp);
+
+    return format_shortest(DIGITS, exp, NEGATIVE, output);
+}
+
+// Hex and binary formatting -------------------------------------------------
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+u64 Tundra_u64_to_hex_buf(u64 num, char *output, bool leading_zeros)
+{
+    if(output == NULL) return 0;
+
+    // Digit count straight from the bit width, one character per nibble.
+    const u64 LENGTH = leading_zeros ? 16 :
+        (num == 0 ? 1 : ((u64)Tundra_get_msb_pos(num) >> 2) + 1);
+
+    for(u64 i = 0; i < LENGTH; ++i)
+    {
+        output[LENGTH - 1 - i] = HEX_DIGITS[(num >> (i * 4)) & 0xF];
+    }
+
+    output[LENGTH] = '\0';
+
+    return LENGTH;
+}
+
+u64 Tundra_u64_to_bin_buf(u64 num, char *output, bool leading_zeros)
+{
+    if(output == NULL) return 0;
+
+    const u64 LENGTH = leading_zeros ? 64 :
+        (num == 0 ? 1 : (u64)Tundra_get_msb_pos(num) + 1);
+
+    for(u64 i = 0; i < LENGTH; ++i)
+    {
+        output[LENGTH - 1 - i] = (char)('0' + ((num >> i) & 1));
+    }
 
-    // Use i64 conversion on the integer part. The returned length is where the
-    // fractional part starts.
-    u64 output_idx = InTundra_int_to_cstr_helper(integer_part, buffer, output, 
-        is_negative);
+    output[LENGTH] = '\0';
 
-    output[output_idx++] = '.';
+    return LENGTH;
+}
 
-    for(u8 i = 0; i < TUNDRA_FLOAT_PRECISION; ++i)
+u64 Tundra_hex_to_u64(const char *str)
+{
+    TUNDRA_RT_ASSERT(str != NULL, "Attempted to convert a NULL string to a "
+        "number.\n");
+
+    u64 str_idx = 0;
+
+    if(str[0] == '0' && (str[1] == 'x' || str[1] == 'X')) { str_idx = 2; }
+
+    TUNDRA_RT_ASSERT(str[str_idx] != '\0', "Attempted to convert an empty "
+        "string to a number.\n");
+
+    u64 result = 0;
+    u64 num_digits = 0;
+
+    for(; str[str_idx] != '\0'; ++str_idx)
     {
-        fraction_part *= 10;
-        u8 digit = (u8)fraction_part;
-        fraction_part -= (float)digit;
+        const char C = str[str_idx];
+
+        u8 value;
 
-        output[output_idx++] = (char)('0' + digit);
+        if(C >= '0' && C <= '9') { value = (u8)(C - '0'); }
+        else if(C >= 'a' && C <= 'f') { value = (u8)(C - 'a' + 10); }
+        else if(C >= 'A' && C <= 'F') { value = (u8)(C - 'A' + 10); }
+
+        else
+        {
+            TUNDRA_FATAL("Invalid character found when converting string "
+                "\"%s\" to hex number. Invalid char: \"%c\".\n", str, C);
+            return 0;
+        }
+
+        result = (result << 4) | value;
+        ++num_digits;
     }
 
-    output[output_idx] = '\0';
+    TUNDRA_RT_ASSERT(num_digits <= 16, "Attempted to convert a hex string "
+        "with more than 16 digits to an u64. String: \"%s\".\n", str);
 
-    return output_idx;
+    return result;
+}
+
+// Columnar batch conversion -------------------------------------------------
+
+void Tundra_u64_array_to_cstr(const u64 *vals, u64 num_vals, char sep,
+    Tundra_String *output)
+{
+    // Size the whole run up front so every value converts straight into its
+    // final position in one allocation.
+    u64 total_chars = num_vals == 0 ? 0 : num_vals - 1;
+
+    for(u64 i = 0; i < num_vals; ++i)
+    {
+        total_chars += Tundra_u64_digit_count(vals[i]);
+    }
+
+    Tundra_Str_init_cap(output, total_chars + 1);
+
+    char *write_pos = output->chars;
+
+    for(u64 i = 0; i < num_vals; ++i)
+    {
+        if(i != 0) { *write_pos++ = sep; }
+
+        write_pos += Tundra_u64_to_cstr_buf(vals[i], write_pos);
+    }
+
+    *write_pos = '\0';
+    output->num_char = total_chars + 1;
+}
+
+void Tundra_i64_array_to_cstr(const i64 *vals, u64 num_vals, char sep,
+    Tundra_String *output)
+{
+    u64 total_chars = num_vals == 0 ? 0 : num_vals - 1;
+
+    for(u64 i = 0; i < num_vals; ++i)
+    {
+        const bool NEGATIVE = vals[i] < 0;
+
+        // Negation through the unsigned domain so the i64 minimum is safe.
+        const u64 MAGNITUDE = NEGATIVE ?
+            (u64)(-(vals[i] + 1)) + 1 : (u64)vals[i];
+
+        total_chars += (u64)Tundra_u64_digit_count(MAGNITUDE) + NEGATIVE;
+    }
+
+    Tundra_Str_init_cap(output, total_chars + 1);
+
+    char *write_pos = output->chars;
+
+    for(u64 i = 0; i < num_vals; ++i)
+    {
+        if(i != 0) { *write_pos++ = sep; }
+
+        write_pos += Tundra_i64_to_cstr_buf(vals[i], write_pos);
+    }
+
+    *write_pos = '\0';
+    output->num_char = total_chars + 1;
+}
+
+// Fused digit-span check and 8-digit SWAR conversion ------------------------
+
+/**
+ * @brief Returns true if all 8 bytes of `chunk` are ASCII digits.
+ *
+ * High nibbles must all be 3, and adding 6 to each low nibble must not carry,
+ * which together admit exactly '0' through '9'.
+ *
+ * @param chunk 8 characters loaded little endian.
+ *
+ * @return bool True if every byte is a digit.
+ */
+static bool all_eight_are_digits(u64 chunk)
+{
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+        (((chunk + 0x0606060606060606ULL) >> 4) & 0xF0F0F0F0F0F0F0F0ULL)) ==
+        0x3030303030303030ULL;
+}
+
+/**
+ * @brief Converts 8 ASCII digits to their integer value with three
+ * multiplies instead of one per character.
+ *
+ * Adjacent digits are first fused into byte pairs, then pairs into 4-digit
+ * groups and 4-digit groups into the full value, each step one
+ * multiply-accumulate over the whole lane.
+ *
+ * @param chunk 8 digit characters loaded little endian.
+ *
+ * @return u32 Integer value of the 8 digits.
+ */
+static u32 parse_eight_digits(u64 chunk)
+{
+    const u64 PAIR_MASK = 0x000000FF000000FFULL;
+    const u64 QUAD_MUL = 0x000F424000000064ULL; // 100, 1000000 per lane.
+    const u64 FULL_MUL = 0x0000271000000001ULL; // 1, 10000 per lane.
+
+    chunk -= 0x3030303030303030ULL;
+    chunk = (chunk * 10) + (chunk >> 8);
+
+    return (u32)((((chunk & PAIR_MASK) * QUAD_MUL) +
+        (((chunk >> 16) & PAIR_MASK) * FULL_MUL)) >> 32);
 }
 
 static u64 str_to_unum_helper(const char *str)
@@ -460,11 +1762,23 @@ static u64 str_to_unum_helper(const char *str)
 
     u64 result = 0;
 
-    u8 pow = 0;
+    u64 str_idx = 0;
+
+    // Fold 8 digits at a time; the digit check doubles as span validation,
+    // and any non-digit falls through to the scalar loop's error handling.
+    while(str_len - str_idx >= 8)
+    {
+        u64 chunk;
+        Tundra_copy_mem_fwd(str + str_idx, &chunk, 8);
+
+        if(!all_eight_are_digits(chunk)) break;
 
-    u64 str_idx = str_len - 1;
+        result = result * 100000000ULL + parse_eight_digits(chunk);
 
-    while(true)
+        str_idx += 8;
+    }
+
+    for(; str_idx < str_len; ++str_idx)
     {
         char c = str[str_idx];
 
@@ -472,12 +1786,8 @@ static u64 str_to_unum_helper(const char *str)
             "converting string \"%s\" to number. Invalid char: \"%c\".\n", 
             str, c);
 
-        result += Tundra_uint_pow(10, pow++) * (u64)(c - '0');
-
-        if(str_idx == 0) break;
-
-        --str_idx;
-    } 
+        result = result * 10 + (u64)(c - '0');
+    }
 
     return result;
 }
@@ -504,11 +1814,22 @@ static i64 str_to_snum_helper(const char *str)
 
     u64 result = 0;
 
-    u8 pow = 0;
+    u64 str_idx = num_start_idx;
+
+    // Same 8-digit folding as the unsigned helper, past the sign.
+    while(str_len - str_idx >= 8)
+    {
+        u64 chunk;
+        Tundra_copy_mem_fwd(str + str_idx, &chunk, 8);
+
+        if(!all_eight_are_digits(chunk)) break;
+
+        result = result * 100000000ULL + parse_eight_digits(chunk);
 
-    u64 str_idx = str_len - 1;
+        str_idx += 8;
+    }
 
-    while(true)
+    for(; str_idx < str_len; ++str_idx)
     {
         char c = str[str_idx];
 
@@ -516,12 +1837,8 @@ static i64 str_to_snum_helper(const char *str)
             "converting string \"%s\" to number. Invalid char: \"%c\".\n", 
             str, c);
 
-        result += Tundra_uint_pow(10, pow++) * (u64)(c - '0');
-
-        if(str_idx == num_start_idx) break;
-
-        --str_idx;
-    } 
+        result = result * 10 + (u64)(c - '0');
+    }
 
     if(num_start_idx == 1)
     {
@@ -0,0 +1,292 @@
+/**
+ * @file StringIntern.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief String interning table mapping distinct strings to stable u32 ids.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/containers/StringIntern.h"
+#include "tundra/common/Core.h"
+#include "tundra/common/Hash.h"
+#include "tundra/utils/Math.h"
+#include "tundra/utils/MemAlloc.h"
+#include "tundra/utils/MemUtils.h"
+
+
+// Ratio (out of 10) of used/capacity slots, where if exceeded the slot array
+// is expanded and rehashed.
+#define SLOT_LOAD_LIMIT 7
+
+
+// Methods ---------------------------------------------------------------------
+
+// -- Local Helper Methods --
+
+/**
+ * @brief Returns a pointer to the payload of `id`: u32 char count followed by
+ * the null terminated characters.
+ *
+ * @param tbl Table to read from.
+ * @param id Id to resolve.
+ *
+ * @return const u8* Payload of the id.
+ */
+static const u8* get_payload(const Tundra_StrIntern *tbl, u32 id)
+{
+    return tbl->arena + tbl->offsets[id];
+}
+
+/**
+ * @brief Returns true if `id`'s payload matches the passed characters.
+ *
+ * @param tbl Table to read from.
+ * @param id Id to compare against.
+ * @param chars Characters to compare.
+ * @param num_char Number of characters.
+ *
+ * @return bool True if the payload matches.
+ */
+static bool id_matches(const Tundra_StrIntern *tbl, u32 id, const char *chars,
+    u64 num_char)
+{
+    const u8 *payload = get_payload(tbl, id);
+
+    u32 payload_len;
+    Tundra_copy_mem_fwd((const void*)payload, (void*)&payload_len,
+        sizeof(u32));
+
+    return payload_len == num_char && Tundra_compare_mem_eq(
+        (const void*)(payload + sizeof(u32)), (const void*)chars, num_char);
+}
+
+/**
+ * @brief Returns the slot index where `chars` lives, or the empty slot where
+ * it would be placed.
+ *
+ * @param tbl Table to probe.
+ * @param chars Characters to probe for.
+ * @param num_char Number of characters.
+ *
+ * @return u64 Slot index.
+ */
+static u64 probe_slot(const Tundra_StrIntern *tbl, const char *chars,
+    u64 num_char)
+{
+    const u64 MASK = tbl->slot_cap - 1;
+
+    u64 slot_idx = Tundra_hash_bytes((const void*)chars, num_char) & MASK;
+
+    // Linear probe; the load limit guarantees an empty slot exists.
+    while(tbl->slots[slot_idx] != 0)
+    {
+        if(id_matches(tbl, tbl->slots[slot_idx] - 1, chars, num_char))
+        {
+            return slot_idx;
+        }
+
+        slot_idx = (slot_idx + 1) & MASK;
+    }
+
+    return slot_idx;
+}
+
+/**
+ * @brief Doubles the slot array and rehashes every interned id into it.
+ *
+ * Payloads and ids do not move; only the u32 slot entries are rebuilt.
+ *
+ * @param tbl Table to expand.
+ */
+static void expand_slots(Tundra_StrIntern *tbl)
+{
+    Tundra_free_mem((void*)tbl->slots);
+
+    tbl->slot_cap *= 2;
+    tbl->slots = (u32*)Tundra_alloc_mem_zeroed(tbl->slot_cap * sizeof(u32));
+
+    const u64 MASK = tbl->slot_cap - 1;
+
+    for(u32 id = 0; id < tbl->num_strs; ++id)
+    {
+        const u8 *payload = get_payload(tbl, id);
+
+        u32 payload_len;
+        Tundra_copy_mem_fwd((const void*)payload, (void*)&payload_len,
+            sizeof(u32));
+
+        u64 slot_idx = Tundra_hash_bytes(
+            (const void*)(payload + sizeof(u32)), payload_len) & MASK;
+
+        while(tbl->slots[slot_idx] != 0)
+        {
+            slot_idx = (slot_idx + 1) & MASK;
+        }
+
+        tbl->slots[slot_idx] = id + 1;
+    }
+}
+
+/**
+ * @brief Bumps `num_bytes` out of the arena, growing it if required, and
+ * returns the byte offset of the reserved region.
+ *
+ * @param tbl Table whose arena to bump.
+ * @param num_bytes Bytes to reserve.
+ *
+ * @return u64 Byte offset of the reserved region.
+ */
+static u64 arena_bump(Tundra_StrIntern *tbl, u64 num_bytes)
+{
+    if(tbl->arena_size + num_bytes > tbl->arena_cap)
+    {
+        u64 new_cap = tbl->arena_cap * 2;
+
+        while(new_cap < tbl->arena_size + num_bytes) { new_cap *= 2; }
+
+        u8 *new_arena = (u8*)Tundra_alloc_copy_mem(
+            (const void*)tbl->arena, new_cap, tbl->arena_size);
+
+        Tundra_free_mem((void*)tbl->arena);
+        tbl->arena = new_arena;
+        tbl->arena_cap = new_cap;
+    }
+
+    const u64 OFFSET = tbl->arena_size;
+
+    tbl->arena_size += num_bytes;
+
+    return OFFSET;
+}
+
+
+// -- Public Methods --
+
+void Tundra_StrIntern_init(Tundra_StrIntern *tbl)
+{
+    Tundra_StrIntern_init_cap(tbl, 0, 0);
+}
+
+void Tundra_StrIntern_init_cap(Tundra_StrIntern *tbl, u64 expected_strs,
+    u64 expected_bytes)
+{
+    tbl->slot_cap = expected_strs == 0 ? TUNDRA_STRINTERN_DEF_SLOT_CAP :
+        Tundra_ceil_pow2(expected_strs * 10 / SLOT_LOAD_LIMIT);
+
+    tbl->slots = (u32*)Tundra_alloc_mem_zeroed(
+        tbl->slot_cap * sizeof(u32));
+
+    tbl->offset_cap = tbl->slot_cap;
+    tbl->offsets = (u64*)Tundra_alloc_mem(tbl->offset_cap * sizeof(u64));
+
+    tbl->num_strs = 0;
+
+    tbl->arena_cap = expected_bytes == 0 ? TUNDRA_STRINTERN_DEF_ARENA_CAP :
+        Tundra_ceil_pow2(expected_bytes);
+    tbl->arena = (u8*)Tundra_alloc_mem(tbl->arena_cap);
+    tbl->arena_size = 0;
+}
+
+u32 Tundra_StrIntern_add(Tundra_StrIntern *tbl, const char *chars,
+    u64 num_char)
+{
+    TUNDRA_RT_ASSERT(chars != NULL, "\"chars\" cannot be NULL.\n");
+
+    u64 slot_idx = probe_slot(tbl, chars, num_char);
+
+    if(tbl->slots[slot_idx] != 0) { return tbl->slots[slot_idx] - 1; }
+
+    // New string; copy the payload into the arena and mint the next id.
+
+    const u32 ID = tbl->num_strs++;
+
+    const u64 OFFSET = arena_bump(tbl,
+        sizeof(u32) + num_char + 1);
+
+    u8 *payload = tbl->arena + OFFSET;
+
+    const u32 LENGTH = (u32)num_char;
+
+    Tundra_copy_mem_fwd((const void*)&LENGTH, (void*)payload, sizeof(u32));
+    Tundra_copy_mem_fwd((const void*)chars, (void*)(payload + sizeof(u32)),
+        num_char);
+    payload[sizeof(u32) + num_char] = '\0';
+
+    if(ID == tbl->offset_cap)
+    {
+        u64 *new_offsets = (u64*)Tundra_alloc_copy_mem(
+            (const void*)tbl->offsets, tbl->offset_cap * 2 * sizeof(u64),
+            tbl->offset_cap * sizeof(u64));
+
+        Tundra_free_mem((void*)tbl->offsets);
+        tbl->offsets = new_offsets;
+        tbl->offset_cap *= 2;
+    }
+
+    tbl->offsets[ID] = OFFSET;
+    tbl->slots[slot_idx] = ID + 1;
+
+    if(tbl->num_strs * 10 >= tbl->slot_cap * SLOT_LOAD_LIMIT)
+    {
+        expand_slots(tbl);
+    }
+
+    return ID;
+}
+
+u32 Tundra_StrIntern_add_cstr(Tundra_StrIntern *tbl, const char *cstr)
+{
+    return Tundra_StrIntern_add(tbl, cstr, Tundra_get_cstr_len(cstr));
+}
+
+i64 Tundra_StrIntern_find(const Tundra_StrIntern *tbl, const char *chars,
+    u64 num_char)
+{
+    TUNDRA_RT_ASSERT(chars != NULL, "\"chars\" cannot be NULL.\n");
+
+    const u64 SLOT_IDX = probe_slot(tbl, chars, num_char);
+
+    if(tbl->slots[SLOT_IDX] == 0) { return -1; }
+
+    return (i64)(tbl->slots[SLOT_IDX] - 1);
+}
+
+const char* Tundra_StrIntern_get(const Tundra_StrIntern *tbl, u32 id)
+{
+    TUNDRA_RT_ASSERT(id < tbl->num_strs, "\"id\" is out of range.\n");
+
+    return (const char*)(get_payload(tbl, id) + sizeof(u32));
+}
+
+u64 Tundra_StrIntern_get_len(const Tundra_StrIntern *tbl, u32 id)
+{
+    TUNDRA_RT_ASSERT(id < tbl->num_strs, "\"id\" is out of range.\n");
+
+    u32 payload_len;
+    Tundra_copy_mem_fwd((const void*)get_payload(tbl, id),
+        (void*)&payload_len, sizeof(u32));
+
+    return payload_len;
+}
+
+u32 Tundra_StrIntern_num_strs(const Tundra_StrIntern *tbl)
+{
+    return tbl->num_strs;
+}
+
+void Tundra_StrIntern_free(Tundra_StrIntern *tbl)
+{
+    Tundra_free_mem((void*)tbl->slots);
+    Tundra_free_mem((void*)tbl->offsets);
+    Tundra_free_mem((void*)tbl->arena);
+
+    tbl->slots = NULL;
+    tbl->offsets = NULL;
+    tbl->arena = NULL;
+    tbl->slot_cap = 0;
+    tbl->offset_cap = 0;
+    tbl->num_strs = 0;
+    tbl->arena_size = 0;
+    tbl->arena_cap = 0;
+}
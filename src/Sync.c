@@ -0,0 +1,79 @@
+/**
+ * @file Sync.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Futex-backed blocking coordination: mutex and event primitives.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/Sync.h"
+#include "tundra/internal/Syscall.h"
+
+#ifdef TUNDRA_PLATFORM_LINUX
+
+#ifdef TUNDRA_SYS_x86_64
+
+#define FUTEX_WAIT_PRIVATE 128
+#define FUTEX_WAKE_PRIVATE 129
+
+// Wake count for "every waiter".
+#define WAKE_ALL 0x7FFFFFFF
+
+static void futex_wait(u32 *addr, u32 expected)
+{
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_FUTEX, (i64)addr,
+        FUTEX_WAIT_PRIVATE, (i64)expected, 0, 0, 0);
+}
+
+static void futex_wake(u32 *addr, i64 num_wake)
+{
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_FUTEX, (i64)addr,
+        FUTEX_WAKE_PRIVATE, num_wake, 0, 0, 0);
+}
+
+void InTundra_Mutex_lock_slow(Tundra_Mutex *mutex)
+{
+    // Take the lock in the contended state so the eventual unlock knows to
+    // wake us. The exchange returning 0 means the holder released between
+    // our fast-path miss and here - the lock is ours, over-marked as
+    // contended at worst, which just costs the next unlock a spare wake.
+    while(Tundra_atm_exchange_u32(&mutex->state, 2, TUNDRA_ATM_ACQUIRE)
+        != 0)
+    { futex_wait(&mutex->state, 2); }
+}
+
+void InTundra_Mutex_unlock_slow(Tundra_Mutex *mutex)
+{
+    Tundra_atm_store_u32(&mutex->state, 0, TUNDRA_ATM_RELEASE);
+    futex_wake(&mutex->state, 1);
+}
+
+void Tundra_Event_wait(Tundra_Event *event)
+{
+    const u32 SEQ = Tundra_atm_load_u32(&event->seq, TUNDRA_ATM_ACQUIRE);
+
+    // Returns immediately if a notify landed between the load and the
+    // wait; the caller's condition loop absorbs the spurious return.
+    futex_wait(&event->seq, SEQ);
+}
+
+void Tundra_Event_notify_one(Tundra_Event *event)
+{
+    Tundra_atm_fetch_add_u32(&event->seq, 1, TUNDRA_ATM_RELEASE);
+    futex_wake(&event->seq, 1);
+}
+
+void Tundra_Event_notify_all(Tundra_Event *event)
+{
+    Tundra_atm_fetch_add_u32(&event->seq, 1, TUNDRA_ATM_RELEASE);
+    futex_wake(&event->seq, WAKE_ALL);
+}
+
+#else // TUNDRA_SYS_x86_64
+#error Not Implemented
+#endif // TUNDRA_SYS_x86_64
+
+#else // TUNDRA_PLATFORM_LINUX
+#error Not Implemented
+#endif // TUNDRA_PLATFORM_LINUX
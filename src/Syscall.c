@@ -11,6 +11,14 @@
 
 #include "tundra/internal/Syscall.h"
 #include "tundra/utils/MemUtils.h"
+#include "tundra/utils/Stats.h"
+
+#ifdef TUNDRA_SYSCALL_TRACE
+#include "tundra/utils/Time.h"
+
+u64 InTundra_syscall_trace_counts[TUNDRA_SYSCALL_TRACE_SLOTS];
+u64 InTundra_syscall_trace_cycles[TUNDRA_SYSCALL_TRACE_SLOTS];
+#endif // TUNDRA_SYSCALL_TRACE
 
 #ifdef TUNDRA_PLATFORM_LINUX
 
@@ -19,6 +27,12 @@
 i64 InTundra_syscall(i64 number, i64 arg0, i64 arg1, i64 arg2, i64 arg3, 
     i64 arg4, i64 arg5)
 {
+    TUNDRA_STAT_INCR(SYSCALL);
+
+#ifdef TUNDRA_SYSCALL_TRACE
+    const u64 TRACE_START = Tundra_get_cycles();
+#endif
+
     i64 result;
 
     register i64 r10 __asm__("r10") = arg3;
@@ -39,9 +53,66 @@ i64 InTundra_syscall(i64 number, i64 arg0, i64 arg1, i64 arg2, i64 arg3,
         : "rcx", "r11", "memory"
     );
 
+#ifdef TUNDRA_SYSCALL_TRACE
+    const u64 SLOT = ((u64)number < TUNDRA_SYSCALL_TRACE_SLOTS) ?
+        (u64)number : TUNDRA_SYSCALL_TRACE_SLOTS - 1;
+
+    __atomic_fetch_add(&InTundra_syscall_trace_counts[SLOT], 1,
+        __ATOMIC_RELAXED);
+    __atomic_fetch_add(&InTundra_syscall_trace_cycles[SLOT],
+        Tundra_get_cycles() - TRACE_START, __ATOMIC_RELAXED);
+#endif
+
     return result;
 }
 
+#elif defined(TUNDRA_SYS_ARM)
+
+i64 InTundra_syscall(i64 number, i64 arg0, i64 arg1, i64 arg2, i64 arg3,
+    i64 arg4, i64 arg5)
+{
+    TUNDRA_STAT_INCR(SYSCALL);
+
+#ifdef TUNDRA_SYSCALL_TRACE
+    const u64 TRACE_START = Tundra_get_cycles();
+#endif
+
+    // aarch64 kernel ABI: number in x8, arguments in x0-x5, result in x0.
+    // Unlike x86_64 the kernel clobbers no other registers.
+    register i64 x8 __asm__("x8") = number;
+    register i64 x0 __asm__("x0") = arg0;
+    register i64 x1 __asm__("x1") = arg1;
+    register i64 x2 __asm__("x2") = arg2;
+    register i64 x3 __asm__("x3") = arg3;
+    register i64 x4 __asm__("x4") = arg4;
+    register i64 x5 __asm__("x5") = arg5;
+
+    __asm__ volatile
+    (
+        "svc #0"
+        : "+r"(x0)
+        : "r"(x8),
+          "r"(x1),
+          "r"(x2),
+          "r"(x3),
+          "r"(x4),
+          "r"(x5)
+        : "memory"
+    );
+
+#ifdef TUNDRA_SYSCALL_TRACE
+    const u64 SLOT = ((u64)number < TUNDRA_SYSCALL_TRACE_SLOTS) ?
+        (u64)number : TUNDRA_SYSCALL_TRACE_SLOTS - 1;
+
+    __atomic_fetch_add(&InTundra_syscall_trace_counts[SLOT], 1,
+        __ATOMIC_RELAXED);
+    __atomic_fetch_add(&InTundra_syscall_trace_cycles[SLOT],
+        Tundra_get_cycles() - TRACE_START, __ATOMIC_RELAXED);
+#endif
+
+    return x0;
+}
+
 #else // TUNDRA_SYS_x86_64
 #error Not Implemented
 #endif // TUNDRA_SYS_x86_64
@@ -0,0 +1,231 @@
+/**
+ * @file SystemInfo.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Runtime cpu feature and numa topology probing.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/common/SystemInfo.h"
+#include "tundra/internal/Syscall.h"
+
+
+// Definitions -----------------------------------------------------------------
+
+// openat constants, local since this file does one sysfs read and does not
+// pull in the io layer.
+#define WORKING_DIRECTORY_FD -100
+#define OPENFLAG_RDONLY 0
+
+
+// Global Variables ------------------------------------------------------------
+
+// Cached feature bitmask, probing is idempotent so racing first calls are
+// harmless. Bit 63 marks the probe as done since a bitmask of 0 is valid.
+static u64 cached_features;
+
+// Cached possible numa node count, same caching scheme as the features.
+static u64 cached_num_numa_nodes;
+
+#define PROBED_BIT (1ULL << 63)
+
+
+// Methods ---------------------------------------------------------------------
+
+// -- Local Helper Methods --
+
+#ifdef TUNDRA_SYS_x86_64
+
+/**
+ * @brief Executes cpuid for a leaf/subleaf pair.
+ *
+ * @param leaf Leaf to query (eax input).
+ * @param subleaf Subleaf to query (ecx input).
+ * @param regs_output Receives eax, ebx, ecx, edx.
+ */
+static void cpuid(u32 leaf, u32 subleaf, u32 *regs_output)
+{
+    asm volatile
+    (
+        "cpuid"
+        : "=a"(regs_output[0]), "=b"(regs_output[1]), "=c"(regs_output[2]),
+          "=d"(regs_output[3])
+        : "a"(leaf), "c"(subleaf)
+    );
+}
+
+/**
+ * @brief Probes the feature bitmask of the executing x86_64 cpu.
+ *
+ * The avx bits require both the cpuid flag and the os having enabled the
+ * register state in xcr0, otherwise executing the instructions would fault
+ * even though the cpu supports them.
+ *
+ * @return u64 Bitmask of TUNDRA_CPU_FEAT_ bits.
+ */
+static u64 probe_features(void)
+{
+    u64 features = 0;
+
+    u32 regs[4];
+
+    cpuid(1, 0, regs);
+
+    if((regs[2] >> 20) & 1) { features |= TUNDRA_CPU_FEAT_SSE42; }
+
+    // Without osxsave the ymm/zmm state is not saved across context
+    // switches and none of the avx tiers are safe.
+    if(!((regs[2] >> 27) & 1)) { return features; }
+
+    const bool CPU_AVX = (regs[2] >> 28) & 1;
+
+    u32 xcr0_lo;
+    u32 xcr0_hi;
+
+    asm volatile
+    (
+        "xgetbv"
+        : "=a"(xcr0_lo), "=d"(xcr0_hi)
+        : "c"(0)
+    );
+
+    // xmm and ymm state enabled.
+    const bool OS_YMM = (xcr0_lo & 0x6) == 0x6;
+
+    // opmask and zmm state enabled on top of ymm.
+    const bool OS_ZMM = (xcr0_lo & 0xE6) == 0xE6;
+
+    if(CPU_AVX && OS_YMM) { features |= TUNDRA_CPU_FEAT_AVX; }
+
+    cpuid(7, 0, regs);
+
+    if((features & TUNDRA_CPU_FEAT_AVX) && ((regs[1] >> 5) & 1))
+    {
+        features |= TUNDRA_CPU_FEAT_AVX2;
+    }
+
+    if(OS_ZMM && ((regs[1] >> 16) & 1))
+    {
+        features |= TUNDRA_CPU_FEAT_AVX512F;
+    }
+
+    return features;
+}
+
+#elif defined(TUNDRA_SYS_ARM)
+
+/**
+ * @brief Probes the feature bitmask of the executing aarch64 cpu.
+ *
+ * @return u64 Bitmask of TUNDRA_CPU_FEAT_ bits.
+ */
+static u64 probe_features(void)
+{
+    // Advanced simd is architectural on aarch64.
+    return TUNDRA_CPU_FEAT_NEON;
+}
+
+#else
+#error Not implemented.
+#endif
+
+/**
+ * @brief Probes the number of possible numa nodes from sysfs.
+ *
+ * The kernel publishes the possible node range as "0" or "0-N"; the count is
+ * the last number plus one. Any failure reads as a single node machine.
+ *
+ * @return u64 Number of possible numa nodes, at least 1.
+ */
+static u64 probe_num_numa_nodes(void)
+{
+    const i64 HANDLE = InTundra_syscall(TUNDRA_LINUX_SYSCALL_OPENAT,
+        WORKING_DIRECTORY_FD, (i64)"/sys/devices/system/node/possible",
+        OPENFLAG_RDONLY, 0, 0, 0);
+
+    if(HANDLE < 0) { return 1; }
+
+    char text[32];
+
+    const i64 NUM_READ = InTundra_syscall(TUNDRA_LINUX_SYSCALL_READ, HANDLE,
+        (i64)text, sizeof(text) - 1, 0, 0, 0);
+
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_CLOSE, HANDLE, 0, 0, 0, 0, 0);
+
+    if(NUM_READ <= 0) { return 1; }
+
+    // The highest node is the last number in the text; walk every digit run
+    // and keep the final one.
+    u64 highest_node = 0;
+    u64 parsed = 0;
+    bool in_digits = false;
+
+    for(i64 i = 0; i < NUM_READ; ++i)
+    {
+        if(text[i] >= '0' && text[i] <= '9')
+        {
+            parsed = parsed * 10 + (u64)(text[i] - '0');
+            in_digits = true;
+            continue;
+        }
+
+        if(in_digits) { highest_node = parsed; }
+
+        parsed = 0;
+        in_digits = false;
+    }
+
+    if(in_digits) { highest_node = parsed; }
+
+    return highest_node + 1;
+}
+
+
+// -- Public Methods --
+
+u64 Tundra_get_cpu_features(void)
+{
+    u64 features = __atomic_load_n(&cached_features, __ATOMIC_RELAXED);
+
+    if(features & PROBED_BIT) { return features & ~PROBED_BIT; }
+
+    features = probe_features();
+
+    __atomic_store_n(&cached_features, features | PROBED_BIT,
+        __ATOMIC_RELAXED);
+
+    return features;
+}
+
+bool Tundra_cpu_has_features(u64 features)
+{
+    return (Tundra_get_cpu_features() & features) == features;
+}
+
+u32 Tundra_get_num_numa_nodes(void)
+{
+    u64 num_nodes = __atomic_load_n(&cached_num_numa_nodes,
+        __ATOMIC_RELAXED);
+
+    if(num_nodes & PROBED_BIT) { return (u32)(num_nodes & ~PROBED_BIT); }
+
+    num_nodes = probe_num_numa_nodes();
+
+    __atomic_store_n(&cached_num_numa_nodes, num_nodes | PROBED_BIT,
+        __ATOMIC_RELAXED);
+
+    return (u32)num_nodes;
+}
+
+u32 Tundra_get_current_numa_node(void)
+{
+    u32 cpu;
+    u32 node;
+
+    if(InTundra_syscall(TUNDRA_LINUX_SYSCALL_GETCPU, (i64)&cpu, (i64)&node,
+        0, 0, 0, 0) != 0)
+    { return 0; }
+
+    return node;
+}
@@ -0,0 +1,524 @@
+/**
+ * @file TaskPool.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Work-stealing task scheduler over the thread and futex primitives.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/TaskPool.h"
+#include "tundra/utils/Thread.h"
+#include "tundra/common/Atomics.h"
+#include "tundra/internal/Syscall.h"
+#include "tundra/internal/LargeMemAlloc.h"
+#include "tundra/utils/Math.h"
+#include "tundra/common/Core.h"
+
+#ifdef TUNDRA_PLATFORM_LINUX
+
+#ifdef TUNDRA_SYS_x86_64
+
+#define FUTEX_WAIT_PRIVATE 128
+#define FUTEX_WAKE_PRIVATE 129
+#define WAKE_ALL 0x7FFFFFFF
+
+// Fixed capacity of each worker's deque; a push onto a full deque runs the
+// task inline instead.
+#define DEQUE_CAP 8192
+TUNDRA_CT_ASSERT(TUNDRA_IS_POW2(DEQUE_CAP));
+
+// Bytes of per-task scratch each worker owns.
+#define WORKER_SCRATCH_BYTES (256 * 1024)
+
+// Pause-loop iterations the backoff doubles up to before a worker goes to
+// sleep in the kernel.
+#define MAX_BACKOFF_PAUSES 1024
+
+/**
+ * One worker thread's state: a Chase-Lev deque owned at the bottom by the
+ * worker and stolen from at the top by the others, plus its thread and
+ * per-task scratch arena. The deque ends sit on separate cache lines so
+ * steals do not bounce the owner's line.
+ */
+typedef struct InTundra_TaskWorker
+{
+    Tundra_Task **deque;
+
+    u64 top;
+    u8 top_padding[TUNDRA_CACHELINE_BYTES - sizeof(u64)];
+
+    u64 bottom;
+    u8 bottom_padding[TUNDRA_CACHELINE_BYTES - sizeof(u64)];
+
+    Tundra_TaskPool *pool;
+    Tundra_Thread thread;
+    Tundra_ScratchArena scratch;
+    u64 index;
+} InTundra_TaskWorker;
+
+// Worker state of the calling thread, when it is a pool worker.
+static __thread InTundra_TaskWorker *tl_worker = NULL;
+
+static void futex_wait(u32 *addr, u32 expected)
+{
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_FUTEX, (i64)addr,
+        FUTEX_WAIT_PRIVATE, (i64)expected, 0, 0, 0);
+}
+
+static void futex_wake(u32 *addr, i64 num_wake)
+{
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_FUTEX, (i64)addr,
+        FUTEX_WAKE_PRIVATE, num_wake, 0, 0, 0);
+}
+
+/**
+ * @brief Announces new work or a completion to any sleeping workers.
+ *
+ * @param pool Pool to wake.
+ */
+static void announce_work(Tundra_TaskPool *pool)
+{
+    Tundra_atm_fetch_add_u32(&pool->work_seq, 1, TUNDRA_ATM_RELEASE);
+    futex_wake(&pool->work_seq, WAKE_ALL);
+}
+
+/**
+ * @brief Runs one task on the calling worker and flags it done.
+ *
+ * @param worker Worker executing the task.
+ * @param task Task to run.
+ */
+static void run_task(InTundra_TaskWorker *worker, Tundra_Task *task)
+{
+    // Mark and restore the scratch offset instead of resetting: a worker
+    // helping from inside `wait` runs nested tasks, whose scratch must not
+    // clobber the suspended task's live allocations below the mark.
+    Tundra_ScratchArena *scratch = &worker->scratch;
+
+    const u64 USED_MARK = scratch->used_bytes;
+    const u64 LAST_ALLOC_MARK = scratch->last_alloc_offset;
+
+    task->fn(task->user_data, scratch);
+
+    scratch->used_bytes = USED_MARK;
+    scratch->last_alloc_offset = LAST_ALLOC_MARK;
+
+    Tundra_atm_store_u32(&task->done_futex, 1, TUNDRA_ATM_RELEASE);
+    futex_wake(&task->done_futex, WAKE_ALL);
+
+    // Waiting workers may be parked on the work counter instead.
+    announce_work(worker->pool);
+}
+
+/**
+ * @brief Owner-side push onto the bottom of the deque.
+ *
+ * @return bool False if the deque is full.
+ */
+static bool deque_push(InTundra_TaskWorker *worker, Tundra_Task *task)
+{
+    const u64 BOTTOM = Tundra_atm_load_u64(&worker->bottom,
+        TUNDRA_ATM_RELAXED);
+    const u64 TOP = Tundra_atm_load_u64(&worker->top, TUNDRA_ATM_ACQUIRE);
+
+    if(BOTTOM - TOP >= DEQUE_CAP) { return false; }
+
+    worker->deque[BOTTOM & (DEQUE_CAP - 1)] = task;
+
+    // Publish the slot before the new bottom so thieves never read a stale
+    // pointer.
+    Tundra_atm_store_u64(&worker->bottom, BOTTOM + 1, TUNDRA_ATM_RELEASE);
+
+    return true;
+}
+
+/**
+ * @brief Owner-side take from the bottom of the deque, newest first.
+ *
+ * @return Tundra_Task* Taken task, NULL if the deque is empty.
+ */
+static Tundra_Task* deque_take(InTundra_TaskWorker *worker)
+{
+    const u64 BOTTOM = Tundra_atm_load_u64(&worker->bottom,
+        TUNDRA_ATM_RELAXED) - 1;
+
+    // Reserve the bottom slot before inspecting the top so a concurrent
+    // thief cannot also claim it unseen.
+    Tundra_atm_store_u64(&worker->bottom, BOTTOM, TUNDRA_ATM_RELAXED);
+    Tundra_atm_fence(TUNDRA_ATM_SEQ_CST);
+
+    u64 top = Tundra_atm_load_u64(&worker->top, TUNDRA_ATM_RELAXED);
+
+    if((i64)(BOTTOM - top) < 0)
+    {
+        // Deque was empty; undo the reservation.
+        Tundra_atm_store_u64(&worker->bottom, BOTTOM + 1,
+            TUNDRA_ATM_RELAXED);
+        return NULL;
+    }
+
+    Tundra_Task *task = worker->deque[BOTTOM & (DEQUE_CAP - 1)];
+
+    if(BOTTOM != top) { return task; }
+
+    // Last element: race the thieves for it through the top cursor.
+    if(!Tundra_atm_cas_u64(&worker->top, &top, top + 1,
+        TUNDRA_ATM_SEQ_CST, TUNDRA_ATM_RELAXED))
+    { task = NULL; }
+
+    Tundra_atm_store_u64(&worker->bottom, BOTTOM + 1, TUNDRA_ATM_RELAXED);
+
+    return task;
+}
+
+/**
+ * @brief Thief-side steal from the top of a victim's deque, oldest first.
+ *
+ * @return Tundra_Task* Stolen task, NULL if the victim had nothing to take.
+ */
+static Tundra_Task* deque_steal(InTundra_TaskWorker *victim)
+{
+    u64 top = Tundra_atm_load_u64(&victim->top, TUNDRA_ATM_ACQUIRE);
+
+    Tundra_atm_fence(TUNDRA_ATM_SEQ_CST);
+
+    const u64 BOTTOM = Tundra_atm_load_u64(&victim->bottom,
+        TUNDRA_ATM_ACQUIRE);
+
+    if((i64)(BOTTOM - top) <= 0) { return NULL; }
+
+    Tundra_Task *task = victim->deque[top & (DEQUE_CAP - 1)];
+
+    // The owner or another thief may have claimed the slot first.
+    if(!Tundra_atm_cas_u64(&victim->top, &top, top + 1,
+        TUNDRA_ATM_SEQ_CST, TUNDRA_ATM_RELAXED))
+    { return NULL; }
+
+    return task;
+}
+
+/**
+ * @brief Pops the oldest externally submitted task, if any.
+ */
+static Tundra_Task* inject_pop(Tundra_TaskPool *pool)
+{
+    if(Tundra_atm_load_ptr((void* const*)&pool->inject_head,
+        TUNDRA_ATM_RELAXED) == NULL)
+    { return NULL; }
+
+    Tundra_Mutex_lock(&pool->inject_lock);
+
+    Tundra_Task *task = pool->inject_head;
+
+    if(task != NULL)
+    {
+        pool->inject_head = task->next;
+        if(pool->inject_head == NULL) { pool->inject_tail = NULL; }
+    }
+
+    Tundra_Mutex_unlock(&pool->inject_lock);
+
+    return task;
+}
+
+/**
+ * @brief Finds one runnable task for `worker`: its own deque first, then
+ * the injection list, then a sweep over the other workers' deques.
+ *
+ * @return Tundra_Task* Found task, NULL if everything is empty.
+ */
+static Tundra_Task* find_task(InTundra_TaskWorker *worker)
+{
+    Tundra_Task *task = deque_take(worker);
+
+    if(task != NULL) { return task; }
+
+    task = inject_pop(worker->pool);
+
+    if(task != NULL) { return task; }
+
+    Tundra_TaskPool *pool = worker->pool;
+
+    for(u64 i = 1; i < pool->num_workers; ++i)
+    {
+        task = deque_steal(
+            &pool->workers[(worker->index + i) % pool->num_workers]);
+
+        if(task != NULL) { return task; }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Body of one worker thread: run tasks, back off when none are
+ * found, sleep once the backoff is exhausted.
+ *
+ * @param user_data The worker's InTundra_TaskWorker.
+ */
+static void worker_entry(void *user_data)
+{
+    InTundra_TaskWorker *worker = (InTundra_TaskWorker*)user_data;
+    Tundra_TaskPool *pool = worker->pool;
+
+    // The scratch arena must be created by its owning thread.
+    Tundra_ScrArena_init(&worker->scratch, WORKER_SCRATCH_BYTES);
+
+    tl_worker = worker;
+
+    u64 backoff = 1;
+
+    while(true)
+    {
+        // Snapshot the work counter before searching, so a submit landing
+        // after an empty search turns the sleep into an immediate return.
+        const u32 SEQ = Tundra_atm_load_u32(&pool->work_seq,
+            TUNDRA_ATM_ACQUIRE);
+
+        Tundra_Task *task = find_task(worker);
+
+        if(task != NULL)
+        {
+            run_task(worker, task);
+            backoff = 1;
+            continue;
+        }
+
+        if(!Tundra_atm_load_u32((u32*)&pool->running, TUNDRA_ATM_ACQUIRE))
+        { break; }
+
+        if(backoff <= MAX_BACKOFF_PAUSES)
+        {
+            for(u64 i = 0; i < backoff; ++i) { Tundra_atm_spin_pause(); }
+            backoff *= 2;
+            continue;
+        }
+
+        futex_wait(&pool->work_seq, SEQ);
+        backoff = 1;
+    }
+
+    Tundra_ScrArena_free(&worker->scratch);
+}
+
+void Tundra_TaskPool_init(Tundra_TaskPool *pool, u64 num_workers)
+{
+    if(num_workers == 0)
+    {
+        // One worker per cpu the calling thread may run on.
+        u64 cpu_mask = 0;
+
+        if(InTundra_syscall(TUNDRA_LINUX_SYSCALL_SCHED_GETAFFINITY, 0,
+            sizeof(cpu_mask), (i64)&cpu_mask, 0, 0, 0) > 0)
+        { num_workers = (u64)__builtin_popcountll(cpu_mask); }
+
+        if(num_workers == 0) { num_workers = 1; }
+    }
+
+    pool->workers = (InTundra_TaskWorker*)InTundra_LgMemAlc_malloc_aligned(
+        num_workers * sizeof(InTundra_TaskWorker),
+        TUNDRA_CACHELINE_BYTES);
+
+    pool->num_workers = num_workers;
+    pool->inject_head = NULL;
+    pool->inject_tail = NULL;
+    pool->inject_lock.state = 0;
+    pool->work_seq = 0;
+    pool->running = true;
+
+    for(u64 i = 0; i < num_workers; ++i)
+    {
+        InTundra_TaskWorker *worker = &pool->workers[i];
+
+        worker->deque = (Tundra_Task**)InTundra_LgMemAlc_malloc(
+            DEQUE_CAP * sizeof(Tundra_Task*));
+
+        worker->top = 0;
+        worker->bottom = 0;
+        worker->pool = pool;
+        worker->index = i;
+    }
+
+    for(u64 i = 0; i < num_workers; ++i)
+    {
+        Tundra_Thread_spawn(&pool->workers[i].thread, worker_entry,
+            &pool->workers[i]);
+    }
+}
+
+void Tundra_TaskPool_free(Tundra_TaskPool *pool)
+{
+    Tundra_atm_store_u32((u32*)&pool->running, 0, TUNDRA_ATM_RELEASE);
+    announce_work(pool);
+
+    for(u64 i = 0; i < pool->num_workers; ++i)
+    { Tundra_Thread_join(&pool->workers[i].thread); }
+
+    for(u64 i = 0; i < pool->num_workers; ++i)
+    { InTundra_LgMemAlc_free((void*)pool->workers[i].deque); }
+
+    InTundra_LgMemAlc_free((void*)pool->workers);
+
+    pool->workers = NULL;
+    pool->num_workers = 0;
+}
+
+void Tundra_TaskPool_submit(Tundra_TaskPool *pool, Tundra_Task *task,
+    Tundra_TaskFn fn, void *user_data)
+{
+    task->fn = fn;
+    task->user_data = user_data;
+    task->done_futex = 0;
+    task->next = NULL;
+
+    // Workers of this pool push to their own deque; a full deque just runs
+    // the task inline.
+    if(tl_worker != NULL && tl_worker->pool == pool)
+    {
+        if(deque_push(tl_worker, task))
+        {
+            announce_work(pool);
+            return;
+        }
+
+        run_task(tl_worker, task);
+        return;
+    }
+
+    Tundra_Mutex_lock(&pool->inject_lock);
+
+    if(pool->inject_tail != NULL) { pool->inject_tail->next = task; }
+    else { pool->inject_head = task; }
+
+    pool->inject_tail = task;
+
+    Tundra_Mutex_unlock(&pool->inject_lock);
+
+    announce_work(pool);
+}
+
+void Tundra_TaskPool_wait(Tundra_TaskPool *pool, Tundra_Task *task)
+{
+    // A waiting worker lends itself to the pool: executing other tasks
+    // both drains the dependency chain and keeps the core busy.
+    if(tl_worker != NULL && tl_worker->pool == pool)
+    {
+        while(Tundra_atm_load_u32(&task->done_futex, TUNDRA_ATM_ACQUIRE)
+            == 0)
+        {
+            const u32 SEQ = Tundra_atm_load_u32(&pool->work_seq,
+                TUNDRA_ATM_ACQUIRE);
+
+            Tundra_Task *other = find_task(tl_worker);
+
+            if(other != NULL)
+            {
+                run_task(tl_worker, other);
+                continue;
+            }
+
+            if(Tundra_atm_load_u32(&task->done_futex, TUNDRA_ATM_ACQUIRE)
+                != 0)
+            { break; }
+
+            // Nothing to help with; sleep until any submit or completion.
+            futex_wait(&pool->work_seq, SEQ);
+        }
+
+        return;
+    }
+
+    while(Tundra_atm_load_u32(&task->done_futex, TUNDRA_ATM_ACQUIRE) == 0)
+    { futex_wait(&task->done_futex, 0); }
+}
+
+/**
+ * One span of a parallel-for: the task handle plus the iteration range and
+ * body it carries to the worker.
+ */
+typedef struct InTundra_ParForSpan
+{
+    Tundra_Task task;
+    u64 begin;
+    u64 end;
+    Tundra_ParallelForFn fn;
+    void *user_data;
+} InTundra_ParForSpan;
+
+/**
+ * @brief Task body adapting a parallel-for span to the task signature.
+ *
+ * @param user_data The span's InTundra_ParForSpan.
+ */
+static void par_for_span_entry(void *user_data, Tundra_ScratchArena *scratch)
+{
+    (void)scratch;
+
+    InTundra_ParForSpan *span = (InTundra_ParForSpan*)user_data;
+
+    span->fn(span->begin, span->end, span->user_data);
+}
+
+void Tundra_parallel_for(Tundra_TaskPool *pool, u64 begin, u64 end,
+    u64 grain, Tundra_ParallelForFn fn, void *user_data)
+{
+    if(begin >= end) { return; }
+
+    const u64 COUNT = end - begin;
+
+    if(grain == 0)
+    {
+        // Several spans per worker so uneven finish times level out,
+        // without drowning short ranges in per-task overhead.
+        grain = COUNT / (pool->num_workers * 8);
+
+        if(grain == 0) { grain = 1; }
+    }
+
+    // A single span needs no tasks at all.
+    if(COUNT <= grain)
+    {
+        fn(begin, end, user_data);
+        return;
+    }
+
+    const u64 NUM_SPANS = (COUNT + grain - 1) / grain;
+
+    InTundra_ParForSpan *spans = (InTundra_ParForSpan*)
+        InTundra_LgMemAlc_malloc(NUM_SPANS * sizeof(InTundra_ParForSpan));
+
+    for(u64 i = 0; i < NUM_SPANS; ++i)
+    {
+        spans[i].begin = begin + i * grain;
+        spans[i].end = spans[i].begin + grain;
+
+        if(spans[i].end > end) { spans[i].end = end; }
+
+        spans[i].fn = fn;
+        spans[i].user_data = user_data;
+    }
+
+    for(u64 i = 1; i < NUM_SPANS; ++i)
+    {
+        Tundra_TaskPool_submit(pool, &spans[i].task, par_for_span_entry,
+            &spans[i]);
+    }
+
+    // The calling thread covers the first span itself instead of just
+    // blocking, then helps drain the rest through `wait`.
+    fn(spans[0].begin, spans[0].end, user_data);
+
+    for(u64 i = 1; i < NUM_SPANS; ++i)
+    { Tundra_TaskPool_wait(pool, &spans[i].task); }
+
+    InTundra_LgMemAlc_free((void*)spans);
+}
+
+#else // TUNDRA_SYS_x86_64
+#error Not Implemented
+#endif // TUNDRA_SYS_x86_64
+
+#else // TUNDRA_PLATFORM_LINUX
+#error Not Implemented
+#endif // TUNDRA_PLATFORM_LINUX
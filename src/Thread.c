@@ -0,0 +1,401 @@
+/**
+ * @file Thread.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Minimal thread spawning, joining and affinity over the clone3
+ * syscall.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/Thread.h"
+#include "tundra/internal/Syscall.h"
+#include "tundra/internal/LargeMemAlloc.h"
+#include "tundra/internal/SmallMemAlloc.h"
+#include "tundra/utils/MemUtils.h"
+#include "tundra/common/Core.h"
+
+#ifdef TUNDRA_PLATFORM_LINUX
+
+#ifdef TUNDRA_SYS_x86_64
+
+// clone3 flags used for every spawn: share the address space, filesystem
+// state, open files, signal handlers and SysV semaphores with the spawner,
+// live in its thread group, install the per-thread TLS block, and have the
+// kernel publish the child tid into the join futex word then clear and wake
+// it on exit. The tid lands in the futex word when the child is first
+// scheduled, so a fresh thread's word still reads zero — exactly like an
+// exited thread's; the `started` flag breaks that ambiguity for `join`.
+#define CLONE_VM 0x100ULL
+#define CLONE_FS 0x200ULL
+#define CLONE_FILES 0x400ULL
+#define CLONE_SIGHAND 0x800ULL
+#define CLONE_THREAD 0x10000ULL
+#define CLONE_SYSVSEM 0x40000ULL
+#define CLONE_SETTLS 0x80000ULL
+#define CLONE_CHILD_CLEARTID 0x200000ULL
+#define CLONE_CHILD_SETTID 0x1000000ULL
+
+#define SPAWN_FLAGS (CLONE_VM | CLONE_FS | CLONE_FILES | CLONE_SIGHAND | \
+    CLONE_THREAD | CLONE_SYSVSEM | CLONE_SETTLS | CLONE_CHILD_SETTID | \
+    CLONE_CHILD_CLEARTID)
+
+#define FUTEX_WAIT 0
+#define FUTEX_WAIT_PRIVATE 128
+#define FUTEX_WAKE_PRIVATE 129
+
+#define MPOL_PREFERRED 1
+
+// Auxiliary vector entries locating the executable's program headers.
+#define AUXV_PHDR 3
+#define AUXV_PHENT 4
+#define AUXV_PHNUM 5
+
+#define ELF_PT_PHDR 6
+#define ELF_PT_TLS 7
+
+// Bytes reserved for the thread control block at the thread pointer, and
+// slack below the executable's TLS block for static TLS that shared
+// libraries may have claimed; spawned threads must not call into libc, but
+// the slack keeps a stray thread-local read from touching foreign memory.
+#define TCB_BYTES 128
+#define TLS_SLACK_BYTES 4096
+
+typedef struct
+{
+    i64 tag;
+    u64 val;
+} AuxvEntry;
+
+typedef struct
+{
+    u32 type;
+    u32 flags;
+    u64 offset;
+    u64 vaddr;
+    u64 paddr;
+    u64 file_size;
+    u64 mem_size;
+    u64 align;
+} ElfProgHeader;
+
+// First revision of the kernel's clone_args.
+typedef struct
+{
+    u64 flags;
+    u64 pidfd;
+    u64 child_tid;
+    u64 parent_tid;
+    u64 exit_signal;
+    u64 stack;
+    u64 stack_size;
+    u64 tls;
+} CloneArgs;
+
+// The executable's TLS initialization image, resolved once from the
+// program headers. `tls_block_bytes` is zero when the executable has no
+// TLS segment. Resolution is idempotent, so the unsynchronized lazy init
+// is a benign race.
+static bool tls_resolved = false;
+static const u8 *tls_image = NULL;
+static u64 tls_image_bytes = 0;
+static u64 tls_block_bytes = 0;
+static u64 tls_align = 16;
+
+// Locates the executable's PT_TLS segment through /proc/self/auxv, like
+// Time.c locates the vDSO.
+static void resolve_tls_image(void)
+{
+    static const char AUXV_PATH[] = "/proc/self/auxv";
+
+    tls_resolved = true;
+
+    // -100 is AT_FDCWD; the path is absolute so it is ignored.
+    const i64 FD = InTundra_syscall(TUNDRA_LINUX_SYSCALL_OPENAT, -100,
+        (i64)AUXV_PATH, 0, 0, 0, 0);
+
+    if(FD < 0) { return; }
+
+    AuxvEntry entries[128];
+
+    const i64 NUM_BYTES = InTundra_syscall(TUNDRA_LINUX_SYSCALL_READ, FD,
+        (i64)entries, (i64)sizeof(entries), 0, 0, 0);
+
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_CLOSE, FD, 0, 0, 0, 0, 0);
+
+    if(NUM_BYTES <= 0) { return; }
+
+    const ElfProgHeader *phdrs = NULL;
+    u64 phdr_ent_bytes = 0;
+    u64 num_phdr = 0;
+
+    const u64 NUM_ENTRY = (u64)NUM_BYTES / sizeof(AuxvEntry);
+
+    for(u64 i = 0; i < NUM_ENTRY; ++i)
+    {
+        switch(entries[i].tag)
+        {
+            case AUXV_PHDR:
+                phdrs = (const ElfProgHeader*)entries[i].val;
+                break;
+
+            case AUXV_PHENT: phdr_ent_bytes = entries[i].val; break;
+            case AUXV_PHNUM: num_phdr = entries[i].val; break;
+        }
+    }
+
+    if(phdrs == NULL || phdr_ent_bytes == 0) { return; }
+
+    // The headers hold virtual addresses; for a position independent
+    // executable they are offsets from a load bias recovered through
+    // PT_PHDR's own address.
+    u64 load_bias = 0;
+    const ElfProgHeader *tls_phdr = NULL;
+
+    for(u64 i = 0; i < num_phdr; ++i)
+    {
+        const ElfProgHeader *PHDR = (const ElfProgHeader*)(
+            (const u8*)phdrs + i * phdr_ent_bytes);
+
+        if(PHDR->type == ELF_PT_PHDR)
+        { load_bias = (u64)phdrs - PHDR->vaddr; }
+
+        else if(PHDR->type == ELF_PT_TLS) { tls_phdr = PHDR; }
+    }
+
+    if(tls_phdr == NULL) { return; }
+
+    tls_image = (const u8*)(load_bias + tls_phdr->vaddr);
+    tls_image_bytes = tls_phdr->file_size;
+
+    if(tls_phdr->align > tls_align) { tls_align = tls_phdr->align; }
+
+    // Variant II TLS: the block sits directly below the thread pointer,
+    // rounded up to its alignment so linker-assigned negative offsets land
+    // inside it.
+    tls_block_bytes = (tls_phdr->mem_size + tls_align - 1) &
+        ~(tls_align - 1);
+}
+
+/**
+ * @brief Builds a fresh TLS block plus thread control block for one thread.
+ *
+ * @param tls_mem_out Backing allocation, for the join-side free.
+ *
+ * @return u64 Thread pointer value for CLONE_SETTLS.
+ */
+static u64 create_tls_block(void **tls_mem_out)
+{
+    if(!tls_resolved) { resolve_tls_image(); }
+
+    const u64 TOTAL = TLS_SLACK_BYTES + tls_block_bytes + TCB_BYTES;
+
+    u8 *block = (u8*)InTundra_LgMemAlc_malloc_aligned(TOTAL, tls_align);
+
+    Tundra_zero_out_mem(block, TOTAL);
+
+    u8 *tcb = block + TLS_SLACK_BYTES + tls_block_bytes;
+
+    if(tls_image_bytes != 0)
+    {
+        Tundra_copy_mem_fwd(tls_image, tcb - tls_block_bytes,
+            tls_image_bytes);
+    }
+
+    // The ABI requires the word at the thread pointer to hold the thread
+    // pointer itself.
+    *(u64*)tcb = (u64)tcb;
+
+    *tls_mem_out = block;
+
+    return (u64)tcb;
+}
+
+/**
+ * @brief Issues clone3 and routes the child into its entry function.
+ *
+ * The child resumes here on its fresh stack, whose top two slots the
+ * spawner preloaded with the entry function and its argument; it must not
+ * touch the spawner's frame, so the child path is pure asm: pop the two
+ * slots, call the entry, then exit the thread.
+ *
+ * @param cl_args Filled clone_args whose stack top holds [entry][arg].
+ *
+ * @return i64 Child tid in the spawner, negative error code on failure.
+ */
+static i64 clone3_and_enter(CloneArgs *cl_args)
+{
+    i64 result;
+
+    __asm__ volatile
+    (
+        "syscall\n\t"
+        "test %%rax, %%rax\n\t"
+        "jnz 1f\n\t"
+        "xor %%ebp, %%ebp\n\t"
+        "pop %%rax\n\t"
+        "pop %%rdi\n\t"
+        "call *%%rax\n\t"
+        "mov $60, %%eax\n\t"
+        "xor %%edi, %%edi\n\t"
+        "syscall\n\t"
+        "1:"
+        : "=a"(result)
+        : "a"(TUNDRA_LINUX_SYSCALL_CLONE3),
+          "D"(cl_args),
+          "S"(sizeof(CloneArgs))
+        : "rcx", "r11", "memory"
+    );
+
+    return result;
+}
+
+/**
+ * @brief First function run on a spawned thread's own stack and TLS.
+ *
+ * @param thread Thread being started.
+ */
+static void thread_entry(void *thread)
+{
+    Tundra_Thread *t = (Tundra_Thread*)thread;
+
+    // Publish that this thread is running; the kernel has already written
+    // its tid into the join futex. `join` may be parked waiting for it.
+    __atomic_store_n(&t->started, 1, __ATOMIC_RELEASE);
+
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_FUTEX, (i64)&t->started,
+        FUTEX_WAKE_PRIVATE, 1, 0, 0, 0);
+
+    // Touch the small allocator so its lazily created thread-local arena
+    // chain exists before the body runs allocation-heavy code.
+    InTundra_SmlMemAlc_free(InTundra_SmlMemAlc_malloc(8));
+
+    t->fn(t->user_data);
+}
+
+bool Tundra_Thread_spawn(Tundra_Thread *thread, Tundra_ThreadFn fn,
+    void *user_data)
+{
+    thread->fn = fn;
+    thread->user_data = user_data;
+    thread->join_futex = 0;
+    thread->started = 0;
+
+    thread->stack_mem = InTundra_LgMemAlc_malloc(TUNDRA_THREAD_STACK_BYTES);
+
+    const u64 TLS = create_tls_block(&thread->tls_mem);
+
+    // Preload the entry function and its argument at an aligned stack top;
+    // after the child pops both, its stack pointer is 16 byte aligned as
+    // the call requires.
+    u64 top = ((u64)thread->stack_mem + TUNDRA_THREAD_STACK_BYTES) &
+        ~15ULL;
+
+    top -= 16;
+    ((u64*)top)[0] = (u64)thread_entry;
+    ((u64*)top)[1] = (u64)thread;
+
+    CloneArgs cl_args = {0};
+
+    cl_args.flags = SPAWN_FLAGS;
+    cl_args.child_tid = (u64)&thread->join_futex;
+    cl_args.stack = (u64)thread->stack_mem;
+    cl_args.stack_size = top - (u64)thread->stack_mem;
+    cl_args.tls = TLS;
+
+    const i64 TID = clone3_and_enter(&cl_args);
+
+    if(TID < 0)
+    {
+        InTundra_LgMemAlc_free(thread->stack_mem);
+        InTundra_LgMemAlc_free(thread->tls_mem);
+        thread->stack_mem = NULL;
+        thread->tls_mem = NULL;
+        return false;
+    }
+
+    thread->tid = TID;
+
+    return true;
+}
+
+void Tundra_Thread_join(Tundra_Thread *thread)
+{
+    TUNDRA_RT_ASSERT(thread->stack_mem != NULL,
+        "Joining a thread that was never spawned.\n");
+
+    // Wait for the thread to start; until then the join futex reads zero
+    // just like it would after exit.
+    while(__atomic_load_n(&thread->started, __ATOMIC_ACQUIRE) == 0)
+    {
+        InTundra_syscall(TUNDRA_LINUX_SYSCALL_FUTEX, (i64)&thread->started,
+            FUTEX_WAIT_PRIVATE, 0, 0, 0, 0);
+    }
+
+    u32 tid;
+
+    // The kernel clears the futex word and wakes waiters when the thread
+    // exits; sleep until that happens. The exit-time wake is a shared
+    // futex op, so the wait must be shared too or the wake is lost. A wait
+    // answered between the load and the sleep returns EAGAIN and
+    // re-checks.
+    while((tid = __atomic_load_n(&thread->join_futex, __ATOMIC_ACQUIRE))
+        != 0)
+    {
+        InTundra_syscall(TUNDRA_LINUX_SYSCALL_FUTEX,
+            (i64)&thread->join_futex, FUTEX_WAIT, (i64)tid, 0, 0, 0);
+    }
+
+    InTundra_LgMemAlc_free(thread->stack_mem);
+    InTundra_LgMemAlc_free(thread->tls_mem);
+    thread->stack_mem = NULL;
+    thread->tls_mem = NULL;
+    thread->tid = 0;
+}
+
+bool Tundra_Thread_set_affinity(const Tundra_Thread *thread, u64 cpu_mask)
+{
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_SCHED_SETAFFINITY,
+        thread->tid, sizeof(cpu_mask), (i64)&cpu_mask, 0, 0, 0) == 0;
+}
+
+bool Tundra_Thread_set_self_affinity(u64 cpu_mask)
+{
+    // tid 0 targets the calling thread.
+    if(InTundra_syscall(TUNDRA_LINUX_SYSCALL_SCHED_SETAFFINITY, 0,
+        sizeof(cpu_mask), (i64)&cpu_mask, 0, 0, 0) != 0)
+    { return false; }
+
+    // The kernel has already migrated this thread inside the mask, so the
+    // node under it now is where it will stay. Prefer that node for every
+    // page the thread faults in from here on (arena growth, task deques, io
+    // buffers), so a pinned worker's memory is socket local by default.
+    // Best effort: without the policy the thread still runs, just with
+    // first-touch placement.
+    u32 cpu;
+    u32 node;
+
+    if(InTundra_syscall(TUNDRA_LINUX_SYSCALL_GETCPU, (i64)&cpu, (i64)&node,
+        0, 0, 0, 0) == 0)
+    {
+        const u64 NODE_MASK = 1ULL << node;
+
+        InTundra_syscall(TUNDRA_LINUX_SYSCALL_SET_MEMPOLICY, MPOL_PREFERRED,
+            (i64)&NODE_MASK, 64 + 1, 0, 0, 0);
+    }
+
+    return true;
+}
+
+i64 Tundra_Thread_self_id(void)
+{
+    return InTundra_syscall(TUNDRA_LINUX_SYSCALL_GETTID, 0, 0, 0, 0, 0, 0);
+}
+
+#else // TUNDRA_SYS_x86_64
+#error Not Implemented
+#endif // TUNDRA_SYS_x86_64
+
+#else // TUNDRA_PLATFORM_LINUX
+#error Not Implemented
+#endif // TUNDRA_PLATFORM_LINUX
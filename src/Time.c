@@ -0,0 +1,269 @@
+/**
+ * @file Time.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Cycle counter and monotonic clock access for timing and benchmarks.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/Time.h"
+#include "tundra/internal/Syscall.h"
+
+#ifdef TUNDRA_PLATFORM_LINUX
+
+#ifdef TUNDRA_SYS_x86_64
+
+#define LINUX_CLOCK_MONOTONIC 1
+
+// Auxiliary vector entry holding the vDSO's load address.
+#define AUXV_SYSINFO_EHDR 33
+
+// Minimal 64 bit ELF definitions for walking the vDSO image; only the
+// fields needed to resolve a dynamic symbol.
+#define ELF_PT_LOAD 1
+#define ELF_PT_DYNAMIC 2
+#define ELF_DT_HASH 4
+#define ELF_DT_STRTAB 5
+#define ELF_DT_SYMTAB 6
+
+typedef struct
+{
+    u8 ident[16];
+    u16 type;
+    u16 machine;
+    u32 version;
+    u64 entry;
+    u64 phdr_offset;
+    u64 shdr_offset;
+    u32 flags;
+    u16 ehdr_size;
+    u16 phdr_ent_size;
+    u16 num_phdr;
+    u16 shdr_ent_size;
+    u16 num_shdr;
+    u16 shdr_str_idx;
+} ElfHeader;
+
+typedef struct
+{
+    u32 type;
+    u32 flags;
+    u64 offset;
+    u64 vaddr;
+    u64 paddr;
+    u64 file_size;
+    u64 mem_size;
+    u64 align;
+} ElfProgHeader;
+
+typedef struct
+{
+    i64 tag;
+    u64 val;
+} ElfDyn;
+
+typedef struct
+{
+    u32 name;
+    u8 info;
+    u8 other;
+    u16 sect_idx;
+    u64 value;
+    u64 size;
+} ElfSym;
+
+typedef struct
+{
+    i64 sec;
+    i64 nsec;
+} LinuxTimespec;
+
+typedef i32 (*ClockGettimeFn)(i32 clock_id, LinuxTimespec *ts);
+
+// Resolved __vdso_clock_gettime, NULL when resolution failed and the raw
+// syscall must be used. Resolution is idempotent, so the unsynchronized
+// lazy init is a benign race.
+static ClockGettimeFn vdso_clock_gettime = NULL;
+static bool vdso_resolved = false;
+
+static bool cstrs_equal(const char *first, const char *second)
+{
+    while(*first != '\0' && *first == *second)
+    {
+        ++first;
+        ++second;
+    }
+
+    return *first == *second;
+}
+
+// Returns the vDSO's load address from /proc/self/auxv, 0 on failure.
+static u64 read_vdso_base(void)
+{
+    static const char AUXV_PATH[] = "/proc/self/auxv";
+
+    // -100 is AT_FDCWD; the path is absolute so it is ignored.
+    const i64 FD = InTundra_syscall(TUNDRA_LINUX_SYSCALL_OPENAT, -100,
+        (i64)AUXV_PATH, 0, 0, 0, 0);
+
+    if(FD < 0) { return 0; }
+
+    u64 base = 0;
+
+    // type/value pairs; well under this on every kernel.
+    u64 entries[128];
+
+    const i64 NUM_BYTES = InTundra_syscall(TUNDRA_LINUX_SYSCALL_READ, FD,
+        (i64)entries, (i64)sizeof(entries), 0, 0, 0);
+
+    InTundra_syscall(TUNDRA_LINUX_SYSCALL_CLOSE, FD, 0, 0, 0, 0, 0);
+
+    if(NUM_BYTES <= 0) { return 0; }
+
+    const u64 NUM_ENTRY = (u64)NUM_BYTES / 16;
+
+    for(u64 i = 0; i < NUM_ENTRY; ++i)
+    {
+        if(entries[2 * i] == AUXV_SYSINFO_EHDR)
+        {
+            base = entries[2 * i + 1];
+            break;
+        }
+    }
+
+    return base;
+}
+
+// Resolves __vdso_clock_gettime out of the vDSO's dynamic symbol table,
+// leaving `vdso_clock_gettime` NULL if anything is missing.
+static void resolve_vdso(void)
+{
+    vdso_resolved = true;
+
+    const u64 BASE = read_vdso_base();
+
+    if(BASE == 0) { return; }
+
+    const ElfHeader *EHDR = (const ElfHeader*)BASE;
+    const ElfProgHeader *PHDRS =
+        (const ElfProgHeader*)(BASE + EHDR->phdr_offset);
+
+    u64 load_bias = 0;
+    const ElfDyn *dyn = NULL;
+
+    for(u16 i = 0; i < EHDR->num_phdr; ++i)
+    {
+        if(PHDRS[i].type == ELF_PT_LOAD)
+        {
+            load_bias = BASE + PHDRS[i].offset - PHDRS[i].vaddr;
+        }
+
+        else if(PHDRS[i].type == ELF_PT_DYNAMIC)
+        {
+            dyn = (const ElfDyn*)(BASE + PHDRS[i].offset);
+        }
+    }
+
+    if(dyn == NULL) { return; }
+
+    const ElfSym *symtab = NULL;
+    const char *strtab = NULL;
+    const u32 *hash = NULL;
+
+    for(; dyn->tag != 0; ++dyn)
+    {
+        switch(dyn->tag)
+        {
+            case ELF_DT_SYMTAB:
+
+                symtab = (const ElfSym*)(load_bias + dyn->val);
+                break;
+
+            case ELF_DT_STRTAB:
+
+                strtab = (const char*)(load_bias + dyn->val);
+                break;
+
+            case ELF_DT_HASH:
+
+                hash = (const u32*)(load_bias + dyn->val);
+                break;
+        }
+    }
+
+    if(symtab == NULL || strtab == NULL || hash == NULL) { return; }
+
+    // hash[1] is nchain, which equals the number of symbols.
+    const u32 NUM_SYM = hash[1];
+
+    for(u32 i = 0; i < NUM_SYM; ++i)
+    {
+        if(symtab[i].value != 0 &&
+            cstrs_equal(strtab + symtab[i].name, "__vdso_clock_gettime"))
+        {
+            vdso_clock_gettime =
+                (ClockGettimeFn)(load_bias + symtab[i].value);
+            return;
+        }
+    }
+}
+
+u64 Tundra_get_monotonic_ns(void)
+{
+    if(!vdso_resolved) { resolve_vdso(); }
+
+    LinuxTimespec ts;
+
+    if(vdso_clock_gettime != NULL)
+    {
+        vdso_clock_gettime(LINUX_CLOCK_MONOTONIC, &ts);
+    }
+
+    else
+    {
+        InTundra_syscall(TUNDRA_LINUX_SYSCALL_CLOCK_GETTIME,
+            LINUX_CLOCK_MONOTONIC, (i64)&ts, 0, 0, 0, 0);
+    }
+
+    return (u64)ts.sec * 1000000000ULL + (u64)ts.nsec;
+}
+
+// Nanoseconds per cycle in 32.32 fixed point, 0 until calibrated. Writes
+// race benignly: every calibration computes the same value to within
+// measurement noise.
+static u64 ns_per_cycle_q32 = 0;
+
+void Tundra_calibrate_cycle_rate(void)
+{
+    const u64 START_NS = Tundra_get_monotonic_ns();
+    const u64 START_CYCLES = Tundra_get_cycles_start();
+
+    // A millisecond spans millions of cycles, plenty for a stable ratio.
+    u64 end_ns = Tundra_get_monotonic_ns();
+
+    while(end_ns - START_NS < 1000000ULL)
+    {
+        end_ns = Tundra_get_monotonic_ns();
+    }
+
+    const u64 END_CYCLES = Tundra_get_cycles_end();
+
+    ns_per_cycle_q32 = (u64)(((unsigned __int128)(end_ns - START_NS) << 32) /
+        (END_CYCLES - START_CYCLES));
+}
+
+u64 Tundra_cycles_to_ns(u64 cycles)
+{
+    if(ns_per_cycle_q32 == 0) { Tundra_calibrate_cycle_rate(); }
+
+    return (u64)(((unsigned __int128)cycles * ns_per_cycle_q32) >> 32);
+}
+
+#else // TUNDRA_SYS_x86_64
+#error Not Implemented
+#endif // TUNDRA_SYS_x86_64
+
+#else // TUNDRA_PLATFORM_LINUX
+#error Not Implemented
+#endif // TUNDRA_PLATFORM_LINUX
@@ -0,0 +1,233 @@
+/**
+ * @file Trace.c
+ * @author Joel Height (On3SnowySnowman@gmail.com)
+ * @brief Per-thread ring buffer scope tracing and its Chrome JSON flusher.
+ * @date 2026-08-30
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tundra/utils/Trace.h"
+#include "tundra/utils/FileHandling.h"
+#include "tundra/utils/Time.h"
+#include "tundra/internal/MemAllocHandler.h"
+#include "tundra/internal/Syscall.h"
+
+
+// Containers ------------------------------------------------------------------
+
+#ifdef TUNDRA_TRACE
+
+typedef struct
+{
+    // Cycle counter at the event, converted at flush time so the hot path
+    // never pays for the conversion.
+    u64 cycles;
+
+    // Scope name; a pointer to a caller-owned literal, never copied.
+    const char *name;
+
+    // 0 for begin, 1 for end.
+    u32 phase;
+} TraceEvent;
+
+typedef struct TraceRing
+{
+    // Next ring in the flusher's registry, pushed once per thread.
+    struct TraceRing *next;
+
+    // Kernel thread id of the owning thread, reported in the output.
+    i64 tid;
+
+    // Total events ever written; the live slot is head modulo the ring
+    // size. Stored with release so the flusher sees the event bytes of
+    // every count it loads.
+    u64 head;
+
+    TraceEvent events[TUNDRA_TRACE_RING_EVENTS];
+} TraceRing;
+
+
+// Global Variables ------------------------------------------------------------
+
+/**
+ * Registry of every thread's ring, pushed with a CAS on first emit. Rings
+ * are never unregistered or freed: a handful of pages per traced thread
+ * that live until process exit, so a flush can still show what an already
+ * exited thread did.
+ */
+static TraceRing *rings_head;
+
+static __thread TraceRing *tl_ring;
+
+#endif // TUNDRA_TRACE
+
+
+// Methods ---------------------------------------------------------------------
+
+// -- Local Helper Methods --
+
+#ifdef TUNDRA_TRACE
+
+/**
+ * @brief Allocates and registers the calling thread's ring.
+ *
+ * The pages come straight from the os rather than the allocator, so the
+ * allocator's own traced slow paths cannot recurse into ring creation.
+ *
+ * @return TraceRing* The thread's ring.
+ */
+static TraceRing* create_ring(void)
+{
+    // Whole pages, rounded up from the ring struct.
+    const u64 RING_BYTES = (sizeof(TraceRing) + TUNDRA_OS_ALLOC_ALIGNMENT -
+        1) / TUNDRA_OS_ALLOC_ALIGNMENT * TUNDRA_OS_ALLOC_ALIGNMENT;
+
+    TraceRing *ring = (TraceRing*)InTundra_Mem_get_mem_from_os(RING_BYTES);
+
+    ring->tid = InTundra_syscall(TUNDRA_LINUX_SYSCALL_GETTID, 0, 0, 0, 0, 0,
+        0);
+    ring->head = 0;
+
+    TraceRing *head = __atomic_load_n(&rings_head, __ATOMIC_RELAXED);
+
+    do
+    {
+        ring->next = head;
+    }
+    while(!__atomic_compare_exchange_n(&rings_head, &head, ring, false,
+        __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    tl_ring = ring;
+
+    return ring;
+}
+
+/**
+ * @brief Writes one microsecond timestamp with a 3 digit nanosecond
+ * fraction, e.g. 12345.678.
+ *
+ * @param file File to write to.
+ * @param ns Timestamp in nanoseconds.
+ *
+ * @return `i64` 0 on success, otherwise an error code.
+ */
+static i64 write_timestamp_us(Tundra_File *file, u64 ns)
+{
+    i64 result = Tundra_File_write_u64(file, ns / 1000);
+    if(result < 0) { return result; }
+
+    result = Tundra_File_write_char(file, '.');
+    if(result < 0) { return result; }
+
+    const u64 FRACTION = ns % 1000;
+
+    if(FRACTION < 100)
+    {
+        result = Tundra_File_write_char(file, '0');
+        if(result < 0) { return result; }
+    }
+
+    if(FRACTION < 10)
+    {
+        result = Tundra_File_write_char(file, '0');
+        if(result < 0) { return result; }
+    }
+
+    return Tundra_File_write_u64(file, FRACTION);
+}
+
+#endif // TUNDRA_TRACE
+
+
+// Public Methods --------------------------------------------------------------
+
+#ifdef TUNDRA_TRACE
+
+void InTundra_trace_emit(const char *name, u8 phase)
+{
+    TraceRing *ring = tl_ring;
+
+    if(ring == NULL) { ring = create_ring(); }
+
+    TraceEvent *event =
+        &ring->events[ring->head & (TUNDRA_TRACE_RING_EVENTS - 1)];
+
+    event->cycles = Tundra_get_cycles();
+    event->name = name;
+    event->phase = phase;
+
+    __atomic_store_n(&ring->head, ring->head + 1, __ATOMIC_RELEASE);
+}
+
+#endif // TUNDRA_TRACE
+
+i64 Tundra_trace_flush(const char *path)
+{
+    Tundra_File file;
+
+    i64 result = Tundra_File_open(&file, path,
+        TUNDRA_FILE_OPEN_MODE_WRITEONLY, TUNDRA_FILE_WRITE_BEHAVIOR_NONE,
+        true, true);
+    if(result < 0) { return result; }
+
+    result = Tundra_File_write_cstr(&file, "{\"traceEvents\":[");
+
+    #ifdef TUNDRA_TRACE
+
+    bool first_event = true;
+
+    for(TraceRing *ring = __atomic_load_n(&rings_head, __ATOMIC_ACQUIRE);
+        ring != NULL && result >= 0; ring = ring->next)
+    {
+        const u64 HEAD = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+        // A full ring holds only the newest window; start past what has
+        // been overwritten.
+        const u64 NUM_EVENTS = HEAD < TUNDRA_TRACE_RING_EVENTS ?
+            HEAD : TUNDRA_TRACE_RING_EVENTS;
+
+        for(u64 i = HEAD - NUM_EVENTS; i < HEAD && result >= 0; ++i)
+        {
+            const TraceEvent *EVENT =
+                &ring->events[i & (TUNDRA_TRACE_RING_EVENTS - 1)];
+
+            result = Tundra_File_write_cstr(&file,
+                first_event ? "\n{\"name\":\"" : ",\n{\"name\":\"");
+            first_event = false;
+
+            if(result >= 0)
+            { result = Tundra_File_write_cstr(&file, EVENT->name); }
+
+            if(result >= 0)
+            {
+                result = Tundra_File_write_cstr(&file, EVENT->phase == 0 ?
+                    "\",\"ph\":\"B\",\"pid\":0,\"tid\":" :
+                    "\",\"ph\":\"E\",\"pid\":0,\"tid\":");
+            }
+
+            if(result >= 0)
+            { result = Tundra_File_write_u64(&file, (u64)ring->tid); }
+
+            if(result >= 0)
+            { result = Tundra_File_write_cstr(&file, ",\"ts\":"); }
+
+            if(result >= 0)
+            {
+                result = write_timestamp_us(&file,
+                    Tundra_cycles_to_ns(EVENT->cycles));
+            }
+
+            if(result >= 0)
+            { result = Tundra_File_write_char(&file, '}'); }
+        }
+    }
+
+    #endif // TUNDRA_TRACE
+
+    if(result >= 0) { result = Tundra_File_write_cstr(&file, "\n]}\n"); }
+
+    if(result < 0) { Tundra_File_close(&file); return result; }
+
+    return Tundra_File_close(&file);
+}